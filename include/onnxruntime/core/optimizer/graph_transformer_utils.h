@@ -22,6 +22,9 @@
 
 namespace onnxruntime {
 class IExecutionProvider;
+namespace concurrency {
+class ThreadPool;
+}
 
 namespace optimizer_utils {
 
@@ -44,12 +47,14 @@ std::unique_ptr<RuleBasedGraphTransformer> GenerateRuleBasedGraphTransformer(
     const InlinedHashSet<std::string_view>& compatible_execution_providers);
 
 /** Generates all predefined (both rule-based and non-rule-based) transformers for this level.
-    Any transformers or rewrite rules named in rules_and_transformers_to_disable will be excluded. */
+    Any transformers or rewrite rules named in rules_and_transformers_to_disable will be excluded.
+    intra_op_thread_pool, if provided, is used by the kernels that constant folding runs. */
 InlinedVector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
     TransformerLevel level,
     const SessionOptions& session_options,
     const IExecutionProvider& execution_provider /*required by constant folding*/,
-    const InlinedHashSet<std::string>& rules_and_transformers_to_disable = {});
+    const InlinedHashSet<std::string>& rules_and_transformers_to_disable = {},
+    concurrency::ThreadPool* intra_op_thread_pool = nullptr);
 
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
@@ -13,6 +13,8 @@
 
 struct OrtThreadingOptions;
 namespace onnxruntime {
+class PrepackedWeightsContainer;
+
 /** TODO: remove this class
    Provides the runtime environment for onnxruntime.
    Create one instance for the duration of execution.
@@ -79,7 +81,8 @@ class Environment {
    */
   Status UnregisterAllocator(const OrtMemoryInfo& mem_info);
 
-  Environment() = default;
+  Environment();
+  ~Environment();
 
   /**
    * Create and register an allocator, specified by provider_type, for sharing between multiple sessions.
@@ -88,6 +91,16 @@ class Environment {
    */
   Status CreateAndRegisterAllocatorV2(const std::string& provider_type, const OrtMemoryInfo& mem_info, const std::unordered_map<std::string, std::string>& options, const OrtArenaCfg* arena_cfg = nullptr);
 
+  /**
+   * Returns the pre-packed weights container used by sessions in this env that share initializers across sessions
+   * (see kOrtSessionOptionsShareInitializersAcrossSessions) and weren't given a container of their own.
+   * Its GetMemoryStats() reports the memory shared by those sessions. Pre-packed weights are released together
+   * with the last session using them.
+   */
+  PrepackedWeightsContainer& GetSharedWeightsContainer() const {
+    return *shared_weights_container_;
+  }
+
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(Environment);
   Status Initialize(std::unique_ptr<logging::LoggingManager> logging_manager,
@@ -99,5 +112,6 @@ class Environment {
   std::unique_ptr<onnxruntime::concurrency::ThreadPool> inter_op_thread_pool_;
   bool create_global_thread_pools_{false};
   std::vector<AllocatorPtr> shared_allocators_;
+  std::unique_ptr<PrepackedWeightsContainer> shared_weights_container_;
 };
 }  // namespace onnxruntime
@@ -4658,6 +4658,59 @@ struct OrtApi {
                   _In_reads_(num_external_initializer_files) char* const* external_initializer_file_buffer_array,
                   _In_reads_(num_external_initializer_files) const size_t* external_initializer_file_lengths,
                   size_t num_external_initializer_files);
+
+  /// \name OrtSession
+  /// @{
+
+  /** \brief Register the parameters of a LoRA adapter with the session
+   *
+   * Each parameter is fed to the graph input with the same name in runs that select the adapter by setting the
+   * "lora.active_adapter" run config entry (see onnxruntime_run_options_config_keys.h) to `adapter_name`.
+   * Graph inputs not covered by the adapter keep their values, so many adapters can share a single session and a
+   * single copy of the base weights.
+   * The session keeps references to the parameter values. They must not be modified while the session uses them.
+   *
+   * \param[in] session
+   * \param[in] adapter_name Null terminated UTF-8 encoded name of the adapter. Must be unique within the session.
+   * \param[in] parameter_names Array of null terminated UTF-8 encoded graph input names.
+   * \param[in] parameter_values Array of tensors to feed to those graph inputs.
+   * \param[in] num_parameters Number of parameters.
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   *
+   * \since Version 1.19.
+   */
+  ORT_API2_STATUS(SessionAddLoraAdapter, _Inout_ OrtSession* session, _In_ const char* adapter_name,
+                  _In_reads_(num_parameters) const char* const* parameter_names,
+                  _In_reads_(num_parameters) const OrtValue* const* parameter_values,
+                  _In_ size_t num_parameters);
+
+  /// @}
+  /// \name OrtPrepackedWeightsContainer
+  /// @{
+
+  /** \brief Get the memory used by the initializers shared through an ::OrtPrepackedWeightsContainer
+   *
+   * Sessions created with the container and the "session.share_initializers_across_sessions" session config entry
+   * (see onnxruntime_session_options_config_keys.h) keep a single copy of the initializers that have the same
+   * contents, e.g. the common weights of several variants of one model.
+   *
+   * \param[in] prepacked_weights_container
+   * \param[out] num_initializers Number of distinct initializers held by sessions using the container.
+   * \param[out] initializers_size_in_bytes Bytes used by those initializers.
+   * \param[out] deduplicated_size_in_bytes Bytes of the initializers that sessions used from the container instead
+   *             of keeping a copy of their own, counted over all sessions created with the container.
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   *
+   * \since Version 1.19.
+   */
+  ORT_API2_STATUS(PrepackedWeightsContainer_GetMemoryStats,
+                  _Inout_ OrtPrepackedWeightsContainer* prepacked_weights_container,
+                  _Out_ size_t* num_initializers, _Out_ size_t* initializers_size_in_bytes,
+                  _Out_ size_t* deduplicated_size_in_bytes);
+
+  /// @}
 };
 
 /*
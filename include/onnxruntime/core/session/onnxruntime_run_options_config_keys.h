@@ -49,3 +49,9 @@ static const char* const kOrtRunOptionsConfigQnnRpcControlLatency = "qnn.rpc_con
 // If the value is set to -1, cuda graph capture/replay is disabled in that run.
 // User are not expected to set the value to 0 as it is reserved for internal use.
 static const char* const kOrtRunOptionsConfigCudaGraphAnnotation = "gpu_graph_id";
+
+// Name of the LoRA adapter to apply in this run. The adapter must have been registered with the session using
+// OrtApi::SessionAddLoraAdapter. Its parameters are fed to the graph inputs with the same names, overriding the
+// defaults of those inputs, so many adapters can share one copy (and one pre-packed form) of the base weights.
+// If the value is not set, or is empty, the model runs without an adapter.
+static const char* const kOrtRunOptionsConfigActiveLoraAdapter = "lora.active_adapter";
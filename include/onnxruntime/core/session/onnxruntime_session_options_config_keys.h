@@ -24,6 +24,17 @@ static const char* const kOrtSessionOptionsConfigDisablePrepacking = "session.di
 // will be used. Use this to override the usage of env allocators on a per session level.
 static const char* const kOrtSessionOptionsConfigUseEnvAllocators = "session.use_env_allocators";
 
+// A value of "1" deduplicates CPU initializers by content across all sessions that share a pre-packed weights
+// container. An initializer with the same type, shape and data as one already held by the container is not copied;
+// the session uses the container's tensor instead. The pre-packed forms of all CPU initializers are cached in the
+// container as well. This lets many variants of one model (e.g. fine-tunes that only differ in adapter weights)
+// cost roughly one copy of the common weights plus the weights that differ.
+// If the session was not created with a pre-packed weights container, the container owned by the environment is used.
+// Initializers with external data are not deduplicated as they are already used in place from the mmap'd file.
+// "0": disabled (default). "1": enabled.
+static const char* const kOrtSessionOptionsShareInitializersAcrossSessions =
+    "session.share_initializers_across_sessions";
+
 // Set to 'ORT' (case sensitive) to load an ORT format model.
 // If unset, model type will default to ONNX unless inferred from filename ('.ort' == ORT format) or bytes to be ORT
 static const char* const kOrtSessionOptionsConfigLoadModelFormat = "session.load_model_format";
@@ -77,6 +88,15 @@ static const char* const kOrtSessionOptionsEnableGeluApproximation = "optimizati
 // Its default value is "0".
 static const char* const kOrtSessionOptionsDisableAheadOfTimeFunctionInlining = "session.disable_aot_function_inlining";
 
+// Limits the size of the initializers that constant folding may create from a single node.
+// A node whose folded outputs are larger than this many bytes, and larger than the constant inputs they replace,
+// is left in the graph. This prevents cheap ops that expand their input (e.g. Expand, Tile, ConstantOfShape) from
+// inflating the model with large initializers that save little compute.
+// Folding that does not grow the initializer footprint is always allowed.
+// "0": no limit. Its default value is "0".
+static const char* const kOrtSessionOptionsConstantFoldingMaxOutputSizeInBytes =
+    "optimization.constant_folding_max_output_size_in_bytes";
+
 #ifdef ENABLE_TRAINING
 // Specifies a path of the file containing a list of memory optimization configurations.
 // The value should be a string indicating the file path of the config file.
@@ -270,3 +290,43 @@ static const char* const kOrtSessionOptionEpContextEmbedMode = "ep.context_embed
 // - "0": Gemm FastMath mode is not enabled. [DEFAULT]
 // - "1": Gemm FastMath mode is enabled.
 static const char* const kOrtSessionOptionsMlasGemmFastMathArm64Bfloat16 = "mlas.enable_gemm_fastmath_arm64_bfloat16";
+
+// Enables the block sparse SGEMM for constant float MatMul/Gemm weights on the CPU EP.
+// The block sparse SGEMM skips the all-zero blocks of the weight instead of multiplying them. An Inf or NaN in the
+// other input that only meets skipped zeros therefore does not produce NaN, unlike the dense SGEMM where
+// Inf * 0 = NaN.
+// Option values:
+// - "0": The block sparse SGEMM is disabled. [DEFAULT]
+// - "1": The block sparse SGEMM is enabled.
+static const char* const kOrtSessionOptionsMlasEnableSparseGemm = "mlas.enable_sparse_gemm";
+
+// Minimum block sparsity of a constant float MatMul/Gemm weight for the CPU EP to pre-pack it for the block sparse
+// SGEMM instead of the dense SGEMM. Only used when "mlas.enable_sparse_gemm" is "1". The block sparsity is the
+// fraction of the 1x16 blocks (one row of K, 16 columns of N) of the weight that are all zero. The default is where
+// the block sparse SGEMM caught up with the dense SGEMM for 16 and more rows of the other input in the
+// onnxruntime_mlas_benchmark SPARSE_SGEMM cases; with a single row it is faster from about half the blocks pruned.
+// Option values:
+// - A float in [0, 1]. Default is "0.85".
+// - A value above 1 disables the block sparse SGEMM.
+static const char* const kOrtSessionOptionsMlasSparseGemmBlockSparsityThreshold =
+    "mlas.sparse_gemm_block_sparsity_threshold";
+
+// Enables shape-specialized re-optimization of the session.
+// When set to a positive integer N, the session counts Run() calls per set of concrete input shapes. Once the same
+// input shapes have been seen N times, the session builds a specialized copy of the model with those input dims
+// fixed, so that shape dependent optimizations (e.g. constant folding of Shape subgraphs, ReshapeFusion) can use the
+// concrete values. The copy is built on a separate thread. Once it is ready, Run() calls with the same input shapes
+// are dispatched to it.
+// The copy is built from the model file, which must not change while the session is in use, or from a serialized
+// copy of the model if it was loaded from memory.
+// Each specialized copy holds its own initializers, so this trades memory for latency.
+// Only ONNX format models in sessions that use the CPU execution provider alone are specialized.
+// Option values:
+// - "0": Shape specialization is disabled. [DEFAULT]
+// - "N": Specialize after N runs with the same input shapes.
+static const char* const kOrtSessionOptionsConfigShapeSpecializationMinRuns = "session.shape_specialization_min_runs";
+
+// Maximum number of shape-specialized copies a session keeps when "session.shape_specialization_min_runs" is set.
+// The default value is "4".
+static const char* const kOrtSessionOptionsConfigShapeSpecializationMaxSessions =
+    "session.shape_specialization_max_sessions";
@@ -0,0 +1,353 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/common/inlined_containers.h"
+#include "core/common/narrow.h"
+#include "core/framework/op_kernel.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
+#include "core/util/math_cpuonly.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+namespace onnxruntime {
+namespace contrib {
+
+// Rows of a float16 or quantized table that are referenced more than once by the indices, and the slot of every
+// index in the float cache of those rows or -1.
+struct HotRowPlan {
+  std::vector<int64_t> hot_rows;
+  std::vector<int32_t> slots;
+};
+
+class EmbeddingBag final : public OpKernel {
+ public:
+  explicit EmbeddingBag(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  bool mean_;
+
+  // Set up in the constructor when both the table and the indices are constant initializers.
+  bool has_constant_plan_ = false;
+  std::vector<int64_t> constant_rows_;
+  HotRowPlan constant_plan_;
+};
+
+ONNX_OPERATOR_KERNEL_EX(
+    EmbeddingBag,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", BuildKernelDefConstraints<float, MLFloat16, int8_t, uint8_t>())
+        .TypeConstraint("Tind", BuildKernelDefConstraints<int32_t, int64_t>()),
+    EmbeddingBag);
+
+namespace {
+
+// Number of indices to look ahead when prefetching table rows. Embedding lookups are random accesses into a
+// table that is usually far larger than the caches, so the loads of the next rows are issued early.
+constexpr ptrdiff_t kPrefetchDistance = 4;
+
+// Upper bound of the float cache of dequantized rows that occur more than once in a Run.
+constexpr size_t kHotRowCacheBytes = 4 * 1024 * 1024;
+
+inline void PrefetchRow(const void* row, size_t row_bytes) {
+  constexpr size_t kCacheLineSize = 64;
+  // Only the head of long rows, the hardware prefetcher picks up the rest of the sequential stream.
+  row_bytes = std::min<size_t>(row_bytes, 4 * kCacheLineSize);
+  const char* p = static_cast<const char*>(row);
+  for (size_t offset = 0; offset < row_bytes; offset += kCacheLineSize) {
+#if defined(__GNUC__)
+    __builtin_prefetch(p + offset);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(p + offset, _MM_HINT_T0);
+#else
+    ORT_UNUSED_PARAMETER(p);
+#endif
+  }
+}
+
+template <typename Tind>
+Status NormalizeIndices(const Tensor& indices, int64_t num_rows, std::vector<int64_t>& rows) {
+  const auto indices_data = indices.DataAsSpan<Tind>();
+  rows.resize(indices_data.size());
+  for (size_t i = 0; i < indices_data.size(); ++i) {
+    int64_t index = static_cast<int64_t>(indices_data[i]);
+    if (index < -num_rows || index >= num_rows) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "indices element out of data bounds, idx=", index,
+                             " must be within the inclusive range [", -num_rows, ",", num_rows - 1, "]");
+    }
+    rows[i] = index < 0 ? index + num_rows : index;
+  }
+  return Status::OK();
+}
+
+// Dequantizes one table row to float.
+template <typename T>
+struct RowDequantizer;
+
+template <>
+struct RowDequantizer<MLFloat16> {
+  const MLFloat16* table;
+  size_t dim;
+
+  void operator()(int64_t row, float* output) const {
+    MlasConvertHalfToFloatBuffer(&table[narrow<size_t>(row) * dim].val, output, dim);
+  }
+};
+
+template <typename T>
+struct RowDequantizer {
+  const T* table;
+  size_t dim;
+  const float* scales;
+  const T* zero_points;
+
+  void operator()(int64_t row, float* output) const {
+    const T* q = table + narrow<size_t>(row) * dim;
+    const float scale = scales[row];
+    const int32_t zero_point = zero_points == nullptr ? 0 : static_cast<int32_t>(zero_points[row]);
+    for (size_t d = 0; d < dim; ++d) {
+      output[d] = static_cast<float>(static_cast<int32_t>(q[d]) - zero_point) * scale;
+    }
+  }
+};
+
+void PoolFloatTable(const float* table, const std::vector<int64_t>& rows, size_t bag_size, size_t dim,
+                    bool mean, float* output, concurrency::ThreadPool* tp) {
+  const ptrdiff_t num_bags = static_cast<ptrdiff_t>(rows.size() / bag_size);
+  const double bag_bytes = static_cast<double>(bag_size * dim * sizeof(float));
+  concurrency::ThreadPool::TryParallelFor(
+      tp, num_bags,
+      TensorOpCost{bag_bytes, static_cast<double>(dim * sizeof(float)), static_cast<double>(bag_size * dim)},
+      [&](ptrdiff_t first, ptrdiff_t last) {
+        const ptrdiff_t total = static_cast<ptrdiff_t>(rows.size());
+        for (ptrdiff_t bag = first; bag < last; ++bag) {
+          EigenVectorArrayMap<float> sum(output + bag * dim, dim);
+          sum.setZero();
+          const ptrdiff_t begin = bag * static_cast<ptrdiff_t>(bag_size);
+          for (ptrdiff_t i = begin; i < begin + static_cast<ptrdiff_t>(bag_size); ++i) {
+            if (i + kPrefetchDistance < total) {
+              PrefetchRow(table + rows[i + kPrefetchDistance] * dim, dim * sizeof(float));
+            }
+            sum += ConstEigenVectorArrayMap<float>(table + rows[i] * dim, dim);
+          }
+          if (mean) {
+            sum /= static_cast<float>(bag_size);
+          }
+        }
+      });
+}
+
+// Counts how often every row is referenced and assigns cache slots to the rows referenced more than once, the
+// hottest first until the cache budget is spent.
+HotRowPlan PlanHotRows(const std::vector<int64_t>& rows, size_t dim) {
+  HotRowPlan plan;
+  InlinedHashMap<int64_t, int32_t> counts;
+  counts.reserve(rows.size());
+  for (int64_t row : rows) {
+    ++counts[row];
+  }
+
+  std::vector<std::pair<int32_t, int64_t>> hot_rows;
+  for (const auto& entry : counts) {
+    if (entry.second > 1) {
+      hot_rows.emplace_back(entry.second, entry.first);
+    }
+  }
+  const size_t max_cached_rows = std::max<size_t>(kHotRowCacheBytes / (dim * sizeof(float)), 1);
+  if (hot_rows.size() > max_cached_rows) {
+    std::nth_element(hot_rows.begin(), hot_rows.begin() + max_cached_rows, hot_rows.end(),
+                     [](const auto& a, const auto& b) { return a.first > b.first; });
+    hot_rows.resize(max_cached_rows);
+  }
+
+  plan.slots.assign(rows.size(), -1);
+  if (hot_rows.empty()) {
+    return plan;
+  }
+
+  // reuse the count map as the map from row to slot so the pooling loop does not need any lookups
+  for (auto& entry : counts) {
+    entry.second = -1;
+  }
+  plan.hot_rows.reserve(hot_rows.size());
+  for (size_t slot = 0; slot < hot_rows.size(); ++slot) {
+    counts[hot_rows[slot].second] = static_cast<int32_t>(slot);
+    plan.hot_rows.push_back(hot_rows[slot].second);
+  }
+  for (size_t i = 0; i < rows.size(); ++i) {
+    plan.slots[i] = counts[rows[i]];
+  }
+  return plan;
+}
+
+// Pools the rows of a float16 or row-quantized table. The hot rows of the plan are dequantized once into a float
+// cache and all other rows are dequantized on the fly while they are accumulated.
+template <typename T>
+void PoolQuantizedTable(const RowDequantizer<T>& dequantize, const std::vector<int64_t>& rows,
+                        const HotRowPlan& plan, size_t bag_size, size_t dim, bool mean, float* output,
+                        concurrency::ThreadPool* tp) {
+  const std::vector<int64_t>& hot_rows = plan.hot_rows;
+  const std::vector<int32_t>& slots = plan.slots;
+
+  std::vector<float> cache(hot_rows.size() * dim);
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<ptrdiff_t>(hot_rows.size()),
+      TensorOpCost{static_cast<double>(dim * sizeof(T)), static_cast<double>(dim * sizeof(float)),
+                   static_cast<double>(dim)},
+      [&](ptrdiff_t first, ptrdiff_t last) {
+        for (ptrdiff_t slot = first; slot < last; ++slot) {
+          dequantize(hot_rows[slot], cache.data() + slot * dim);
+        }
+      });
+
+  const ptrdiff_t num_bags = static_cast<ptrdiff_t>(rows.size() / bag_size);
+  const double bag_bytes = static_cast<double>(bag_size * dim * sizeof(T));
+  concurrency::ThreadPool::TryParallelFor(
+      tp, num_bags,
+      TensorOpCost{bag_bytes, static_cast<double>(dim * sizeof(float)), static_cast<double>(2 * bag_size * dim)},
+      [&](ptrdiff_t first, ptrdiff_t last) {
+        const ptrdiff_t total = static_cast<ptrdiff_t>(rows.size());
+        std::vector<float> row_buffer(dim);
+        ConstEigenVectorArrayMap<float> row(row_buffer.data(), dim);
+        for (ptrdiff_t bag = first; bag < last; ++bag) {
+          EigenVectorArrayMap<float> sum(output + bag * dim, dim);
+          sum.setZero();
+          const ptrdiff_t begin = bag * static_cast<ptrdiff_t>(bag_size);
+          for (ptrdiff_t i = begin; i < begin + static_cast<ptrdiff_t>(bag_size); ++i) {
+            if (i + kPrefetchDistance < total && slots[i + kPrefetchDistance] < 0) {
+              PrefetchRow(dequantize.table + rows[i + kPrefetchDistance] * dim, dim * sizeof(T));
+            }
+            if (slots[i] >= 0) {
+              sum += ConstEigenVectorArrayMap<float>(cache.data() + slots[i] * dim, dim);
+            } else {
+              dequantize(rows[i], row_buffer.data());
+              sum += row;
+            }
+          }
+          if (mean) {
+            sum /= static_cast<float>(bag_size);
+          }
+        }
+      });
+}
+
+}  // namespace
+
+EmbeddingBag::EmbeddingBag(const OpKernelInfo& info) : OpKernel(info) {
+  std::string mode = info.GetAttrOrDefault<std::string>("mode", "sum");
+  ORT_ENFORCE(mode == "sum" || mode == "mean", "EmbeddingBag mode must be 'sum' or 'mean'. Got: ", mode);
+  mean_ = mode == "mean";
+
+  // With a constant table and constant indices the hot rows are the same in every Run, so they are planned once
+  // here. Invalid inputs are left to Compute to report.
+  const Tensor* table = nullptr;
+  const Tensor* indices = nullptr;
+  if (info.TryGetConstantInput(0, &table) && info.TryGetConstantInput(1, &indices) &&
+      !table->IsDataType<float>() && table->Shape().NumDimensions() == 2 &&
+      indices->Shape().NumDimensions() == 2 && indices->Shape().Size() > 0 && table->Shape()[1] > 0) {
+    const int64_t num_rows = table->Shape()[0];
+    Status status = indices->IsDataType<int32_t>() ? NormalizeIndices<int32_t>(*indices, num_rows, constant_rows_)
+                                                   : NormalizeIndices<int64_t>(*indices, num_rows, constant_rows_);
+    if (status.IsOK()) {
+      constant_plan_ = PlanHotRows(constant_rows_, narrow<size_t>(table->Shape()[1]));
+      has_constant_plan_ = true;
+    } else {
+      constant_rows_.clear();
+    }
+  }
+}
+
+Status EmbeddingBag::Compute(OpKernelContext* context) const {
+  const Tensor* table = context->Input<Tensor>(0);
+  const Tensor* indices = context->Input<Tensor>(1);
+  const Tensor* scales = context->Input<Tensor>(2);
+  const Tensor* zero_points = context->Input<Tensor>(3);
+
+  const auto& table_shape = table->Shape();
+  const auto& indices_shape = indices->Shape();
+  if (table_shape.NumDimensions() != 2) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "table must be 2D. Got: ", table_shape);
+  }
+  if (indices_shape.NumDimensions() != 2) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "indices must be 2D. Got: ", indices_shape);
+  }
+
+  const int64_t num_rows = table_shape[0];
+  const size_t dim = narrow<size_t>(table_shape[1]);
+  const size_t bag_size = narrow<size_t>(indices_shape[1]);
+
+  const bool is_quantized = table->IsDataType<int8_t>() || table->IsDataType<uint8_t>();
+  if (is_quantized) {
+    if (scales == nullptr || scales->Shape().Size() != num_rows) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "scales with one element per table row are required for a quantized table");
+    }
+    if (zero_points != nullptr && zero_points->Shape().Size() != num_rows) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "zero_points must have one element per table row. Got: ", zero_points->Shape());
+    }
+  } else if (scales != nullptr || zero_points != nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "scales and zero_points are only supported for int8 and uint8 tables");
+  }
+
+  Tensor* output = context->Output(0, {indices_shape[0], table_shape[1]});
+  if (output->Shape().Size() == 0) {
+    return Status::OK();
+  }
+  float* output_data = output->MutableData<float>();
+  if (bag_size == 0) {
+    // an empty bag sums to zero and, like ReduceMean over an empty axis, averages to NaN
+    std::fill_n(output_data, output->Shape().Size(),
+                mean_ ? std::numeric_limits<float>::quiet_NaN() : 0.0f);
+    return Status::OK();
+  }
+
+  std::vector<int64_t> run_rows;
+  HotRowPlan run_plan;
+  const std::vector<int64_t>* rows = &constant_rows_;
+  const HotRowPlan* plan = &constant_plan_;
+  if (!has_constant_plan_) {
+    ORT_RETURN_IF_ERROR(indices->IsDataType<int32_t>() ? NormalizeIndices<int32_t>(*indices, num_rows, run_rows)
+                                                       : NormalizeIndices<int64_t>(*indices, num_rows, run_rows));
+    rows = &run_rows;
+    if (!table->IsDataType<float>()) {
+      run_plan = PlanHotRows(run_rows, dim);
+      plan = &run_plan;
+    }
+  }
+
+  concurrency::ThreadPool* tp = context->GetOperatorThreadPool();
+  if (table->IsDataType<float>()) {
+    PoolFloatTable(table->Data<float>(), *rows, bag_size, dim, mean_, output_data, tp);
+  } else if (table->IsDataType<MLFloat16>()) {
+    PoolQuantizedTable(RowDequantizer<MLFloat16>{table->Data<MLFloat16>(), dim}, *rows, *plan, bag_size, dim,
+                       mean_, output_data, tp);
+  } else if (table->IsDataType<int8_t>()) {
+    PoolQuantizedTable(RowDequantizer<int8_t>{table->Data<int8_t>(), dim, scales->Data<float>(),
+                                              zero_points ? zero_points->Data<int8_t>() : nullptr},
+                       *rows, *plan, bag_size, dim, mean_, output_data, tp);
+  } else {
+    PoolQuantizedTable(RowDequantizer<uint8_t>{table->Data<uint8_t>(), dim, scales->Data<float>(),
+                                               zero_points ? zero_points->Data<uint8_t>() : nullptr},
+                       *rows, *plan, bag_size, dim, mean_, output_data, tp);
+  }
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
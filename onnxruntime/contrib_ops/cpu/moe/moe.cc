@@ -0,0 +1,341 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cpu/moe/moe.h"
+#include "contrib_ops/cpu/moe/moe_helper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "core/common/inlined_containers.h"
+#include "core/common/safeint.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
+
+using onnxruntime::concurrency::ThreadPool;
+
+namespace onnxruntime {
+namespace contrib {
+
+ONNX_OPERATOR_TYPED_KERNEL_EX(
+    MoE,
+    kMSDomain,
+    1,
+    float,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    MoE);
+
+MoE::MoE(const OpKernelInfo& info) : OpKernel(info) {
+  k_ = info.GetAttrOrDefault<int64_t>("k", 1);
+  normalize_routing_weights_ = info.GetAttrOrDefault<int64_t>("normalize_routing_weights", 0) == 1;
+
+  const std::string activation_type = info.GetAttrOrDefault<std::string>("activation_type", "relu");
+  if (activation_type == "relu") {
+    activation_type_ = MoEActivationType::Relu;
+  } else if (activation_type == "gelu") {
+    activation_type_ = MoEActivationType::Gelu;
+  } else if (activation_type == "silu") {
+    activation_type_ = MoEActivationType::Silu;
+  } else if (activation_type == "identity") {
+    activation_type_ = MoEActivationType::Identity;
+  } else {
+    ORT_THROW("Unsupported MoE activation type: ", activation_type);
+  }
+}
+
+void MoE::ApplyActivation(float* data, size_t count) const {
+  // gelu uses the tanh approximation like the CUDA kernel: 0.5 * (1 + Tanh(x * (C * x * x + B))) * x.
+  static constexpr float B = 0.7978845608028654f;    // sqrt(2.0 / M_PI)
+  static constexpr float C = 0.035677408136300125f;  // 0.044715 * sqrt(2.0 / M_PI)
+  static constexpr size_t kChunkSize = 256;
+
+  switch (activation_type_) {
+    case MoEActivationType::Relu:
+      for (size_t i = 0; i < count; i++) {
+        data[i] = std::max(data[i], 0.0f);
+      }
+      break;
+
+    case MoEActivationType::Gelu:
+    case MoEActivationType::Silu:
+      for (size_t start = 0; start < count; start += kChunkSize) {
+        const size_t chunk = std::min(kChunkSize, count - start);
+        float* x = data + start;
+        float temp[kChunkSize];
+
+        if (activation_type_ == MoEActivationType::Gelu) {
+          for (size_t i = 0; i < chunk; i++) {
+            temp[i] = x[i] * (C * x[i] * x[i] + B);
+          }
+          MlasComputeTanh(temp, temp, chunk);
+          for (size_t i = 0; i < chunk; i++) {
+            x[i] = 0.5f * x[i] * (temp[i] + 1.0f);
+          }
+        } else {
+          MlasComputeLogistic(x, temp, chunk);
+          for (size_t i = 0; i < chunk; i++) {
+            x[i] *= temp[i];
+          }
+        }
+      }
+      break;
+
+    case MoEActivationType::Identity:
+      break;
+  }
+}
+
+Status MoE::Compute(OpKernelContext* context) const {
+  const Tensor* input = context->Input<Tensor>(0);
+  const Tensor* router_probs = context->Input<Tensor>(1);
+  const Tensor* fc1_experts_weights = context->Input<Tensor>(2);
+  const Tensor* fc1_experts_bias_optional = context->Input<Tensor>(3);
+  const Tensor* fc2_experts_weights = context->Input<Tensor>(4);
+  const Tensor* fc2_experts_bias_optional = context->Input<Tensor>(5);
+  const Tensor* fc3_experts_weights_optional = context->Input<Tensor>(6);
+  const Tensor* fc3_experts_bias_optional = context->Input<Tensor>(7);
+
+  moe_helper::MoEParameters parameters;
+  ORT_RETURN_IF_ERROR(moe_helper::CheckInputs(parameters, k_, input, router_probs, fc1_experts_weights,
+                                              fc1_experts_bias_optional, fc2_experts_weights,
+                                              fc2_experts_bias_optional, fc3_experts_weights_optional,
+                                              fc3_experts_bias_optional));
+
+  Tensor* output = context->Output(0, input->Shape());
+
+  const size_t num_rows = narrow<size_t>(parameters.num_rows);
+  const size_t num_experts = narrow<size_t>(parameters.num_experts);
+  const size_t hidden_size = narrow<size_t>(parameters.hidden_size);
+  const size_t inter_size = narrow<size_t>(parameters.inter_size);
+  const size_t k = narrow<size_t>(k_);
+  const size_t num_routes = num_rows * k;
+
+  if (num_rows == 0) {
+    return Status::OK();
+  }
+
+  ThreadPool* tp = context->GetOperatorThreadPool();
+
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+
+  //
+  // Route every row to the k experts with the highest probability after a softmax over all the experts.
+  // Ties go to the expert with the lower index. A NaN logit ranks below every other expert, so the k experts
+  // of a row are always distinct. When the largest logit is infinite, the softmax is taken in the limit: the
+  // experts with that logit share the probability equally and every other expert gets 0.
+  //
+
+  const float* router_probs_data = router_probs->Data<float>();
+  InlinedVector<int32_t> route_experts(num_routes);
+  InlinedVector<float> route_scales(num_routes);
+
+  ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_rows),
+      TensorOpCost{static_cast<double>(num_experts * sizeof(float)), static_cast<double>(k * 8),
+                   static_cast<double>(num_experts * (k + 4))},
+      [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+        InlinedVector<float> probs(num_experts);
+        for (size_t row = static_cast<size_t>(begin); row < static_cast<size_t>(end); row++) {
+          const float* logits = router_probs_data + row * num_experts;
+          float max_logit = -std::numeric_limits<float>::infinity();
+          for (size_t e = 0; e < num_experts; e++) {
+            if (logits[e] > max_logit) {
+              max_logit = logits[e];
+            }
+          }
+          float sum = 0.0f;
+          if (std::isinf(max_logit)) {
+            // exp(inf - inf) is NaN, so give every expert at the maximum the same weight instead
+            for (size_t e = 0; e < num_experts; e++) {
+              probs[e] = logits[e] == max_logit ? 1.0f : 0.0f;
+              sum += probs[e];
+            }
+          } else {
+            for (size_t e = 0; e < num_experts; e++) {
+              const float prob = std::exp(logits[e] - max_logit);
+              probs[e] = std::isnan(prob) ? 0.0f : prob;
+              sum += probs[e];
+            }
+          }
+
+          int32_t* experts = route_experts.data() + row * k;
+          float* scales = route_scales.data() + row * k;
+          float selected_sum = 0.0f;
+          for (size_t j = 0; j < k; j++) {
+            size_t best = 0;
+            for (size_t e = 1; e < num_experts; e++) {
+              if (probs[e] > probs[best]) {
+                best = e;
+              }
+            }
+            experts[j] = static_cast<int32_t>(best);
+            scales[j] = probs[best] / sum;
+            selected_sum += scales[j];
+            probs[best] = -1.0f;
+          }
+
+          if (normalize_routing_weights_) {
+            for (size_t j = 0; j < k; j++) {
+              scales[j] /= selected_sum;
+            }
+          }
+        }
+      });
+
+  //
+  // Bucket the routes by expert, keeping the row order within every expert, and gather the input rows of
+  // every expert into one contiguous block.
+  //
+
+  InlinedVector<size_t> expert_rows(num_experts, 0);
+  for (size_t i = 0; i < num_routes; i++) {
+    expert_rows[route_experts[i]]++;
+  }
+
+  InlinedVector<size_t> expert_offsets(num_experts + 1, 0);
+  for (size_t e = 0; e < num_experts; e++) {
+    expert_offsets[e + 1] = expert_offsets[e] + expert_rows[e];
+  }
+
+  InlinedVector<size_t> route_positions(num_routes);
+  InlinedVector<size_t> permuted_rows(num_routes);
+  InlinedVector<int32_t> permuted_experts(num_routes);
+  {
+    InlinedVector<size_t> next_position(expert_offsets.begin(), expert_offsets.end() - 1);
+    for (size_t i = 0; i < num_routes; i++) {
+      const size_t position = next_position[route_experts[i]]++;
+      route_positions[i] = position;
+      permuted_rows[position] = i / k;
+      permuted_experts[position] = route_experts[i];
+    }
+  }
+
+  const float* input_data = input->Data<float>();
+  auto permuted_input = IAllocator::MakeUniquePtr<float>(alloc, SafeInt<size_t>(num_routes) * hidden_size);
+
+  ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_routes),
+      TensorOpCost{static_cast<double>(hidden_size * sizeof(float)), static_cast<double>(hidden_size * sizeof(float)),
+                   0.0},
+      [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+        for (size_t position = static_cast<size_t>(begin); position < static_cast<size_t>(end); position++) {
+          std::copy_n(input_data + permuted_rows[position] * hidden_size, hidden_size,
+                      permuted_input.get() + position * hidden_size);
+        }
+      });
+
+  //
+  // Run every expert as one GEMM over its block of rows. The grouped GEMM threads over the rows of all the
+  // experts together, so the experts run in parallel and experts without rows cost nothing.
+  //
+
+  const bool has_fc3 = fc3_experts_weights_optional != nullptr;
+
+  auto fc1_output = IAllocator::MakeUniquePtr<float>(alloc, SafeInt<size_t>(num_routes) * inter_size);
+  IAllocatorUniquePtr<float> fc3_output;
+  if (has_fc3) {
+    fc3_output = IAllocator::MakeUniquePtr<float>(alloc, SafeInt<size_t>(num_routes) * inter_size);
+  }
+  auto fc2_output = IAllocator::MakeUniquePtr<float>(alloc, SafeInt<size_t>(num_routes) * hidden_size);
+
+  InlinedVector<MLAS_SGEMM_DATA_PARAMS> gemm_params(num_experts);
+
+  // The weights of every expert are consumed column major like the CUDA kernel does, so a (k_dim, n) weight is
+  // stored as n rows of k_dim elements.
+  auto run_experts = [&](const float* a, size_t lda, const float* weights, float* c, size_t n, size_t k_dim) {
+    for (size_t e = 0; e < num_experts; e++) {
+      gemm_params[e].A = a + expert_offsets[e] * lda;
+      gemm_params[e].lda = lda;
+      gemm_params[e].B = weights + e * k_dim * n;
+      gemm_params[e].ldb = k_dim;
+      gemm_params[e].C = c + expert_offsets[e] * n;
+      gemm_params[e].ldc = n;
+    }
+    MlasGemmGroupedBatch(CblasNoTrans, CblasTrans, expert_rows.data(), n, k_dim, gemm_params.data(),
+                         num_experts, tp);
+  };
+
+  run_experts(permuted_input.get(), hidden_size, fc1_experts_weights->Data<float>(), fc1_output.get(),
+              inter_size, hidden_size);
+  if (has_fc3) {
+    run_experts(permuted_input.get(), hidden_size, fc3_experts_weights_optional->Data<float>(), fc3_output.get(),
+                inter_size, hidden_size);
+  }
+
+  const float* fc1_bias = fc1_experts_bias_optional != nullptr ? fc1_experts_bias_optional->Data<float>() : nullptr;
+  const float* fc3_bias = fc3_experts_bias_optional != nullptr ? fc3_experts_bias_optional->Data<float>() : nullptr;
+
+  ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_routes),
+      TensorOpCost{static_cast<double>(inter_size * sizeof(float) * (has_fc3 ? 2 : 1)),
+                   static_cast<double>(inter_size * sizeof(float)), static_cast<double>(inter_size * 8)},
+      [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+        for (size_t position = static_cast<size_t>(begin); position < static_cast<size_t>(end); position++) {
+          const size_t expert = static_cast<size_t>(permuted_experts[position]);
+          float* fc1_row = fc1_output.get() + position * inter_size;
+          if (fc1_bias != nullptr) {
+            const float* bias = fc1_bias + expert * inter_size;
+            for (size_t i = 0; i < inter_size; i++) {
+              fc1_row[i] += bias[i];
+            }
+          }
+
+          ApplyActivation(fc1_row, inter_size);
+
+          if (has_fc3) {
+            const float* fc3_row = fc3_output.get() + position * inter_size;
+            const float* bias = fc3_bias != nullptr ? fc3_bias + expert * inter_size : nullptr;
+            for (size_t i = 0; i < inter_size; i++) {
+              fc1_row[i] *= bias != nullptr ? fc3_row[i] + bias[i] : fc3_row[i];
+            }
+          }
+        }
+      });
+
+  run_experts(fc1_output.get(), inter_size, fc2_experts_weights->Data<float>(), fc2_output.get(),
+              hidden_size, inter_size);
+
+  //
+  // Combine the expert outputs of every row in a single gather-scale-add pass. The fc2 bias is added here
+  // so that it is scaled by the routing weight as well.
+  //
+
+  const float* fc2_bias = fc2_experts_bias_optional != nullptr ? fc2_experts_bias_optional->Data<float>() : nullptr;
+  float* output_data = output->MutableData<float>();
+
+  ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_rows),
+      TensorOpCost{static_cast<double>(k * hidden_size * sizeof(float) * 2),
+                   static_cast<double>(hidden_size * sizeof(float)), static_cast<double>(k * hidden_size * 2)},
+      [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+        for (size_t row = static_cast<size_t>(begin); row < static_cast<size_t>(end); row++) {
+          float* output_row = output_data + row * hidden_size;
+          std::fill_n(output_row, hidden_size, 0.0f);
+
+          for (size_t j = 0; j < k; j++) {
+            const size_t route = row * k + j;
+            const float scale = route_scales[route];
+            const float* expert_row = fc2_output.get() + route_positions[route] * hidden_size;
+            if (fc2_bias != nullptr) {
+              const float* bias = fc2_bias + static_cast<size_t>(route_experts[route]) * hidden_size;
+              for (size_t i = 0; i < hidden_size; i++) {
+                output_row[i] += scale * (expert_row[i] + bias[i]);
+              }
+            } else {
+              for (size_t i = 0; i < hidden_size; i++) {
+                output_row[i] += scale * expert_row[i];
+              }
+            }
+          }
+        }
+      });
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,36 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+#include "core/framework/op_kernel.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+enum class MoEActivationType {
+  Relu,
+  Gelu,
+  Silu,
+  Identity,
+};
+
+// Mixture of experts layer. Every token is routed to the k experts with the highest router probability, the
+// tokens of each expert are gathered into one contiguous block so that every expert runs as a single GEMM,
+// and the expert outputs are scaled by the routing weights and summed back into token order.
+class MoE final : public OpKernel {
+ public:
+  explicit MoE(const OpKernelInfo& info);
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  void ApplyActivation(float* data, size_t count) const;
+
+  int64_t k_;
+  bool normalize_routing_weights_;
+  MoEActivationType activation_type_;
+};
+
+}  // namespace contrib
+}  // namespace onnxruntime
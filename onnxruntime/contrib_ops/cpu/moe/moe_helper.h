@@ -0,0 +1,122 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+#include "core/framework/tensor.h"
+
+namespace onnxruntime {
+namespace contrib {
+namespace moe_helper {
+
+struct MoEParameters {
+  int64_t num_rows;
+  int64_t num_experts;
+  int64_t hidden_size;
+  int64_t inter_size;
+};
+
+inline Status CheckBias(const Tensor* bias, const char* name, int64_t num_experts, int64_t size) {
+  if (bias == nullptr) {
+    return Status::OK();
+  }
+
+  const auto& bias_dims = bias->Shape().GetDims();
+  if (bias_dims.size() != 2 || bias_dims[0] != num_experts || bias_dims[1] != size) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, name, " must have shape (", num_experts, ", ", size,
+                           "), got ", bias->Shape());
+  }
+
+  return Status::OK();
+}
+
+inline Status CheckInputs(MoEParameters& parameters, int64_t k, const Tensor* input, const Tensor* router_probs,
+                          const Tensor* fc1_experts_weights, const Tensor* fc1_experts_bias_optional,
+                          const Tensor* fc2_experts_weights, const Tensor* fc2_experts_bias_optional,
+                          const Tensor* fc3_experts_weights_optional, const Tensor* fc3_experts_bias_optional) {
+  const auto& input_dims = input->Shape().GetDims();
+  const auto& router_probs_dims = router_probs->Shape().GetDims();
+  const auto& fc1_experts_weights_dims = fc1_experts_weights->Shape().GetDims();
+  const auto& fc2_experts_weights_dims = fc2_experts_weights->Shape().GetDims();
+
+  if (input_dims.size() != 2 && input_dims.size() != 3) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "input must be 2D or 3D, got ", input_dims.size());
+  }
+  if (router_probs_dims.size() != 2) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "router_probs_dims must be 2D, got ",
+                           router_probs_dims.size());
+  }
+  if (fc1_experts_weights_dims.size() != 3) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "fc1_experts_weights_dims must be 3D, got ",
+                           fc1_experts_weights_dims.size());
+  }
+  if (fc2_experts_weights_dims.size() != 3) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "fc2_experts_weights_dims must be 3D, got ",
+                           fc2_experts_weights_dims.size());
+  }
+
+  const int64_t num_rows = input_dims.size() == 2 ? input_dims[0] : input_dims[0] * input_dims[1];
+  const int64_t hidden_size = input_dims[input_dims.size() - 1];
+  const int64_t num_experts = router_probs_dims[1];
+  const int64_t inter_size = fc2_experts_weights_dims[1];
+
+  if (router_probs_dims[0] != num_rows) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "router_probs_dims[0] must be equal to num_rows, got ",
+                           router_probs_dims[0], " and ", num_rows);
+  }
+
+  // The experts are not sharded across devices on CPU, so every expert the router can select must be present.
+  if (fc1_experts_weights_dims[0] != num_experts || fc2_experts_weights_dims[0] != num_experts) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "fc1_experts_weights_dims[0] and fc2_experts_weights_dims[0] must be equal to num_experts, "
+                           "got ", fc1_experts_weights_dims[0], ", ", fc2_experts_weights_dims[0], " and ",
+                           num_experts);
+  }
+  if (fc1_experts_weights_dims[1] != hidden_size) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "fc1_experts_weights_dims[1] must be equal to hidden_size, got ",
+                           fc1_experts_weights_dims[1], " and ", hidden_size);
+  }
+  if (fc1_experts_weights_dims[2] != inter_size) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "fc1_experts_weights_dims[2] must be equal to inter_size, got ",
+                           fc1_experts_weights_dims[2], " and ", inter_size);
+  }
+  if (fc2_experts_weights_dims[2] != hidden_size) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "fc2_experts_weights_dims[2] must be equal to hidden_size, got ",
+                           fc2_experts_weights_dims[2], " and ", hidden_size);
+  }
+
+  if (fc3_experts_weights_optional != nullptr &&
+      fc3_experts_weights_optional->Shape().GetDims() != fc1_experts_weights_dims) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "fc3_experts_weights_dims must be equal to fc1_experts_weights_dims, got ",
+                           fc3_experts_weights_optional->Shape(), " and ", fc1_experts_weights->Shape());
+  }
+  if (fc3_experts_bias_optional != nullptr && fc3_experts_weights_optional == nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "fc3_experts_bias requires fc3_experts_weights to be provided");
+  }
+
+  ORT_RETURN_IF_ERROR(CheckBias(fc1_experts_bias_optional, "fc1_experts_bias", num_experts, inter_size));
+  ORT_RETURN_IF_ERROR(CheckBias(fc2_experts_bias_optional, "fc2_experts_bias", num_experts, hidden_size));
+  ORT_RETURN_IF_ERROR(CheckBias(fc3_experts_bias_optional, "fc3_experts_bias", num_experts, inter_size));
+
+  if (k <= 0 || k > num_experts) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "k must be in the range [1, num_experts], got ", k,
+                           " and ", num_experts);
+  }
+
+  parameters.num_rows = num_rows;
+  parameters.num_experts = num_experts;
+  parameters.hidden_size = hidden_size;
+  parameters.inter_size = inter_size;
+
+  return Status::OK();
+}
+
+}  // namespace moe_helper
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,372 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include <cstdint>
+
+#include "core/common/common.h"
+#include "core/common/narrow.h"
+#include "core/common/safeint.h"
+#include "core/framework/op_kernel.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/mlas/inc/mlas_q4.h"
+#include "core/mlas/inc/mlas_qnbit.h"
+#include "core/providers/cpu/nn/conv_attributes.h"
+#include "core/util/math.h"
+#include "core/util/math_cpuonly.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+namespace {
+
+// ConvNBits op input indices.
+// These should match the inputs names specified in the op schema.
+namespace InputIndex {
+constexpr size_t X = 0,
+                 B = 1,
+                 scales = 2,
+                 zero_points = 3,
+                 bias = 4;
+};
+
+// Find a supported compute type that is not less accurate than the one given, same as MatMulNBits.
+// CompMostAccurate is always supported with the fallback implementation.
+MLAS_SQNBIT_GEMM_COMPUTE_TYPE GetComputeType(size_t nbits, size_t block_size, int64_t accuracy_level_attr) {
+  int64_t accuracy_level = std::clamp(accuracy_level_attr,
+                                      static_cast<int64_t>(CompMostAccurate),
+                                      static_cast<int64_t>(CompLeastAccurate));
+  for (; accuracy_level > CompMostAccurate; --accuracy_level) {
+    if (MlasIsSQNBitGemmAvailable(nbits, block_size, static_cast<MLAS_SQNBIT_GEMM_COMPUTE_TYPE>(accuracy_level))) {
+      break;
+    }
+  }
+
+  return static_cast<MLAS_SQNBIT_GEMM_COMPUTE_TYPE>(accuracy_level);
+}
+
+}  // namespace
+
+using ConvPadVector = ConvAttributes::ConvPadVector;
+
+// Conv with a blockwise quantized weight laid out like the MatMulNBits B input: one quantized column of
+// K = C / group * kernel_size values per output channel.
+//
+// With a packed weight, each image and group is computed as Y^T = col^T * W^T by MlasSQNBitGemmBatch, so the
+// weight is read in its quantized form. The im2col output is transposed to [output_image_size, K] for the GEMM and
+// the GEMM output, with all groups side by side, is transposed back into the NCHW output. Otherwise the weight is
+// dequantized and the convolution is computed with a float GEMM like Conv.
+class ConvNBits final : public OpKernel {
+ public:
+  ConvNBits(const OpKernelInfo& info)
+      : OpKernel(info),
+        conv_attrs_{info},
+        K_{narrow<size_t>(info.GetAttr<int64_t>("K"))},
+        N_{narrow<size_t>(info.GetAttr<int64_t>("N"))},
+        block_size_{narrow<size_t>(info.GetAttr<int64_t>("block_size"))},
+        nbits_{narrow<size_t>(info.GetAttr<int64_t>("bits"))},
+        compute_type_{GetComputeType(nbits_, block_size_, info.GetAttrOrDefault<int64_t>("accuracy_level", 0))} {
+    ORT_ENFORCE(nbits_ == 4, "Only 4b quantization is supported for ConvNBits op.");
+
+    TensorShapeVector kernel_shape;
+    ORT_ENFORCE(info.GetAttrs("kernel_shape", kernel_shape).IsOK() && !kernel_shape.empty(),
+                "ConvNBits requires the kernel_shape attribute.");
+    const int64_t kernel_size = TensorShape(kernel_shape).Size();
+    const int64_t group = conv_attrs_.group;
+    ORT_ENFORCE(kernel_size > 0 && K_ % narrow<size_t>(kernel_size) == 0,
+                "K must be a multiple of the kernel size. K: ", K_, " kernel_shape: ", TensorShape(kernel_shape));
+    ORT_ENFORCE(group > 0 && N_ % narrow<size_t>(group) == 0,
+                "N must be a multiple of group. N: ", N_, " group: ", group);
+
+    // the shape of the unquantized weight, used to validate the inputs like Conv does
+    TensorShapeVector weight_dims{static_cast<int64_t>(N_), static_cast<int64_t>(K_) / kernel_size};
+    weight_dims.insert(weight_dims.end(), kernel_shape.begin(), kernel_shape.end());
+    weight_shape_ = TensorShape(weight_dims);
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+
+  Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                 /*out*/ bool& is_packed,
+                 /*out*/ PrePackedWeights* prepacked_weights) override;
+
+  Status UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers, int input_idx,
+                                   /*out*/ bool& used_shared_buffers) override;
+
+ private:
+  size_t PackedGroupStride() const {
+    const size_t group_output_channels = N_ / narrow<size_t>(conv_attrs_.group);
+    const size_t alignment = MlasGetPreferredBufferAlignment();
+    const size_t size = MlasSQNBitGemmPackQuantBDataSize(group_output_channels, K_, nbits_, block_size_,
+                                                         compute_type_);
+    return (size + alignment - 1) / alignment * alignment;
+  }
+
+  ConvAttributes conv_attrs_;
+  const size_t K_;
+  const size_t N_;
+  const size_t block_size_;
+  const size_t nbits_;
+  const MLAS_SQNBIT_GEMM_COMPUTE_TYPE compute_type_;
+  TensorShape weight_shape_;
+  IAllocatorUniquePtr<void> packed_b_{};
+};
+
+Status ConvNBits::PrePack(const Tensor& tensor, int input_idx, /*out*/ AllocatorPtr alloc,
+                          /*out*/ bool& is_packed,
+                          /*out*/ PrePackedWeights* prepacked_weights) {
+  is_packed = false;
+
+  if (input_idx != InputIndex::B || !MlasIsSQNBitGemmAvailable(nbits_, block_size_, compute_type_)) {
+    return Status::OK();
+  }
+
+  const size_t group_stride = PackedGroupStride();
+  if (group_stride == 0) {
+    return Status::OK();
+  }
+
+  // each group is packed on its own so that it can be passed to MlasSQNBitGemmBatch as a complete B matrix
+  const size_t group_count = narrow<size_t>(conv_attrs_.group);
+  const size_t group_output_channels = N_ / group_count;
+  const size_t column_size = (K_ + block_size_ - 1) / block_size_ * (block_size_ * nbits_ / 8);
+  ORT_RETURN_IF_NOT(tensor.SizeInBytes() == N_ * column_size,
+                    "Unexpected size of quantized weight B: ", tensor.SizeInBytes(), " bytes");
+
+  const size_t packed_b_size = SafeInt<size_t>(group_stride) * group_count;
+  packed_b_ = IAllocator::MakeUniquePtr<void>(alloc, packed_b_size, true);
+
+  const auto* b_data = static_cast<const std::byte*>(tensor.DataRaw());
+  auto* packed_b_data = static_cast<std::byte*>(packed_b_.get());
+  for (size_t group_id = 0; group_id < group_count; ++group_id) {
+    MlasSQNBitGemmPackQuantBData(group_output_channels, K_, nbits_, block_size_, compute_type_,
+                                 b_data + group_id * group_output_channels * column_size,
+                                 packed_b_data + group_id * group_stride);
+  }
+
+  if (prepacked_weights) {
+    prepacked_weights->buffers_.push_back(std::move(packed_b_));
+    prepacked_weights->buffer_sizes_.push_back(packed_b_size);
+  }
+  is_packed = true;
+
+  return Status::OK();
+}
+
+Status ConvNBits::UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers, int input_idx,
+                                            /*out*/ bool& used_shared_buffers) {
+  used_shared_buffers = false;
+
+  if (input_idx == InputIndex::B) {
+    used_shared_buffers = true;
+    packed_b_ = std::move(prepacked_buffers[0]);
+  }
+
+  return Status::OK();
+}
+
+Status ConvNBits::Compute(OpKernelContext* context) const {
+  const auto* X = context->Input<Tensor>(InputIndex::X);
+  const auto* scales = context->Input<Tensor>(InputIndex::scales);
+  const auto* zero_points = context->Input<Tensor>(InputIndex::zero_points);
+  const auto* bias = context->Input<Tensor>(InputIndex::bias);
+
+  ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X->Shape(), weight_shape_));
+
+  const int64_t N = X->Shape()[0];
+  const int64_t C = X->Shape()[1];
+  const int64_t M = weight_shape_[0];
+
+  ORT_RETURN_IF_NOT(bias == nullptr || bias->Shape().Size() == M,
+                    "bias must have shape [N] where N = ", M, ". Got ", bias->Shape());
+
+  TensorShapeVector kernel_shape;
+  ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(weight_shape_, kernel_shape));
+
+  ConvPadVector pads(conv_attrs_.pads);
+  if (pads.empty()) {
+    pads.resize(kernel_shape.size() * 2, 0);
+  }
+  TensorShapeVector dilations(conv_attrs_.dilations);
+  if (dilations.empty()) {
+    dilations.resize(kernel_shape.size(), 1);
+  }
+  TensorShapeVector strides(conv_attrs_.strides);
+  if (strides.empty()) {
+    strides.resize(kernel_shape.size(), 1);
+  }
+
+  TensorShapeVector Y_dims({N, M});
+  TensorShape input_shape = X->Shape().Slice(2);
+  ORT_RETURN_IF_ERROR(conv_attrs_.InferPadsAndOutputShape(input_shape, kernel_shape, strides, dilations, pads, Y_dims));
+  Tensor* Y = context->Output(0, TensorShape(Y_dims));
+  TensorShape output_shape = Y->Shape().Slice(2);
+
+  // Bail out early if one of the dimensions is zero.
+  if (Y->Shape().Size() == 0) {
+    return Status::OK();
+  }
+
+  const size_t group_count = narrow<size_t>(conv_attrs_.group);
+  const size_t group_output_channels = N_ / group_count;
+  const size_t input_image_size = narrow<size_t>(input_shape.Size());
+  const size_t output_image_size = narrow<size_t>(output_shape.Size());
+  const size_t kernel_size = narrow<size_t>(TensorShape(kernel_shape).Size());
+  const size_t kernel_rank = kernel_shape.size();
+  const size_t X_offset = narrow<size_t>(C) / group_count * input_image_size;
+  const size_t Y_offset = group_output_channels * output_image_size;
+
+  const size_t k_blocks = (K_ + block_size_ - 1) / block_size_;
+  const size_t zero_point_column_size = (k_blocks * nbits_ + 7) / 8;
+
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+
+  // Pointwise convolutions can use the original input tensor in place,
+  // otherwise a temporary buffer is required for the im2col transform.
+  IAllocatorUniquePtr<float> col_buffer;
+  if (kernel_size != 1 || !conv_attrs_.HasStridesOneAndNoPadding()) {
+    col_buffer = IAllocator::MakeUniquePtr<float>(alloc, SafeInt<size_t>(K_) * output_image_size);
+  }
+
+  IAllocatorUniquePtr<float> transposed_col_buffer;
+  IAllocatorUniquePtr<float> transposed_output_buffer;
+  IAllocatorUniquePtr<std::byte> workspace;
+  IAllocatorUniquePtr<float> dequantized_b;
+
+  if (packed_b_) {
+    transposed_col_buffer = IAllocator::MakeUniquePtr<float>(alloc, SafeInt<size_t>(output_image_size) * K_);
+    transposed_output_buffer = IAllocator::MakeUniquePtr<float>(alloc, SafeInt<size_t>(output_image_size) * N_);
+    if (const size_t workspace_size = MlasSQNBitGemmBatchWorkspaceSize(output_image_size, group_output_channels, K_,
+                                                                       1, nbits_, block_size_, compute_type_);
+        workspace_size > 0) {
+      workspace = IAllocator::MakeUniquePtr<std::byte>(alloc, workspace_size);
+    }
+  } else {
+    // fallback implementation - dequantize B to [N, K] first and then compute float gemm
+    dequantized_b = IAllocator::MakeUniquePtr<float>(alloc, SafeInt<size_t>(K_) * N_);
+    MlasDequantizeBlockwise<float, 4>(
+        dequantized_b.get(),
+        context->Input<Tensor>(InputIndex::B)->Data<uint8_t>(),
+        scales->Data<float>(),
+        zero_points == nullptr ? nullptr : zero_points->Data<uint8_t>(),
+        static_cast<int32_t>(block_size_),
+        /* columnwise */ true,
+        static_cast<int32_t>(K_),
+        static_cast<int32_t>(N_),
+        context->GetOperatorThreadPool());
+  }
+
+  concurrency::ThreadPool* thread_pool = context->GetOperatorThreadPool();
+
+  const auto* Xdata = X->Data<float>();
+  const auto* scales_data = scales->Data<float>();
+  const auto* zero_points_data = zero_points == nullptr ? nullptr : zero_points->Data<uint8_t>();
+  const auto* bias_data = bias == nullptr ? nullptr : bias->Data<float>();
+  auto* Ydata = Y->MutableData<float>();
+  auto* col_buffer_data = col_buffer.get();
+
+  for (int64_t image_id = 0; image_id < N; ++image_id) {
+    for (size_t group_id = 0; group_id < group_count; ++group_id) {
+      if (col_buffer_data != nullptr) {
+        if (kernel_rank == 2) {
+          math::Im2col<float, StorageOrder::NCHW>()(
+              Xdata,
+              C / conv_attrs_.group,
+              input_shape[0],
+              input_shape[1],
+              kernel_shape[0],
+              kernel_shape[1],
+              dilations[0],
+              dilations[1],
+              pads[0],
+              pads[1],
+              pads[2],
+              pads[3],
+              strides[0],
+              strides[1],
+              col_buffer_data);
+        } else {
+          math::Im2col<float, StorageOrder::NCHW>()(
+              Xdata,
+              input_shape.GetDims().data(),
+              output_shape.GetDims().data(),
+              static_cast<int64_t>(K_),
+              kernel_shape.data(),
+              strides.data(),
+              dilations.data(),
+              pads.data(),
+              static_cast<int>(kernel_rank),
+              col_buffer_data);
+        }
+      }
+
+      const float* col_data = (col_buffer_data == nullptr) ? Xdata : col_buffer_data;
+      const size_t first_channel = group_id * group_output_channels;
+
+      if (packed_b_) {
+        MlasTranspose(col_data, transposed_col_buffer.get(), K_, output_image_size);
+
+        MLAS_SQNBIT_GEMM_DATA_PARAMS data;
+        data.A = transposed_col_buffer.get();
+        data.lda = K_;
+        data.QuantBData = static_cast<const std::byte*>(packed_b_.get()) + group_id * PackedGroupStride();
+        data.QuantBScale = scales_data + first_channel * k_blocks;
+        data.QuantBZeroPoint =
+            zero_points_data == nullptr ? nullptr : zero_points_data + first_channel * zero_point_column_size;
+        data.Bias = bias_data == nullptr ? nullptr : bias_data + first_channel;
+        data.C = transposed_output_buffer.get() + first_channel;
+        data.ldc = N_;
+
+        MlasSQNBitGemmBatch(output_image_size, group_output_channels, K_, 1, nbits_, block_size_, compute_type_,
+                            &data, workspace.get(), thread_pool);
+      } else {
+        // if there is a bias input, copy bias values into Y and set beta to 1.0f
+        float* y_group = Ydata + group_id * Y_offset;
+        float beta = 0.0f;
+        if (bias_data != nullptr) {
+          for (size_t m = 0; m < group_output_channels; ++m) {
+            std::fill_n(y_group + m * output_image_size, output_image_size, bias_data[first_channel + m]);
+          }
+          beta = 1.0f;
+        }
+
+        math::Gemm<float>(CblasNoTrans,
+                          CblasNoTrans,
+                          narrow<ptrdiff_t>(group_output_channels),
+                          narrow<ptrdiff_t>(output_image_size),
+                          narrow<ptrdiff_t>(K_),
+                          1.0f,
+                          dequantized_b.get() + first_channel * K_,
+                          col_data,
+                          beta,
+                          y_group,
+                          thread_pool);
+      }
+
+      Xdata += X_offset;
+    }
+
+    if (packed_b_) {
+      MlasTranspose(transposed_output_buffer.get(), Ydata, output_image_size, N_);
+    }
+
+    Ydata += group_count * Y_offset;
+  }
+
+  return Status::OK();
+}
+
+ONNX_OPERATOR_KERNEL_EX(
+    ConvNBits,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T1", DataTypeImpl::GetTensorType<float>())
+        .TypeConstraint("T2", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T3", DataTypeImpl::GetTensorType<uint8_t>()),
+    ConvNBits);
+
+}  // namespace contrib
+}  // namespace onnxruntime
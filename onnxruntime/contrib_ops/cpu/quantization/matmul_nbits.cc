@@ -33,7 +33,9 @@ constexpr size_t A = 0,
                  scales = 2,
                  zero_points = 3,
                  g_idx = 4,
-                 bias = 5;
+                 bias = 5,
+                 lora_a = 6,
+                 lora_b = 7;
 };
 
 int64_t GetAccuracyLevel(size_t nbits, size_t block_size, int64_t accuracy_level_attr) {
@@ -127,6 +129,14 @@ class MatMulNBits final : public OpKernel {
                                    /*out*/ bool& used_shared_buffers) override;
 
  private:
+  // Checks the shapes and types of the lora inputs. lora_a and lora_b are left null if they are not provided.
+  Status GetLowRankUpdateInputs(OpKernelContext* ctx, const Tensor*& lora_a, const Tensor*& lora_b) const;
+
+  // Adds the low-rank update (A * lora_a) * lora_b to Y, if the lora inputs are provided.
+  Status AddLowRankUpdate(OpKernelContext* ctx, const MatMulComputeHelper& helper,
+                          const Tensor* lora_a, const Tensor* lora_b,
+                          const float* a_data, float* y_data, concurrency::ThreadPool* thread_pool) const;
+
   const size_t K_;
   const size_t N_;
   const size_t block_size_;
@@ -273,6 +283,11 @@ Status MatMulNBits::Compute(OpKernelContext* ctx) const {
   MatMulComputeHelper helper;
   ORT_RETURN_IF_ERROR(helper.Compute(a->Shape(), b_shape, false, true));
 
+  // Reject invalid lora inputs before the main GEMM runs.
+  const Tensor* lora_a = nullptr;
+  const Tensor* lora_b = nullptr;
+  ORT_RETURN_IF_ERROR(GetLowRankUpdateInputs(ctx, lora_a, lora_b));
+
   Tensor* y = ctx->Output(0, helper.OutputShape());
 
   // Bail out early if the output is going to be empty
@@ -310,7 +325,7 @@ Status MatMulNBits::Compute(OpKernelContext* ctx) const {
     // workspace for activation process(dynamic quantization and others)
     auto ws_ptr = IAllocator::MakeUniquePtr<int8_t>(allocator, ws_size);
     NSSQNBitsGemmBatchPackedB(M, N, K, batch_count, gemm_params.data(), ws_ptr.get(), thread_pool);
-    return Status::OK();
+    return AddLowRankUpdate(ctx, helper, lora_a, lora_b, a_data, y_data, thread_pool);
   }
 
 #else  // defined(ORT_NEURAL_SPEED)
@@ -355,7 +370,7 @@ Status MatMulNBits::Compute(OpKernelContext* ctx) const {
       MlasSQNBitGemmBatch(M, N, K, batch_count, nbits_, block_size_, compute_type, data.data(), workspace.get(),
                           thread_pool);
 
-      return Status::OK();
+      return AddLowRankUpdate(ctx, helper, lora_a, lora_b, a_data, y_data, thread_pool);
     }
   }
 
@@ -456,6 +471,83 @@ Status MatMulNBits::Compute(OpKernelContext* ctx) const {
   MlasGemmBatch(CblasNoTrans, CblasTrans,
                 M, N, K, data.data(), batch_count, thread_pool);
 
+  return AddLowRankUpdate(ctx, helper, lora_a, lora_b, a_data, y_data, thread_pool);
+}
+
+Status MatMulNBits::GetLowRankUpdateInputs(OpKernelContext* ctx, const Tensor*& lora_a,
+                                           const Tensor*& lora_b) const {
+  lora_a = ctx->Input<Tensor>(InputIndex::lora_a);
+  lora_b = ctx->Input<Tensor>(InputIndex::lora_b);
+  if (lora_a == nullptr && lora_b == nullptr) {
+    return Status::OK();
+  }
+
+  ORT_RETURN_IF(lora_a == nullptr || lora_b == nullptr, "lora_a and lora_b must be provided together");
+  ORT_RETURN_IF_NOT(lora_a->IsDataType<float>() && lora_b->IsDataType<float>(),
+                    "lora_a and lora_b must be float tensors");
+
+  const auto& lora_a_shape = lora_a->Shape();
+  const auto& lora_b_shape = lora_b->Shape();
+  ORT_RETURN_IF_NOT(lora_a_shape.NumDimensions() == 2 && lora_a_shape[0] == static_cast<int64_t>(K_),
+                    "lora_a must have shape [K, rank]. Got ", lora_a_shape);
+  ORT_RETURN_IF_NOT(lora_b_shape.NumDimensions() == 2 && lora_b_shape[0] == lora_a_shape[1] &&
+                        lora_b_shape[1] == static_cast<int64_t>(N_),
+                    "lora_b must have shape [rank, N]. Got ", lora_b_shape, " with lora_a shape ", lora_a_shape);
+
+  return Status::OK();
+}
+
+Status MatMulNBits::AddLowRankUpdate(OpKernelContext* ctx, const MatMulComputeHelper& helper,
+                                     const Tensor* lora_a, const Tensor* lora_b,
+                                     const float* a_data, float* y_data,
+                                     concurrency::ThreadPool* thread_pool) const {
+  if (lora_a == nullptr) {
+    return Status::OK();
+  }
+
+  const size_t rank = narrow<size_t>(lora_a->Shape()[1]);
+  if (rank == 0) {
+    return Status::OK();
+  }
+
+  const size_t batch_count = helper.OutputOffsets().size();
+  const size_t M = static_cast<size_t>(helper.M());
+  const size_t N = static_cast<size_t>(helper.N());
+  const size_t K = static_cast<size_t>(helper.K());
+  const size_t lda = helper.Lda(false);
+
+  // The rank is small compared to K and N so the intermediate A * lora_a is cheap to hold.
+  AllocatorPtr allocator;
+  ORT_RETURN_IF_ERROR(ctx->GetTempSpaceAllocator(&allocator));
+  auto a_lora_a = IAllocator::MakeUniquePtr<float>(allocator, SafeInt<size_t>(batch_count) * M * rank);
+
+  std::vector<MLAS_SGEMM_DATA_PARAMS> data(batch_count);
+  for (size_t i = 0; i < batch_count; i++) {
+    data[i].A = a_data + helper.LeftOffsets()[i];
+    data[i].lda = lda;
+    data[i].B = lora_a->Data<float>();
+    data[i].ldb = rank;
+    data[i].C = a_lora_a.get() + i * M * rank;
+    data[i].ldc = rank;
+    data[i].alpha = 1.f;
+    data[i].beta = 0.0f;
+  }
+
+  MlasGemmBatch(CblasNoTrans, CblasNoTrans, M, rank, K, data.data(), batch_count, thread_pool);
+
+  // Accumulate into Y, which already holds A * B (+ bias).
+  for (size_t i = 0; i < batch_count; i++) {
+    data[i].A = a_lora_a.get() + i * M * rank;
+    data[i].lda = rank;
+    data[i].B = lora_b->Data<float>();
+    data[i].ldb = N;
+    data[i].C = y_data + helper.OutputOffsets()[i];
+    data[i].ldc = N;
+    data[i].beta = 1.0f;
+  }
+
+  MlasGemmBatch(CblasNoTrans, CblasNoTrans, M, N, rank, data.data(), batch_count, thread_pool);
+
   return Status::OK();
 }
 
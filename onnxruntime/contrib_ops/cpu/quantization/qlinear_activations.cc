@@ -4,6 +4,9 @@
 #include "qlinear_activations.h"
 #include "qlinear_lookup_table.h"
 
+#include <cmath>
+#include <string>
+
 #include "core/common/narrow.h"
 #include "core/mlas/inc/mlas.h"
 #include "core/platform/threadpool.h"
@@ -97,6 +100,34 @@ Status QLinearSigmoid<T>::Compute(OpKernelContext* context) const {
   });
 }
 
+template <typename T>
+float QLinearGelu<T>::GeluErf(float v) {
+  static constexpr float kSqrtHalf = 0.7071067811865476f;  // 1 / sqrt(2.0)
+  return 0.5f * v * (1.0f + std::erf(v * kSqrtHalf));
+}
+
+template <typename T>
+float QLinearGelu<T>::GeluTanh(float v) {
+  static constexpr float B = 0.7978845608028654f;    // sqrt(2.0 / M_PI)
+  static constexpr float C = 0.035677408136300125f;  // 0.044715 * sqrt(2.0 / M_PI)
+  return 0.5f * v * (1.0f + std::tanh(v * (C * v * v + B)));
+}
+
+template <typename T>
+QLinearGelu<T>::QLinearGelu(const OpKernelInfo& info)
+    : QLinearLookupBase<T>(info) {
+  const std::string approximate = info.GetAttrOrDefault<std::string>("approximate", "none");
+  ORT_ENFORCE(approximate == "none" || approximate == "tanh",
+              "QLinearGelu: approximate must be 'none' or 'tanh', got ", approximate);
+  use_tanh_ = approximate == "tanh";
+  this->BuildLookupTableIfFixed(info, use_tanh_ ? &GeluTanh : &GeluErf);
+}
+
+template <typename T>
+Status QLinearGelu<T>::Compute(OpKernelContext* context) const {
+  return this->ComputeBase(context, use_tanh_ ? &GeluTanh : &GeluErf);
+}
+
 #define REGISTER_QLINEAR_LOOKUPTABLE_TYPED_KERNEL(op_name, version, data_type, KERNEL_CLASS) \
   ONNX_CPU_OPERATOR_TYPED_MS_KERNEL(                                                         \
       op_name, version, data_type,                                                           \
@@ -108,6 +139,8 @@ REGISTER_QLINEAR_LOOKUPTABLE_TYPED_KERNEL(QLinearLeakyRelu, 1, int8_t, QLinearLe
 REGISTER_QLINEAR_LOOKUPTABLE_TYPED_KERNEL(QLinearLeakyRelu, 1, uint8_t, QLinearLeakyRelu);
 REGISTER_QLINEAR_LOOKUPTABLE_TYPED_KERNEL(QLinearSigmoid, 1, int8_t, QLinearSigmoid);
 REGISTER_QLINEAR_LOOKUPTABLE_TYPED_KERNEL(QLinearSigmoid, 1, uint8_t, QLinearSigmoid);
+REGISTER_QLINEAR_LOOKUPTABLE_TYPED_KERNEL(QLinearGelu, 1, int8_t, QLinearGelu);
+REGISTER_QLINEAR_LOOKUPTABLE_TYPED_KERNEL(QLinearGelu, 1, uint8_t, QLinearGelu);
 
 }  // namespace contrib
 }  // namespace onnxruntime
@@ -49,5 +49,20 @@ class QLinearSigmoid final : public QLinearLookupBase<T> {
   Status Compute(OpKernelContext* context) const override;
 };
 
+template <typename T>
+class QLinearGelu final : public QLinearLookupBase<T> {
+ public:
+  QLinearGelu(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  static float GeluErf(float v);
+  static float GeluTanh(float v);
+
+  // approximate == "tanh"
+  bool use_tanh_;
+};
+
 }  // namespace contrib
 }  // namespace onnxruntime
@@ -0,0 +1,116 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cpu/quantization/qlinear_layer_norm.h"
+
+#include <algorithm>
+#include <memory>
+
+#include "core/common/narrow.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
+#include "core/providers/common.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+namespace {
+
+// number of dequantized input elements buffered per task
+constexpr size_t kRowBlockElements = 16384;
+
+}  // namespace
+
+template <typename T>
+QLinearLayerNormalization<T>::QLinearLayerNormalization(const OpKernelInfo& info)
+    : OpKernel(info),
+      axis_(info.GetAttrOrDefault<int64_t>("axis", -1)),
+      epsilon_(info.GetAttrOrDefault<float>("epsilon", 1e-5f)) {
+}
+
+template <typename T>
+Status QLinearLayerNormalization<T>::Compute(OpKernelContext* context) const {
+  const auto& X = *context->Input<Tensor>(0);
+  const auto* X_scale = context->Input<Tensor>(1);
+  const auto* X_zero_point = context->Input<Tensor>(2);
+  const auto& scale = *context->Input<Tensor>(3);
+  const auto* Y_scale = context->Input<Tensor>(4);
+  const auto* Y_zero_point = context->Input<Tensor>(5);
+  const auto* bias = context->Input<Tensor>(6);
+
+  ORT_RETURN_IF_NOT(IsScalarOr1ElementVector(X_scale),
+                    "QLinearLayerNormalization : input X_scale must be a scalar or 1D tensor of size 1");
+  ORT_RETURN_IF_NOT(X_zero_point == nullptr || IsScalarOr1ElementVector(X_zero_point),
+                    "QLinearLayerNormalization : input X_zero_point must be a scalar or 1D tensor of size 1");
+  ORT_RETURN_IF_NOT(IsScalarOr1ElementVector(Y_scale),
+                    "QLinearLayerNormalization : input Y_scale must be a scalar or 1D tensor of size 1");
+  ORT_RETURN_IF_NOT(Y_zero_point == nullptr || IsScalarOr1ElementVector(Y_zero_point),
+                    "QLinearLayerNormalization : input Y_zero_point must be a scalar or 1D tensor of size 1");
+
+  const TensorShape& x_shape = X.Shape();
+  const int64_t axis = HandleNegativeAxis(axis_, x_shape.NumDimensions());
+  const int64_t norm_count = x_shape.SizeToDimension(onnxruntime::narrow<size_t>(axis));
+  const int64_t norm_size = x_shape.SizeFromDimension(onnxruntime::narrow<size_t>(axis));
+
+  const int64_t bias_size = bias != nullptr ? bias->Shape().Size() : 0;
+  if (scale.Shape().Size() != norm_size || (bias != nullptr && bias_size != norm_size)) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Size of X.shape()[axis:] == ", norm_size,
+                           ". Size of scale and bias (if provided) must match this. Got scale size of ",
+                           scale.Shape().Size(), " and bias size of ", bias_size);
+  }
+
+  Tensor& Y = *context->Output(0, x_shape);
+  if (norm_count == 0 || norm_size == 0) {
+    return Status::OK();
+  }
+
+  const float x_scale = *X_scale->Data<float>();
+  const T x_zero_point = X_zero_point != nullptr ? *X_zero_point->Data<T>() : T(0);
+
+  MLAS_LAYER_NORM_PARAMS<float> params;
+  params.Scale = scale.Data<float>();
+  params.Bias = bias != nullptr ? bias->Data<float>() : nullptr;
+  params.Epsilon = epsilon_;
+  params.OutputScale = *Y_scale->Data<float>();
+  params.OutputZeroPoint = Y_zero_point != nullptr ? static_cast<int32_t>(*Y_zero_point->Data<T>()) : 0;
+
+  const size_t D = narrow<size_t>(norm_size);
+  const size_t N = narrow<size_t>(norm_count);
+  const size_t rows_per_block = std::max<size_t>(1, kRowBlockElements / D);
+  const size_t block_count = (N + rows_per_block - 1) / rows_per_block;
+
+  const T* x_data = X.Data<T>();
+  T* y_data = Y.MutableData<T>();
+
+  const double block_elements = static_cast<double>(rows_per_block * D);
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), narrow<std::ptrdiff_t>(block_count),
+      TensorOpCost{block_elements * sizeof(T), block_elements * sizeof(T), block_elements * 8.0},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        const size_t row_begin = static_cast<size_t>(first) * rows_per_block;
+        const size_t row_end = std::min(N, static_cast<size_t>(last) * rows_per_block);
+        auto buffer = std::make_unique<float[]>(std::min(N - row_begin, rows_per_block) * D);
+
+        for (size_t row = row_begin; row < row_end; row += rows_per_block) {
+          const size_t rows = std::min(rows_per_block, row_end - row);
+          MlasDequantizeLinear(x_data + row * D, buffer.get(), rows * D, x_scale, x_zero_point);
+          MlasLayerNormalization(buffer.get(), y_data + row * D, rows, D, params, nullptr);
+        }
+      });
+
+  return Status::OK();
+}
+
+#define REGISTER_QLINEAR_LAYER_NORM_TYPED_KERNEL(data_type)               \
+  ONNX_CPU_OPERATOR_TYPED_MS_KERNEL(                                      \
+      QLinearLayerNormalization, 1, data_type,                            \
+      KernelDefBuilder()                                                  \
+          .TypeConstraint("T", DataTypeImpl::GetTensorType<data_type>()), \
+      QLinearLayerNormalization<data_type>);
+
+REGISTER_QLINEAR_LAYER_NORM_TYPED_KERNEL(int8_t);
+REGISTER_QLINEAR_LAYER_NORM_TYPED_KERNEL(uint8_t);
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,26 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/framework/op_kernel.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// LayerNormalization between a DequantizeLinear and a QuantizeLinear. Blocks of rows are dequantized into a
+// float scratch buffer, normalized and quantized straight into the output by MlasLayerNormalization.
+template <typename T>
+class QLinearLayerNormalization final : public OpKernel {
+ public:
+  QLinearLayerNormalization(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  int64_t axis_;
+  float epsilon_;
+};
+
+}  // namespace contrib
+}  // namespace onnxruntime
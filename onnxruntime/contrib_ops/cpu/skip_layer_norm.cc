@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "core/framework/tensor.h"
+#include "core/mlas/inc/mlas.h"
 #include "core/util/math_cpuonly.h"
 #include "core/providers/common.h"
 #include "core/platform/threadpool.h"
@@ -33,6 +34,7 @@ namespace contrib {
 
 REGISTER_KERNEL_TYPED(float)
 REGISTER_KERNEL_TYPED(double)
+REGISTER_KERNEL_TYPED(MLFloat16)
 
 template <typename T, bool simplified>
 SkipLayerNorm<T, simplified>::SkipLayerNorm(const OpKernelInfo& op_kernel_info)
@@ -81,53 +83,69 @@ Status SkipLayerNorm<T, simplified>::Compute(OpKernelContext* p_ctx) const {
 
   const auto& skip_size = skip->Shape().Size();
 
-  concurrency::ThreadPool::TryBatchParallelFor(
-      p_ctx->GetOperatorThreadPool(), static_cast<int32_t>(task_count),
-      [&](ptrdiff_t task_idx) {
-        auto offset = task_idx * hidden_size;
-
-        const T* p_input = input_data + offset;
-        const T* p_skip = skip_data + (offset % skip_size);
-        T* p_output = output_data + offset;
-        T* p_skip_input_bias_add_output_data = skip_input_bias_add_output_data != nullptr ? skip_input_bias_add_output_data + offset : nullptr;
-
-        T mean = 0;
-        T mean_square = 0;
-
-        for (int64_t h = 0; h < hidden_size; h++) {
-          T value = p_input[h] + p_skip[h];
-
-          if (nullptr != bias_data) {
-            value += bias_data[h];
-          }
-
-          if (nullptr != p_skip_input_bias_add_output_data) {
-            p_skip_input_bias_add_output_data[h] = value;
+  if constexpr (std::is_same_v<T, float> || std::is_same_v<T, MLFloat16>) {
+    // the skip and bias adds are fused into the single pass MLAS normalization
+    MLAS_LAYER_NORM_PARAMS<T> params;
+    params.Skip = skip_data;
+    params.SkipRows = narrow<size_t>(skip_size / hidden_size);
+    params.SkipBias = bias_data;
+    params.SumOutput = skip_input_bias_add_output_data;
+    params.Scale = gamma_data;
+    params.Bias = simplified ? nullptr : beta_data;
+    params.Epsilon = epsilon_;
+    params.Simplified = simplified;
+
+    MlasLayerNormalization(input_data, output_data, narrow<size_t>(task_count), narrow<size_t>(hidden_size), params,
+                           p_ctx->GetOperatorThreadPool());
+  } else {
+    concurrency::ThreadPool::TryBatchParallelFor(
+        p_ctx->GetOperatorThreadPool(), static_cast<int32_t>(task_count),
+        [&](ptrdiff_t task_idx) {
+          auto offset = task_idx * hidden_size;
+
+          const T* p_input = input_data + offset;
+          const T* p_skip = skip_data + (offset % skip_size);
+          T* p_output = output_data + offset;
+          T* p_skip_input_bias_add_output_data = skip_input_bias_add_output_data != nullptr ? skip_input_bias_add_output_data + offset : nullptr;
+
+          T mean = 0;
+          T mean_square = 0;
+
+          for (int64_t h = 0; h < hidden_size; h++) {
+            T value = p_input[h] + p_skip[h];
+
+            if (nullptr != bias_data) {
+              value += bias_data[h];
+            }
+
+            if (nullptr != p_skip_input_bias_add_output_data) {
+              p_skip_input_bias_add_output_data[h] = value;
+            }
+
+            p_output[h] = value;
+            mean += value;
+            mean_square += value * value;
           }
 
-          p_output[h] = value;
-          mean += value;
-          mean_square += value * value;
-        }
-
-        mean = mean / hidden_size;
-        if (simplified) {
-          mean_square = sqrt(mean_square / hidden_size + epsilon_);
-        } else {
-          mean_square = sqrt(mean_square / hidden_size - mean * mean + epsilon_);
-        }
-
-        for (int64_t h = 0; h < hidden_size; h++) {
+          mean = mean / hidden_size;
           if (simplified) {
-            p_output[h] = p_output[h] / mean_square * gamma_data[h];
-          } else if (nullptr == beta_data) {
-            p_output[h] = (p_output[h] - mean) / mean_square * gamma_data[h];
+            mean_square = sqrt(mean_square / hidden_size + epsilon_);
           } else {
-            p_output[h] = (p_output[h] - mean) / mean_square * gamma_data[h] + beta_data[h];
+            mean_square = sqrt(mean_square / hidden_size - mean * mean + epsilon_);
+          }
+
+          for (int64_t h = 0; h < hidden_size; h++) {
+            if (simplified) {
+              p_output[h] = p_output[h] / mean_square * gamma_data[h];
+            } else if (nullptr == beta_data) {
+              p_output[h] = (p_output[h] - mean) / mean_square * gamma_data[h];
+            } else {
+              p_output[h] = (p_output[h] - mean) / mean_square * gamma_data[h] + beta_data[h];
+            }
           }
-        }
-      },
-      0);
+        },
+        0);
+  }
 
   return Status::OK();
 }
@@ -24,6 +24,10 @@ class MatMulNBits final : public CudaKernel {
     ORT_ENFORCE(Status::OK() == info.GetAttr<int64_t>("N", &N_));
     ORT_ENFORCE(Status::OK() == info.GetAttr<int64_t>("block_size", &block_size_));
     ORT_ENFORCE(Status::OK() == info.GetAttr<int64_t>("bits", &nbits_));
+    const auto& input_defs = info.node().InputDefs();
+    for (size_t i = 6; i < input_defs.size(); ++i) {
+      ORT_ENFORCE(!input_defs[i]->Exists(), "lora_a and lora_b inputs are not supported by the CUDA MatMulNBits kernel");
+    }
   }
 
   Status ComputeInternal(OpKernelContext* context) const override;
@@ -21,6 +21,10 @@ class MatMulNBits final : public JsKernel {
                 "Only 4b quantization is supported for MatMulNBits op, additional bits support is planned.");
     ORT_ENFORCE(block_size_ >= 16 && !(block_size_ & (block_size_ - 1)),
                 "Block size must be a power of 2 and greater than or equal to 16.");
+    const auto& input_defs = info.node().InputDefs();
+    for (size_t i = 6; i < input_defs.size(); ++i) {
+      ORT_ENFORCE(!input_defs[i]->Exists(), "lora_a and lora_b inputs are not supported by the JS MatMulNBits kernel");
+    }
     JSEP_INIT_KERNEL_ATTRIBUTE(MatMulNBits, ({
                                  "k" : $1,
                                  "n" : $2,
@@ -8,6 +8,8 @@
 #include "core/framework/tensor.h"
 #include "core/framework/op_kernel_type_control_utils.h"
 
+#include <algorithm>
+#include <cstring>
 #include <vector>
 
 namespace onnxruntime {
@@ -229,6 +231,55 @@ void StridedCopy(concurrency::ThreadPool* thread_pool,
   }
 }
 
+// A contiguous piece of a larger copy.
+struct CopySegment {
+  void* dst;
+  const void* src;
+  size_t size;  // in bytes
+};
+
+// Copies `total_bytes` bytes using the thread pool, with the work split by the cost model so that small copies run
+// inline and large ones are spread over all threads.
+// The copy is described as a sequence of `num_segments` contiguous segments laid out over the byte range
+// [0, total_bytes). `segment_at(offset)` returns the segment containing `offset`, with dst/src/size adjusted to start
+// at `offset`. The segment size must be non-zero and segments must not overlap in the destination.
+//
+// The thread pool splits the range into blocks of the average segment size, capped so that a few large segments are
+// still split across threads. Each block is charged the bytes it moves plus the cost of starting a segment.
+//
+// This works for any type that can be copied with memcpy, so ops that move data around only need to describe
+// the layout of their output. Strings must use StridedCopy.
+template <typename SegmentFunc>
+void ParallelCopy(concurrency::ThreadPool* thread_pool, size_t total_bytes, size_t num_segments,
+                  const SegmentFunc& segment_at) {
+  if (total_bytes == 0) {
+    return;
+  }
+
+  // segment_at() and the memcpy call, in cycles
+  constexpr double kSegmentCost = 64.0;
+  constexpr size_t kMaxBlockBytes = 16 * 1024;
+
+  const size_t segments = std::max<size_t>(num_segments, 1);
+  const size_t segment_bytes = (total_bytes + segments - 1) / segments;
+  const size_t block_bytes = std::min(segment_bytes, kMaxBlockBytes);
+  const size_t num_blocks = (total_bytes + block_bytes - 1) / block_bytes;
+
+  concurrency::ThreadPool::TryParallelFor(
+      thread_pool, static_cast<std::ptrdiff_t>(num_blocks),
+      {static_cast<double>(block_bytes), static_cast<double>(block_bytes), kSegmentCost},
+      [&segment_at, total_bytes, block_bytes](std::ptrdiff_t first_block, std::ptrdiff_t last_block) {
+        size_t first = static_cast<size_t>(first_block) * block_bytes;
+        const size_t last = std::min(static_cast<size_t>(last_block) * block_bytes, total_bytes);
+        while (first < last) {
+          const CopySegment segment = segment_at(first);
+          const size_t size = std::min(segment.size, last - first);
+          memcpy(segment.dst, segment.src, size);
+          first += size;
+        }
+      });
+}
+
 // call StridedCopy if there is a type with the same size as T in the set of EnabledTypes
 // e.g. if uint32_t is enabled all 4 byte types are supported
 template <typename EnabledTypes, typename T>
@@ -2,7 +2,13 @@
 // Licensed under the MIT License.
 
 #include "core/framework/prepacked_weights_container.h"
+
+#include <algorithm>
+#include <cstring>
+
 #include "core/framework/allocator_utils.h"
+#include "core/framework/murmurhash3.h"
+#include "core/framework/tensor.h"
 
 namespace onnxruntime {
 
@@ -45,8 +51,128 @@ bool PrepackedWeightsContainer::HasWeight(const std::string& key) const {
          prepacked_weights_map_.end();
 }
 
+void PrepackedWeightsContainer::AddWeightReference(const std::string& key) {
+  ++weight_reference_counts_[key];
+}
+
+void PrepackedWeightsContainer::ReleaseWeights(gsl::span<const std::string> keys) {
+  std::lock_guard<OrtMutex> l(mutex_);
+
+  for (const auto& key : keys) {
+    // this is called from the SessionState destructor, so ignore keys that aren't referenced instead of throwing
+    auto iter = weight_reference_counts_.find(key);
+    if (iter == weight_reference_counts_.end()) {
+      continue;
+    }
+
+    if (--iter->second == 0) {
+      weight_reference_counts_.erase(iter);
+      if (release_unused_weights_) {
+        prepacked_weights_map_.erase(key);
+      }
+    }
+  }
+}
+
 size_t PrepackedWeightsContainer::GetNumberOfElements() const {
   return prepacked_weights_map_.size();
 }
 
+static HashValue HashTensorData(const Tensor& tensor) {
+  uint32_t hash[4] = {0, 0, 0, 0};
+
+  // MurmurHash3 takes an int length so hash large tensors in chunks, chaining the hash through the seed
+  constexpr size_t max_chunk_size = size_t{1} << 30;
+  const auto* data = static_cast<const uint8_t*>(tensor.DataRaw());
+  size_t remaining = tensor.SizeInBytes();
+  while (remaining > 0) {
+    const size_t chunk_size = std::min(remaining, max_chunk_size);
+    MurmurHash3::x86_128(data, static_cast<int>(chunk_size), hash[0], &hash);
+    data += chunk_size;
+    remaining -= chunk_size;
+  }
+
+  return HashValue{hash[0]} | (HashValue{hash[1]} << 32);
+}
+
+static bool HaveSameContents(const Tensor& a, const Tensor& b) {
+  return a.DataType() == b.DataType() &&
+         a.Shape() == b.Shape() &&
+         std::memcmp(a.DataRaw(), b.DataRaw(), a.SizeInBytes()) == 0;
+}
+
+// Returns an OrtValue that references the Tensor in `holder` and keeps `holder` alive.
+static OrtValue MakeSharedInitializerValue(const std::shared_ptr<OrtValue>& holder) {
+  OrtValue value;
+  value.Init(holder->GetMutable<Tensor>(), DataTypeImpl::GetType<Tensor>(), [holder](void*) {});
+  return value;
+}
+
+bool PrepackedWeightsContainer::GetOrAddInitializer(OrtValue& value) {
+  const Tensor& tensor = value.Get<Tensor>();
+  ORT_ENFORCE(!tensor.IsDataTypeString(), "String initializers can't be shared");
+  ORT_ENFORCE(tensor.Location().device.Type() == OrtDevice::CPU, "Only CPU initializers can be shared");
+
+  const HashValue hash = HashTensorData(tensor);
+
+  std::lock_guard<OrtMutex> l(initializers_mutex_);
+
+  auto range = initializers_.equal_range(hash);
+  for (auto it = range.first; it != range.second;) {
+    std::shared_ptr<OrtValue> existing = it->second.lock();
+    if (!existing) {
+      it = initializers_.erase(it);
+      continue;
+    }
+
+    if (HaveSameContents(existing->Get<Tensor>(), tensor)) {
+      ++num_reused_initializers_;
+      reused_initializers_size_in_bytes_ += tensor.SizeInBytes();
+      value = MakeSharedInitializerValue(existing);
+      return true;
+    }
+
+    ++it;
+  }
+
+  auto holder = std::make_shared<OrtValue>(std::move(value));
+  initializers_.emplace(hash, holder);
+  value = MakeSharedInitializerValue(holder);
+  return false;
+}
+
+PrepackedWeightsContainer::MemoryStats PrepackedWeightsContainer::GetMemoryStats() {
+  MemoryStats stats;
+
+  {
+    std::lock_guard<OrtMutex> l(initializers_mutex_);
+    for (auto it = initializers_.begin(); it != initializers_.end();) {
+      std::shared_ptr<OrtValue> initializer = it->second.lock();
+      if (!initializer) {
+        it = initializers_.erase(it);
+        continue;
+      }
+
+      ++stats.num_initializers;
+      stats.initializers_size_in_bytes += initializer->Get<Tensor>().SizeInBytes();
+      ++it;
+    }
+
+    stats.num_reused_initializers = num_reused_initializers_;
+    stats.reused_initializers_size_in_bytes = reused_initializers_size_in_bytes_;
+  }
+
+  {
+    std::lock_guard<OrtMutex> l(mutex_);
+    stats.num_prepacked_weights = prepacked_weights_map_.size();
+    for (const auto& entry : prepacked_weights_map_) {
+      for (size_t buffer_size : entry.second.buffer_sizes_) {
+        stats.prepacked_weights_size_in_bytes += buffer_size;
+      }
+    }
+  }
+
+  return stats;
+}
+
 }  // namespace onnxruntime
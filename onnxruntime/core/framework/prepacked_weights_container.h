@@ -3,14 +3,18 @@
 
 #pragma once
 
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
 #include <string>
 #include <cstdint>
+#include <vector>
 
+#include "core/common/gsl.h"
 #include "core/framework/buffer_deleter.h"
 
 #include "core/framework/allocator.h"
+#include "core/framework/ort_value.h"
 #include "core/platform/ort_mutex.h"
 #include "prepacked_weights.h"
 
@@ -18,7 +22,10 @@ namespace onnxruntime {
 
 class PrepackedWeightsContainer final {
  public:
-  PrepackedWeightsContainer() {
+  // If `release_unused_weights` is true, a pre-packed weight is erased once every session that referenced it
+  // (see AddWeightReference) has released it. Otherwise weights are kept for the lifetime of the container.
+  explicit PrepackedWeightsContainer(bool release_unused_weights = false)
+      : release_unused_weights_(release_unused_weights) {
   }
 
   ~PrepackedWeightsContainer() = default;
@@ -44,9 +51,39 @@ class PrepackedWeightsContainer final {
   // The key is : op_type + "+" + hash_of_prepacked_buffers_in_the_PrepackedWeights_instance.
   bool HasWeight(const std::string& key) const;
 
+  // Records that a session uses the PrePackedWeights instance pertaining to the provided key.
+  // The caller must hold mutex_.
+  void AddWeightReference(const std::string& key);
+
+  // Drops one reference to each of the provided keys, as recorded by AddWeightReference. If the container
+  // releases unused weights, the PrePackedWeights instances that are no longer referenced are erased.
+  // Acquires mutex_.
+  void ReleaseWeights(gsl::span<const std::string> keys);
+
   // Returns the number of elements in the container
   size_t GetNumberOfElements() const;
 
+  // Deduplicates a CPU initializer by content.
+  // If the container holds a live initializer with the same type, shape and data as `value`, `value` is replaced
+  // with an OrtValue referencing the container's copy and true is returned. Otherwise `value` is recorded for
+  // sharing with later callers, replaced with an OrtValue referencing the recorded copy, and false is returned.
+  // The container doesn't keep initializers alive: an entry is released once no session references it.
+  // String tensors are not supported.
+  bool GetOrAddInitializer(OrtValue& value);
+
+  struct MemoryStats {
+    size_t num_initializers = 0;                   // distinct initializers currently held
+    size_t initializers_size_in_bytes = 0;         // memory used by those initializers
+    size_t num_reused_initializers = 0;            // initializers handed out instead of keeping a new copy
+    size_t reused_initializers_size_in_bytes = 0;  // memory saved by doing so
+    size_t num_prepacked_weights = 0;
+    size_t prepacked_weights_size_in_bytes = 0;
+  };
+
+  // Reports the memory held in the container and how much deduplicating initializers saved.
+  // Must not be called while holding mutex_.
+  MemoryStats GetMemoryStats();
+
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(PrepackedWeightsContainer);
 
   // Resource to be acquired by the method that is going to invoke calls to the kernels'
@@ -64,6 +101,19 @@ class PrepackedWeightsContainer final {
   // to PrePackedWeights instances.
   // The key is : op_type + "+" + hash_of_prepacked_buffers_in_the_PrepackedWeights_instance.
   std::unordered_map<std::string, PrePackedWeights> prepacked_weights_map_;
+
+ private:
+  const bool release_unused_weights_;
+
+  // Number of session references to each key in prepacked_weights_map_. Guarded by mutex_.
+  std::unordered_map<std::string, size_t> weight_reference_counts_;
+
+  // Initializers deduplicated by GetOrAddInitializer, keyed by a hash of their data.
+  // Entries are weak so that the initializers are freed together with the last session using them.
+  OrtMutex initializers_mutex_;
+  std::unordered_multimap<HashValue, std::weak_ptr<OrtValue>> initializers_;
+  size_t num_reused_initializers_ = 0;
+  size_t reused_initializers_size_in_bytes_ = 0;
 };
 
 }  // namespace onnxruntime
@@ -396,7 +396,11 @@ static std::string GenerateKeyForPrepackedWeightsMap(const std::string& op_type,
 
 Status SessionState::PrepackConstantInitializedTensors(InlinedHashMap<std::string, size_t>& constant_initializers_use_count,
                                                        const std::unordered_map<std::string, const OrtValue*>& initializers_to_share_map) {
-  auto prepacked_constant_weights = [this, &constant_initializers_use_count, &initializers_to_share_map](
+  const bool share_initializers_across_sessions =
+      sess_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsShareInitializersAcrossSessions, "0") == "1";
+
+  auto prepacked_constant_weights = [this, &constant_initializers_use_count, &initializers_to_share_map,
+                                     share_initializers_across_sessions](
                                         bool should_cache_prepacked_weights_for_shared_initializers) -> Status {
     for (auto& node : GetGraphViewer().Nodes()) {
       auto kernel = GetMutableKernel(node.Index());
@@ -417,7 +421,9 @@ Status SessionState::PrepackConstantInitializedTensors(InlinedHashMap<std::strin
                 const Tensor& const_initialized_tensor = constant_initialized_tensors[ort_value_idx].Get<Tensor>();
 
                 auto iter = initializers_to_share_map.find(input_name);
-                bool is_shared_initializer = (iter != initializers_to_share_map.end());
+                // When initializers are shared across sessions by content, any CPU initializer may be shared
+                bool is_shared_initializer = (iter != initializers_to_share_map.end()) ||
+                                             share_initializers_across_sessions;
 
                 // Caching pre-packed weights is limited to shared initializers associated with the CPU EP for now
                 if (is_shared_initializer && should_cache_prepacked_weights_for_shared_initializers &&
@@ -474,6 +480,9 @@ Status SessionState::PrepackConstantInitializedTensors(InlinedHashMap<std::strin
                                                                           prepacked_weights_container_->GetWeight(prepacked_weights_container_key),
                                                                           node.Name()));
                     }
+
+                    prepacked_weights_container_->AddWeightReference(prepacked_weights_container_key);
+                    used_prepacked_weights_keys_.push_back(prepacked_weights_container_key);
                   }
 
                 } else {  // caching of pre-packed weights' turned OFF
@@ -1443,6 +1452,11 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
 
   const auto& initializer_allocation_order = p_seq_exec_plan_->initializer_allocation_order;
 
+  PrepackedWeightsContainer* shared_initializers_container =
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsShareInitializersAcrossSessions, "0") == "1"
+          ? prepacked_weights_container_
+          : nullptr;
+
   // move initializers from TensorProto instances in Graph to OrtValue instances in SessionState
   session_state_utils::MemoryProfileFunction memory_profile_func = nullptr;
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
@@ -1486,7 +1500,8 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
             }
             return Status::OK();
           },
-          logger_, data_transfer_mgr_, *p_seq_exec_plan_, session_options, memory_profile_func));
+          logger_, data_transfer_mgr_, *p_seq_exec_plan_, session_options, memory_profile_func,
+          shared_initializers_container));
 
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   // Record Weight allocation info on device
@@ -99,6 +99,10 @@ class SessionState {
                AllocatorMap* parent_allocators = nullptr);
 
   ~SessionState() {
+    if (!used_prepacked_weights_keys_.empty()) {
+      prepacked_weights_container_->ReleaseWeights(used_prepacked_weights_keys_);
+    }
+
     for (auto& kvp : deleter_for_initialized_tensors_) {
       kvp.second.f(kvp.second.param);
     }
@@ -548,6 +552,10 @@ class SessionState {
   // a constant initialized weight was used by the session state
   size_t used_shared_pre_packed_weights_counter_ = 0;
 
+  // Keys of the pre-packed weights in prepacked_weights_container_ used by the kernels of this session state.
+  // They are released when the session state is destroyed.
+  std::vector<std::string> used_prepacked_weights_keys_;
+
 #ifdef DEBUG_NODE_INPUTS_OUTPUTS
   // Counter for number of times the session graph has been executed
   size_t graph_executions_counter_ = 0;
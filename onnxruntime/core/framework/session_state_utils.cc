@@ -93,6 +93,24 @@ static inline common::Status ExtDataTensorProtoToTensor(const Env& env,
   return common::Status::OK();
 }
 
+// given a tensor proto with external data return an OrtValue with a CPU tensor that uses the external data in place.
+// The file containing the external data is mmap'd where possible, so no buffer is allocated for the tensor and
+// its pages are only read in when the initializer is first accessed (e.g. by PrePack or by the kernel).
+static common::Status ExtDataTensorProtoToCpuOrtValue(const Env& env,
+                                                      const std::basic_string<PATH_CHAR_TYPE>& proto_path,
+                                                      const ONNX_NAMESPACE::TensorProto& tensor_proto,
+                                                      OrtValue& ort_value) {
+  auto p_tensor = std::make_unique<Tensor>();
+  OrtCallback ext_data_deleter;
+  ORT_RETURN_IF_ERROR(ExtDataTensorProtoToTensor(env, proto_path, tensor_proto, *p_tensor, ext_data_deleter));
+
+  ExtDataValueDeleter deleter{ext_data_deleter, p_tensor.get()};
+
+  MLDataType ml_tensor_type = DataTypeImpl::GetType<Tensor>();
+  ort_value.Init(p_tensor.release(), ml_tensor_type, deleter);
+  return common::Status::OK();
+}
+
 static common::Status DeserializeTensorProto(const Env& env, const std::basic_string<PATH_CHAR_TYPE>& proto_path,
                                              const ONNX_NAMESPACE::TensorProto& tensor_proto, const MemBuffer* m,
                                              const AllocatorPtr& alloc, const AllocatorPtr& default_cpu_alloc,
@@ -128,19 +146,6 @@ static common::Status DeserializeTensorProto(const Env& env, const std::basic_st
 
   if (p_tensor->Location().device.Type() == OrtDevice::CPU) {
     // deserialize directly to CPU tensor
-    if (utils::HasExternalData(tensor_proto)) {
-      // NB: The file containing external data for the tensor is mmap'd. If the tensor will be used on CPU we can
-      // utilize the mmap'd buffer directly by calling ExtDataTensorProtoToTensor. If we called
-      // TensorProtoToTensor it would copy the data, causing unnecessary overhead
-      OrtCallback ext_data_deleter;
-      ORT_RETURN_IF_ERROR(ExtDataTensorProtoToTensor(env, proto_path, tensor_proto, *p_tensor, ext_data_deleter));
-
-      ExtDataValueDeleter deleter{ext_data_deleter, p_tensor.get()};
-
-      MLDataType ml_tensor_type = DataTypeImpl::GetType<Tensor>();
-      ort_value.Init(p_tensor.release(), ml_tensor_type, deleter);
-      return common::Status::OK();
-    }
     ORT_RETURN_IF_ERROR(utils::TensorProtoToTensor(env, proto_path.c_str(), tensor_proto, *p_tensor));
   } else {  // non-cpu tensor
     if (tensor_proto.data_type() == ONNX_NAMESPACE::TensorProto_DataType_STRING) {
@@ -197,7 +202,8 @@ common::Status SaveInitializedTensors(
     const logging::Logger& logger, const DataTransferManager& data_transfer_mgr,
     const ExecutionPlanBase& exec_plan,
     const SessionOptions& session_options,
-    const MemoryProfileFunction& memory_profile_func) {
+    const MemoryProfileFunction& memory_profile_func,
+    PrepackedWeightsContainer* shared_initializers_container) {
   LOGS(logger, INFO) << "Saving initialized tensors.";
   ORT_ENFORCE(ort_value_name_idx_map.MaxIdx() > -1, "OrtValue indexes should have been populated.");
 
@@ -230,6 +236,17 @@ common::Status SaveInitializedTensors(
     return retval;
   };
 
+  // Determine if an initializer is deduplicated against the initializers of other sessions in
+  // shared_initializers_container. These live in memory owned by the container so no memory is planned for them.
+  auto use_shared_initializer =
+      [shared_initializers_container, &exec_plan](int ort_value_index,
+                                                  const ONNX_NAMESPACE::TensorProto& tensor_proto) -> bool {
+    return shared_initializers_container != nullptr &&
+           exec_plan.GetLocation(ort_value_index).Type() == OrtDevice::CPU &&
+           tensor_proto.data_type() != ONNX_NAMESPACE::TensorProto_DataType_STRING &&
+           !utils::HasExternalData(tensor_proto);
+  };
+
   // 1. first plan the memory
   const InitializedTensorSet& initialized_tensor_set = graph.GetAllInitializedTensors();
   InlinedHashMap<int, const ONNX_NAMESPACE::TensorProto*> id_to_initialized_tensor;
@@ -256,7 +273,8 @@ common::Status SaveInitializedTensors(
     const auto entry = initialized_tensors_to_allocate.find(ort_value_index);
     ORT_ENFORCE(entry != initialized_tensors_to_allocate.end(),
                 "OrtValue index: ", ort_value_index, " from initializer_allocation_order not found among initialized tensors");
-    if (!(utils::HasExternalData(*entry->second) && exec_plan.GetLocation(ort_value_index).Type() == OrtDevice::CPU)) {
+    if (!(utils::HasExternalData(*entry->second) && exec_plan.GetLocation(ort_value_index).Type() == OrtDevice::CPU) &&
+        !use_shared_initializer(ort_value_index, *entry->second)) {
       // can not trace string tensor
       ORT_ENFORCE(entry->second->data_type() != ONNX_NAMESPACE::TensorProto_DataType_STRING, "Can not trace string tensor");
       ORT_RETURN_IF_ERROR(planner.Trace(entry->first, entry->second));
@@ -269,6 +287,13 @@ common::Status SaveInitializedTensors(
     if (user_supplied_initializer_ids.find(entry.first) != user_supplied_initializer_ids.end()) {
       continue;
     }
+    // External data used on CPU is mmap'd and used in place, so no memory needs to be planned for it
+    if (utils::HasExternalData(*entry.second) && exec_plan.GetLocation(entry.first).Type() == OrtDevice::CPU) {
+      continue;
+    }
+    if (use_shared_initializer(entry.first, *entry.second)) {
+      continue;
+    }
     if (entry.second->data_type() == ONNX_NAMESPACE::TensorProto_DataType_STRING) {
       // do not trace string tensor
       continue;
@@ -292,6 +317,12 @@ common::Status SaveInitializedTensors(
 
   OrtCallback deleter{nullptr, nullptr};
 
+  AllocatorPtr shared_initializers_alloc;
+  if (shared_initializers_container != nullptr) {
+    std::lock_guard<OrtMutex> l(shared_initializers_container->mutex_);
+    shared_initializers_alloc = shared_initializers_container->GetOrCreateAllocator(CPU);
+  }
+
   // 3. create weight tensors based on weights buffer
   for (const auto& entry : id_to_initialized_tensor) {
     int ort_value_index = entry.first;
@@ -310,16 +341,32 @@ common::Status SaveInitializedTensors(
     } else {
       const ONNX_NAMESPACE::TensorProto& tensor_proto = *(entry.second);
 
-      std::optional<MemBuffer> m;
-      AllocatorPtr alloc;
-      // TODO: if the tensor need be copied, does it have enough room?
-      ORT_RETURN_IF_ERROR(planner.GetPreallocatedBuffer(ort_value_index, name, m, alloc));
-      bool use_device_allocator_for_initializers =
-          session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsUseDeviceAllocatorForInitializers, "0") == "1";
+      Status st;
+      if (utils::HasExternalData(tensor_proto) && exec_plan.GetLocation(ort_value_index).Type() == OrtDevice::CPU) {
+        // NB: The file containing external data for the tensor is mmap'd. If the tensor will be used on CPU we can
+        // utilize the mmap'd buffer directly instead of copying it into a planned or newly allocated buffer.
+        st = ExtDataTensorProtoToCpuOrtValue(env, graph_loc, tensor_proto, ort_value);
+      } else if (use_shared_initializer(ort_value_index, tensor_proto)) {
+        // Deserialize using the container's allocator as the tensor may outlive this session if another session
+        // shares it, and then swap it for the container's copy if one with the same contents exists.
+        st = DeserializeTensorProto(env, graph_loc, tensor_proto, nullptr, shared_initializers_alloc,
+                                    default_cpu_alloc, ort_value, data_transfer_mgr);
+        if (st.IsOK() && shared_initializers_container->GetOrAddInitializer(ort_value)) {
+          LOGS(logger, INFO) << "Using initializer with name (" << name << ") shared with another session.";
+        }
+      } else {
+        std::optional<MemBuffer> m;
+        AllocatorPtr alloc;
+        // TODO: if the tensor need be copied, does it have enough room?
+        ORT_RETURN_IF_ERROR(planner.GetPreallocatedBuffer(ort_value_index, name, m, alloc));
+        bool use_device_allocator_for_initializers =
+            session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsUseDeviceAllocatorForInitializers, "0") == "1";
+
+        st = DeserializeTensorProto(env, graph_loc, tensor_proto, (m.has_value()) ? &*m : nullptr, alloc,
+                                    default_cpu_alloc, ort_value, data_transfer_mgr,
+                                    use_device_allocator_for_initializers);
+      }
 
-      Status st = DeserializeTensorProto(env, graph_loc, tensor_proto, (m.has_value()) ? &*m : nullptr, alloc,
-                                         default_cpu_alloc, ort_value, data_transfer_mgr,
-                                         use_device_allocator_for_initializers);
       if (!st.IsOK()) {
         std::ostringstream oss;
         oss << "Deserialize tensor " << name << " failed." << st.ErrorMessage();
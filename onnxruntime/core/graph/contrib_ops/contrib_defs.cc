@@ -2573,6 +2573,55 @@ ONNX_MS_OPERATOR_SET_SCHEMA(CDist, 1,
                                         "T")
                                 .TypeConstraint("T", {"tensor(float)", "tensor(double)"}, "Constrains input to only numeric types."));
 
+constexpr const char* EmbeddingBag_ver1_doc = R"DOC(
+EmbeddingBag looks up the rows of an embedding table for fixed size bags of indices and pools the rows of each bag,
+which is the same as Gather(table, indices) followed by ReduceSum or ReduceMean over the bag axis.
+The table can be stored as float16, or as int8/uint8 with a scale and an optional zero point per row,
+in which case the rows are dequantized on the fly: row = (table[index] - zero_points[index]) * scales[index].
+Negative indices count back from the end of the table like in Gather.
+Empty bags (bag_size of 0) pool to 0 in sum mode and to NaN in mean mode, like ReduceSum and ReduceMean.
+)DOC";
+
+ONNX_MS_OPERATOR_SET_SCHEMA(EmbeddingBag, 1,
+                            OpSchema()
+                                .SetDoc(EmbeddingBag_ver1_doc)
+                                .Attr("mode", "How the rows of a bag are pooled: 'sum' or 'mean'.",
+                                      AttributeProto::STRING, std::string("sum"))
+                                .Input(0, "table", "2D embedding table with shape (num_rows, embedding_dim)", "T")
+                                .Input(1, "indices", "2D indices with shape (num_bags, bag_size)", "Tind")
+                                .Input(2, "scales",
+                                       "1D scale of each row with shape (num_rows). Required for int8 and uint8 tables.",
+                                       "tensor(float)", OpSchema::Optional)
+                                .Input(3, "zero_points",
+                                       "1D zero point of each row with shape (num_rows). Only for int8 and uint8 tables, "
+                                       "defaults to 0.",
+                                       "T", OpSchema::Optional)
+                                .Output(0, "output", "2D pooled rows with shape (num_bags, embedding_dim)", "tensor(float)")
+                                .TypeConstraint("T", {"tensor(float)", "tensor(float16)", "tensor(int8)", "tensor(uint8)"},
+                                                "Constrain the table to float or row-quantized types.")
+                                .TypeConstraint("Tind", {"tensor(int32)", "tensor(int64)"},
+                                                "Constrain indices to integer types.")
+                                .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+                                  updateOutputElemType(ctx, 0, ONNX_NAMESPACE::TensorProto::FLOAT);
+                                  if (!hasInputShape(ctx, 0) || !hasInputShape(ctx, 1)) {
+                                    return;
+                                  }
+
+                                  const auto& table_shape = getInputShape(ctx, 0);
+                                  const auto& indices_shape = getInputShape(ctx, 1);
+                                  if (table_shape.dim_size() != 2) {
+                                    fail_shape_inference("table must be 2D");
+                                  }
+                                  if (indices_shape.dim_size() != 2) {
+                                    fail_shape_inference("indices must be 2D");
+                                  }
+
+                                  ONNX_NAMESPACE::TensorShapeProto output_shape;
+                                  *output_shape.add_dim() = indices_shape.dim(0);
+                                  *output_shape.add_dim() = table_shape.dim(1);
+                                  updateOutputShape(ctx, 0, output_shape);
+                                }));
+
 ONNX_MS_OPERATOR_SET_SCHEMA(CropAndResize, 1,
                             OpSchema()
                                 .Attr(
@@ -3424,6 +3473,10 @@ Input scales is stored in same type as original type of B(float32, float16) with
 Input zero_points is stored as uint8_t or same as type(A). It has the same packing method as input B.
   - [CeilDiv((N * n_blocks_per_col + 1) *bits, 8)]
   If zero_points has same type as A, it's not packed and has the same shape as Scales.
+
+Inputs lora_a and lora_b are an optional low-rank update of the weight, e.g. from a LoRA adapter.
+If provided, Y = A * B' + (A * lora_a) * lora_b (+ bias), where B' is the dequantized B.
+lora_a has shape [K, rank] and lora_b has shape [rank, N]. A rank of 0 means no update.
 )DOC";
 
   ONNX_CONTRIB_OPERATOR_SCHEMA(MatMulNBits)
@@ -3447,6 +3500,8 @@ Input zero_points is stored as uint8_t or same as type(A). It has the same packi
       .Input(3, "zero_points", "quantization zero points", "T3", OpSchema::Optional)
       .Input(4, "g_idx", "group_idx", "T4", OpSchema::Optional)
       .Input(5, "bias", "Bias to add to result. It should have shape [N].", "T1", OpSchema::Optional)
+      .Input(6, "lora_a", "Low-rank update down projection. It should have shape [K, rank].", "T1", OpSchema::Optional)
+      .Input(7, "lora_b", "Low-rank update up projection. It should have shape [rank, N].", "T1", OpSchema::Optional)
       .Output(0, "Y", "tensor. The output tensor has the same rank as the input. ", "T1")
       .TypeConstraint("T1", {"tensor(float)", "tensor(float16)"}, "Constrain input and output types to float/half_float tensors.")
       .TypeConstraint("T2", {"tensor(uint8)", "tensor(int32)"}, "Constrain quantized weight types to uint8/int32.")
@@ -3475,6 +3530,51 @@ Input zero_points is stored as uint8_t or same as type(A). It has the same packi
         }
       });
 
+  static const char* ConvNBits_ver1_doc = R"DOC(
+ConvNBits is a Conv with weight quantized with N bits. It computes the same result as Conv (https://github.com/onnx/onnx/blob/main/docs/Operators.md#Conv) with differences:
+  1. Input B is the constant weight W of shape [N, C / group, kernel_shape...] reshaped to [N, K] with K = C / group * prod(kernel_shape).
+     It is quantized and stored exactly like input B of MatMulNBits, one column of K values per output channel.
+     The output channel count and K are specified by attribute 'N' and 'K'. Attribute 'kernel_shape' is required.
+  2. Input B's scale and zero point are specified by input scales and zero_points, with the same shapes as for MatMulNBits.
+  3. Input bias is the optional Conv bias of shape [N].
+)DOC";
+
+  ONNX_CONTRIB_OPERATOR_SCHEMA(ConvNBits)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc(ConvNBits_ver1_doc)
+      .Attr("K", "size of each quantized weight column, C / group * prod(kernel_shape)", AttributeProto::INT)
+      .Attr("N", "number of output channels", AttributeProto::INT)
+      .Attr("bits", "number of bits used for weight quantization (default 4)", AttributeProto::INT)
+      .Attr("block_size", "number of groupsize used for weight quantization,(default 128). It needs to be a power of 2 and not smaller than 16.", AttributeProto::INT)
+      .Attr("accuracy_level",
+            "The minimum accuracy level of input X, with the same meaning as the MatMulNBits attribute.",
+            AttributeProto::INT, static_cast<int64_t>(0))
+      .Attr("auto_pad", "", AttributeProto::STRING, std::string("NOTSET"))
+      .Attr("kernel_shape", "", AttributeProto::INTS)
+      .Attr("dilations", "", AttributeProto::INTS, OPTIONAL_VALUE)
+      .Attr("strides", "", AttributeProto::INTS, OPTIONAL_VALUE)
+      .Attr("pads", "", AttributeProto::INTS, OPTIONAL_VALUE)
+      .Attr("group", "", AttributeProto::INT, static_cast<int64_t>(1))
+      .Input(0, "X", "The input tensor, not quantized", "T1")
+      .Input(1, "B", "Quantized weight with shape [N][n_blocks_per_col][blob_size]", "T2")
+      .Input(2, "scales", "quantization scale", "T1")
+      .Input(3, "zero_points", "quantization zero points", "T3", OpSchema::Optional)
+      .Input(4, "bias", "Bias to add to result. It should have shape [N].", "T1", OpSchema::Optional)
+      .Output(0, "Y", "The output tensor", "T1")
+      .TypeConstraint("T1", {"tensor(float)"}, "Constrain input and output types to float tensors.")
+      .TypeConstraint("T2", {"tensor(uint8)"}, "Constrain quantized weight types to uint8.")
+      .TypeConstraint("T3", {"tensor(uint8)"}, "Constrain quantized zero point types to uint8.")
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        propagateElemTypeFromInputToOutput(ctx, 0, 0);
+        // same spatial shape inference as a pooling op, then the channel count comes from attribute N
+        ONNX_NAMESPACE::convPoolShapeInference(ctx, true, true, 0, -1);
+        auto* output_tensor_type = ctx.getOutputType(0)->mutable_tensor_type();
+        if (output_tensor_type->has_shape() && output_tensor_type->shape().dim_size() > 1) {
+          output_tensor_type->mutable_shape()->mutable_dim(1)->set_dim_value(getAttribute(ctx, "N", -1));
+        }
+      });
+
   static const char* MatMulBnb4_ver1_doc = R"DOC(
 MatMulBnb4 is a MatMul with weight quantized with 4 bits using either FP4 or NF4 data type (https://arxiv.org/pdf/2305.14314.pdf). It does Matrix Multiplication like MatMul (https://github.com/onnx/onnx/blob/main/docs/Operators.md#matmul) with differences:
   1. Input B is a 2D constant Matrix. Its input feature count and output feature count are specified by attribute 'K' and 'N'.
@@ -598,6 +598,71 @@ ONNX_MS_OPERATOR_SET_SCHEMA(
         .TypeConstraint("T", {"tensor(uint8)", "tensor(int8)"}, "Constrain input and output types to 8 bit tensors.")
         .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput));
 
+const char* QLinearGeluDoc_ver1 = R"DOC(
+QLinearGelu takes quantized input data (Tensor), and quantize parameter for output, and produces one output data
+(Tensor<T>) where the function `f(x) = quantize(Gelu(dequantize(x)))`, is applied to the data tensor elementwise.
+Where the function `Gelu(x) = 0.5 * x * (1 + erf(x / sqrt(2)))`, or its tanh approximation when the attribute
+approximate is "tanh". )DOC";
+
+ONNX_MS_OPERATOR_SET_SCHEMA(
+    QLinearGelu, 1,
+    OpSchema()
+        .SetDoc(QLinearGeluDoc_ver1)
+        .Attr("approximate", "Gelu approximation algorithm: \"tanh\" or \"none\" (the exact erf form).",
+              AttributeProto::STRING, std::string("none"))
+        .Input(0, "X", "Input tensor", "T")
+        .Input(1, "X_scale", "Input X's scale. It's a scalar, which means a per-tensor/layer quantization.",
+               "tensor(float)")
+        .Input(2, "X_zero_point",
+               "Input X's zero point. Default value is 0 if it's not specified. It's a scalar, which means a "
+               "per-tensor/layer quantization.",
+               "T", OpSchema::Optional)
+        .Input(3, "Y_scale", "Output Y's scale. It's a scalar, which means a per-tensor/layer quantization.",
+               "tensor(float)")
+        .Input(4, "Y_zero_point",
+               "Output Y's zero point. Default value is 0 if it's not specified. It's a scalar, which means a "
+               "per-tensor/layer quantization.",
+               "T", OpSchema::Optional)
+        .Output(0, "Y", "Output tensor", "T")
+        .TypeConstraint("T", {"tensor(uint8)", "tensor(int8)"}, "Constrain input and output types to 8 bit tensors.")
+        .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput));
+
+const char* QLinearLayerNormalizationDoc_ver1 = R"DOC(
+QLinearLayerNormalization takes quantized input data (Tensor), float Scale and B tensors, and quantize parameter for
+output, and produces one output data (Tensor<T>) where `Y = quantize(LayerNormalization(dequantize(X), Scale, B))`.
+The normalization is computed in float over the dimensions axis : rank(X), without materializing the dequantized
+input tensor.
+)DOC";
+
+ONNX_MS_OPERATOR_SET_SCHEMA(
+    QLinearLayerNormalization, 1,
+    OpSchema()
+        .SetDoc(QLinearLayerNormalizationDoc_ver1)
+        .Attr("axis",
+              "The first normalization dimension: normalization will be performed along dimensions axis : rank(X).",
+              AttributeProto::INT, static_cast<int64_t>(-1))
+        .Attr("epsilon", "The epsilon value to use to avoid division by zero.", AttributeProto::FLOAT, 1e-5f)
+        .Attr("stash_type", "Unused. The statistics are always computed in float.", AttributeProto::INT,
+              static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_FLOAT))
+        .Input(0, "X", "Input tensor", "T")
+        .Input(1, "X_scale", "Input X's scale. It's a scalar, which means a per-tensor/layer quantization.",
+               "tensor(float)")
+        .Input(2, "X_zero_point",
+               "Input X's zero point. Default value is 0 if it's not specified. It's a scalar, which means a "
+               "per-tensor/layer quantization.",
+               "T", OpSchema::Optional)
+        .Input(3, "Scale", "Scale tensor with the shape of X.shape()[axis:].", "tensor(float)")
+        .Input(4, "Y_scale", "Output Y's scale. It's a scalar, which means a per-tensor/layer quantization.",
+               "tensor(float)")
+        .Input(5, "Y_zero_point",
+               "Output Y's zero point. Default value is 0 if it's not specified. It's a scalar, which means a "
+               "per-tensor/layer quantization.",
+               "T", OpSchema::Optional)
+        .Input(6, "B", "Bias tensor with the shape of X.shape()[axis:].", "tensor(float)", OpSchema::Optional)
+        .Output(0, "Y", "Output tensor", "T")
+        .TypeConstraint("T", {"tensor(uint8)", "tensor(int8)"}, "Constrain input and output types to 8 bit tensors.")
+        .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput));
+
 ONNX_MS_OPERATOR_SET_SCHEMA(
     QLinearSoftmax, 1,
     OpSchema()
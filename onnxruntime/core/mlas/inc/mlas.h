@@ -241,6 +241,35 @@ MlasGemmBatch(
     MLAS_THREADPOOL* ThreadPool
     );
 
+/**
+ * @brief  Grouped single precision matrix/matrix multiply operation (SGEMM)
+ *         where every group has its own number of rows
+ *
+ * @param TransA      Supplies the transpose operation for matrix A.
+ * @param TransB      Supplies the transpose operation for matrix B.
+ * @param M           Supplies the number of rows of matrix A and matrix C of
+                      every group, groups may have zero rows.
+ * @param N           Supplies the number of columns of matrix B and matrix C.
+ * @param K           Supplies the number of columns of matrix A and the number
+                      of rows of matrix B.
+ * @param Data        A array of matrices data parameters, one per group
+ * @param GroupCount  Supplies number of groups
+ * @param ThreadPool  Supplies the thread pool object to use, else nullptr if the
+                      base library threading support should be used.
+ */
+void
+MLASCALL
+MlasGemmGroupedBatch(
+    CBLAS_TRANSPOSE TransA,
+    CBLAS_TRANSPOSE TransB,
+    const size_t* M,
+    size_t N,
+    size_t K,
+    const MLAS_SGEMM_DATA_PARAMS* Data,
+    size_t GroupCount,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 /**
  * @brief  Single precision matrix/matrix multiply operation (SGEMM)
  *
@@ -746,6 +775,83 @@ MlasSymmQgemmPackB(
     void* PackedB
     );
 
+//
+// Block sparse SGEMM routines. Matrix B is stored as the non-zero 1x16 blocks
+// of its rows, so the cost of the multiplication scales with the fraction of
+// blocks that are not pruned.
+//
+
+/**
+ * @brief Returns the size of the buffer that MlasSparseGemmPackB needs for
+ *        matrix B, 0 if the matrix cannot be packed. This is the size of the
+ *        packed matrix when none of its blocks are all zero.
+*/
+size_t
+MLASCALL
+MlasSparseGemmPackBSize(
+    size_t N,
+    size_t K
+    );
+
+/**
+ * @brief Packs the non-zero 1x16 blocks of matrix B in a single pass
+ * @param TransB   Supplies the transpose operation for matrix B
+ * @param N        Number of columns of matrix B
+ * @param K        Number of rows of matrix B
+ * @param B        Address of matrix B
+ * @param ldb      First dimension of matrix B
+ * @param PackedB  Address of the packing buffer of MlasSparseGemmPackBSize bytes
+ * @return The number of bytes at the start of PackedB that hold the packed
+ *         matrix, which may be copied to a buffer of that size
+*/
+size_t
+MLASCALL
+MlasSparseGemmPackB(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb,
+    void* PackedB
+    );
+
+/**
+ * @brief Returns the fraction of the 1x16 blocks of a matrix B packed by
+ *        MlasSparseGemmPackB that are all zero
+*/
+float
+MLASCALL
+MlasSparseGemmPackedBBlockSparsity(
+    const void* PackedB
+    );
+
+/**
+ * @brief Batched single precision matrix/matrix multiply operation with a
+ *        block sparse matrix B packed by MlasSparseGemmPackB
+ *
+ * @param TransA      Supplies the transpose operation for matrix A.
+ * @param M           Supplies the number of rows of matrix A and matrix C.
+ * @param N           Supplies the number of columns of matrix B and matrix C.
+ * @param K           Supplies the number of columns of matrix A and the number
+                      of rows of matrix B.
+ * @param Data        A array of matrices data parameters, B is the packed buffer
+                      and BIsPacked and ldb are ignored
+ * @param BatchSize   Supplies number of multiplications in this batch
+ * @param ThreadPool  Supplies the thread pool object to use, else nullptr if the
+                      base library threading support should be used.
+ */
+void
+MLASCALL
+MlasSparseGemmBatch(
+    CBLAS_TRANSPOSE TransA,
+    size_t M,
+    size_t N,
+    size_t K,
+    const MLAS_SGEMM_DATA_PARAMS* Data,
+    size_t BatchSize,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Convolution routines.
 //
@@ -1024,6 +1130,59 @@ MlasComputeTanh(
     size_t N
     );
 
+//
+// Recurrent network routines.
+//
+
+void
+MLASCALL
+MlasLstmGates(
+    const float* Gates,
+    const float* Bias,
+    float* CellState,
+    float* HiddenState,
+    float Clip,
+    size_t HiddenSize
+    );
+
+//
+// Layer normalization routines.
+//
+
+template <typename T>
+struct MLAS_LAYER_NORM_PARAMS {
+    const T* Skip = nullptr;          /**< optional residual added to the input, SkipRows x D broadcast over the rows */
+    size_t SkipRows = 0;
+    const T* SkipBias = nullptr;      /**< optional D elements added together with the skip */
+    T* SumOutput = nullptr;           /**< optional N x D sum of the input, skip and skip bias */
+    const T* Scale = nullptr;         /**< gamma, D elements */
+    const T* Bias = nullptr;          /**< optional beta, D elements, unused by the simplified normalization */
+    float* Mean = nullptr;            /**< optional N row means, not computed by the simplified normalization */
+    float* InvStdDev = nullptr;       /**< optional N inverse standard deviations (or root mean squares) */
+    float Epsilon = 0.0f;
+    bool Simplified = false;          /**< RMS normalization, the mean is not subtracted */
+    float OutputScale = 1.0f;         /**< quantization parameters for int8_t and uint8_t outputs */
+    int32_t OutputZeroPoint = 0;
+};
+
+/**
+ * @brief Layer normalization (or RMS normalization) of N rows of D elements in a
+ *        single pass over the data of each row. InputType is float or MLAS_FP16.
+ *        OutputType is InputType, or int8_t/uint8_t to quantize the normalized
+ *        values with Params.OutputScale and Params.OutputZeroPoint.
+ */
+template <typename InputType, typename OutputType>
+void
+MLASCALL
+MlasLayerNormalization(
+    const InputType* Input,
+    OutputType* Output,
+    size_t N,
+    size_t D,
+    const MLAS_LAYER_NORM_PARAMS<InputType>& Params,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Half-precision floating-point routines.
 //
@@ -1037,6 +1196,65 @@ MlasConvertHalfToFloatBuffer(
     size_t Count
     );
 
+extern "C"
+void
+MLASCALL
+MlasConvertFloatToHalfBuffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    );
+
+//
+// Brain floating-point routines.
+//
+// Conversions to bfloat16 round to nearest even, keep denormals and turn NaNs
+// into quiet NaNs of the same sign.
+//
+
+extern "C"
+void
+MLASCALL
+MlasConvertBFloat16ToFloatBuffer(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    );
+
+extern "C"
+void
+MLASCALL
+MlasConvertFloatToBFloat16Buffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    );
+
+//
+// Integer conversion routines.
+//
+// Conversions to int32 truncate toward zero. The result for NaN and for values
+// outside the range of int32 is unspecified.
+//
+
+extern "C"
+void
+MLASCALL
+MlasConvertInt32ToFloatBuffer(
+    const int32_t* Source,
+    float* Destination,
+    size_t Count
+    );
+
+extern "C"
+void
+MLASCALL
+MlasConvertFloatToInt32Buffer(
+    const float* Source,
+    int32_t* Destination,
+    size_t Count
+    );
+
 //
 // Transpose routines.
 //
@@ -1222,6 +1440,27 @@ MlasQuantizeLinear(
     OutputType ZeroPoint
     );
 
+/**
+ * @brief Dequantize a buffer: Output = (Input - ZeroPoint) * Scale
+ *
+ * @tparam InputType    int8_t, uint8_t, int16_t, uint16_t or int32_t
+ * @param Input         Quantized input buffer
+ * @param Output        Float output buffer
+ * @param N             Number of elements
+ * @param Scale         Quantization scale
+ * @param ZeroPoint     Quantization zero point value
+ */
+template<typename InputType>
+void
+MLASCALL
+MlasDequantizeLinear(
+    const InputType* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    InputType ZeroPoint
+    );
+
 /**
  * @brief Requantize a block of the intermediate buffer to the output buffer,
  *        optionally adding the supplied bias
@@ -0,0 +1,441 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    cast.cpp
+
+Abstract:
+
+    This module implements routines to convert buffers between the half,
+    brain and single precision floating point formats, and between single
+    precision floats and 32-bit integers.
+
+--*/
+
+#include "mlasi.h"
+#include "mlas_float16.h"
+
+void
+MLASCALL
+MlasCastF16ToF32Kernel(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of half precision floats to the
+    destination buffer of single precision floats.
+
+Arguments:
+
+    Source - Supplies the address of the source buffer.
+
+    Destination - Supplies the address of the destination buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_F16VEC_INTRINSICS_SUPPORTED) && defined(MLAS_TARGET_ARM64)
+
+    while (Count >= 8) {
+
+        float16x8_t Vector = vreinterpretq_f16_u16(vld1q_u16(Source));
+
+        vst1q_f32(Destination, vcvt_f32_f16(vget_low_f16(Vector)));
+        vst1q_f32(Destination + 4, vcvt_f32_f16(vget_high_f16(Vector)));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+#endif
+
+    for (size_t n = 0; n < Count; n++) {
+        Destination[n] = MLAS_Half2Float(Source[n]);
+    }
+}
+
+void
+MLASCALL
+MlasCastF32ToF16Kernel(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of single precision floats to the
+    destination buffer of half precision floats, rounding to nearest even.
+
+Arguments:
+
+    Source - Supplies the address of the source buffer.
+
+    Destination - Supplies the address of the destination buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_F16VEC_INTRINSICS_SUPPORTED) && defined(MLAS_TARGET_ARM64)
+
+    while (Count >= 8) {
+
+        float16x4_t Low = vcvt_f16_f32(vld1q_f32(Source));
+        float16x4_t High = vcvt_f16_f32(vld1q_f32(Source + 4));
+
+        vst1q_u16(Destination, vreinterpretq_u16_f16(vcombine_f16(Low, High)));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+#endif
+
+    for (size_t n = 0; n < Count; n++) {
+        Destination[n] = MLAS_Float2Half(Source[n]);
+    }
+}
+
+void
+MLASCALL
+MlasConvertHalfToFloatBuffer(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+{
+#if defined(MLAS_TARGET_AMD64)
+    GetMlasPlatform().CastF16ToF32Kernel(Source, Destination, Count);
+#else
+    MlasCastF16ToF32Kernel(Source, Destination, Count);
+#endif
+}
+
+void
+MLASCALL
+MlasConvertFloatToHalfBuffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+{
+#if defined(MLAS_TARGET_AMD64)
+    GetMlasPlatform().CastF32ToF16Kernel(Source, Destination, Count);
+#else
+    MlasCastF32ToF16Kernel(Source, Destination, Count);
+#endif
+}
+
+MLAS_FORCEINLINE
+unsigned short
+MlasFloatToBFloat16(
+    float Value
+    )
+/*++
+
+Routine Description:
+
+    This routine converts a single precision float to a brain float by
+    rounding the upper half of its bits to nearest even. NaNs are quieted and
+    keep their sign.
+
+--*/
+{
+    uint32_t Bits;
+    std::memcpy(&Bits, &Value, sizeof(Bits));
+
+    if ((Bits & 0x7FFFFFFF) > 0x7F800000) {
+        return static_cast<unsigned short>((Bits >> 16) | 0x0040);
+    }
+
+    return static_cast<unsigned short>((Bits + 0x7FFF + ((Bits >> 16) & 1)) >> 16);
+}
+
+void
+MLASCALL
+MlasCastF32ToBF16Kernel(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of single precision floats to the
+    destination buffer of brain floats, rounding to nearest even.
+
+Arguments:
+
+    Source - Supplies the address of the source buffer.
+
+    Destination - Supplies the address of the destination buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_SSE2_INTRINSICS)
+
+    const __m128i RoundingBias = _mm_set1_epi32(0x7FFF);
+    const __m128i One = _mm_set1_epi32(1);
+    const __m128i AbsMask = _mm_set1_epi32(0x7FFFFFFF);
+    const __m128i Infinity = _mm_set1_epi32(0x7F800000);
+    const __m128i QuietBit = _mm_set1_epi32(0x00400000);
+
+    auto RoundToBFloat16 = [&](__m128i Bits) {
+        __m128i Lsb = _mm_and_si128(_mm_srli_epi32(Bits, 16), One);
+        __m128i Rounded = _mm_add_epi32(Bits, _mm_add_epi32(RoundingBias, Lsb));
+        __m128i IsNan = _mm_cmpgt_epi32(_mm_and_si128(Bits, AbsMask), Infinity);
+        __m128i Quiet = _mm_or_si128(Bits, QuietBit);
+        // The arithmetic shift keeps the upper half within the int16 range so
+        // that the saturating pack below is exact.
+        return _mm_srai_epi32(MlasBlendInt32x4(Rounded, Quiet, IsNan), 16);
+    };
+
+    while (Count >= 8) {
+
+        __m128i Low = RoundToBFloat16(_mm_castps_si128(_mm_loadu_ps(Source)));
+        __m128i High = RoundToBFloat16(_mm_castps_si128(_mm_loadu_ps(Source + 4)));
+
+        _mm_storeu_si128((__m128i*)Destination, _mm_packs_epi32(Low, High));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+#elif defined(MLAS_NEON_INTRINSICS)
+
+    const uint32x4_t RoundingBias = vdupq_n_u32(0x7FFF);
+    const uint32x4_t One = vdupq_n_u32(1);
+    const uint32x4_t AbsMask = vdupq_n_u32(0x7FFFFFFF);
+    const uint32x4_t Infinity = vdupq_n_u32(0x7F800000);
+    const uint32x4_t QuietBit = vdupq_n_u32(0x00400000);
+
+    auto RoundToBFloat16 = [&](uint32x4_t Bits) {
+        uint32x4_t Lsb = vandq_u32(vshrq_n_u32(Bits, 16), One);
+        uint32x4_t Rounded = vaddq_u32(Bits, vaddq_u32(RoundingBias, Lsb));
+        uint32x4_t IsNan = vcgtq_u32(vandq_u32(Bits, AbsMask), Infinity);
+        uint32x4_t Quiet = vorrq_u32(Bits, QuietBit);
+        return vshrn_n_u32(vbslq_u32(IsNan, Quiet, Rounded), 16);
+    };
+
+    while (Count >= 8) {
+
+        uint16x4_t Low = RoundToBFloat16(vreinterpretq_u32_f32(vld1q_f32(Source)));
+        uint16x4_t High = RoundToBFloat16(vreinterpretq_u32_f32(vld1q_f32(Source + 4)));
+
+        vst1q_u16(Destination, vcombine_u16(Low, High));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+#endif
+
+    for (size_t n = 0; n < Count; n++) {
+        Destination[n] = MlasFloatToBFloat16(Source[n]);
+    }
+}
+
+void
+MLASCALL
+MlasConvertBFloat16ToFloatBuffer(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of brain floats to the
+    destination buffer of single precision floats. The conversion is exact:
+    a brain float is the upper half of the bits of a single precision float.
+
+Arguments:
+
+    Source - Supplies the address of the source buffer.
+
+    Destination - Supplies the address of the destination buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_SSE2_INTRINSICS)
+
+    const __m128i Zero = _mm_setzero_si128();
+
+    while (Count >= 8) {
+
+        __m128i Vector = _mm_loadu_si128((const __m128i*)Source);
+
+        _mm_storeu_si128((__m128i*)Destination, _mm_unpacklo_epi16(Zero, Vector));
+        _mm_storeu_si128((__m128i*)(Destination + 4), _mm_unpackhi_epi16(Zero, Vector));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+#elif defined(MLAS_NEON_INTRINSICS)
+
+    while (Count >= 8) {
+
+        uint16x8_t Vector = vld1q_u16(Source);
+
+        vst1q_u32(reinterpret_cast<uint32_t*>(Destination), vshll_n_u16(vget_low_u16(Vector), 16));
+        vst1q_u32(reinterpret_cast<uint32_t*>(Destination + 4), vshll_n_u16(vget_high_u16(Vector), 16));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+#endif
+
+    for (size_t n = 0; n < Count; n++) {
+        uint32_t Bits = uint32_t(Source[n]) << 16;
+        std::memcpy(&Destination[n], &Bits, sizeof(Bits));
+    }
+}
+
+void
+MLASCALL
+MlasConvertFloatToBFloat16Buffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+{
+#if defined(MLAS_TARGET_AMD64)
+    GetMlasPlatform().CastF32ToBF16Kernel(Source, Destination, Count);
+#else
+    MlasCastF32ToBF16Kernel(Source, Destination, Count);
+#endif
+}
+
+void
+MLASCALL
+MlasConvertInt32ToFloatBuffer(
+    const int32_t* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of 32-bit integers to the
+    destination buffer of single precision floats, rounding to nearest even.
+
+Arguments:
+
+    Source - Supplies the address of the source buffer.
+
+    Destination - Supplies the address of the destination buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (Count >= 8) {
+
+        MLAS_FLOAT32X4 Low = MlasCastToFloat32x4(MlasLoadInt32x4(Source));
+        MLAS_FLOAT32X4 High = MlasCastToFloat32x4(MlasLoadInt32x4(Source + 4));
+
+        MlasStoreFloat32x4(Destination, Low);
+        MlasStoreFloat32x4(Destination + 4, High);
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+    for (size_t n = 0; n < Count; n++) {
+        Destination[n] = static_cast<float>(Source[n]);
+    }
+}
+
+void
+MLASCALL
+MlasConvertFloatToInt32Buffer(
+    const float* Source,
+    int32_t* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of single precision floats to the
+    destination buffer of 32-bit integers, truncating toward zero. The result
+    for NaN and for values outside the range of int32 is unspecified.
+
+Arguments:
+
+    Source - Supplies the address of the source buffer.
+
+    Destination - Supplies the address of the destination buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (Count >= 8) {
+
+        MLAS_INT32X4 Low = MlasCastToInt32x4(MlasLoadFloat32x4(Source));
+        MLAS_INT32X4 High = MlasCastToInt32x4(MlasLoadFloat32x4(Source + 4));
+
+        MlasStoreInt32x4(Destination, Low);
+        MlasStoreInt32x4(Destination + 4, High);
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+    for (size_t n = 0; n < Count; n++) {
+        Destination[n] = static_cast<int32_t>(Source[n]);
+    }
+}
@@ -0,0 +1,104 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    cvtfp16_avx2.cpp
+
+Abstract:
+
+    This module implements routines to convert between the half and single
+    precision floating point formats using the F16C instructions.
+
+--*/
+
+#include "../../mlasi.h"
+
+void
+MLASCALL
+MlasCastF16ToF32KernelAvx2(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+{
+    while (Count >= 16) {
+
+        __m128i Half0 = _mm_loadu_si128((const __m128i*)Source);
+        __m128i Half1 = _mm_loadu_si128((const __m128i*)(Source + 8));
+
+        _mm256_storeu_ps(Destination, _mm256_cvtph_ps(Half0));
+        _mm256_storeu_ps(Destination + 8, _mm256_cvtph_ps(Half1));
+
+        Source += 16;
+        Destination += 16;
+        Count -= 16;
+    }
+
+    if (Count >= 8) {
+
+        _mm256_storeu_ps(Destination, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)Source)));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+    if (Count > 0) {
+
+        //
+        // Convert the remaining elements through a zero padded buffer.
+        //
+
+        MLAS_DECLSPEC_ALIGN(unsigned short HalfBuffer[8], 16) = {};
+        MLAS_DECLSPEC_ALIGN(float FloatBuffer[8], 32);
+
+        std::copy_n(Source, Count, HalfBuffer);
+        _mm256_store_ps(FloatBuffer, _mm256_cvtph_ps(_mm_load_si128((const __m128i*)HalfBuffer)));
+        std::copy_n(FloatBuffer, Count, Destination);
+    }
+}
+
+void
+MLASCALL
+MlasCastF32ToF16KernelAvx2(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+{
+    while (Count >= 16) {
+
+        __m128i Half0 = _mm256_cvtps_ph(_mm256_loadu_ps(Source), _MM_FROUND_TO_NEAREST_INT);
+        __m128i Half1 = _mm256_cvtps_ph(_mm256_loadu_ps(Source + 8), _MM_FROUND_TO_NEAREST_INT);
+
+        _mm_storeu_si128((__m128i*)Destination, Half0);
+        _mm_storeu_si128((__m128i*)(Destination + 8), Half1);
+
+        Source += 16;
+        Destination += 16;
+        Count -= 16;
+    }
+
+    if (Count >= 8) {
+
+        _mm_storeu_si128((__m128i*)Destination, _mm256_cvtps_ph(_mm256_loadu_ps(Source), _MM_FROUND_TO_NEAREST_INT));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+    if (Count > 0) {
+
+        MLAS_DECLSPEC_ALIGN(float FloatBuffer[8], 32) = {};
+        MLAS_DECLSPEC_ALIGN(unsigned short HalfBuffer[8], 16);
+
+        std::copy_n(Source, Count, FloatBuffer);
+        _mm_store_si128((__m128i*)HalfBuffer, _mm256_cvtps_ph(_mm256_load_ps(FloatBuffer), _MM_FROUND_TO_NEAREST_INT));
+        std::copy_n(HalfBuffer, Count, Destination);
+    }
+}
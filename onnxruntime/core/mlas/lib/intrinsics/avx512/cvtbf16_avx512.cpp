@@ -0,0 +1,78 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    cvtbf16_avx512.cpp
+
+Abstract:
+
+    This module implements routines to convert single precision floats to
+    brain floats using the AVX512_BF16 instructions.
+
+--*/
+
+#include "../../mlasi.h"
+
+void
+MLASCALL
+MlasCastF32ToBF16KernelAvx512BF16(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of single precision floats to the
+    destination buffer of brain floats, rounding to nearest even.
+
+    VCVTNEPS2BF16 treats denormal inputs as zero. A block of elements that
+    contains a denormal is converted by the portable kernel instead, so the
+    results match on every platform.
+
+Arguments:
+
+    Source - Supplies the address of the source buffer.
+
+    Destination - Supplies the address of the destination buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const __m512i ExponentMask = _mm512_set1_epi32(0x7F800000);
+    const __m512i MantissaMask = _mm512_set1_epi32(0x007FFFFF);
+
+    while (Count >= 16) {
+
+        __m512 Vector = _mm512_loadu_ps(Source);
+        __m512i Bits = _mm512_castps_si512(Vector);
+
+        __mmask16 DenormalMask = _mm512_mask_test_epi32_mask(_mm512_testn_epi32_mask(Bits, ExponentMask),
+                                                             Bits, MantissaMask);
+
+        if (DenormalMask == 0) {
+            __m256bh BFloat16 = _mm512_cvtneps_pbh(Vector);
+            std::memcpy(Destination, &BFloat16, sizeof(BFloat16));
+        } else {
+            MlasCastF32ToBF16Kernel(Source, Destination, 16);
+        }
+
+        Source += 16;
+        Destination += 16;
+        Count -= 16;
+    }
+
+    if (Count > 0) {
+        MlasCastF32ToBF16Kernel(Source, Destination, Count);
+    }
+}
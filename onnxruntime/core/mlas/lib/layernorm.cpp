@@ -0,0 +1,549 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    layernorm.cpp
+
+Abstract:
+
+    This module implements routines to compute layer normalization and RMS
+    normalization, optionally after adding a residual (skip) input.
+
+    The mean and variance of a row are computed in a single pass with Welford's
+    algorithm: every vector lane updates its own running mean and sum of squared
+    deviations, and the lanes are merged with Chan's pairwise formula. Half
+    precision rows are converted in a row sized buffer that stays in the cache,
+    and quantized outputs are produced from that buffer without a float copy of
+    the whole tensor.
+
+--*/
+
+#include "mlasi.h"
+
+#include <memory>
+
+namespace {
+
+constexpr size_t LayerNormVectorWidth = 4;
+
+struct MLAS_LAYER_NORM_STATISTICS {
+    float Mean;
+    float InvStdDev;
+};
+
+//
+// Merges the running mean and sum of squared deviations of two sets of values.
+//
+
+MLAS_FORCEINLINE
+void
+MlasLayerNormMergeWelford(
+    float& Mean,
+    float& M2,
+    size_t& Count,
+    float OtherMean,
+    float OtherM2,
+    size_t OtherCount
+    )
+{
+    if (OtherCount == 0) {
+        return;
+    }
+
+    const size_t TotalCount = Count + OtherCount;
+    const float Delta = OtherMean - Mean;
+    const float OtherWeight = float(OtherCount) / float(TotalCount);
+
+    Mean += Delta * OtherWeight;
+    M2 += OtherM2 + Delta * Delta * float(Count) * OtherWeight;
+    Count = TotalCount;
+}
+
+MLAS_LAYER_NORM_STATISTICS
+MlasLayerNormComputeStatistics(
+    const float* Row,
+    size_t D,
+    float Epsilon
+    )
+{
+    MLAS_FLOAT32X4 MeanVector0 = MlasZeroFloat32x4();
+    MLAS_FLOAT32X4 MeanVector1 = MlasZeroFloat32x4();
+    MLAS_FLOAT32X4 M2Vector0 = MlasZeroFloat32x4();
+    MLAS_FLOAT32X4 M2Vector1 = MlasZeroFloat32x4();
+
+    size_t LaneCount = 0;
+    size_t d = 0;
+
+    //
+    // Two independent sets of lanes hide the latency of the dependent updates.
+    //
+
+    for (; d + 2 * LayerNormVectorWidth <= D; d += 2 * LayerNormVectorWidth) {
+
+        LaneCount++;
+        MLAS_FLOAT32X4 InverseCount = MlasBroadcastFloat32x4(1.0f / float(LaneCount));
+
+        MLAS_FLOAT32X4 Value0 = MlasLoadFloat32x4(Row + d);
+        MLAS_FLOAT32X4 Value1 = MlasLoadFloat32x4(Row + d + LayerNormVectorWidth);
+
+        MLAS_FLOAT32X4 Delta0 = MlasSubtractFloat32x4(Value0, MeanVector0);
+        MLAS_FLOAT32X4 Delta1 = MlasSubtractFloat32x4(Value1, MeanVector1);
+
+        MeanVector0 = MlasMultiplyAddFloat32x4(Delta0, InverseCount, MeanVector0);
+        MeanVector1 = MlasMultiplyAddFloat32x4(Delta1, InverseCount, MeanVector1);
+
+        M2Vector0 = MlasMultiplyAddFloat32x4(Delta0, MlasSubtractFloat32x4(Value0, MeanVector0), M2Vector0);
+        M2Vector1 = MlasMultiplyAddFloat32x4(Delta1, MlasSubtractFloat32x4(Value1, MeanVector1), M2Vector1);
+    }
+
+    float Mean = 0.0f;
+    float M2 = 0.0f;
+    size_t Count = 0;
+
+    if (LaneCount > 0) {
+
+        float LaneMean[2 * LayerNormVectorWidth];
+        float LaneM2[2 * LayerNormVectorWidth];
+
+        MlasStoreFloat32x4(LaneMean, MeanVector0);
+        MlasStoreFloat32x4(LaneMean + LayerNormVectorWidth, MeanVector1);
+        MlasStoreFloat32x4(LaneM2, M2Vector0);
+        MlasStoreFloat32x4(LaneM2 + LayerNormVectorWidth, M2Vector1);
+
+        //
+        // All lanes have seen the same number of values, so the merged mean is
+        // the average of the lane means.
+        //
+
+        for (size_t lane = 0; lane < 2 * LayerNormVectorWidth; lane++) {
+            Mean += LaneMean[lane];
+        }
+        Mean /= float(2 * LayerNormVectorWidth);
+
+        for (size_t lane = 0; lane < 2 * LayerNormVectorWidth; lane++) {
+            const float Delta = LaneMean[lane] - Mean;
+            M2 += LaneM2[lane] + float(LaneCount) * Delta * Delta;
+        }
+
+        Count = 2 * LayerNormVectorWidth * LaneCount;
+    }
+
+    //
+    // Accumulate the remaining values of the row.
+    //
+
+    float TailMean = 0.0f;
+    float TailM2 = 0.0f;
+    size_t TailCount = 0;
+
+    for (; d < D; d++) {
+        TailCount++;
+        const float Delta = Row[d] - TailMean;
+        TailMean += Delta / float(TailCount);
+        TailM2 += Delta * (Row[d] - TailMean);
+    }
+
+    MlasLayerNormMergeWelford(Mean, M2, Count, TailMean, TailM2, TailCount);
+
+    const float Variance = std::max(M2 / float(D), 0.0f);
+
+    return {Mean, 1.0f / std::sqrt(Variance + Epsilon)};
+}
+
+MLAS_LAYER_NORM_STATISTICS
+MlasRmsNormComputeStatistics(
+    const float* Row,
+    size_t D,
+    float Epsilon
+    )
+{
+    MLAS_FLOAT32X4 SumSquares0 = MlasZeroFloat32x4();
+    MLAS_FLOAT32X4 SumSquares1 = MlasZeroFloat32x4();
+
+    size_t d = 0;
+
+    for (; d + 2 * LayerNormVectorWidth <= D; d += 2 * LayerNormVectorWidth) {
+        MLAS_FLOAT32X4 Value0 = MlasLoadFloat32x4(Row + d);
+        MLAS_FLOAT32X4 Value1 = MlasLoadFloat32x4(Row + d + LayerNormVectorWidth);
+        SumSquares0 = MlasMultiplyAddFloat32x4(Value0, Value0, SumSquares0);
+        SumSquares1 = MlasMultiplyAddFloat32x4(Value1, Value1, SumSquares1);
+    }
+
+    float SumSquares = MlasReduceAddFloat32x4(MlasAddFloat32x4(SumSquares0, SumSquares1));
+
+    for (; d < D; d++) {
+        SumSquares += Row[d] * Row[d];
+    }
+
+    return {0.0f, 1.0f / std::sqrt(SumSquares / float(D) + Epsilon)};
+}
+
+//
+// Computes Output = (Row - Mean) * InvStdDev * Scale [+ Bias]. Output may alias Row.
+//
+
+void
+MlasLayerNormNormalizeRow(
+    const float* Row,
+    float* Output,
+    size_t D,
+    MLAS_LAYER_NORM_STATISTICS Statistics,
+    const float* Scale,
+    const float* Bias
+    )
+{
+    MLAS_FLOAT32X4 MeanVector = MlasBroadcastFloat32x4(Statistics.Mean);
+    MLAS_FLOAT32X4 InvStdDevVector = MlasBroadcastFloat32x4(Statistics.InvStdDev);
+
+    size_t d = 0;
+
+    for (; d + LayerNormVectorWidth <= D; d += LayerNormVectorWidth) {
+        MLAS_FLOAT32X4 Value = MlasLoadFloat32x4(Row + d);
+        Value = MlasMultiplyFloat32x4(MlasSubtractFloat32x4(Value, MeanVector), InvStdDevVector);
+        if (Bias != nullptr) {
+            Value = MlasMultiplyAddFloat32x4(Value, MlasLoadFloat32x4(Scale + d), MlasLoadFloat32x4(Bias + d));
+        } else {
+            Value = MlasMultiplyFloat32x4(Value, MlasLoadFloat32x4(Scale + d));
+        }
+        MlasStoreFloat32x4(Output + d, Value);
+    }
+
+    for (; d < D; d++) {
+        float Value = (Row[d] - Statistics.Mean) * Statistics.InvStdDev * Scale[d];
+        if (Bias != nullptr) {
+            Value += Bias[d];
+        }
+        Output[d] = Value;
+    }
+}
+
+MLAS_FORCEINLINE
+void
+MlasLayerNormLoadRow(
+    const float* Source,
+    float* Destination,
+    size_t D
+    )
+{
+    std::copy_n(Source, D, Destination);
+}
+
+MLAS_FORCEINLINE
+void
+MlasLayerNormLoadRow(
+    const MLAS_FP16* Source,
+    float* Destination,
+    size_t D
+    )
+{
+    MlasConvertHalfToFloatBuffer(reinterpret_cast<const unsigned short*>(Source), Destination, D);
+}
+
+MLAS_FORCEINLINE
+void
+MlasLayerNormStoreRow(
+    const float* Source,
+    float* Destination,
+    size_t D,
+    float,
+    int32_t
+    )
+{
+    if (Source != Destination) {
+        std::copy_n(Source, D, Destination);
+    }
+}
+
+MLAS_FORCEINLINE
+void
+MlasLayerNormStoreRow(
+    const float* Source,
+    MLAS_FP16* Destination,
+    size_t D,
+    float,
+    int32_t
+    )
+{
+    MlasConvertFloatToHalfBuffer(Source, reinterpret_cast<unsigned short*>(Destination), D);
+}
+
+template <typename QuantizedType>
+MLAS_FORCEINLINE
+void
+MlasLayerNormStoreRow(
+    const float* Source,
+    QuantizedType* Destination,
+    size_t D,
+    float OutputScale,
+    int32_t OutputZeroPoint
+    )
+{
+    MlasQuantizeLinear(Source, Destination, D, OutputScale, static_cast<QuantizedType>(OutputZeroPoint));
+}
+
+//
+// Returns the float values of an optional vector parameter, converting half
+// precision values once into Buffer.
+//
+
+const float*
+MlasLayerNormFloatParameter(
+    const float* Parameter,
+    std::unique_ptr<float[]>&,
+    size_t
+    )
+{
+    return Parameter;
+}
+
+const float*
+MlasLayerNormFloatParameter(
+    const MLAS_FP16* Parameter,
+    std::unique_ptr<float[]>& Buffer,
+    size_t D
+    )
+{
+    if (Parameter == nullptr) {
+        return nullptr;
+    }
+    Buffer = std::make_unique<float[]>(D);
+    MlasLayerNormLoadRow(Parameter, Buffer.get(), D);
+    return Buffer.get();
+}
+
+}  // namespace
+
+template <typename InputType, typename OutputType>
+void
+MLASCALL
+MlasLayerNormalization(
+    const InputType* Input,
+    OutputType* Output,
+    size_t N,
+    size_t D,
+    const MLAS_LAYER_NORM_PARAMS<InputType>& Params,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine computes layer normalization, or RMS normalization if
+    Params.Simplified is set, of N rows of D elements. If Params.Skip is
+    supplied, the rows of the skip input (broadcast modulo Params.SkipRows)
+    and the optional skip bias are added to the input first.
+
+Arguments:
+
+    Input - Supplies the input buffer of N x D elements.
+
+    Output - Supplies the output buffer of N x D elements.
+
+    N - Supplies the number of rows to process.
+
+    D - Supplies the number of elements per row.
+
+    Params - Supplies the parameters and optional outputs of the normalization.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    std::unique_ptr<float[]> ScaleBuffer;
+    std::unique_ptr<float[]> BiasBuffer;
+    std::unique_ptr<float[]> SkipBiasBuffer;
+
+    const float* Scale = MlasLayerNormFloatParameter(Params.Scale, ScaleBuffer, D);
+    const float* Bias = Params.Simplified ? nullptr : MlasLayerNormFloatParameter(Params.Bias, BiasBuffer, D);
+    const float* SkipBias = MlasLayerNormFloatParameter(Params.SkipBias, SkipBiasBuffer, D);
+
+    //
+    // Limit the number of threads so that each thread processes a minimum
+    // number of elements.
+    //
+
+    constexpr size_t MinimumElementsPerThread = 16384;
+
+    ptrdiff_t ThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+    const size_t BlockCount = ((N * D) / MinimumElementsPerThread) + 1;
+
+    if (size_t(ThreadCount) > BlockCount) {
+        ThreadCount = ptrdiff_t(BlockCount);
+    }
+    if (size_t(ThreadCount) > N) {
+        ThreadCount = ptrdiff_t(N);
+    }
+    if (ThreadCount == 0) {
+        return;
+    }
+
+    MlasTrySimpleParallel(ThreadPool, ThreadCount, [&](ptrdiff_t tid) {
+
+        size_t n;
+        size_t CountN;
+
+        MlasPartitionWork(tid, ThreadCount, N, &n, &CountN);
+
+        //
+        // Rows that are not plain float inputs are assembled in a row buffer.
+        //
+
+        constexpr bool InputIsFloat = std::is_same<InputType, float>::value;
+        constexpr bool OutputIsFloat = std::is_same<OutputType, float>::value;
+
+        const bool NeedsRowBuffer = !InputIsFloat || !OutputIsFloat || Params.Skip != nullptr;
+        std::unique_ptr<float[]> RowBuffer;
+        std::unique_ptr<float[]> SkipBuffer;
+
+        if (NeedsRowBuffer) {
+            RowBuffer = std::make_unique<float[]>(D);
+        }
+        if (!InputIsFloat && Params.Skip != nullptr) {
+            SkipBuffer = std::make_unique<float[]>(D);
+        }
+
+        for (; CountN > 0; n++, CountN--) {
+
+            const InputType* InputRow = Input + n * D;
+            OutputType* OutputRow = Output + n * D;
+
+            const float* Row;
+
+            if (NeedsRowBuffer) {
+
+                MlasLayerNormLoadRow(InputRow, RowBuffer.get(), D);
+
+                if (Params.Skip != nullptr) {
+
+                    const InputType* SkipRow = Params.Skip + (n % Params.SkipRows) * D;
+                    const float* SkipValues;
+
+                    if constexpr (InputIsFloat) {
+                        SkipValues = SkipRow;
+                    } else {
+                        MlasLayerNormLoadRow(SkipRow, SkipBuffer.get(), D);
+                        SkipValues = SkipBuffer.get();
+                    }
+
+                    float* Sum = RowBuffer.get();
+                    for (size_t d = 0; d < D; d++) {
+                        Sum[d] += SkipValues[d];
+                    }
+                    if (SkipBias != nullptr) {
+                        for (size_t d = 0; d < D; d++) {
+                            Sum[d] += SkipBias[d];
+                        }
+                    }
+
+                    if (Params.SumOutput != nullptr) {
+                        MlasLayerNormStoreRow(Sum, Params.SumOutput + n * D, D, 1.0f, 0);
+                    }
+                }
+
+                Row = RowBuffer.get();
+
+            } else {
+                Row = reinterpret_cast<const float*>(InputRow);
+            }
+
+            const MLAS_LAYER_NORM_STATISTICS Statistics = Params.Simplified
+                ? MlasRmsNormComputeStatistics(Row, D, Params.Epsilon)
+                : MlasLayerNormComputeStatistics(Row, D, Params.Epsilon);
+
+            if (Params.Mean != nullptr && !Params.Simplified) {
+                Params.Mean[n] = Statistics.Mean;
+            }
+            if (Params.InvStdDev != nullptr) {
+                Params.InvStdDev[n] = Statistics.InvStdDev;
+            }
+
+            if constexpr (OutputIsFloat) {
+                MlasLayerNormNormalizeRow(Row, OutputRow, D, Statistics, Scale, Bias);
+            } else {
+                MlasLayerNormNormalizeRow(Row, RowBuffer.get(), D, Statistics, Scale, Bias);
+                MlasLayerNormStoreRow(RowBuffer.get(), OutputRow, D, Params.OutputScale, Params.OutputZeroPoint);
+            }
+        }
+    });
+}
+
+template
+void
+MLASCALL
+MlasLayerNormalization<float, float>(
+    const float* Input,
+    float* Output,
+    size_t N,
+    size_t D,
+    const MLAS_LAYER_NORM_PARAMS<float>& Params,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+template
+void
+MLASCALL
+MlasLayerNormalization<float, int8_t>(
+    const float* Input,
+    int8_t* Output,
+    size_t N,
+    size_t D,
+    const MLAS_LAYER_NORM_PARAMS<float>& Params,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+template
+void
+MLASCALL
+MlasLayerNormalization<float, uint8_t>(
+    const float* Input,
+    uint8_t* Output,
+    size_t N,
+    size_t D,
+    const MLAS_LAYER_NORM_PARAMS<float>& Params,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+template
+void
+MLASCALL
+MlasLayerNormalization<MLAS_FP16, MLAS_FP16>(
+    const MLAS_FP16* Input,
+    MLAS_FP16* Output,
+    size_t N,
+    size_t D,
+    const MLAS_LAYER_NORM_PARAMS<MLAS_FP16>& Params,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+template
+void
+MLASCALL
+MlasLayerNormalization<MLAS_FP16, int8_t>(
+    const MLAS_FP16* Input,
+    int8_t* Output,
+    size_t N,
+    size_t D,
+    const MLAS_LAYER_NORM_PARAMS<MLAS_FP16>& Params,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+template
+void
+MLASCALL
+MlasLayerNormalization<MLAS_FP16, uint8_t>(
+    const MLAS_FP16* Input,
+    uint8_t* Output,
+    size_t N,
+    size_t D,
+    const MLAS_LAYER_NORM_PARAMS<MLAS_FP16>& Params,
+    MLAS_THREADPOOL* ThreadPool
+    );
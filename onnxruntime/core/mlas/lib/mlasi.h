@@ -671,6 +671,30 @@ void
     float Scale,
     uint16_t ZeroPoint);
 
+typedef
+void
+(MLASCALL MLAS_CAST_F16_TO_F32_KERNEL)(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    );
+
+typedef
+void
+(MLASCALL MLAS_CAST_F32_TO_F16_KERNEL)(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    );
+
+typedef
+void
+(MLASCALL MLAS_CAST_F32_TO_BF16_KERNEL)(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    );
+
 typedef
 void
 (MLASCALL MLAS_QUANTIZE_LINEAR_S16_KERNEL)(
@@ -826,7 +850,14 @@ extern "C" {
     MLAS_QUANTIZE_LINEAR_U8_KERNEL MlasQuantizeLinearU8Kernel;
     MLAS_QUANTIZE_LINEAR_S16_KERNEL MlasQuantizeLinearS16Kernel;
     MLAS_QUANTIZE_LINEAR_U16_KERNEL MlasQuantizeLinearU16Kernel;
+    MLAS_CAST_F16_TO_F32_KERNEL MlasCastF16ToF32Kernel;
+    MLAS_CAST_F32_TO_F16_KERNEL MlasCastF32ToF16Kernel;
+    MLAS_CAST_F32_TO_BF16_KERNEL MlasCastF32ToBF16Kernel;
 #if defined(MLAS_TARGET_AMD64)
+    MLAS_CAST_F16_TO_F32_KERNEL MlasCastF16ToF32KernelSse;
+    MLAS_CAST_F16_TO_F32_KERNEL MlasCastF16ToF32KernelAvx2;
+    MLAS_CAST_F32_TO_F16_KERNEL MlasCastF32ToF16KernelAvx2;
+    MLAS_CAST_F32_TO_BF16_KERNEL MlasCastF32ToBF16KernelAvx512BF16;
     MLAS_COMPUTE_UNARY_FLOAT_KERNEL MlasErfKernelFma3;
     MLAS_COMPUTE_UNARY_FLOAT_KERNEL MlasComputeExpF32KernelFma3;
     MLAS_COMPUTE_UNARY_FLOAT_KERNEL MlasComputeExpF32KernelAvx512F;
@@ -852,6 +883,49 @@ extern "C" {
 
 }
 
+//
+// Define the constants of the polynomial approximations of the logistic and
+// hyperbolic tangent functions. The constants are defined in logistic.cpp
+// and tanh.cpp and are shared with kernels written in assembly, so the field
+// order must not change.
+//
+
+struct MLAS_LOGISTIC_CONSTANTS {
+    float LowerRange;
+    float UpperRange;
+    float alpha_9;
+    float alpha_7;
+    float alpha_5;
+    float alpha_3;
+    float alpha_1;
+    float beta_10;
+    float beta_8;
+    float beta_6;
+    float beta_4;
+    float beta_2;
+    float beta_0;
+    float one_half;
+};
+
+struct MLAS_TANH_CONSTANTS {
+    float LowerRange;
+    float UpperRange;
+    float alpha_13;
+    float alpha_11;
+    float alpha_9;
+    float alpha_7;
+    float alpha_5;
+    float alpha_3;
+    float alpha_1;
+    float beta_6;
+    float beta_4;
+    float beta_2;
+    float beta_0;
+};
+
+MLAS_INTERNAL_DATA const MLAS_LOGISTIC_CONSTANTS MlasLogisticConstants;
+MLAS_INTERNAL_DATA const MLAS_TANH_CONSTANTS MlasTanhConstants;
+
 //
 // Define the default preferred byte alignment for buffers.
 //
@@ -1112,6 +1186,9 @@ struct MLAS_PLATFORM {
     MLAS_QUANTIZE_LINEAR_U8_KERNEL* QuantizeLinearU8Kernel;
     MLAS_QUANTIZE_LINEAR_S16_KERNEL* QuantizeLinearS16Kernel;
     MLAS_QUANTIZE_LINEAR_U16_KERNEL* QuantizeLinearU16Kernel;
+    MLAS_CAST_F16_TO_F32_KERNEL* CastF16ToF32Kernel;
+    MLAS_CAST_F32_TO_F16_KERNEL* CastF32ToF16Kernel;
+    MLAS_CAST_F32_TO_BF16_KERNEL* CastF32ToBF16Kernel;
     uint32_t NchwcBlockSize;
     uint32_t PreferredBufferAlignment;
     int32_t MaximumThreadCount;
@@ -274,6 +274,13 @@ Return Value:
     this->QuantizeLinearU8Kernel = MlasQuantizeLinearU8Kernel;
     this->QuantizeLinearS16Kernel = MlasQuantizeLinearS16Kernel;
     this->QuantizeLinearU16Kernel = MlasQuantizeLinearU16Kernel;
+#if defined(_WIN32)
+    this->CastF16ToF32Kernel = MlasCastF16ToF32KernelSse;
+#else
+    this->CastF16ToF32Kernel = MlasCastF16ToF32Kernel;
+#endif
+    this->CastF32ToF16Kernel = MlasCastF32ToF16Kernel;
+    this->CastF32ToBF16Kernel = MlasCastF32ToBF16Kernel;
 
     this->NchwcBlockSize = 8;
     this->PreferredBufferAlignment = MLAS_DEFAULT_PREFERRED_BUFFER_ALIGNMENT;
@@ -375,6 +382,16 @@ Return Value:
                 this->ComputeSumExpF32Kernel = MlasComputeSumExpF32KernelFma3;
                 this->SQNBitGemmDispatch = &MlasSQNBitGemmDispatchAvx2;
 
+                //
+                // Check if the processor supports the F16C half precision
+                // conversion instructions.
+                //
+
+                if ((Cpuid1[2] & 0x20000000) != 0) {
+                    this->CastF16ToF32Kernel = MlasCastF16ToF32KernelAvx2;
+                    this->CastF32ToF16Kernel = MlasCastF32ToF16KernelAvx2;
+                }
+
                 //
                 // Check if the processor supports Hybrid core architecture.
                 //
@@ -428,6 +445,15 @@ Return Value:
                     this->NchwcBlockSize = 16;
                     this->PreferredBufferAlignment = 64;
 
+                    //
+                    // Check if the processor supports the AVX512_BF16
+                    // conversion instructions.
+                    //
+
+                    if ((Cpuid7_1[0] & 0x20) != 0) {
+                        this->CastF32ToBF16Kernel = MlasCastF32ToBF16KernelAvx512BF16;
+                    }
+
                     //
                     // Check if the processor supports AVX512 core features
                     // (AVX512BW/AVX512DQ/AVX512VL).
@@ -1925,3 +1925,285 @@ Return Value:
     MlasReduceMinimumMaximumF32Kernel(Input, Min, Max, N);
 #endif
 }
+
+#if defined(MLAS_NEON64_INTRINSICS) || defined(MLAS_SSE2_INTRINSICS)
+
+//
+// DequantizeLinear implementation using NEON or SSE2 intrinsics.
+//
+
+template<typename InputType>
+MLAS_FORCEINLINE
+void
+MlasDequantizeLinearLoad16(
+    const InputType* Input,
+    MLAS_INT32X4 Vectors[4]
+    );
+
+template<>
+MLAS_FORCEINLINE
+void
+MlasDequantizeLinearLoad16<uint8_t>(
+    const uint8_t* Input,
+    MLAS_INT32X4 Vectors[4]
+    )
+{
+#if defined(MLAS_NEON64_INTRINSICS)
+    uint8x16_t Bytes = vld1q_u8(Input);
+    uint16x8_t Low = vmovl_u8(vget_low_u8(Bytes));
+    uint16x8_t High = vmovl_high_u8(Bytes);
+    Vectors[0] = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(Low)));
+    Vectors[1] = vreinterpretq_s32_u32(vmovl_high_u16(Low));
+    Vectors[2] = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(High)));
+    Vectors[3] = vreinterpretq_s32_u32(vmovl_high_u16(High));
+#else
+    __m128i Bytes = _mm_loadu_si128((const __m128i*)Input);
+    __m128i Zero = _mm_setzero_si128();
+    __m128i Low = _mm_unpacklo_epi8(Bytes, Zero);
+    __m128i High = _mm_unpackhi_epi8(Bytes, Zero);
+    Vectors[0] = _mm_unpacklo_epi16(Low, Zero);
+    Vectors[1] = _mm_unpackhi_epi16(Low, Zero);
+    Vectors[2] = _mm_unpacklo_epi16(High, Zero);
+    Vectors[3] = _mm_unpackhi_epi16(High, Zero);
+#endif
+}
+
+template<>
+MLAS_FORCEINLINE
+void
+MlasDequantizeLinearLoad16<int8_t>(
+    const int8_t* Input,
+    MLAS_INT32X4 Vectors[4]
+    )
+{
+#if defined(MLAS_NEON64_INTRINSICS)
+    int8x16_t Bytes = vld1q_s8(Input);
+    int16x8_t Low = vmovl_s8(vget_low_s8(Bytes));
+    int16x8_t High = vmovl_high_s8(Bytes);
+    Vectors[0] = vmovl_s16(vget_low_s16(Low));
+    Vectors[1] = vmovl_high_s16(Low);
+    Vectors[2] = vmovl_s16(vget_low_s16(High));
+    Vectors[3] = vmovl_high_s16(High);
+#else
+    // Sign extend by moving each value to the upper half of a wider lane and
+    // shifting it back arithmetically.
+    __m128i Bytes = _mm_loadu_si128((const __m128i*)Input);
+    __m128i Low = _mm_srai_epi16(_mm_unpacklo_epi8(Bytes, Bytes), 8);
+    __m128i High = _mm_srai_epi16(_mm_unpackhi_epi8(Bytes, Bytes), 8);
+    Vectors[0] = _mm_srai_epi32(_mm_unpacklo_epi16(Low, Low), 16);
+    Vectors[1] = _mm_srai_epi32(_mm_unpackhi_epi16(Low, Low), 16);
+    Vectors[2] = _mm_srai_epi32(_mm_unpacklo_epi16(High, High), 16);
+    Vectors[3] = _mm_srai_epi32(_mm_unpackhi_epi16(High, High), 16);
+#endif
+}
+
+template<>
+MLAS_FORCEINLINE
+void
+MlasDequantizeLinearLoad16<uint16_t>(
+    const uint16_t* Input,
+    MLAS_INT32X4 Vectors[4]
+    )
+{
+    for (size_t i = 0; i < 2; i++) {
+#if defined(MLAS_NEON64_INTRINSICS)
+        uint16x8_t Words = vld1q_u16(Input + i * 8);
+        Vectors[i * 2] = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(Words)));
+        Vectors[i * 2 + 1] = vreinterpretq_s32_u32(vmovl_high_u16(Words));
+#else
+        __m128i Words = _mm_loadu_si128((const __m128i*)(Input + i * 8));
+        __m128i Zero = _mm_setzero_si128();
+        Vectors[i * 2] = _mm_unpacklo_epi16(Words, Zero);
+        Vectors[i * 2 + 1] = _mm_unpackhi_epi16(Words, Zero);
+#endif
+    }
+}
+
+template<>
+MLAS_FORCEINLINE
+void
+MlasDequantizeLinearLoad16<int16_t>(
+    const int16_t* Input,
+    MLAS_INT32X4 Vectors[4]
+    )
+{
+    for (size_t i = 0; i < 2; i++) {
+#if defined(MLAS_NEON64_INTRINSICS)
+        int16x8_t Words = vld1q_s16(Input + i * 8);
+        Vectors[i * 2] = vmovl_s16(vget_low_s16(Words));
+        Vectors[i * 2 + 1] = vmovl_high_s16(Words);
+#else
+        __m128i Words = _mm_loadu_si128((const __m128i*)(Input + i * 8));
+        Vectors[i * 2] = _mm_srai_epi32(_mm_unpacklo_epi16(Words, Words), 16);
+        Vectors[i * 2 + 1] = _mm_srai_epi32(_mm_unpackhi_epi16(Words, Words), 16);
+#endif
+    }
+}
+
+template<>
+MLAS_FORCEINLINE
+void
+MlasDequantizeLinearLoad16<int32_t>(
+    const int32_t* Input,
+    MLAS_INT32X4 Vectors[4]
+    )
+{
+    for (size_t i = 0; i < 4; i++) {
+#if defined(MLAS_NEON64_INTRINSICS)
+        Vectors[i] = vld1q_s32(Input + i * 4);
+#else
+        Vectors[i] = _mm_loadu_si128((const __m128i*)(Input + i * 4));
+#endif
+    }
+}
+
+template<typename InputType>
+void
+MlasDequantizeLinearKernel(
+    const InputType* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    InputType ZeroPoint
+    )
+{
+    auto ScaleVector = MlasBroadcastFloat32x4(Scale);
+    auto ZeroPointVector = MlasBroadcastInt32x4(int32_t(ZeroPoint));
+
+    while (N >= 16) {
+
+        MLAS_INT32X4 IntegerVectors[4];
+        MlasDequantizeLinearLoad16(Input, IntegerVectors);
+
+        for (size_t i = 0; i < 4; i++) {
+            auto FloatVector = MlasCastToFloat32x4(MlasSubtractInt32x4(IntegerVectors[i], ZeroPointVector));
+            MlasStoreFloat32x4(Output + i * 4, MlasMultiplyFloat32x4(FloatVector, ScaleVector));
+        }
+
+        Input += 16;
+        Output += 16;
+        N -= 16;
+    }
+
+    for (size_t n = 0; n < N; n++) {
+        Output[n] = float(int32_t(Input[n]) - int32_t(ZeroPoint)) * Scale;
+    }
+}
+
+#else
+
+//
+// DequantizeLinear implementation using the C++ runtime.
+//
+
+template<typename InputType>
+void
+MlasDequantizeLinearKernel(
+    const InputType* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    InputType ZeroPoint
+    )
+{
+    for (size_t n = 0; n < N; n++) {
+        Output[n] = float(int32_t(Input[n]) - int32_t(ZeroPoint)) * Scale;
+    }
+}
+
+#endif
+
+template<typename InputType>
+void
+MLASCALL
+MlasDequantizeLinear(
+    const InputType* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    InputType ZeroPoint
+    )
+/*++
+
+Routine Description:
+
+    This routine dequantizes the input buffer using the supplied quantization
+    parameters:
+
+        Output = (Input - ZeroPoint) * Scale
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+    Scale - Supplies the quantization scale.
+
+    ZeroPoint - Supplies the quantization zero point value.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MlasDequantizeLinearKernel<InputType>(Input, Output, N, Scale, ZeroPoint);
+}
+
+template
+void
+MLASCALL
+MlasDequantizeLinear<int8_t>(
+    const int8_t* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    int8_t ZeroPoint
+    );
+
+template
+void
+MLASCALL
+MlasDequantizeLinear<uint8_t>(
+    const uint8_t* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    uint8_t ZeroPoint
+    );
+
+template
+void
+MLASCALL
+MlasDequantizeLinear<int16_t>(
+    const int16_t* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    int16_t ZeroPoint
+    );
+
+template
+void
+MLASCALL
+MlasDequantizeLinear<uint16_t>(
+    const uint16_t* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    uint16_t ZeroPoint
+    );
+
+template
+void
+MLASCALL
+MlasDequantizeLinear<int32_t>(
+    const int32_t* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    int32_t ZeroPoint
+    );
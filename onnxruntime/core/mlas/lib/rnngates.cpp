@@ -0,0 +1,276 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    rnngates.cpp
+
+Abstract:
+
+    This module implements routines to compute the element-wise gate section
+    of recurrent network cells.
+
+    The gate pre-activations produced by the recurrent GEMM are consumed in a
+    single pass: the bias add, clip, logistic/tanh activations and the cell
+    and hidden state updates are applied while the values are held in vector
+    registers. The activations use the polynomial approximations and constants
+    of logistic.cpp and tanh.cpp.
+
+--*/
+
+#include "mlasi.h"
+
+namespace {
+
+MLAS_FORCEINLINE
+MLAS_FLOAT32X4
+MlasLogisticFloat32x4(
+    MLAS_FLOAT32X4 Value
+    )
+{
+    Value = MlasMaximumFloat32x4(MlasBroadcastFloat32x4(MlasLogisticConstants.LowerRange), Value);
+    Value = MlasMinimumFloat32x4(MlasBroadcastFloat32x4(MlasLogisticConstants.UpperRange), Value);
+
+    MLAS_FLOAT32X4 ValueSquared = MlasMultiplyFloat32x4(Value, Value);
+
+    MLAS_FLOAT32X4 p;
+    p = MlasMultiplyAddFloat32x4(ValueSquared, MlasBroadcastFloat32x4(MlasLogisticConstants.alpha_9),
+        MlasBroadcastFloat32x4(MlasLogisticConstants.alpha_7));
+    p = MlasMultiplyAddFloat32x4(p, ValueSquared, MlasBroadcastFloat32x4(MlasLogisticConstants.alpha_5));
+    p = MlasMultiplyAddFloat32x4(p, ValueSquared, MlasBroadcastFloat32x4(MlasLogisticConstants.alpha_3));
+    p = MlasMultiplyAddFloat32x4(p, ValueSquared, MlasBroadcastFloat32x4(MlasLogisticConstants.alpha_1));
+    p = MlasMultiplyFloat32x4(p, Value);
+
+    MLAS_FLOAT32X4 q;
+    q = MlasMultiplyAddFloat32x4(ValueSquared, MlasBroadcastFloat32x4(MlasLogisticConstants.beta_10),
+        MlasBroadcastFloat32x4(MlasLogisticConstants.beta_8));
+    q = MlasMultiplyAddFloat32x4(q, ValueSquared, MlasBroadcastFloat32x4(MlasLogisticConstants.beta_6));
+    q = MlasMultiplyAddFloat32x4(q, ValueSquared, MlasBroadcastFloat32x4(MlasLogisticConstants.beta_4));
+    q = MlasMultiplyAddFloat32x4(q, ValueSquared, MlasBroadcastFloat32x4(MlasLogisticConstants.beta_2));
+    q = MlasMultiplyAddFloat32x4(q, ValueSquared, MlasBroadcastFloat32x4(MlasLogisticConstants.beta_0));
+
+    return MlasAddFloat32x4(MlasDivideFloat32x4(p, q), MlasBroadcastFloat32x4(0.5f));
+}
+
+MLAS_FORCEINLINE
+MLAS_FLOAT32X4
+MlasTanhFloat32x4(
+    MLAS_FLOAT32X4 Value
+    )
+{
+    Value = MlasMaximumFloat32x4(MlasBroadcastFloat32x4(MlasTanhConstants.LowerRange), Value);
+    Value = MlasMinimumFloat32x4(MlasBroadcastFloat32x4(MlasTanhConstants.UpperRange), Value);
+
+    MLAS_FLOAT32X4 ValueSquared = MlasMultiplyFloat32x4(Value, Value);
+
+    MLAS_FLOAT32X4 p;
+    p = MlasMultiplyAddFloat32x4(ValueSquared, MlasBroadcastFloat32x4(MlasTanhConstants.alpha_13),
+        MlasBroadcastFloat32x4(MlasTanhConstants.alpha_11));
+    p = MlasMultiplyAddFloat32x4(p, ValueSquared, MlasBroadcastFloat32x4(MlasTanhConstants.alpha_9));
+    p = MlasMultiplyAddFloat32x4(p, ValueSquared, MlasBroadcastFloat32x4(MlasTanhConstants.alpha_7));
+    p = MlasMultiplyAddFloat32x4(p, ValueSquared, MlasBroadcastFloat32x4(MlasTanhConstants.alpha_5));
+    p = MlasMultiplyAddFloat32x4(p, ValueSquared, MlasBroadcastFloat32x4(MlasTanhConstants.alpha_3));
+    p = MlasMultiplyAddFloat32x4(p, ValueSquared, MlasBroadcastFloat32x4(MlasTanhConstants.alpha_1));
+    p = MlasMultiplyFloat32x4(p, Value);
+
+    MLAS_FLOAT32X4 q;
+    q = MlasMultiplyAddFloat32x4(ValueSquared, MlasBroadcastFloat32x4(MlasTanhConstants.beta_6),
+        MlasBroadcastFloat32x4(MlasTanhConstants.beta_4));
+    q = MlasMultiplyAddFloat32x4(q, ValueSquared, MlasBroadcastFloat32x4(MlasTanhConstants.beta_2));
+    q = MlasMultiplyAddFloat32x4(q, ValueSquared, MlasBroadcastFloat32x4(MlasTanhConstants.beta_0));
+
+    return MlasDivideFloat32x4(p, q);
+}
+
+MLAS_FORCEINLINE
+float
+MlasLogisticFloat(
+    float Value
+    )
+{
+    // Clamp in two steps so that a NaN input carries through to the output.
+    float v_tmp = (Value < MlasLogisticConstants.LowerRange) ? MlasLogisticConstants.LowerRange : Value;
+    Value = (v_tmp > MlasLogisticConstants.UpperRange) ? MlasLogisticConstants.UpperRange : v_tmp;
+
+    float ValueSquared = Value * Value;
+
+    float p;
+    p = ValueSquared * MlasLogisticConstants.alpha_9 + MlasLogisticConstants.alpha_7;
+    p = p * ValueSquared + MlasLogisticConstants.alpha_5;
+    p = p * ValueSquared + MlasLogisticConstants.alpha_3;
+    p = p * ValueSquared + MlasLogisticConstants.alpha_1;
+    p = p * Value;
+
+    float q;
+    q = ValueSquared * MlasLogisticConstants.beta_10 + MlasLogisticConstants.beta_8;
+    q = q * ValueSquared + MlasLogisticConstants.beta_6;
+    q = q * ValueSquared + MlasLogisticConstants.beta_4;
+    q = q * ValueSquared + MlasLogisticConstants.beta_2;
+    q = q * ValueSquared + MlasLogisticConstants.beta_0;
+
+    return (p / q) + 0.5f;
+}
+
+MLAS_FORCEINLINE
+float
+MlasTanhFloat(
+    float Value
+    )
+{
+    float v_tmp = (Value < MlasTanhConstants.LowerRange) ? MlasTanhConstants.LowerRange : Value;
+    Value = (v_tmp > MlasTanhConstants.UpperRange) ? MlasTanhConstants.UpperRange : v_tmp;
+
+    float ValueSquared = Value * Value;
+
+    float p;
+    p = ValueSquared * MlasTanhConstants.alpha_13 + MlasTanhConstants.alpha_11;
+    p = p * ValueSquared + MlasTanhConstants.alpha_9;
+    p = p * ValueSquared + MlasTanhConstants.alpha_7;
+    p = p * ValueSquared + MlasTanhConstants.alpha_5;
+    p = p * ValueSquared + MlasTanhConstants.alpha_3;
+    p = p * ValueSquared + MlasTanhConstants.alpha_1;
+    p = p * Value;
+
+    float q;
+    q = ValueSquared * MlasTanhConstants.beta_6 + MlasTanhConstants.beta_4;
+    q = q * ValueSquared + MlasTanhConstants.beta_2;
+    q = q * ValueSquared + MlasTanhConstants.beta_0;
+
+    return p / q;
+}
+
+template<bool HasBias>
+void
+MlasLstmGatesKernel(
+    const float* Gates,
+    const float* Bias,
+    float* CellState,
+    float* HiddenState,
+    float Clip,
+    size_t HiddenSize
+    )
+{
+    const float* GateI = Gates;
+    const float* GateO = Gates + HiddenSize;
+    const float* GateF = Gates + 2 * HiddenSize;
+    const float* GateC = Gates + 3 * HiddenSize;
+
+    const float* BiasI = Bias;
+    const float* BiasO = HasBias ? Bias + HiddenSize : nullptr;
+    const float* BiasF = HasBias ? Bias + 2 * HiddenSize : nullptr;
+    const float* BiasC = HasBias ? Bias + 3 * HiddenSize : nullptr;
+
+    const MLAS_FLOAT32X4 ClipUpper = MlasBroadcastFloat32x4(Clip);
+    const MLAS_FLOAT32X4 ClipLower = MlasBroadcastFloat32x4(-Clip);
+
+    size_t n = 0;
+
+    for (; n + 4 <= HiddenSize; n += 4) {
+
+        MLAS_FLOAT32X4 i = MlasLoadFloat32x4(GateI + n);
+        MLAS_FLOAT32X4 o = MlasLoadFloat32x4(GateO + n);
+        MLAS_FLOAT32X4 f = MlasLoadFloat32x4(GateF + n);
+        MLAS_FLOAT32X4 c = MlasLoadFloat32x4(GateC + n);
+
+        if (HasBias) {
+            i = MlasAddFloat32x4(i, MlasLoadFloat32x4(BiasI + n));
+            o = MlasAddFloat32x4(o, MlasLoadFloat32x4(BiasO + n));
+            f = MlasAddFloat32x4(f, MlasLoadFloat32x4(BiasF + n));
+            c = MlasAddFloat32x4(c, MlasLoadFloat32x4(BiasC + n));
+        }
+
+        i = MlasLogisticFloat32x4(MlasMaximumFloat32x4(ClipLower, MlasMinimumFloat32x4(ClipUpper, i)));
+        o = MlasLogisticFloat32x4(MlasMaximumFloat32x4(ClipLower, MlasMinimumFloat32x4(ClipUpper, o)));
+        f = MlasLogisticFloat32x4(MlasMaximumFloat32x4(ClipLower, MlasMinimumFloat32x4(ClipUpper, f)));
+        c = MlasTanhFloat32x4(MlasMaximumFloat32x4(ClipLower, MlasMinimumFloat32x4(ClipUpper, c)));
+
+        MLAS_FLOAT32X4 Cell = MlasLoadFloat32x4(CellState + n);
+        Cell = MlasMultiplyAddFloat32x4(Cell, f, MlasMultiplyFloat32x4(i, c));
+        MlasStoreFloat32x4(CellState + n, Cell);
+
+        MlasStoreFloat32x4(HiddenState + n, MlasMultiplyFloat32x4(o, MlasTanhFloat32x4(Cell)));
+    }
+
+    for (; n < HiddenSize; n++) {
+
+        float i = GateI[n];
+        float o = GateO[n];
+        float f = GateF[n];
+        float c = GateC[n];
+
+        if (HasBias) {
+            i += BiasI[n];
+            o += BiasO[n];
+            f += BiasF[n];
+            c += BiasC[n];
+        }
+
+        i = MlasLogisticFloat(std::max(-Clip, std::min(Clip, i)));
+        o = MlasLogisticFloat(std::max(-Clip, std::min(Clip, o)));
+        f = MlasLogisticFloat(std::max(-Clip, std::min(Clip, f)));
+        c = MlasTanhFloat(std::max(-Clip, std::min(Clip, c)));
+
+        const float Cell = CellState[n] * f + i * c;
+        CellState[n] = Cell;
+        HiddenState[n] = o * MlasTanhFloat(Cell);
+    }
+}
+
+}  // namespace
+
+void
+MLASCALL
+MlasLstmGates(
+    const float* Gates,
+    const float* Bias,
+    float* CellState,
+    float* HiddenState,
+    float Clip,
+    size_t HiddenSize
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the gate section of an LSTM cell with the default
+    activations (f = logistic, g = tanh, h = tanh) for one batch row:
+
+        it = f(clip(Gi + Bi))
+        ot = f(clip(Go + Bo))
+        ft = f(clip(Gf + Bf))
+        ct = g(clip(Gc + Bc))
+        Ct = ft (.) Ct-1 + it (.) ct
+        Ht = ot (.) h(Ct)
+
+Arguments:
+
+    Gates - Supplies the gate pre-activations for the row, laid out as the
+        input, output, forget and cell gates of HiddenSize elements each.
+
+    Bias - Optionally supplies the combined input and recurrent bias in the
+        same gate order. May be nullptr.
+
+    CellState - Supplies the previous cell state and receives the updated cell
+        state.
+
+    HiddenState - Receives the hidden state.
+
+    Clip - Supplies the cell clip threshold applied to each pre-activation.
+
+    HiddenSize - Supplies the number of elements per gate.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (Bias != nullptr) {
+        MlasLstmGatesKernel<true>(Gates, Bias, CellState, HiddenState, Clip, HiddenSize);
+    } else {
+        MlasLstmGatesKernel<false>(Gates, Bias, CellState, HiddenState, Clip, HiddenSize);
+    }
+}
@@ -1639,6 +1639,153 @@ MlasGemmBatch(
 #pragma warning(pop)
 #endif
 
+void
+MLASCALL
+MlasGemmGroupedBatch(
+    CBLAS_TRANSPOSE TransA,
+    CBLAS_TRANSPOSE TransB,
+    const size_t* M,
+    size_t N,
+    size_t K,
+    const MLAS_SGEMM_DATA_PARAMS* Data,
+    size_t GroupCount,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements a group of single precision matrix/matrix multiply
+    operations that share N and K but each have their own number of rows, for
+    example the tokens routed to every expert of a mixture of experts layer.
+
+    The rows of all groups are treated as one tall matrix for threading, so a
+    thread computes a contiguous range of rows that can span several groups,
+    and groups without rows cost nothing.
+
+Arguments:
+
+    TransA - Supplies the transpose operation for matrix A.
+
+    TransB - Supplies the transpose operation for matrix B.
+
+    M - Supplies the number of rows of matrix A and matrix C of every group.
+
+    N - Supplies the number of columns of matrix B and matrix C.
+
+    K - Supplies the number of columns of matrix A and the number of rows of
+        matrix B.
+
+    Data - Supplies the matrix data parameters of every group.
+
+    GroupCount - Supplies the number of groups.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    size_t TotalM = 0;
+
+    for (size_t g = 0; g < GroupCount; g++) {
+        TotalM += M[g];
+    }
+
+    if (TotalM == 0 || N == 0) {
+        return;
+    }
+
+    //
+    // Compute the number of target threads given the complexity of all the
+    // groups together.
+    //
+
+    const double Complexity = double(TotalM) * double(N) * double(K);
+
+    ptrdiff_t TargetThreadCount;
+
+    if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * GetMlasPlatform().MaximumThreadCount)) {
+        TargetThreadCount = ptrdiff_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+    } else {
+        TargetThreadCount = GetMlasPlatform().MaximumThreadCount;
+    }
+
+    ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    ptrdiff_t ThreadCountM;
+    ptrdiff_t ThreadCountN;
+
+    if (N > TotalM) {
+
+        const size_t BlockedN = (N + MLAS_SGEMM_STRIDEN_THREAD_ALIGN - 1) /
+            MLAS_SGEMM_STRIDEN_THREAD_ALIGN;
+
+        if (size_t(TargetThreadCount) > BlockedN) {
+            TargetThreadCount = ptrdiff_t(BlockedN);
+        }
+
+        ThreadCountM = 1;
+        ThreadCountN = TargetThreadCount;
+
+    } else {
+
+        if (size_t(TargetThreadCount) > TotalM) {
+            TargetThreadCount = ptrdiff_t(TotalM);
+        }
+
+        ThreadCountM = TargetThreadCount;
+        ThreadCountN = 1;
+    }
+
+    MlasTrySimpleParallel(ThreadPool, TargetThreadCount, [=](ptrdiff_t tid)
+    {
+        const ptrdiff_t ThreadIdM = tid / ThreadCountN;
+        const ptrdiff_t ThreadIdN = tid % ThreadCountN;
+
+        size_t RangeStartM;
+        size_t RangeCountM;
+
+        MlasPartitionWork(ThreadIdM, ThreadCountM, TotalM, &RangeStartM, &RangeCountM);
+
+        const size_t RangeEndM = RangeStartM + RangeCountM;
+
+        //
+        // Compute the part of every group that overlaps the rows of this
+        // thread. The N dimension is partitioned by MlasSgemmThreaded.
+        //
+
+        size_t GroupStartM = 0;
+
+        for (size_t g = 0; g < GroupCount && GroupStartM < RangeEndM; g++) {
+
+            const size_t GroupEndM = GroupStartM + M[g];
+            const size_t StartM = std::max(GroupStartM, RangeStartM);
+            const size_t EndM = std::min(GroupEndM, RangeEndM);
+
+            if (StartM < EndM) {
+
+                const size_t RowOffset = StartM - GroupStartM;
+
+                MLAS_SGEMM_DATA_PARAMS GroupData = Data[g];
+                GroupData.A += RowOffset * ((TransA == CblasNoTrans) ? GroupData.lda : 1);
+                GroupData.C += RowOffset * GroupData.ldc;
+
+                MlasSgemmThreaded(1, ThreadCountN, TransA, TransB, EndM - StartM, N, K, &GroupData, ThreadIdN);
+            }
+
+            GroupStartM = GroupEndM;
+        }
+    });
+}
+
 size_t
 MLASCALL
 MlasGemmPackBSize(
@@ -0,0 +1,532 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    sparsegemm.cpp
+
+Abstract:
+
+    This module implements the single precision matrix/matrix multiply
+    operation (SGEMM) for a constant matrix B that has been pruned in blocks.
+
+    Matrix B is split into panels of 16 columns and every row of a panel is a
+    1x16 block. Blocks that are all zero are dropped when B is packed; the
+    remaining blocks of a panel are stored in row order together with their
+    row index. The kernel broadcasts the element of A that belongs to a block
+    and accumulates the block into 16 columns of C, so the work done is
+    proportional to the number of non-zero blocks.
+
+    The packed buffer is laid out as:
+
+        MLAS_SPARSE_SGEMM_PACKED_B_HEADER
+        size_t   PanelOffsets[PanelCount + 1]   first block of every panel
+        float    BlockValues[BlockCount][16]    aligned, zero padded in N
+        uint32_t BlockRows[BlockCount]          row (K index) of every block
+
+    The offset of the block values only depends on N, so matrix B is packed in
+    a single pass into a buffer sized for every block being non-zero; the
+    used prefix of that buffer is the packed matrix.
+
+--*/
+
+#include "mlasi.h"
+
+namespace {
+
+constexpr size_t MLAS_SPARSE_SGEMM_BLOCK_N = 16;
+
+constexpr size_t MLAS_SPARSE_SGEMM_VECTOR_COUNT = MLAS_SPARSE_SGEMM_BLOCK_N / 4;
+
+struct MLAS_SPARSE_SGEMM_PACKED_B_HEADER {
+    size_t N;
+    size_t K;
+    size_t BlockCount;
+};
+
+struct MLAS_SPARSE_SGEMM_PACKED_B {
+    const size_t* PanelOffsets;
+    const uint32_t* BlockRows;
+    const float* BlockValues;
+};
+
+size_t
+MlasSparseGemmPanelCount(
+    size_t N
+    )
+{
+    return (N + MLAS_SPARSE_SGEMM_BLOCK_N - 1) / MLAS_SPARSE_SGEMM_BLOCK_N;
+}
+
+size_t
+MlasSparseGemmBlockValuesOffset(
+    size_t N
+    )
+{
+    const size_t Alignment = MlasGetPreferredBufferAlignment();
+
+    size_t Offset = sizeof(MLAS_SPARSE_SGEMM_PACKED_B_HEADER);
+    Offset += (MlasSparseGemmPanelCount(N) + 1) * sizeof(size_t);
+
+    return (Offset + Alignment - 1) & ~(Alignment - 1);
+}
+
+size_t
+MlasSparseGemmPackedBSize(
+    size_t N,
+    size_t BlockCount
+    )
+{
+    const size_t Alignment = MlasGetPreferredBufferAlignment();
+
+    size_t Size = MlasSparseGemmBlockValuesOffset(N);
+    Size += BlockCount * (MLAS_SPARSE_SGEMM_BLOCK_N * sizeof(float) + sizeof(uint32_t));
+
+    return (Size + Alignment - 1) & ~(Alignment - 1);
+}
+
+MLAS_SPARSE_SGEMM_PACKED_B
+MlasSparseGemmGetPackedB(
+    const void* PackedB
+    )
+{
+    const auto* Header = static_cast<const MLAS_SPARSE_SGEMM_PACKED_B_HEADER*>(PackedB);
+    const auto* Buffer = static_cast<const uint8_t*>(PackedB);
+
+    MLAS_SPARSE_SGEMM_PACKED_B Packed;
+    Packed.PanelOffsets = reinterpret_cast<const size_t*>(Header + 1);
+    Packed.BlockValues = reinterpret_cast<const float*>(Buffer + MlasSparseGemmBlockValuesOffset(Header->N));
+    Packed.BlockRows = reinterpret_cast<const uint32_t*>(
+        Packed.BlockValues + Header->BlockCount * MLAS_SPARSE_SGEMM_BLOCK_N);
+
+    return Packed;
+}
+
+//
+// Multiplies RowCount rows of matrix A by the non-zero blocks of one panel of
+// matrix B and stores the result to CountN columns of matrix C.
+//
+
+template <size_t RowCount>
+void
+MlasSparseGemmKernel(
+    const float* A,
+    size_t StrideAM,
+    size_t StrideAK,
+    const uint32_t* BlockRows,
+    const float* BlockValues,
+    size_t BlockCount,
+    float* C,
+    size_t ldc,
+    size_t CountN,
+    float alpha,
+    float beta
+    )
+{
+    MLAS_FLOAT32X4 Accumulators[RowCount][MLAS_SPARSE_SGEMM_VECTOR_COUNT];
+
+    for (size_t r = 0; r < RowCount; r++) {
+        for (size_t v = 0; v < MLAS_SPARSE_SGEMM_VECTOR_COUNT; v++) {
+            Accumulators[r][v] = MlasZeroFloat32x4();
+        }
+    }
+
+    for (size_t b = 0; b < BlockCount; b++) {
+
+        const float* a = A + size_t(BlockRows[b]) * StrideAK;
+
+        MLAS_FLOAT32X4 BlockVectors[MLAS_SPARSE_SGEMM_VECTOR_COUNT];
+
+        for (size_t v = 0; v < MLAS_SPARSE_SGEMM_VECTOR_COUNT; v++) {
+            BlockVectors[v] = MlasLoadFloat32x4(BlockValues + v * 4);
+        }
+
+        for (size_t r = 0; r < RowCount; r++) {
+            const MLAS_FLOAT32X4 AElement = MlasBroadcastFloat32x4(a + r * StrideAM);
+            for (size_t v = 0; v < MLAS_SPARSE_SGEMM_VECTOR_COUNT; v++) {
+                Accumulators[r][v] = MlasMultiplyAddFloat32x4(BlockVectors[v], AElement, Accumulators[r][v]);
+            }
+        }
+
+        BlockValues += MLAS_SPARSE_SGEMM_BLOCK_N;
+    }
+
+    const MLAS_FLOAT32X4 AlphaBroadcast = MlasBroadcastFloat32x4(alpha);
+    const MLAS_FLOAT32X4 BetaBroadcast = MlasBroadcastFloat32x4(beta);
+
+    for (size_t r = 0; r < RowCount; r++) {
+
+        float* c = C + r * ldc;
+
+        if (CountN == MLAS_SPARSE_SGEMM_BLOCK_N) {
+
+            for (size_t v = 0; v < MLAS_SPARSE_SGEMM_VECTOR_COUNT; v++) {
+                MLAS_FLOAT32X4 Result = MlasMultiplyFloat32x4(Accumulators[r][v], AlphaBroadcast);
+                if (beta != 0.0f) {
+                    Result = MlasMultiplyAddFloat32x4(MlasLoadFloat32x4(c + v * 4), BetaBroadcast, Result);
+                }
+                MlasStoreFloat32x4(c + v * 4, Result);
+            }
+
+        } else {
+
+            float Result[MLAS_SPARSE_SGEMM_BLOCK_N];
+
+            for (size_t v = 0; v < MLAS_SPARSE_SGEMM_VECTOR_COUNT; v++) {
+                MlasStoreFloat32x4(Result + v * 4, MlasMultiplyFloat32x4(Accumulators[r][v], AlphaBroadcast));
+            }
+
+            for (size_t n = 0; n < CountN; n++) {
+                c[n] = (beta != 0.0f) ? Result[n] + beta * c[n] : Result[n];
+            }
+        }
+    }
+}
+
+void
+MlasSparseGemmThreaded(
+    ptrdiff_t ThreadCountM,
+    ptrdiff_t ThreadCountN,
+    CBLAS_TRANSPOSE TransA,
+    size_t M,
+    size_t N,
+    const MLAS_SGEMM_DATA_PARAMS* Data,
+    ptrdiff_t ThreadId
+    )
+{
+    const ptrdiff_t ThreadIdM = ThreadId / ThreadCountN;
+    const ptrdiff_t ThreadIdN = ThreadId % ThreadCountN;
+
+    size_t RangeStartM;
+    size_t RangeCountM;
+    MlasPartitionWork(ThreadIdM, ThreadCountM, M, &RangeStartM, &RangeCountM);
+
+    size_t RangeStartPanel;
+    size_t RangeCountPanel;
+    MlasPartitionWork(ThreadIdN, ThreadCountN, MlasSparseGemmPanelCount(N), &RangeStartPanel, &RangeCountPanel);
+
+    const MLAS_SPARSE_SGEMM_PACKED_B Packed = MlasSparseGemmGetPackedB(Data->B);
+
+    const size_t StrideAM = (TransA == CblasNoTrans) ? Data->lda : 1;
+    const size_t StrideAK = (TransA == CblasNoTrans) ? 1 : Data->lda;
+
+    for (size_t p = RangeStartPanel; p < RangeStartPanel + RangeCountPanel; p++) {
+
+        const size_t n = p * MLAS_SPARSE_SGEMM_BLOCK_N;
+        const size_t CountN = std::min(N - n, MLAS_SPARSE_SGEMM_BLOCK_N);
+
+        const size_t FirstBlock = Packed.PanelOffsets[p];
+        const size_t BlockCount = Packed.PanelOffsets[p + 1] - FirstBlock;
+        const uint32_t* BlockRows = Packed.BlockRows + FirstBlock;
+        const float* BlockValues = Packed.BlockValues + FirstBlock * MLAS_SPARSE_SGEMM_BLOCK_N;
+
+        size_t m = RangeStartM;
+        const size_t RangeEndM = RangeStartM + RangeCountM;
+
+        for (; m + 2 <= RangeEndM; m += 2) {
+            MlasSparseGemmKernel<2>(Data->A + m * StrideAM, StrideAM, StrideAK, BlockRows, BlockValues,
+                                    BlockCount, Data->C + m * Data->ldc + n, Data->ldc, CountN,
+                                    Data->alpha, Data->beta);
+        }
+
+        if (m < RangeEndM) {
+            MlasSparseGemmKernel<1>(Data->A + m * StrideAM, StrideAM, StrideAK, BlockRows, BlockValues,
+                                    BlockCount, Data->C + m * Data->ldc + n, Data->ldc, CountN,
+                                    Data->alpha, Data->beta);
+        }
+    }
+}
+
+}  // namespace
+
+size_t
+MLASCALL
+MlasSparseGemmPackBSize(
+    size_t N,
+    size_t K
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the length in bytes of the buffer that
+    MlasSparseGemmPackB needs for matrix B, which is the length of the packed
+    matrix if none of its blocks are all zero.
+
+Arguments:
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the number of rows of matrix B.
+
+Return Value:
+
+    Returns the size in bytes for the packing buffer, or zero if the matrix
+    cannot be packed.
+
+--*/
+{
+    if (N == 0 || K == 0 || K > std::numeric_limits<uint32_t>::max()) {
+        return 0;
+    }
+
+    return MlasSparseGemmPackedBSize(N, MlasSparseGemmPanelCount(N) * K);
+}
+
+size_t
+MLASCALL
+MlasSparseGemmPackB(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb,
+    void* PackedB
+    )
+/*++
+
+Routine Description:
+
+    This routine packs the non-zero 1x16 blocks of matrix B in a single pass
+    over matrix B. The packed buffer must be aligned to
+    MlasGetPreferredBufferAlignment() and be at least as large as returned by
+    MlasSparseGemmPackBSize.
+
+Arguments:
+
+    TransB - Supplies the transpose operation for matrix B.
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the number of rows of matrix B.
+
+    B - Supplies the address of matrix B.
+
+    ldb - Supplies the first dimension of matrix B.
+
+    PackedB - Supplies the address of packed matrix B.
+
+Return Value:
+
+    Returns the number of bytes at the start of the packed buffer that hold
+    the packed matrix, which is a multiple of the preferred alignment. The
+    rest of the buffer is not used by MlasSparseGemmBatch, so the packed
+    matrix may be copied to a buffer of this size.
+
+--*/
+{
+    const size_t PanelCount = MlasSparseGemmPanelCount(N);
+
+    auto* Header = static_cast<MLAS_SPARSE_SGEMM_PACKED_B_HEADER*>(PackedB);
+    Header->N = N;
+    Header->K = K;
+
+    auto* PanelOffsets = reinterpret_cast<size_t*>(Header + 1);
+    auto* BlockValues = reinterpret_cast<float*>(
+        static_cast<uint8_t*>(PackedB) + MlasSparseGemmBlockValuesOffset(N));
+
+    //
+    // The block count is not known until matrix B has been scanned, so the
+    // block rows are first stored after the values of the largest possible
+    // block count and moved behind the used values at the end.
+    //
+
+    auto* BlockRows = reinterpret_cast<uint32_t*>(BlockValues + PanelCount * K * MLAS_SPARSE_SGEMM_BLOCK_N);
+
+    size_t Block = 0;
+    size_t Panel = 0;
+
+    for (size_t n = 0; n < N; n += MLAS_SPARSE_SGEMM_BLOCK_N) {
+
+        const size_t CountN = std::min(N - n, MLAS_SPARSE_SGEMM_BLOCK_N);
+
+        PanelOffsets[Panel++] = Block;
+
+        for (size_t k = 0; k < K; k++) {
+
+            float* Values = BlockValues + Block * MLAS_SPARSE_SGEMM_BLOCK_N;
+            bool IsNonZero = false;
+
+            for (size_t i = 0; i < MLAS_SPARSE_SGEMM_BLOCK_N; i++) {
+                float Value = 0.0f;
+                if (i < CountN) {
+                    Value = (TransB == CblasNoTrans) ? B[k * ldb + n + i] : B[(n + i) * ldb + k];
+                }
+                IsNonZero |= (Value != 0.0f);
+                Values[i] = Value;
+            }
+
+            //
+            // An all zero block is overwritten by the next block.
+            //
+
+            if (IsNonZero) {
+                BlockRows[Block++] = static_cast<uint32_t>(k);
+            }
+        }
+    }
+
+    PanelOffsets[Panel] = Block;
+    Header->BlockCount = Block;
+
+    //
+    // Every byte of the packed matrix is written, including the alignment
+    // padding, so the packed matrix only depends on the contents of matrix B.
+    //
+
+    uint8_t* PanelOffsetsEnd = reinterpret_cast<uint8_t*>(PanelOffsets + Panel + 1);
+    std::memset(PanelOffsetsEnd, 0, reinterpret_cast<uint8_t*>(BlockValues) - PanelOffsetsEnd);
+
+    uint32_t* PackedBlockRows = reinterpret_cast<uint32_t*>(BlockValues + Block * MLAS_SPARSE_SGEMM_BLOCK_N);
+    std::memmove(PackedBlockRows, BlockRows, Block * sizeof(uint32_t));
+
+    const size_t PackedBSize = MlasSparseGemmPackedBSize(N, Block);
+    uint8_t* PackedEnd = reinterpret_cast<uint8_t*>(PackedBlockRows + Block);
+    std::memset(PackedEnd, 0, static_cast<uint8_t*>(PackedB) + PackedBSize - PackedEnd);
+
+    return PackedBSize;
+}
+
+float
+MLASCALL
+MlasSparseGemmPackedBBlockSparsity(
+    const void* PackedB
+    )
+/*++
+
+Routine Description:
+
+    This routine returns the fraction of the 1x16 blocks of a packed matrix B
+    that are all zero.
+
+Arguments:
+
+    PackedB - Supplies the address of packed matrix B.
+
+Return Value:
+
+    Returns the fraction of all zero blocks.
+
+--*/
+{
+    const auto* Header = static_cast<const MLAS_SPARSE_SGEMM_PACKED_B_HEADER*>(PackedB);
+
+    const size_t TotalBlockCount = MlasSparseGemmPanelCount(Header->N) * Header->K;
+
+    return float(TotalBlockCount - Header->BlockCount) / float(TotalBlockCount);
+}
+
+void
+MLASCALL
+MlasSparseGemmBatch(
+    CBLAS_TRANSPOSE TransA,
+    size_t M,
+    size_t N,
+    size_t K,
+    const MLAS_SGEMM_DATA_PARAMS* Data,
+    size_t BatchSize,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the batched single precision matrix/matrix
+    multiply operation with a block sparse packed matrix B.
+
+Arguments:
+
+    TransA - Supplies the transpose operation for matrix A.
+
+    M - Supplies the number of rows of matrix A and matrix C.
+
+    N - Supplies the number of columns of matrix B and matrix C.
+
+    K - Supplies the number of columns of matrix A and the number of rows of
+        matrix B.
+
+    Data - Supplies the array of matrix data parameters. The B member of every
+        entry is the packed buffer from MlasSparseGemmPackB.
+
+    BatchSize - Supplies the number of multiplications in this batch.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (M == 0 || N == 0 || BatchSize == 0) {
+        return;
+    }
+
+    MLAS_UNREFERENCED_PARAMETER(K);
+
+    //
+    // Compute the number of target threads from the work done for the non-zero
+    // blocks of matrix B.
+    //
+
+    const auto* Header = reinterpret_cast<const MLAS_SPARSE_SGEMM_PACKED_B_HEADER*>(Data[0].B);
+
+    const double Complexity = double(M) * double(Header->BlockCount) * double(MLAS_SPARSE_SGEMM_BLOCK_N);
+
+    ptrdiff_t TargetThreadCount;
+
+    if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * GetMlasPlatform().MaximumThreadCount)) {
+        TargetThreadCount = ptrdiff_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+    } else {
+        TargetThreadCount = GetMlasPlatform().MaximumThreadCount;
+    }
+
+    ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    //
+    // Segment each multiplication across panels of matrix B when N is larger,
+    // else across rows of matrix A.
+    //
+
+    ptrdiff_t ThreadsPerGemm = (TargetThreadCount + BatchSize - 1) / BatchSize;
+    ptrdiff_t ThreadCountM;
+    ptrdiff_t ThreadCountN;
+
+    if (N > M) {
+
+        const size_t PanelCount = MlasSparseGemmPanelCount(N);
+
+        if (size_t(ThreadsPerGemm) > PanelCount) {
+            ThreadsPerGemm = ptrdiff_t(PanelCount);
+        }
+
+        ThreadCountM = 1;
+        ThreadCountN = ThreadsPerGemm;
+
+    } else {
+
+        if (size_t(ThreadsPerGemm) > M) {
+            ThreadsPerGemm = ptrdiff_t(M);
+        }
+
+        ThreadCountM = ThreadsPerGemm;
+        ThreadCountN = 1;
+    }
+
+    MlasTrySimpleParallel(ThreadPool,
+        ThreadsPerGemm * static_cast<ptrdiff_t>(BatchSize),
+        [=](ptrdiff_t tid)
+    {
+        ptrdiff_t GemmIdx = tid / ThreadsPerGemm;
+        ptrdiff_t ThreadIdx = tid % ThreadsPerGemm;
+        MlasSparseGemmThreaded(ThreadCountM, ThreadCountN, TransA, M, N, &(Data[GemmIdx]), ThreadIdx);
+    });
+}
@@ -94,14 +94,9 @@ namespace
 size_t
 SQNBitGemmWorkspaceAlignment(SQNBitGemmVariant Variant)
 {
-    switch (Variant) {
-        case SQNBitGemmVariant_BitWidth4_CompInt8: {
-            return Q8BlkAlignment();
-        }
-        default: {
-            return 1;
-        }
-    }
+    MLAS_UNREFERENCED_PARAMETER(Variant);
+
+    return 1;
 }
 
 size_t
@@ -113,19 +108,17 @@ SQNBitGemmPerGemmWorkspaceSize(
     size_t BlkLen
 )
 {
+    MLAS_UNREFERENCED_PARAMETER(Variant);
+    MLAS_UNREFERENCED_PARAMETER(M);
     MLAS_UNREFERENCED_PARAMETER(N);
+    MLAS_UNREFERENCED_PARAMETER(K);
+    MLAS_UNREFERENCED_PARAMETER(BlkLen);
 
-    switch (Variant) {
-        case SQNBitGemmVariant_BitWidth4_CompInt8: {
-            // workspace buffer is used for block quantization of A to int8
-            const size_t BlockCountK = MlasDivRoundup(K, BlkLen);
-            const size_t PerGemmWorkspaceSize = M * BlockCountK * Q8BlkSize(BlkLen);
-            return PerGemmWorkspaceSize;
-        }
-        default: {
-            return 0;
-        }
-    }
+    //
+    // No variant currently needs a shared workspace. CompInt8 quantizes the rows of A used by each tile into a
+    // thread local buffer, see SQ4BitGemm_CompInt8().
+    //
+    return 0;
 }
 
 size_t
@@ -405,6 +398,8 @@ SQ4BitGemm_CompInt8(
         return;
     }
 #endif
+    MLAS_UNREFERENCED_PARAMETER(PerGemmWorkspace);
+
     constexpr size_t BlkBitWidth = 4;
 
     const size_t k_blks = MlasDivRoundup(K, BlkLen);
@@ -414,7 +409,29 @@ SQ4BitGemm_CompInt8(
     const size_t ldb = k_blks * MlasQNBitBlkDataSizeInBytes(BlkBitWidth, BlkLen);
     const size_t k_blks_zp_bytes = MlasQNBitZeroPointsForBlksSizeInBytes<BlkBitWidth>(k_blks);
 
-    const std::byte* QuantA = static_cast<const std::byte*>(PerGemmWorkspace) + RangeStartM * lda;
+    //
+    // Quantize the rows of A used by this tile as part of the tile itself rather than in a separate pass over all
+    // of A. The quantized rows stay in cache for the kernel calls below and, for the M=1 decode case, there is no
+    // serial pre-pass ahead of the threaded GEMM. Tiles that share rows of A each quantize their own copy, which
+    // costs one pass over K per row against RangeCountN passes for the GEMM itself.
+    //
+    static_assert(ThreadedBufAlignment % alignof(float) == 0);
+    MlasThreadedBufAlloc(RangeCountM * lda);
+    std::byte* QuantA = reinterpret_cast<std::byte*>(ThreadedBufHolder.get());
+
+    {
+        const auto QuantizeARow = GetMlasPlatform().SQNBitGemmDispatch->QuantizeARow_CompInt8;
+
+        const float* ARowPtr = DataParams->A + RangeStartM * DataParams->lda;
+        std::byte* QuantARowPtr = QuantA;
+
+        for (size_t m = 0; m < RangeCountM; ++m) {
+            QuantizeARow(BlkLen, ARowPtr, K, QuantARowPtr);
+
+            ARowPtr += DataParams->lda;
+            QuantARowPtr += lda;
+        }
+    }
 
     const std::byte* QuantBData = static_cast<const std::byte*>(DataParams->QuantBData) + RangeStartN * ldb;
     const float* QuantBScale = DataParams->QuantBScale + RangeStartN * k_blks;
@@ -500,41 +517,6 @@ typedef void(InitializeWorkspaceFn)(
     MLAS_THREADPOOL* ThreadPool
 );
 
-void
-InitializeWorkspace_CompInt8(
-    size_t M,
-    size_t N,
-    size_t K,
-    size_t BatchN,
-    size_t BlkLen,
-    const MLAS_SQNBIT_GEMM_DATA_PARAMS* DataParams,
-    void* Workspace,
-    size_t PerGemmWorkspaceStride,
-    MLAS_THREADPOOL* ThreadPool
-)
-{
-    MLAS_UNREFERENCED_PARAMETER(N);
-
-    const auto QuantizeARow = GetMlasPlatform().SQNBitGemmDispatch->QuantizeARow_CompInt8;
-
-    const size_t BlockCountK = MlasDivRoundup(K, BlkLen);
-    const size_t QuantAStride = BlockCountK * Q8BlkSize(BlkLen);
-
-    MlasTrySimpleParallel(ThreadPool, BatchN, [&](ptrdiff_t gemm_idx) {
-        const auto& data = DataParams[gemm_idx];
-
-        const float* ARowPtr = data.A;
-        std::byte* QuantARowPtr = static_cast<std::byte*>(Workspace) + gemm_idx * PerGemmWorkspaceStride;
-
-        for (size_t m = 0; m < M; ++m) {
-            QuantizeARow(BlkLen, ARowPtr, K, QuantARowPtr);
-
-            ARowPtr += data.lda;
-            QuantARowPtr += QuantAStride;
-        }
-    });
-}
-
 struct Operations {
     InitializeWorkspaceFn* InitializeWorkspace = nullptr;
     SQNBitGemmFn* SQNBitGemm = nullptr;
@@ -545,7 +527,6 @@ constexpr auto OperationMap = []() {
 
     ops[SQNBitGemmVariant_BitWidth4_CompFp32].SQNBitGemm = SQ4BitGemm_CompFp32;
 
-    ops[SQNBitGemmVariant_BitWidth4_CompInt8].InitializeWorkspace = InitializeWorkspace_CompInt8;
     ops[SQNBitGemmVariant_BitWidth4_CompInt8].SQNBitGemm = SQ4BitGemm_CompInt8;
 
     return ops;
@@ -26,21 +26,7 @@ Abstract:
 // Bundles the floating point constants for use by kernels written in assembly.
 //
 
-MLAS_INTERNAL_DATA const struct {
-    float LowerRange;
-    float UpperRange;
-    float alpha_13;
-    float alpha_11;
-    float alpha_9;
-    float alpha_7;
-    float alpha_5;
-    float alpha_3;
-    float alpha_1;
-    float beta_6;
-    float beta_4;
-    float beta_2;
-    float beta_0;
-} MlasTanhConstants = {
+MLAS_INTERNAL_DATA const MLAS_TANH_CONSTANTS MlasTanhConstants = {
     -9.0f,
     9.0f,
     -2.76076847742355e-16f,
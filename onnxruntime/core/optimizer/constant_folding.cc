@@ -1,7 +1,9 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <chrono>
 #include <limits>
+#include <optional>
 
 #include "core/optimizer/constant_folding.h"
 #include "core/optimizer/initializer.h"
@@ -11,6 +13,8 @@
 #include "core/optimizer/utils.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/tensorprotoutils.h"
+#include "core/common/parse_string.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 
 using namespace onnxruntime::common;
 
@@ -20,12 +24,60 @@ ConstantFolding::ConstantFolding(const IExecutionProvider& execution_provider,
                                  bool skip_dequantize_linear,
                                  const ConfigOptions& config_options,
                                  const InlinedHashSet<std::string_view>& compatible_execution_providers,
-                                 const InlinedHashSet<std::string>& excluded_initializers) noexcept
+                                 const InlinedHashSet<std::string>& excluded_initializers,
+                                 concurrency::ThreadPool* thread_pool) noexcept
     : GraphTransformer("ConstantFolding", compatible_execution_providers),
       skip_dequantize_linear_(skip_dequantize_linear),
       config_options_(config_options),
       excluded_initializers_(excluded_initializers),
-      execution_provider_(execution_provider) {
+      execution_provider_(execution_provider),
+      thread_pool_(thread_pool) {
+}
+
+// Total size of the constant inputs of a node. Inputs with a size that can't be computed (e.g. strings) count as 0.
+static size_t GetConstantInputsSizeInBytes(const InitializedTensorSet& constant_inputs) {
+  size_t total = 0;
+  for (const auto& entry : constant_inputs) {
+    size_t size = 0;
+    if (utils::GetSizeInBytesFromTensorProto<0>(*entry.second, &size).IsOK()) {
+      total += size;
+    }
+  }
+  return total;
+}
+
+// Size of the outputs of a node as inferred from the output NodeArgs.
+// Returns std::nullopt if any output is not a tensor with a known element type and fully known shape.
+static std::optional<size_t> GetInferredOutputsSizeInBytes(const Node& node) {
+  size_t total = 0;
+  for (const auto* output_def : node.OutputDefs()) {
+    const auto* type_proto = output_def->TypeAsProto();
+    const auto* shape_proto = output_def->Shape();
+    if (type_proto == nullptr || shape_proto == nullptr || !utils::HasTensorType(*type_proto) ||
+        !utils::HasElemType(type_proto->tensor_type()) ||
+        type_proto->tensor_type().elem_type() == ONNX_NAMESPACE::TensorProto_DataType_STRING) {
+      return std::nullopt;
+    }
+
+    for (const auto& dim : shape_proto->dim()) {
+      if (!utils::HasDimValue(dim) || dim.dim_value() < 0) {
+        return std::nullopt;
+      }
+    }
+
+    const auto* element_type = DataTypeImpl::TensorTypeFromONNXEnum(type_proto->tensor_type().elem_type())
+                                   ->GetElementType();
+    total += Tensor::CalculateTensorStorageSize(element_type,
+                                                utils::GetTensorShapeFromTensorShapeProto(*shape_proto));
+  }
+
+  return total;
+}
+
+// Folding is always allowed if it doesn't grow the initializer footprint. Otherwise the folded outputs must fit
+// within the budget. A budget of 0 means no limit.
+static bool IsWithinFoldingBudget(size_t output_size, size_t constant_inputs_size, size_t max_output_size) {
+  return max_output_size == 0 || output_size <= constant_inputs_size || output_size <= max_output_size;
 }
 
 // We need to handle a Shape node separately as the input doesn't need to be a constant initializer for
@@ -134,6 +186,20 @@ static Status ConstantFoldIfNode(Graph& graph, Node& if_node, const logging::Log
 
 Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
   bool have_updated_nodes = false;
+
+  size_t max_output_size_in_bytes = 0;
+  ORT_RETURN_IF_ERROR(ParseStringWithClassicLocale(
+      config_options_.GetConfigOrDefault(kOrtSessionOptionsConstantFoldingMaxOutputSizeInBytes, "0"),
+      max_output_size_in_bytes));
+
+  // Totals reported once the graph has been processed.
+  size_t num_folded_nodes = 0;
+  size_t total_output_size = 0;
+  size_t total_constant_inputs_size = 0;
+
+  // Nodes of QDQ node units that are folded as a whole. Their budget was checked once for the whole unit.
+  InlinedHashSet<NodeIndex> qdq_unit_nodes_to_fold;
+
   GraphViewer graph_viewer(graph);
   auto& order = graph_viewer.GetNodesInTopologicalOrder();
 
@@ -223,6 +289,42 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         if (!can_constant_fold_qdq_node_unit) {
           continue;
         }
+
+        // Folding the unit replaces the quantized constant inputs of DQ with the quantized output of Q, so the
+        // budget applies to the unit as a whole and not to the float tensors in between. Folding only part of the
+        // unit would break it up, so it is not folded at all if the size of the Q output is unknown.
+        const Node& node_x = *node->OutputNodesBegin();
+        const Node& q_node = *node_x.OutputNodesBegin();
+        if (max_output_size_in_bytes != 0) {
+          const size_t unit_constant_inputs_size = GetConstantInputsSizeInBytes(constant_inputs);
+          const auto unit_output_size = GetInferredOutputsSizeInBytes(q_node);
+          if (!unit_output_size.has_value() ||
+              !IsWithinFoldingBudget(*unit_output_size, unit_constant_inputs_size, max_output_size_in_bytes)) {
+            LOGS(logger, VERBOSE) << "Skipping constant folding of the QDQ node unit starting at node '"
+                                  << node->Name() << "'. The size of its output is unknown or exceeds the limit of "
+                                  << max_output_size_in_bytes << " bytes.";
+            continue;
+          }
+        }
+
+        qdq_unit_nodes_to_fold.insert(node->Index());
+        qdq_unit_nodes_to_fold.insert(node_x.Index());
+        qdq_unit_nodes_to_fold.insert(q_node.Index());
+      }
+
+      // If shape inferencing already tells us the outputs won't fit in the budget, don't bother computing them.
+      const size_t constant_inputs_size = GetConstantInputsSizeInBytes(constant_inputs);
+      const bool check_budget = max_output_size_in_bytes != 0 && qdq_unit_nodes_to_fold.count(node->Index()) == 0;
+      if (check_budget) {
+        const auto inferred_output_size = GetInferredOutputsSizeInBytes(*node);
+        if (inferred_output_size.has_value() &&
+            !IsWithinFoldingBudget(*inferred_output_size, constant_inputs_size, max_output_size_in_bytes)) {
+          LOGS(logger, VERBOSE) << "Skipping constant folding of " << node->OpType() << " node '" << node->Name()
+                                << "'. Outputs of " << *inferred_output_size << " bytes would replace "
+                                << constant_inputs_size << " bytes of constant inputs and exceed the limit of "
+                                << max_output_size_in_bytes << " bytes.";
+          continue;
+        }
       }
 
 #if !defined(DISABLE_SPARSE_TENSORS)
@@ -278,8 +380,11 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
 #pragma warning(push)
 #pragma warning(disable : 6387)
 #endif
-      OpKernelContext op_kernel_context(&frame, kernel.get(), /*stream*/ nullptr, nullptr, logger);
+      OpKernelContext op_kernel_context(&frame, kernel.get(), /*stream*/ nullptr, thread_pool_, logger);
+      const auto compute_start = std::chrono::steady_clock::now();
       ORT_RETURN_IF_ERROR(kernel->Compute(&op_kernel_context));
+      const auto compute_duration = std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - compute_start);
 #ifdef _WIN32
 #pragma warning(pop)
 #endif
@@ -302,6 +407,31 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         }
       }
 
+      if (converted_to_constant) {
+        // The output shapes may not have been known before computing the node, so check the budget again.
+        size_t output_size = 0;
+        for (const auto& fetch : fetches) {
+          output_size += fetch.Get<Tensor>().SizeInBytes();
+        }
+
+        if (check_budget && !IsWithinFoldingBudget(output_size, constant_inputs_size, max_output_size_in_bytes)) {
+          LOGS(logger, VERBOSE) << "Skipping constant folding of " << node->OpType() << " node '" << node->Name()
+                                << "'. Outputs of " << output_size << " bytes would replace "
+                                << constant_inputs_size << " bytes of constant inputs and exceed the limit of "
+                                << max_output_size_in_bytes << " bytes.";
+          converted_to_constant = false;
+        } else {
+          // The compute time is what each inference run saves by not executing the node.
+          LOGS(logger, VERBOSE) << "Constant folded " << node->OpType() << " node '" << node->Name()
+                                << "'. Saved compute: " << compute_duration.count() << "us. Initializers added: "
+                                << output_size << " bytes. Constant inputs replaced: " << constant_inputs_size
+                                << " bytes.";
+          ++num_folded_nodes;
+          total_output_size += output_size;
+          total_constant_inputs_size += constant_inputs_size;
+        }
+      }
+
       if (converted_to_constant) {
         for (size_t fetch_idx = 0; fetch_idx < fetches.size(); ++fetch_idx) {
           OrtValue& ort_value = fetches[fetch_idx];
@@ -341,6 +471,14 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
     }
   }
 
+  if (num_folded_nodes > 0) {
+    // Constant inputs are only released if no other node consumes them, so the net growth may be larger than
+    // the difference between these two numbers.
+    LOGS(logger, INFO) << "Constant folded " << num_folded_nodes << " nodes at graph level " << graph_level
+                       << ". Initializers added: " << total_output_size
+                       << " bytes. Constant inputs replaced: " << total_constant_inputs_size << " bytes.";
+  }
+
   return Status::OK();
 }
 }  // namespace onnxruntime
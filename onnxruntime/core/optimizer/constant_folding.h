@@ -9,24 +9,33 @@
 #include "core/framework/execution_provider.h"
 
 namespace onnxruntime {
+namespace concurrency {
+class ThreadPool;
+}
 
 /**
 @class ConstantFolding
 
 Transformer that traverses the graph top-down and performs constant folding, i.e.,
 it statically computes parts of the graph that rely only on constant initializers.
+
+Folding a node whose outputs are much larger than its constant inputs trades initializer memory for little saved
+compute, so the size of the outputs a single node may fold into is capped by the
+kOrtSessionOptionsConstantFoldingMaxOutputSizeInBytes config option.
 */
 class ConstantFolding : public GraphTransformer {
  public:
   /*! Constant folding will not be applied to nodes that have one of initializers from excluded_initializers as input.
       For pre-training, the trainable weights are those initializers to be excluded.
       \param execution_provider Execution provider instance to execute constant folding.
+      \param thread_pool Optional intra-op thread pool used by the kernels that compute the folded values.
   */
   ConstantFolding(const IExecutionProvider& execution_provider,
                   bool skip_dequantize_linear,
                   const ConfigOptions& config_options,
                   const InlinedHashSet<std::string_view>& compatible_execution_providers = {},
-                  const InlinedHashSet<std::string>& excluded_initializers = {}) noexcept;
+                  const InlinedHashSet<std::string>& excluded_initializers = {},
+                  concurrency::ThreadPool* thread_pool = nullptr) noexcept;
 
  private:
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
@@ -35,6 +44,7 @@ class ConstantFolding : public GraphTransformer {
   const ConfigOptions& config_options_;
   const InlinedHashSet<std::string> excluded_initializers_;
   const IExecutionProvider& execution_provider_;
+  concurrency::ThreadPool* thread_pool_;
 };
 
 }  // namespace onnxruntime
@@ -0,0 +1,114 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/embedding_bag_fusion.h"
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+// The reduction must be over axis 1 of the rank 3 Gather output only, which removes the bag axis.
+static bool IsReductionOverBags(const Graph& graph, const Node& reduce_node, bool axes_is_input) {
+  InlinedVector<int64_t> axes;
+  if (axes_is_input) {
+    if (reduce_node.InputDefs().size() < 2 || !reduce_node.InputDefs()[1]->Exists() ||
+        !optimizer_utils::AppendTensorFromInitializer(graph, *reduce_node.InputDefs()[1], axes, true)) {
+      return false;
+    }
+  } else if (!graph_utils::GetRepeatedNodeAttributeValues(reduce_node, "axes", axes)) {
+    return false;
+  }
+
+  if (axes.size() != 1 || (axes[0] != 1 && axes[0] != -2)) {
+    return false;
+  }
+
+  const auto* keepdims = graph_utils::GetNodeAttribute(reduce_node, "keepdims");
+  return keepdims != nullptr && keepdims->i() == 0;
+}
+
+Status EmbeddingBagFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                     const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (nullptr == node_ptr)
+      continue;  // node was removed
+
+    auto& node = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, "Gather", {1, 11, 13}) ||
+        !graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders()) ||
+        !optimizer_utils::CheckOutputEdges(graph, node, 1)) {
+      continue;
+    }
+
+    const auto* axis = graph_utils::GetNodeAttribute(node, "axis");
+    if (axis != nullptr && axis->i() != 0) {
+      continue;
+    }
+
+    const NodeArg& table = *node.InputDefs()[0];
+    const NodeArg& indices = *node.InputDefs()[1];
+    const TensorShapeProto* table_shape = table.Shape();
+    const TensorShapeProto* indices_shape = indices.Shape();
+    if (table_shape == nullptr || indices_shape == nullptr ||
+        table_shape->dim_size() != 2 || indices_shape->dim_size() != 2 ||
+        table.TypeAsProto()->tensor_type().elem_type() != TensorProto_DataType_FLOAT) {
+      continue;
+    }
+
+    const Node& next_node = *node.OutputNodesBegin();
+    bool is_mean = false;
+    if (graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "ReduceSum", {1, 11})) {
+      if (!IsReductionOverBags(graph, next_node, false)) continue;
+    } else if (graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "ReduceSum", {13})) {
+      if (!IsReductionOverBags(graph, next_node, true)) continue;
+    } else if (graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "ReduceMean", {1, 11, 13})) {
+      if (!IsReductionOverBags(graph, next_node, false)) continue;
+      is_mean = true;
+    } else if (graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "ReduceMean", {18})) {
+      if (!IsReductionOverBags(graph, next_node, true)) continue;
+      is_mean = true;
+    } else {
+      continue;
+    }
+
+    if (next_node.GetExecutionProviderType() != node.GetExecutionProviderType() ||
+        graph.NodeProducesGraphOutput(node)) {
+      continue;
+    }
+
+    Node& gather_node = node;
+    Node& reduce_node = const_cast<Node&>(next_node);
+    InlinedVector<NodeArg*> embedding_bag_input{gather_node.MutableInputDefs()[0],
+                                                gather_node.MutableInputDefs()[1]};
+
+    Node& embedding_bag_node = graph.AddNode(graph.GenerateNodeName("EmbeddingBag"),
+                                             "EmbeddingBag",
+                                             "fused Gather and " + reduce_node.OpType(),
+                                             embedding_bag_input,
+                                             {},
+                                             {},
+                                             kMSDomain);
+    embedding_bag_node.AddAttribute("mode", std::string(is_mean ? "mean" : "sum"));
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    embedding_bag_node.SetExecutionProviderType(gather_node.GetExecutionProviderType());
+
+    // move output definitions and edges from reduce_node to embedding_bag_node
+    // delete gather_node and reduce_node.
+    graph_utils::FinalizeNodeFusion(graph, {gather_node, reduce_node}, embedding_bag_node);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+}  // namespace onnxruntime
@@ -55,6 +55,22 @@ std::vector<NodeAndMoveInfo> VariadicMoves() {
   return moves;
 }
 
+// moves for replacing LayerNormalization with a DQ input and float scale with the qlinear version
+std::vector<NodeAndMoveInfo> LayerNormMoves() {
+  NTO::NodeLocation dq{NTO::NodeType::kInput, 0};
+  NTO::NodeLocation target{NTO::NodeType::kTarget, 0};
+  NTO::NodeLocation q{NTO::NodeType::kOutput, 0};
+
+  std::vector<NodeAndMoveInfo> moves{
+      MoveAll(dq, ArgType::kInput),                                // append all inputs from dq to new node
+      MoveAndAppend(target, ArgType::kInput, 1, ArgType::kInput),  // append the float scale
+      MoveAndAppend(q, ArgType::kInput, 1, ArgType::kInput),       // append scale (input 1) from q
+      MoveAndAppend(q, ArgType::kInput, 2, ArgType::kInput),       // append zp (input 2) from q
+      MoveAll(q, ArgType::kOutput)};
+
+  return moves;
+}
+
 // moves for replacing a node with a Conv node with DQ inputs with the qlinear version
 std::vector<NodeAndMoveInfo> ConvMoves() {
   NTO::NodeLocation dq_x{NTO::NodeType::kInput, 0};
@@ -242,6 +258,23 @@ VariadicReplaceWithQLinear::VariadicReplaceWithQLinear(std::string domain)
     : ReplaceWithQLinear(std::move(domain), VariadicMoves()) {
 }
 
+LayerNormReplaceWithQLinear::LayerNormReplaceWithQLinear()
+    : ReplaceWithQLinear(kMSDomain, LayerNormMoves()) {
+}
+
+std::vector<NodeAndMoveInfo> LayerNormReplaceWithQLinear::ValueMoves(const RuntimeState& state) const {
+  auto moves = ReplaceWithQLinear::ValueMoves(state);
+
+  // the bias is optional, append it after the output quantization parameters when present
+  const auto& input_defs = state.selected_nodes.Target().InputDefs();
+  if (input_defs.size() > 2 && input_defs[2]->Exists()) {
+    NTO::NodeLocation target{NTO::NodeType::kTarget, 0};
+    moves.push_back(MoveAndAppend(target, ArgType::kInput, 2, ArgType::kInput));
+  }
+
+  return moves;
+}
+
 ConvReplaceWithQLinear::ConvReplaceWithQLinear()
     : ReplaceWithQLinear(kOnnxDomain, ConvMoves()) {
 }
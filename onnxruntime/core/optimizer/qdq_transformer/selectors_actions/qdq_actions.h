@@ -56,6 +56,14 @@ struct VariadicReplaceWithQLinear : ReplaceWithQLinear {
   VariadicReplaceWithQLinear(std::string domain);
 };
 
+// QLinearLayerNormalization takes the optional float bias as its last input
+struct LayerNormReplaceWithQLinear : ReplaceWithQLinear {
+  LayerNormReplaceWithQLinear();
+
+ private:
+  std::vector<NodeAndMoveInfo> ValueMoves(const RuntimeState& state) const override;
+};
+
 struct ConvReplaceWithQLinear : ReplaceWithQLinear {
   ConvReplaceWithQLinear();
 };
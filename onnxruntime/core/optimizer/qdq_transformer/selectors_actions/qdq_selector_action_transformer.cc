@@ -112,7 +112,9 @@ void UnaryOpQDQRules(SelectorActionRegistry& qdq_selector_action_registry) {
                                                           {"LeakyRelu", {}},
                                                           {"GlobalAveragePool", {}},
                                                           {"Sigmoid", {}},
-                                                          {"Softmax", {}}},
+                                                          {"Softmax", {}},
+                                                          {"Gelu", {}},
+                                                          {SelectorActionRegistry::OpVersionsMapKey("Gelu", kMSDomain), {}}},
                                                          std::move(selector),
                                                          std::move(action));
 #else
@@ -249,6 +251,25 @@ void GemmQDQRules(SelectorActionRegistry& qdq_selector_action_registry) {
 #endif
 }
 
+void LayerNormQDQRules(SelectorActionRegistry& qdq_selector_action_registry) {
+  // 3 nodes. DQ for X, LayerNormalization with float scale and bias, Q
+  // Replace with QLinearLayerNormalization. Delete all original nodes.
+  const std::string action_name{"LayerNorm"};
+  std::unique_ptr<Action> action = std::make_unique<QDQ::LayerNormReplaceWithQLinear>();
+
+#if !defined(ORT_MINIMAL_BUILD)
+  std::vector<const char*> providers = {kCpuExecutionProvider};
+  std::unique_ptr<NodeSelector> selector = std::make_unique<QDQ::LayerNormalizationSelector>(providers);
+  qdq_selector_action_registry.RegisterSelectorAndAction(action_name,
+                                                         {{"LayerNormalization", {}}},
+                                                         std::move(selector),
+                                                         std::move(action));
+
+#else
+  qdq_selector_action_registry.RegisterAction(action_name, std::move(action));
+#endif
+}
+
 void WhereQDQRules(SelectorActionRegistry& qdq_selector_action_registry) {
   // 3 nodes.  2 x DQ for inputs and 1X Q for output
   // Compare to other BinaryOperators (Add, Mul), Where also have a special case that it has boolean input
@@ -283,6 +304,7 @@ SelectorActionRegistry CreateSelectorActionRegistry(bool is_int8_allowed) {
   MatMulQDQRules(qdq_selector_action_registry, is_int8_allowed);
   GemmQDQRules(qdq_selector_action_registry);
   WhereQDQRules(qdq_selector_action_registry);
+  LayerNormQDQRules(qdq_selector_action_registry);
 
   return qdq_selector_action_registry;
 }
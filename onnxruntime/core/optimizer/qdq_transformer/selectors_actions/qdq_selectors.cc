@@ -497,6 +497,40 @@ bool InstanceAndLayerNormalizationNodeGroupSelector::Check(const GraphViewer& gr
          (has_bias ? dt_bias == ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_INT32 : true);
 }
 
+bool LayerNormalizationNodeGroupSelector::Check(const GraphViewer& graph_viewer,
+                                                const Node& node,
+                                                const std::vector<const Node*>& dq_nodes,
+                                                const std::vector<const Node*>& q_nodes) const {
+  if (!CheckQDQNodes(graph_viewer, node, dq_nodes, q_nodes, 1)) {
+    return false;
+  }
+
+  // the DQ node has to provide X. Scale and B stay float.
+  const auto& input_defs = node.InputDefs();
+  if (dq_nodes[0]->OutputDefs()[0] != input_defs[0]) {
+    return false;
+  }
+
+  for (size_t i = 1; i < input_defs.size(); ++i) {
+    if (input_defs[i]->Exists() &&
+        input_defs[i]->TypeAsProto()->tensor_type().elem_type() != ONNX_NAMESPACE::TensorProto_DataType_FLOAT) {
+      return false;
+    }
+  }
+
+  int32_t dt_input = dq_nodes[0]->InputDefs()[0]->TypeAsProto()->tensor_type().elem_type();
+  int32_t dt_output = q_nodes[0]->OutputDefs()[0]->TypeAsProto()->tensor_type().elem_type();
+  if (dt_input != dt_output ||
+      (dt_input != ONNX_NAMESPACE::TensorProto_DataType_INT8 &&
+       dt_input != ONNX_NAMESPACE::TensorProto_DataType_UINT8)) {
+    return false;
+  }
+
+  // the kernel takes per-tensor quantization parameters
+  return optimizer_utils::IsScalar(*dq_nodes[0]->InputDefs()[QDQ::InputIndex::SCALE_ID]) &&
+         optimizer_utils::IsScalar(*q_nodes[0]->InputDefs()[QDQ::InputIndex::SCALE_ID]);
+}
+
 bool BatchNormalizationNodeGroupSelector::Check(const GraphViewer& graph_viewer,
                                                 const Node& node,
                                                 const std::vector<const Node*>& dq_nodes,
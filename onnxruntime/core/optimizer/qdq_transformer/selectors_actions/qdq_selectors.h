@@ -210,6 +210,15 @@ class InstanceAndLayerNormalizationNodeGroupSelector : public NodeGroupSelector
              const std::vector<const Node*>& q_nodes) const override;
 };
 
+// Single per-tensor DQ node for X -> LayerNormalization with float Scale and optional float B -> Q.
+// Used for the CPU EP QLinearLayerNormalization, which keeps the normalization parameters in float.
+class LayerNormalizationNodeGroupSelector : public NodeGroupSelector {
+ private:
+  bool Check(const GraphViewer& graph_viewer, const Node& node,
+             const std::vector<const Node*>& dq_nodes,
+             const std::vector<const Node*>& q_nodes) const override;
+};
+
 // DQ nodes for X, W and optionally B, not used for mean, var -> node -> Q
 class BatchNormalizationNodeGroupSelector : public NodeGroupSelector {
  public:
@@ -289,6 +298,12 @@ class UnarySelector : public BaseSelector {
       : BaseSelector(std::make_unique<UnaryNodeGroupSelector>(allow_16bit), compatible_providers) {}
 };
 
+class LayerNormalizationSelector : public BaseSelector {
+ public:
+  explicit LayerNormalizationSelector(gsl::span<const char*> compatible_providers = {})
+      : BaseSelector(std::make_unique<LayerNormalizationNodeGroupSelector>(), compatible_providers) {}
+};
+
 class BinarySelector : public BaseSelector {
  public:
   explicit BinarySelector(gsl::span<const char*> compatible_providers = {}, bool allow_16bit = false)
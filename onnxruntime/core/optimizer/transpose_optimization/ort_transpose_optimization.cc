@@ -143,6 +143,7 @@ const HandlerMap& OrtExtendedHandlers() {
         {"com.microsoft.QLinearAdd", q_linear_binary_op_handler},
         {"com.microsoft.QLinearAveragePool", q_linear_pool_op_handler},
         {"com.microsoft.QLinearConcat", q_linear_concat_handler},
+        {"com.microsoft.QLinearGelu", node_1_inp_handler},
         {"com.microsoft.QLinearGlobalAveragePool", q_linear_pool_op_handler},
         {"com.microsoft.QLinearLeakyRelu", node_1_inp_handler},
         {"com.microsoft.QLinearMul", q_linear_binary_op_handler},
@@ -2,6 +2,8 @@
 // Licensed under the MIT License.
 
 #include "einsum_auxiliary_ops.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/util/math_cpuonly.h"
 
 using namespace onnxruntime::common;
 
@@ -28,21 +30,75 @@ Status Transpose(const gsl::span<const size_t>& permutation, const Tensor& input
   return TransposeBase::DoTranspose(permutation, input, output, input_shape_override);
 }
 
-// CPU specific MatMul helper
+// CPU specific MatMul helper(s)
+
+// Generic batched GEMM for the types MLAS has no kernel for.
+// The row-major [M, N] output is computed as its column-major transpose: C^T = op(B)^T * op(A)^T
+template <typename T>
+static void BatchedGemm(const T* input_1_data, const T* input_2_data, T* output_data,
+                        size_t left_stride, size_t right_stride, size_t output_stride,
+                        size_t num_batches, size_t M, size_t K, size_t N,
+                        bool trans_a, bool trans_b, concurrency::ThreadPool* /*tp*/) {
+  const auto m = static_cast<ptrdiff_t>(M);
+  const auto k = static_cast<ptrdiff_t>(K);
+  const auto n = static_cast<ptrdiff_t>(N);
+
+  for (size_t i = 0; i < num_batches; ++i) {
+    const T* a = input_1_data + i * left_stride;
+    const T* b = input_2_data + i * right_stride;
+    auto c_mat = EigenMatrixMap<T>(output_data + i * output_stride, n, m);
+
+    if (!trans_a && !trans_b) {
+      c_mat.noalias() = ConstEigenMatrixMap<T>(b, n, k) * ConstEigenMatrixMap<T>(a, k, m);
+    } else if (!trans_a) {
+      c_mat.noalias() = ConstEigenMatrixMap<T>(b, k, n).transpose() * ConstEigenMatrixMap<T>(a, k, m);
+    } else if (!trans_b) {
+      c_mat.noalias() = ConstEigenMatrixMap<T>(b, n, k) * ConstEigenMatrixMap<T>(a, m, k).transpose();
+    } else {
+      c_mat.noalias() = ConstEigenMatrixMap<T>(b, k, n).transpose() * ConstEigenMatrixMap<T>(a, m, k).transpose();
+    }
+  }
+}
+
+// All the batches are handed to MLAS in one call so that it can partition the work across batches as well
+static void BatchedGemm(const float* input_1_data, const float* input_2_data, float* output_data,
+                        size_t left_stride, size_t right_stride, size_t output_stride,
+                        size_t num_batches, size_t M, size_t K, size_t N,
+                        bool trans_a, bool trans_b, concurrency::ThreadPool* tp) {
+  std::vector<MLAS_SGEMM_DATA_PARAMS> data(num_batches);
+  for (size_t i = 0; i < num_batches; ++i) {
+    data[i].A = input_1_data + i * left_stride;
+    data[i].lda = trans_a ? M : K;
+    data[i].B = input_2_data + i * right_stride;
+    data[i].ldb = trans_b ? K : N;
+    data[i].C = output_data + i * output_stride;
+    data[i].ldc = N;
+  }
+
+  MlasGemmBatch(trans_a ? CblasTrans : CblasNoTrans, trans_b ? CblasTrans : CblasNoTrans,
+                M, N, K, data.data(), num_batches, tp);
+}
+
+static void BatchedGemm(const double* input_1_data, const double* input_2_data, double* output_data,
+                        size_t left_stride, size_t right_stride, size_t output_stride,
+                        size_t num_batches, size_t M, size_t K, size_t N,
+                        bool trans_a, bool trans_b, concurrency::ThreadPool* tp) {
+  for (size_t i = 0; i < num_batches; ++i) {
+    math::Gemm<double>(trans_a ? CblasTrans : CblasNoTrans, trans_b ? CblasTrans : CblasNoTrans,
+                       static_cast<ptrdiff_t>(M), static_cast<ptrdiff_t>(N), static_cast<ptrdiff_t>(K), 1.0,
+                       input_1_data + i * left_stride, input_2_data + i * right_stride, 0.0,
+                       output_data + i * output_stride, tp);
+  }
+}
+
 template <typename T>
 Status MatMul(const T* input_1_data, const T* input_2_data, T* output_data,
               size_t left_stride, size_t right_stride, size_t output_stride,
-              size_t num_batches, size_t M, size_t K, size_t N, concurrency::ThreadPool* tp,
+              size_t num_batches, size_t M, size_t K, size_t N,
+              bool trans_a, bool trans_b, concurrency::ThreadPool* tp,
               void* /*einsum_cuda_assets*/) {
-  for (size_t i = 0; i < num_batches; ++i) {
-    math::MatMul<T>(
-        static_cast<int>(M),
-        static_cast<int>(N),
-        static_cast<int>(K),
-        input_1_data + i * left_stride,
-        input_2_data + i * right_stride,
-        output_data + i * output_stride, tp);
-  }
+  BatchedGemm(input_1_data, input_2_data, output_data, left_stride, right_stride, output_stride,
+              num_batches, M, K, N, trans_a, trans_b, tp);
 
   return Status::OK();
 }
@@ -303,8 +359,8 @@ std::unique_ptr<Tensor> Transpose(const Tensor& input, const TensorShape& input_
 template <typename T>
 std::unique_ptr<Tensor> MatMul(const Tensor& input_1, const gsl::span<const int64_t>& input_shape_1_override,
                                const Tensor& input_2, const gsl::span<const int64_t>& input_shape_2_override,
-                               AllocatorPtr allocator, concurrency::ThreadPool* tp, void* einsum_cuda_assets,
-                               const DeviceHelpers::MatMul<T>& device_matmul_func) {
+                               bool trans_a, bool trans_b, AllocatorPtr allocator, concurrency::ThreadPool* tp,
+                               void* einsum_cuda_assets, const DeviceHelpers::MatMul<T>& device_matmul_func) {
   // Sanity checks before the actual MatMul
   ORT_ENFORCE(input_1.DataType() == input_2.DataType(), "Data types of the inputs must match for MatMul");
   ORT_ENFORCE(input_shape_1_override.size() == 3 && input_shape_2_override.size() == 3, "Only 1 batch dimension is allowed for MatMul");
@@ -335,7 +391,8 @@ std::unique_ptr<Tensor> MatMul(const Tensor& input_1, const gsl::span<const int6
   T* output_data = output->MutableData<T>();
 
   auto status = device_matmul_func(input_1_data, input_2_data, output_data,
-                                   left_offset, right_offset, output_offset, batches, M, K, N, tp, einsum_cuda_assets);
+                                   left_offset, right_offset, output_offset, batches, M, K, N,
+                                   trans_a, trans_b, tp, einsum_cuda_assets);
 
   if (!status.IsOK()) {
     ORT_THROW(ONNXRUNTIME, FAIL, "Einsum op: Exception during MatMul operation: ",
@@ -359,13 +416,14 @@ std::unique_ptr<Tensor> ReduceSum(const Tensor& input, const TensorShape& input_
 template Status DeviceHelpers::CpuDeviceHelpers::MatMul<float>(
     const float* input_1_data, const float* input_2_data, float* output_data,
     size_t left_stride, size_t right_stride, size_t output_stride,
-    size_t num_batches, size_t M, size_t K, size_t N, concurrency::ThreadPool* tp,
+    size_t num_batches, size_t M, size_t K, size_t N,
+    bool trans_a, bool trans_b, concurrency::ThreadPool* tp,
     void* einsum_cuda_assets);
 
 template std::unique_ptr<Tensor> MatMul<float>(
     const Tensor& input_1, const gsl::span<const int64_t>& input_shape_1_override,
     const Tensor& input_2, const gsl::span<const int64_t>& input_shape_2_override,
-    AllocatorPtr allocator, concurrency::ThreadPool* tp, void* einsum_cuda_assets,
+    bool trans_a, bool trans_b, AllocatorPtr allocator, concurrency::ThreadPool* tp, void* einsum_cuda_assets,
     const DeviceHelpers::MatMul<float>& device_matmul_func);
 
 template std::unique_ptr<Tensor> DeviceHelpers::CpuDeviceHelpers::ReduceSum<float>(
@@ -383,13 +441,14 @@ template std::unique_ptr<Tensor> ReduceSum<float>(
 template Status DeviceHelpers::CpuDeviceHelpers::MatMul<int32_t>(
     const int32_t* input_1_data, const int32_t* input_2_data, int32_t* output_data,
     size_t left_stride, size_t right_stride, size_t output_stride,
-    size_t num_batches, size_t M, size_t K, size_t N, concurrency::ThreadPool* tp,
+    size_t num_batches, size_t M, size_t K, size_t N,
+    bool trans_a, bool trans_b, concurrency::ThreadPool* tp,
     void* einsum_cuda_assets);
 
 template std::unique_ptr<Tensor> MatMul<int32_t>(
     const Tensor& input_1, const gsl::span<const int64_t>& input_shape_1_override,
     const Tensor& input_2, const gsl::span<const int64_t>& input_shape_2_override,
-    AllocatorPtr allocator, concurrency::ThreadPool* tp, void* einsum_cuda_assets,
+    bool trans_a, bool trans_b, AllocatorPtr allocator, concurrency::ThreadPool* tp, void* einsum_cuda_assets,
     const DeviceHelpers::MatMul<int32_t>& device_matmul_func);
 
 template std::unique_ptr<Tensor> DeviceHelpers::CpuDeviceHelpers::ReduceSum<int32_t>(
@@ -408,13 +467,14 @@ template std::unique_ptr<Tensor> ReduceSum<int32_t>(
 template Status DeviceHelpers::CpuDeviceHelpers::MatMul<double>(
     const double* input_1_data, const double* input_2_data, double* output_data,
     size_t left_stride, size_t right_stride, size_t output_stride,
-    size_t num_batches, size_t M, size_t K, size_t N, concurrency::ThreadPool* tp,
+    size_t num_batches, size_t M, size_t K, size_t N,
+    bool trans_a, bool trans_b, concurrency::ThreadPool* tp,
     void* einsum_cuda_assets);
 
 template std::unique_ptr<Tensor> MatMul<double>(
     const Tensor& input_1, const gsl::span<const int64_t>& input_shape_1_override,
     const Tensor& input_2, const gsl::span<const int64_t>& input_shape_2_override,
-    AllocatorPtr allocator, concurrency::ThreadPool* tp, void* einsum_cuda_assets,
+    bool trans_a, bool trans_b, AllocatorPtr allocator, concurrency::ThreadPool* tp, void* einsum_cuda_assets,
     const DeviceHelpers::MatMul<double>& device_matmul_func);
 
 template std::unique_ptr<Tensor> DeviceHelpers::CpuDeviceHelpers::ReduceSum<double>(
@@ -433,7 +493,8 @@ template std::unique_ptr<Tensor> ReduceSum<double>(
 template Status DeviceHelpers::CpuDeviceHelpers::MatMul<int64_t>(
     const int64_t* input_1_data, const int64_t* input_2_data, int64_t* output_data,
     size_t left_stride, size_t right_stride, size_t output_stride,
-    size_t num_batches, size_t M, size_t K, size_t N, concurrency::ThreadPool* tp,
+    size_t num_batches, size_t M, size_t K, size_t N,
+    bool trans_a, bool trans_b, concurrency::ThreadPool* tp,
     void* einsum_cuda_assets);
 
 template std::unique_ptr<Tensor> DeviceHelpers::CpuDeviceHelpers::ReduceSum<int64_t>(
@@ -445,7 +506,7 @@ template std::unique_ptr<Tensor> DeviceHelpers::CpuDeviceHelpers::ReduceSum<int6
 template std::unique_ptr<Tensor> MatMul<int64_t>(
     const Tensor& input_1, const gsl::span<const int64_t>& input_shape_1_override,
     const Tensor& input_2, const gsl::span<const int64_t>& input_shape_2_override,
-    AllocatorPtr allocator, concurrency::ThreadPool* tp, void* einsum_cuda_assets,
+    bool trans_a, bool trans_b, AllocatorPtr allocator, concurrency::ThreadPool* tp, void* einsum_cuda_assets,
     const DeviceHelpers::MatMul<int64_t>& device_matmul_func);
 
 template std::unique_ptr<Tensor> ReduceSum<int64_t>(
@@ -457,7 +518,7 @@ template std::unique_ptr<Tensor> ReduceSum<int64_t>(
 template std::unique_ptr<Tensor> MatMul<MLFloat16>(
     const Tensor& input_1, const gsl::span<const int64_t>& input_shape_1_override,
     const Tensor& input_2, const gsl::span<const int64_t>& input_shape_2_override,
-    AllocatorPtr allocator, concurrency::ThreadPool* tp, void* einsum_cuda_assets,
+    bool trans_a, bool trans_b, AllocatorPtr allocator, concurrency::ThreadPool* tp, void* einsum_cuda_assets,
     const DeviceHelpers::MatMul<MLFloat16>& device_matmul_func);
 
 template std::unique_ptr<Tensor> ReduceSum<MLFloat16>(
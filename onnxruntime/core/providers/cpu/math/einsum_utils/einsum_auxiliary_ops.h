@@ -33,10 +33,13 @@ using Transpose = std::function<Status(const gsl::span<const size_t>& permutatio
                                        void* einsum_cuda_assets)>;
 
 // MatMul op - Multiplies two inputs of shapes [num_batches, M, K] and [num_batches, K, N]
+// If `trans_a` is set, each batch of the first input is stored as [K, M] instead of [M, K]
+// If `trans_b` is set, each batch of the second input is stored as [N, K] instead of [K, N]
 template <typename T>
 using MatMul = std::function<Status(const T* input_1_data, const T* input_2_data, T* output_data,
                                     size_t left_stride, size_t right_stride, size_t output_stride,
-                                    size_t num_batches, size_t M, size_t K, size_t N, concurrency::ThreadPool* tp,
+                                    size_t num_batches, size_t M, size_t K, size_t N,
+                                    bool trans_a, bool trans_b, concurrency::ThreadPool* tp,
                                     void* einsum_cuda_assets)>;
 
 // ReduceSum op - Reduces along `reduce_axes`
@@ -69,7 +72,8 @@ Status Transpose(const gsl::span<const size_t>& permutation, const Tensor& input
 template <typename T>
 Status MatMul(const T* input_1_data, const T* input_2_data, T* output_data,
               size_t left_stride, size_t right_stride, size_t output_stride,
-              size_t num_batches, size_t M, size_t K, size_t N, concurrency::ThreadPool* tp,
+              size_t num_batches, size_t M, size_t K, size_t N,
+              bool trans_a, bool trans_b, concurrency::ThreadPool* tp,
               void* einsum_cuda_assets);
 
 template <typename T>
@@ -95,10 +99,12 @@ std::unique_ptr<Tensor> Transpose(const Tensor& input, const TensorShape& input_
 // Thin wrapper over the MatMul op to be called from Einsum that does some checks and invokes the device specific helper
 // Not using the MatMulHelper for checks and to compute output dims as it adds a lot of checking overhead involving transposes of the inputs
 // In our case, we have a more simplistic version which doesn't need to have those checks
+// The shape overrides are the logical [batch, M, K] and [batch, K, N] shapes; `trans_a` / `trans_b` indicate
+// that the inner two axes of the corresponding input are stored swapped, which saves an explicit Transpose
 template <typename T>
 std::unique_ptr<Tensor> MatMul(const Tensor& input_1, const gsl::span<const int64_t>& input_1_shape_override,
                                const Tensor& input_2, const gsl::span<const int64_t>& input_2_shape_override,
-                               AllocatorPtr allocator, concurrency::ThreadPool* tp, void* einsum_cuda_assets,
+                               bool trans_a, bool trans_b, AllocatorPtr allocator, concurrency::ThreadPool* tp, void* einsum_cuda_assets,
                                const DeviceHelpers::MatMul<T>& device_matmul_func);
 
 // Thin wrapper over the ReduceSum op
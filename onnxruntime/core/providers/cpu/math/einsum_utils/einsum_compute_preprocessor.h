@@ -15,6 +15,11 @@
 
 #include "einsum_auxiliary_ops.h"
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
 namespace onnxruntime {
 
 namespace EinsumOp {
@@ -41,6 +46,42 @@ inline int64_t LetterToIndex(char ch) {
   return -1;
 }
 
+// The order in which the operands are contracted pair-wise.
+// Each step contracts the live operands at positions `first` and `second` (first < second):
+// the result takes the place of `first` and `second` is dropped from the list of live operands.
+// So {(0, 1), (0, 1), ...} is the plain left-to-right order.
+using ContractionPath = std::vector<std::pair<size_t, size_t>>;
+
+// The contraction path only depends on the equation and the input shapes, so it is searched once
+// per set of input shapes and re-used by subsequent runs of the same node.
+class ContractionPathCache {
+ public:
+  bool Find(const std::vector<int64_t>& input_dims, ContractionPath& path) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = paths_.find(input_dims);
+    if (it == paths_.end()) {
+      return false;
+    }
+    path = it->second;
+    return true;
+  }
+
+  void Insert(const std::vector<int64_t>& input_dims, const ContractionPath& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Models with free dimensions may see many different shapes - don't let the cache grow unbounded
+    if (paths_.size() >= max_cached_paths) {
+      paths_.clear();
+    }
+    paths_.emplace(input_dims, path);
+  }
+
+ private:
+  static constexpr size_t max_cached_paths = 32;
+
+  mutable std::mutex mutex_;
+  std::map<std::vector<int64_t>, ContractionPath> paths_;
+};
+
 }  // namespace EinsumOp
 
 struct EinsumEquationPreprocessor {
@@ -76,9 +117,6 @@ struct EinsumEquationPreprocessor {
   }
 
   // Holds the pre-processed equation string
-  // In theory, we could re-write the einsum equation to lower overall cost of intermediate arrays
-  // See numpy.einsum_path for details/examples
-  // These are very advanced optimizations that we don't require for the average use-case
   std::string einsum_preprocessed_equation_;
 
   // In explicit form, holds the left side of the einsum equation
@@ -95,6 +133,11 @@ struct EinsumEquationPreprocessor {
 
   // Flag indicating if the Einsum op is being used in explicit form (i.e.) contains '->'
   bool is_explicit_ = false;
+
+  // Holds the contraction paths (see numpy.einsum_path) searched for the input shapes seen so far.
+  // Shared by all copies of this instance so that every Compute() of the node sees the same cache.
+  std::shared_ptr<EinsumOp::ContractionPathCache> contraction_path_cache_ =
+      std::make_shared<EinsumOp::ContractionPathCache>();
 };
 
 // Prologue:
@@ -142,6 +185,9 @@ class EinsumComputePreprocessor final {
   // Get the number of subscript indices (subscript labels) in the einsum equation
   int64_t GetNumSubscriptIndices() const;
 
+  // Get the cache of contraction paths of the node this pre-processor runs for
+  EinsumOp::ContractionPathCache& GetContractionPathCache() const;
+
   // Pass-in device specific functions
   // (Pass-in CPU implementation or CUDA implementation function depending on the kernel using this class)
   void SetDeviceHelpers(const EinsumOp::DeviceHelpers::Diagonal& diagonal_func,
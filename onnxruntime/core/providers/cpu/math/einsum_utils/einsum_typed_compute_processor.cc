@@ -5,6 +5,9 @@
 #include "core/common/narrow.h"
 #include "core/common/span_utils.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace onnxruntime {
 
 template <typename T>
@@ -194,6 +197,7 @@ std::unique_ptr<Tensor> EinsumTypedComputeProcessor<T>::PairwiseOperandProcess(c
   }
 
   // Permutate the left operand so that the axes order go like this: [lro, lo, reduce_dims, ro]
+  // (or [lro, reduce_dims, lo, ro] if that only needs a reshape - the MatMul then reads it transposed)
   TensorShapeVector reshaped_dims;
   InlinedVector<size_t> left_permutation;
   left_permutation.reserve(lro.size() + lo.size() + reduce_dims.size() + ro.size());
@@ -204,26 +208,46 @@ std::unique_ptr<Tensor> EinsumTypedComputeProcessor<T>::PairwiseOperandProcess(c
     left_permutation.push_back(onnxruntime::narrow<size_t>(a));
   }
   left_permutation.insert(left_permutation.end(), ro.begin(), ro.end());
+
+  InlinedVector<size_t> left_transposed_permutation;
+  left_transposed_permutation.reserve(left_permutation.size());
+  left_transposed_permutation.insert(left_transposed_permutation.end(), lro.begin(), lro.end());
+  for (auto& a : reduce_dims) {
+    left_transposed_permutation.push_back(onnxruntime::narrow<size_t>(a));
+  }
+  left_transposed_permutation.insert(left_transposed_permutation.end(), lo.begin(), lo.end());
+  left_transposed_permutation.insert(left_transposed_permutation.end(), ro.begin(), ro.end());
+
+  bool trans_a = false;
   if (EinsumOp::IsTransposeRequired(current_left ? current_left->Shape().NumDimensions() : left_dims.size(),
                                     left_permutation)) {
-    if (current_left && IsTransposeReshapeForEinsum(left_permutation,
-                                                    current_left->Shape().GetDims(),
-                                                    reshaped_dims)) {
+    const auto left_operand_dims = current_left ? current_left->Shape().GetDims() : left_dims;
+    if (IsTransposeReshapeForEinsum(left_permutation, left_operand_dims, reshaped_dims)) {
       // This can be done because curent_* tensors (if they exist) and output tensors are
       // intermediate tensors and cannot be input tensors to the Einsum node itself
-      // (which are immutable).
+      // (which are immutable). The inputs don't need the reshape as the MatMul below
+      // only relies on the shape overrides.
       // Covered by ExplicitEinsumAsTensorContractionReshapeLeft.
-      current_left->Reshape(reshaped_dims);
+      if (current_left) {
+        current_left->Reshape(reshaped_dims);
+      }
+    } else if (IsTransposeReshapeForEinsum(left_transposed_permutation, left_operand_dims, reshaped_dims)) {
+      // Let the MatMul read the [lro, reduce_dims, lo] layout transposed instead of copying the data
+      trans_a = true;
+      if (current_left) {
+        current_left->Reshape(reshaped_dims);
+      }
     } else {
       // Covered by ExplicitEinsumAsTensorContraction, DiagonalWithMatmul, ...
       current_left = EinsumOp::Transpose(current_left ? *current_left : left,
-                                         current_left ? current_left->Shape().GetDims() : left_dims,
+                                         left_operand_dims,
                                          left_permutation, allocator_, einsum_ep_assets_,
                                          device_transpose_func_);
     }
   }
 
   // Permutate the right operand so that the axes order go like this: [lro, reduce_dims, ro, lo]
+  // (or [lro, ro, reduce_dims, lo] if that only needs a reshape - the MatMul then reads it transposed)
   InlinedVector<size_t> right_permutation;
   right_permutation.reserve(lro.size() + lo.size() + reduce_dims.size() + ro.size());
   right_permutation.insert(right_permutation.end(), lro.begin(), lro.end());
@@ -233,18 +257,36 @@ std::unique_ptr<Tensor> EinsumTypedComputeProcessor<T>::PairwiseOperandProcess(c
   }
   right_permutation.insert(right_permutation.end(), ro.begin(), ro.end());
   right_permutation.insert(right_permutation.end(), lo.begin(), lo.end());
+
+  InlinedVector<size_t> right_transposed_permutation;
+  right_transposed_permutation.reserve(right_permutation.size());
+  right_transposed_permutation.insert(right_transposed_permutation.end(), lro.begin(), lro.end());
+  right_transposed_permutation.insert(right_transposed_permutation.end(), ro.begin(), ro.end());
+  for (auto& a : reduce_dims) {
+    right_transposed_permutation.push_back(onnxruntime::narrow<size_t>(a));
+  }
+  right_transposed_permutation.insert(right_transposed_permutation.end(), lo.begin(), lo.end());
+
+  bool trans_b = false;
   if (EinsumOp::IsTransposeRequired(current_right ? current_right->Shape().GetDims().size() : right_dims.size(),
                                     right_permutation)) {
-    if (current_right && IsTransposeReshapeForEinsum(right_permutation,
-                                                     current_right->Shape().GetDims(),
-                                                     reshaped_dims)) {
+    const auto right_operand_dims = current_right ? current_right->Shape().GetDims() : right_dims;
+    if (IsTransposeReshapeForEinsum(right_permutation, right_operand_dims, reshaped_dims)) {
       // See note following the previous call of function IsTransposeReshapeForEinsum.
       // Covered by ExplicitEinsumAsBatchedMatmulWithBroadcasting_1, ExplicitEinsumAsMatmul_2, ...
-      current_right->Reshape(reshaped_dims);
+      if (current_right) {
+        current_right->Reshape(reshaped_dims);
+      }
+    } else if (IsTransposeReshapeForEinsum(right_transposed_permutation, right_operand_dims, reshaped_dims)) {
+      // Let the MatMul read the [lro, ro, reduce_dims] layout transposed instead of copying the data
+      trans_b = true;
+      if (current_right) {
+        current_right->Reshape(reshaped_dims);
+      }
     } else {
       // Covered by DiagonalWithMatmul, ExplicitEinsumAsBatchedMatmul, ...
       current_right = EinsumOp::Transpose(current_right ? *current_right : right,
-                                          current_right ? current_right->Shape().GetDims() : right_dims,
+                                          right_operand_dims,
                                           right_permutation, allocator_, einsum_ep_assets_,
                                           device_transpose_func_);
     }
@@ -308,7 +350,7 @@ std::unique_ptr<Tensor> EinsumTypedComputeProcessor<T>::PairwiseOperandProcess(c
   // Multiply the mutated inputs
   auto output = EinsumOp::MatMul<T>(current_left ? *current_left : left, TensorShapeVector{lro_size, lo_size, reduced_size},
                                     current_right ? *current_right : right, TensorShapeVector{lro_size, reduced_size, ro_size},
-                                    allocator_, tp_, einsum_ep_assets_, device_matmul_func_);
+                                    trans_a, trans_b, allocator_, tp_, einsum_ep_assets_, device_matmul_func_);
 
   output->Reshape(output_dims);
 
@@ -332,6 +374,131 @@ std::unique_ptr<Tensor> EinsumTypedComputeProcessor<T>::PairwiseOperandProcess(c
   return output;
 }
 
+// Contraction path search, in the spirit of numpy.einsum_path / opt_einsum.
+// Operands are described by their homogenized dims (a dim value of 1 means the operand doesn't have the subscript).
+// The cost of contracting a pair is the number of multiply-adds of the pair-wise MatMul (the product of all
+// the dims spanned by the pair) and the result keeps a dim only if it occurs in the output or in another live operand.
+static TensorShapeVector ContractOperandDims(const InlinedVector<TensorShapeVector>& operands,
+                                             size_t first, size_t second,
+                                             const std::vector<int64_t>& subscript_indices_to_output_indices,
+                                             double& flops) {
+  const size_t num_dims = operands[first].size();
+  TensorShapeVector result(num_dims, 1);
+  flops = 1.0;
+  for (size_t dim = 0; dim < num_dims; ++dim) {
+    const int64_t dim_value = std::max(operands[first][dim], operands[second][dim]);
+    flops *= static_cast<double>(dim_value);
+
+    bool is_kept = subscript_indices_to_output_indices[dim] != -1;
+    for (size_t operand = 0; !is_kept && operand < operands.size(); ++operand) {
+      is_kept = operand != first && operand != second && operands[operand][dim] > 1;
+    }
+    if (is_kept) {
+      result[dim] = dim_value;
+    }
+  }
+  return result;
+}
+
+static double NumElements(const TensorShapeVector& dims) {
+  double size = 1.0;
+  for (auto dim : dims) {
+    size *= static_cast<double>(dim);
+  }
+  return size;
+}
+
+// Exhaustive search over all the pair-wise orders - only affordable for a handful of operands.
+// Pairs are visited in ascending order and only strictly cheaper paths replace the best one,
+// so the plain left-to-right order is kept unless there is something to gain.
+static void SearchOptimalContractionPath(const InlinedVector<TensorShapeVector>& operands,
+                                         const std::vector<int64_t>& subscript_indices_to_output_indices,
+                                         double cost, EinsumOp::ContractionPath& current_path,
+                                         EinsumOp::ContractionPath& best_path, double& best_cost) {
+  if (operands.size() == 1) {
+    if (cost < best_cost) {
+      best_cost = cost;
+      best_path = current_path;
+    }
+    return;
+  }
+
+  for (size_t first = 0; first < operands.size(); ++first) {
+    for (size_t second = first + 1; second < operands.size(); ++second) {
+      double flops = 0.0;
+      auto contracted = ContractOperandDims(operands, first, second, subscript_indices_to_output_indices, flops);
+      if (cost + flops >= best_cost) {
+        continue;
+      }
+
+      InlinedVector<TensorShapeVector> remaining_operands = operands;
+      remaining_operands[first] = std::move(contracted);
+      remaining_operands.erase(remaining_operands.begin() + second);
+
+      current_path.emplace_back(first, second);
+      SearchOptimalContractionPath(remaining_operands, subscript_indices_to_output_indices, cost + flops,
+                                   current_path, best_path, best_cost);
+      current_path.pop_back();
+    }
+  }
+}
+
+// Greedy search for larger operand counts: repeatedly contract the pair that shrinks the
+// live intermediates the most (ties broken by the cost of the contraction)
+static EinsumOp::ContractionPath SearchGreedyContractionPath(InlinedVector<TensorShapeVector> operands,
+                                                             const std::vector<int64_t>& subscript_indices_to_output_indices) {
+  EinsumOp::ContractionPath path;
+  while (operands.size() > 1) {
+    size_t best_first = 0;
+    size_t best_second = 1;
+    double best_size_delta = std::numeric_limits<double>::max();
+    double best_flops = std::numeric_limits<double>::max();
+    TensorShapeVector best_contracted;
+
+    for (size_t first = 0; first < operands.size(); ++first) {
+      for (size_t second = first + 1; second < operands.size(); ++second) {
+        double flops = 0.0;
+        auto contracted = ContractOperandDims(operands, first, second, subscript_indices_to_output_indices, flops);
+        const double size_delta = NumElements(contracted) - NumElements(operands[first]) - NumElements(operands[second]);
+        if (size_delta < best_size_delta || (size_delta == best_size_delta && flops < best_flops)) {
+          best_first = first;
+          best_second = second;
+          best_size_delta = size_delta;
+          best_flops = flops;
+          best_contracted = std::move(contracted);
+        }
+      }
+    }
+
+    operands[best_first] = std::move(best_contracted);
+    operands.erase(operands.begin() + best_second);
+    path.emplace_back(best_first, best_second);
+  }
+  return path;
+}
+
+static EinsumOp::ContractionPath FindContractionPath(gsl::span<const TensorShape> operand_shapes,
+                                                     const std::vector<int64_t>& subscript_indices_to_output_indices) {
+  // Same threshold as opt_einsum's 'auto' strategy
+  constexpr size_t max_operands_for_optimal_search = 4;
+
+  InlinedVector<TensorShapeVector> operands;
+  operands.reserve(operand_shapes.size());
+  for (const auto& shape : operand_shapes) {
+    operands.push_back(shape.AsShapeVector());
+  }
+
+  if (operands.size() > max_operands_for_optimal_search) {
+    return SearchGreedyContractionPath(std::move(operands), subscript_indices_to_output_indices);
+  }
+
+  EinsumOp::ContractionPath current_path;
+  EinsumOp::ContractionPath best_path;
+  double best_cost = std::numeric_limits<double>::max();
+  SearchOptimalContractionPath(operands, subscript_indices_to_output_indices, 0.0, current_path, best_path, best_cost);
+  return best_path;
+}
+
 template <typename T>
 void EinsumTypedComputeProcessor<T>::SetDeviceHelpers(const EinsumOp::DeviceHelpers::Transpose& device_transpose_func,
                                                       const EinsumOp::DeviceHelpers::MatMul<T>& device_matmul_func,
@@ -400,26 +567,84 @@ Status EinsumTypedComputeProcessor<T>::Run() {
 
   // Process the operands in a pair-wise fashion
   {
-    bool is_final_pair = false;
-    // Keep processing each input pair-wise
-    for (int input = 1; input < num_inputs; ++input) {
+    const auto& subscript_indices_to_output_indices =
+        einsum_compute_preprocessor_.GetMappedSubscriptIndicesToOutputindices();
+
+    // The live operands along with the shapes they are to be processed with.
+    // The intermediate results are owned by `live_results`.
+    InlinedVector<const Tensor*> live_tensors;
+    InlinedVector<TensorShape> live_shapes;
+    InlinedVector<std::unique_ptr<const Tensor>> live_results;
+    live_tensors.reserve(onnxruntime::narrow<size_t>(num_inputs));
+    live_shapes.reserve(onnxruntime::narrow<size_t>(num_inputs));
+    live_results.reserve(onnxruntime::narrow<size_t>(num_inputs));
+
+    for (int input = 0; input < num_inputs; ++input) {
+      if (input == 0) {
+        live_tensors.push_back(result ? result.get() : raw_inputs[0]);
+        live_shapes.push_back(result ? result->Shape() : homogenized_input_dims[0]);
+        live_results.push_back(std::move(result));
+      } else {
+        // Use either the preprocessed inputs (if it is available) or the corresponding raw inputs
+        live_tensors.push_back(preprocessed_inputs[input] ? preprocessed_inputs[input].get() : raw_inputs[input]);
+        live_shapes.push_back(homogenized_input_dims[input]);
+        live_results.push_back(nullptr);
+      }
+    }
+
+    EinsumOp::ContractionPath path;
+    if (num_inputs == 2) {
+      path.emplace_back(0, 1);
+    } else {
+      std::vector<int64_t> path_key;
+      for (const auto& shape : live_shapes) {
+        const auto dims = shape.GetDims();
+        path_key.insert(path_key.end(), dims.begin(), dims.end());
+      }
+
+      auto& path_cache = einsum_compute_preprocessor_.GetContractionPathCache();
+      if (!path_cache.Find(path_key, path)) {
+        path = FindContractionPath(live_shapes, subscript_indices_to_output_indices);
+        path_cache.Insert(path_key, path);
+      }
+    }
+
+    InlinedVector<bool> is_reduced(onnxruntime::narrow<size_t>(num_subscript_labels), false);
+    for (size_t step = 0, num_steps = path.size(); step < num_steps; ++step) {
+      const size_t first = path[step].first;
+      const size_t second = path[step].second;
+
+      // A dim that doesn't occur in the output can be reduced as soon as no other live operand has it
       TensorShapeVector reduced_dims;
       reduced_dims.reserve(onnxruntime::narrow<size_t>(num_subscript_labels));  // num_subscript_labels is the upper bound. No harm in over-reserving by a small margin.
-      for (int64_t dim = 0; dim < num_subscript_labels; ++dim) {
-        if (mapped_indices_to_last_input_index[onnxruntime::narrow<size_t>(dim)] == input) {
-          // This is the last input we are seeing this dimension (and it doesn't occur in the output), so reduce along the dimension
-          reduced_dims.push_back(dim);
+      for (size_t dim = 0; dim < onnxruntime::narrow<size_t>(num_subscript_labels); ++dim) {
+        if (is_reduced[dim] || subscript_indices_to_output_indices[dim] != -1) {
+          continue;
+        }
+        bool is_needed_later = false;
+        for (size_t operand = 0; operand < live_shapes.size(); ++operand) {
+          if (operand != first && operand != second && live_shapes[operand][dim] > 1) {
+            is_needed_later = true;
+            break;
+          }
+        }
+        if (!is_needed_later) {
+          reduced_dims.push_back(static_cast<int64_t>(dim));
+          is_reduced[dim] = true;
         }
       }
-      if (input == num_inputs - 1) {
-        is_final_pair = true;
-      }
-      // Use either the preprocessed inputs (if it is available) or the corresponding raw inputs
-      result = PairwiseOperandProcess(result ? *result : *raw_inputs[0],
-                                      result ? result->Shape() : homogenized_input_dims[0],
-                                      preprocessed_inputs[input] ? *preprocessed_inputs[input] : *raw_inputs[input],
-                                      homogenized_input_dims[input],
-                                      reduced_dims, is_final_pair);
+
+      auto contracted = PairwiseOperandProcess(*live_tensors[first], live_shapes[first],
+                                               *live_tensors[second], live_shapes[second],
+                                               reduced_dims, step + 1 == num_steps);
+
+      live_tensors[first] = contracted.get();
+      live_shapes[first] = contracted->Shape();
+      live_results[first] = std::move(contracted);
+
+      live_tensors.erase(live_tensors.begin() + second);
+      live_shapes.erase(live_shapes.begin() + second);
+      live_results.erase(live_results.begin() + second);
     }
   }
 
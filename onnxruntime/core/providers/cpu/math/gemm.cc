@@ -2,10 +2,13 @@
 // Licensed under the MIT License.
 
 #include <onnxruntime_config.h>
+#include <limits>
 #include "core/providers/cpu/math/gemm.h"
 #include "core/common/narrow.h"
+#include "core/common/parse_string.h"
 #include "core/common/safeint.h"
 #include "core/providers/cpu/math/gemm_matmul_common.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #include "core/util/math_cpuonly.h"
 #include "gemm_helper.h"
 #include "core/mlas/inc/mlas.h"
@@ -138,6 +141,60 @@ bool GemmPackBFp32(AllocatorPtr& alloc,
   return true;
 }
 
+float GemmSparseBlockSparsityThreshold(const OpKernelInfo& info) {
+  // a threshold above 1 can never be reached, which keeps the dense SGEMM
+  if (info.GetConfigOptions().GetConfigOrDefault(kOrtSessionOptionsMlasEnableSparseGemm, "0") != "1") {
+    return std::numeric_limits<float>::infinity();
+  }
+
+  const std::string config = info.GetConfigOptions().GetConfigOrDefault(
+      kOrtSessionOptionsMlasSparseGemmBlockSparsityThreshold, "0.85");
+  float threshold;
+  ORT_ENFORCE(TryParseStringWithClassicLocale(config, threshold),
+              "Invalid value for ", kOrtSessionOptionsMlasSparseGemmBlockSparsityThreshold, ": ", config);
+  return threshold;
+}
+
+bool GemmPackBSparseFp32(AllocatorPtr& alloc,
+                         const Tensor& tensor_b,
+                         bool trans_b,
+                         float sparsity_threshold,
+                         IAllocatorUniquePtr<void>& packed_b,
+                         size_t& packed_b_size,
+                         TensorShape& b_shape) {
+  if (tensor_b.Shape().NumDimensions() != 2 || sparsity_threshold > 1.0f) {
+    return false;
+  }
+
+  const TensorShape& shape = tensor_b.Shape();
+  const size_t K = trans_b ? static_cast<size_t>(shape[1]) : static_cast<size_t>(shape[0]);
+  const size_t N = trans_b ? static_cast<size_t>(shape[0]) : static_cast<size_t>(shape[1]);
+  const CBLAS_TRANSPOSE trans = trans_b ? CblasTrans : CblasNoTrans;
+  const float* b_data = tensor_b.Data<float>();
+  const size_t ldb = trans_b ? K : N;
+
+  const size_t max_packed_b_size = MlasSparseGemmPackBSize(N, K);
+  if (max_packed_b_size == 0) {
+    return false;
+  }
+
+  // B is scanned once: the pack reports both the block sparsity and the bytes it used of the worst case buffer.
+  auto max_packed_b = IAllocator::MakeUniquePtr<void>(alloc, max_packed_b_size, true);
+  const size_t used_packed_b_size = MlasSparseGemmPackB(trans, N, K, b_data, ldb, max_packed_b.get());
+
+  // the block sparse kernel only pays off once most of the blocks of the weight can be skipped
+  if (MlasSparseGemmPackedBBlockSparsity(max_packed_b.get()) < sparsity_threshold) {
+    return false;
+  }
+
+  packed_b_size = used_packed_b_size;
+  b_shape = shape;
+
+  packed_b = IAllocator::MakeUniquePtr<void>(alloc, packed_b_size, true);
+  memcpy(packed_b.get(), max_packed_b.get(), packed_b_size);
+  return true;
+}
+
 template <typename T>
 void Gemm<T>::ComputeGemm(CBLAS_TRANSPOSE trans_a, CBLAS_TRANSPOSE trans_b,
                           ptrdiff_t M, ptrdiff_t N, ptrdiff_t K,
@@ -253,7 +310,10 @@ Status Gemm<float>::PrePack(const Tensor& tensor, int input_idx,
   // only pack Matrix B
   if (input_idx == 1) {
     size_t packed_b_size;
-    is_packed = GemmPackBFp32(alloc, tensor, trans_B_ != CblasNoTrans, packed_b_, packed_b_size, b_shape_);
+    packed_b_is_sparse_ = GemmPackBSparseFp32(alloc, tensor, trans_B_ != CblasNoTrans,
+                                              sparse_block_sparsity_threshold_, packed_b_, packed_b_size, b_shape_);
+    is_packed = packed_b_is_sparse_ ||
+                GemmPackBFp32(alloc, tensor, trans_B_ != CblasNoTrans, packed_b_, packed_b_size, b_shape_);
     bool share_prepacked_weights = (prepacked_weights != nullptr);
     if (is_packed && share_prepacked_weights) {
       prepacked_weights->buffers_.push_back(std::move(packed_b_));
@@ -411,6 +471,18 @@ Status Gemm<float>::Compute(OpKernelContext* context) const {
   if (B) {
     ComputeGemm(trans_A_, trans_B_, M, N, K, alpha_, A->Data<float>(), B->Data<float>(), beta_,
                 c_data, c_shape, y_data, thread_pool);
+  } else if (packed_b_is_sparse_) {
+    GemmBroadcastBias(M, N, beta_, c_data, c_shape, y_data);
+    MLAS_SGEMM_DATA_PARAMS data;
+    data.A = A->Data<float>();
+    data.lda = static_cast<size_t>(trans_A_ != CblasNoTrans ? M : K);
+    data.B = static_cast<const float*>(packed_b_.get());
+    data.C = y_data;
+    data.ldc = static_cast<size_t>(N);
+    data.alpha = alpha_;
+    data.beta = c_data != nullptr ? beta_ : 0.0f;
+    MlasSparseGemmBatch(trans_A_, static_cast<size_t>(M), static_cast<size_t>(N), static_cast<size_t>(K),
+                        &data, 1, thread_pool);
   } else {
     GemmBroadcastBias(M, N, beta_, c_data, c_shape, y_data);
     MlasGemm(
@@ -9,13 +9,15 @@
 #include "core/common/common.h"
 #include "core/util/math.h"
 #include "core/providers/cpu/activation/activations.h"
+#include "core/providers/cpu/math/gemm_matmul_common.h"
 
 namespace onnxruntime {
 
 template <typename T>
 class Gemm : protected GemmBase, public OpKernel {
  public:
-  Gemm(const OpKernelInfo& info) : GemmBase(info), OpKernel(info) {
+  Gemm(const OpKernelInfo& info)
+      : GemmBase(info), OpKernel(info), sparse_block_sparsity_threshold_(GemmSparseBlockSparsityThreshold(info)) {
   }
 
   Status Compute(OpKernelContext* context) const override;
@@ -41,6 +43,10 @@ class Gemm : protected GemmBase, public OpKernel {
   TensorShape b_shape_;
   IAllocatorUniquePtr<void> packed_b_;
 
+  // B is packed for MlasSparseGemmBatch when enough of its blocks are zero
+  float sparse_block_sparsity_threshold_;
+  bool packed_b_is_sparse_ = false;
+
   // For fused gemm + activation
   std::unique_ptr<functors::ElementWiseRangedTransform<T>> activation_;
 
@@ -14,4 +14,17 @@ bool GemmPackBFp32(AllocatorPtr& alloc,
                    size_t& packed_b_size,
                    TensorShape& b_shape);
 
+// Reads the block sparsity that a constant weight needs to be packed for the block sparse SGEMM from the
+// session configuration. Returns a value above 1 when the block sparse SGEMM is not enabled.
+float GemmSparseBlockSparsityThreshold(const OpKernelInfo& info);
+
+// Packs a 2D weight for MlasSparseGemmBatch when its block sparsity reaches sparsity_threshold.
+bool GemmPackBSparseFp32(AllocatorPtr& alloc,
+                         const Tensor& tensor_b,
+                         bool trans_b,
+                         float sparsity_threshold,
+                         IAllocatorUniquePtr<void>& packed_b,
+                         size_t& packed_b_size,
+                         TensorShape& b_shape);
+
 };  // namespace onnxruntime
@@ -5,6 +5,7 @@
 
 #include "core/framework/op_kernel.h"
 #include "core/mlas/inc/mlas.h"
+#include "core/providers/cpu/math/gemm_matmul_common.h"
 #include "core/session/onnxruntime_session_options_config_keys.h"
 
 namespace onnxruntime {
@@ -29,6 +30,7 @@ class MatMul<float> final : public OpKernel {
     info.GetAttrOrDefault<int64_t>("transBatchB", &trans_batch_b_attr, 0);
     trans_batch_a_ = trans_batch_a_attr != 0;
     trans_batch_b_ = trans_batch_b_attr != 0;
+    sparse_block_sparsity_threshold_ = GemmSparseBlockSparsityThreshold(info);
 
 #if defined(__aarch64__) && defined(__linux__)
     auto config_ops = info.GetConfigOptions().GetConfigEntry(kOrtSessionOptionsMlasGemmFastMathArm64Bfloat16);
@@ -49,6 +51,10 @@ class MatMul<float> final : public OpKernel {
   TensorShape b_shape_;
   IAllocatorUniquePtr<void> packed_b_;
 
+  // B is packed for MlasSparseGemmBatch when enough of its blocks are zero
+  float sparse_block_sparsity_threshold_;
+  bool packed_b_is_sparse_ = false;
+
   // For FusedMatMul contrib ops
   float alpha_attr_;
   int64_t trans_a_attr_;
@@ -87,28 +87,41 @@ common::Status ComputeByType(OpKernelContext* context,
 
   Tensor* Y = context->Output(0, x_shape);
   T* y_data = Y->MutableData<T>();
-  if (imputed_values.size() == static_cast<size_t>(stride)) {
-    for (size_t i = 0; i < x_size; i++) {
-      if (std::isnan(static_cast<float>(x_data[i])) && std::isnan(static_cast<float>(replaced_value))) {
-        y_data[i] = imputed_values[i % stride];
-      } else if (x_data[i] == replaced_value) {
-        y_data[i] = imputed_values[i % stride];
-      } else {
-        y_data[i] = x_data[i];
-      }
-    }
-  } else {
-    for (size_t i = 0; i < x_size; i++) {
-      if (std::isnan(static_cast<float>(x_data[i])) && std::isnan(static_cast<float>(replaced_value))) {
-        y_data[i] = imputed_values[0];
-      } else if (x_data[i] == replaced_value) {
-        y_data[i] = imputed_values[0];
-      } else {
-        y_data[i] = x_data[i];
-      }
-    }
+  if (x_size == 0) {
+    return Status::OK();
   }
 
+  // a NaN replaced value matches every NaN input, otherwise the values are compared directly
+  const bool replace_nan = std::isnan(static_cast<float>(replaced_value));
+  auto impute = [replace_nan, replaced_value](T x, T imputed_value) {
+    const bool replace = replace_nan ? std::isnan(static_cast<float>(x)) : x == replaced_value;
+    return replace ? imputed_value : x;
+  };
+
+  // split the input into rows of 'stride' values so that every task reads the imputed values from the start
+  const bool per_feature = imputed_values.size() == static_cast<size_t>(stride);
+  const ptrdiff_t row_size = per_feature ? onnxruntime::narrow<ptrdiff_t>(stride) : std::min<ptrdiff_t>(4096, x_size);
+  const ptrdiff_t num_rows = (onnxruntime::narrow<ptrdiff_t>(x_size) + row_size - 1) / row_size;
+  const TensorOpCost cost{static_cast<double>(row_size * sizeof(T)), static_cast<double>(row_size * sizeof(T)),
+                          static_cast<double>(row_size * 2)};
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), num_rows, cost, [&](ptrdiff_t first, ptrdiff_t last) {
+        const ptrdiff_t begin = first * row_size;
+        const ptrdiff_t end = std::min(last * row_size, onnxruntime::narrow<ptrdiff_t>(x_size));
+        if (per_feature) {
+          for (ptrdiff_t row = begin; row < end; row += row_size) {
+            for (ptrdiff_t i = 0; i < row_size; ++i) {
+              y_data[row + i] = impute(x_data[row + i], imputed_values[i]);
+            }
+          }
+        } else {
+          const T imputed_value = imputed_values[0];
+          for (ptrdiff_t i = begin; i < end; ++i) {
+            y_data[i] = impute(x_data[i], imputed_value);
+          }
+        }
+      });
+
   return Status::OK();
 }
 
@@ -8,10 +8,29 @@
 #include "core/providers/cpu/ml/ml_common.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/common/safeint.h"
+#include "core/platform/threadpool.h"
 
 namespace onnxruntime {
 namespace ml {
 
+// Looks up every input in map, or uses default_value if it is not a key, over blocks of the input in parallel.
+template <typename TKey, typename TValue, typename TMap>
+void MapLabels(const TMap& map, const TValue& default_value, gsl::span<const TKey> input, gsl::span<TValue> output,
+               concurrency::ThreadPool* tp) {
+  // hashing and copying strings costs much more than the lookup of a number
+  constexpr bool has_strings = std::is_same_v<TKey, std::string> || std::is_same_v<TValue, std::string>;
+  const TensorOpCost cost{static_cast<double>(sizeof(TKey)), static_cast<double>(sizeof(TValue)),
+                          has_strings ? 64.0 : 8.0};
+  const auto map_end = map.end();
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(input.size()), cost, [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t i = first; i < last; ++i) {
+          const auto found = map.find(input[i]);
+          output[i] = found == map_end ? default_value : found->second;
+        }
+      });
+}
+
 class LabelEncoder final : public OpKernel {
  public:
   LabelEncoder(const OpKernelInfo& info) : OpKernel(info) {
@@ -72,16 +91,8 @@ class LabelEncoder_2 final : public OpKernel {
     const TensorShape& shape = X->Shape();
     auto* Y = context->Output(0, shape);
 
-    auto input = X->template DataAsSpan<TKey>();
-    auto output = Y->template MutableDataAsSpan<TValue>();
-    auto input_iter = input.begin();
-    auto output_iter = output.begin();
-    while (input_iter != input.end()) {
-      const auto found = map_.find(*input_iter);
-      *output_iter = found == map_.end() ? default_value_ : found->second;
-      ++output_iter;
-      ++input_iter;
-    }
+    MapLabels(map_, default_value_, X->template DataAsSpan<TKey>(), Y->template MutableDataAsSpan<TValue>(),
+              context->GetOperatorThreadPool());
     return Status::OK();
   }
 
@@ -211,16 +222,8 @@ class LabelEncoder_4 final : public OpKernel {
     const TensorShape& shape = X->Shape();
     auto* Y = context->Output(0, shape);
 
-    auto input = X->template DataAsSpan<TKey>();
-    auto output = Y->template MutableDataAsSpan<TValue>();
-    auto input_iter = input.begin();
-    auto output_iter = output.begin();
-    while (input_iter != input.end()) {
-      const auto found = map_.find(*input_iter);
-      *output_iter = found == map_.end() ? default_value_ : found->second;
-      ++output_iter;
-      ++input_iter;
-    }
+    MapLabels(map_, default_value_, X->template DataAsSpan<TKey>(), Y->template MutableDataAsSpan<TValue>(),
+              context->GetOperatorThreadPool());
     return Status::OK();
   }
 
@@ -136,17 +136,18 @@ Status Normalizer::Normalize(OpKernelContext* context) const {
   const T* input = X.Data<T>();
   float* output = Y->MutableData<float>();
 
+  void (*normalize)(const T*, float*, int64_t, int64_t) = nullptr;
   switch (normalization_) {
     case NORMALIZE::NMAX: {
-      NormalizeMax(input, output, num_batches, batch_size);
+      normalize = NormalizeMax<T>;
       break;
     }
     case NORMALIZE::L1: {
-      NormalizeL1(input, output, num_batches, batch_size);
+      normalize = NormalizeL1<T>;
       break;
     }
     case NORMALIZE::L2: {
-      NormalizeL2(input, output, num_batches, batch_size);
+      normalize = NormalizeL2<T>;
       break;
     }
     default: {
@@ -154,6 +155,15 @@ Status Normalizer::Normalize(OpKernelContext* context) const {
     }
   }
 
+  // every batch is normalized independently
+  const TensorOpCost cost{static_cast<double>(batch_size * sizeof(T)), static_cast<double>(batch_size * sizeof(float)),
+                          static_cast<double>(batch_size * 4)};
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), onnxruntime::narrow<ptrdiff_t>(num_batches), cost,
+      [&](ptrdiff_t first, ptrdiff_t last) {
+        normalize(input + first * batch_size, output + first * batch_size, last - first, batch_size);
+      });
+
   return Status::OK();
 }
 
@@ -2,6 +2,9 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/ml/onehotencoder.h"
+
+#include <atomic>
+
 /**
 https://github.com/onnx/onnx/blob/main/onnx/defs/traditionalml/defs.cc
 ONNX_OPERATOR_SCHEMA(OneHotEncoder)
@@ -68,6 +71,34 @@ OneHotEncoderOp<T>::OneHotEncoderOp(const OpKernelInfo& info) : OpKernel(info),
   ORT_ENFORCE(num_categories_ > 0);
 }
 
+// Writes one row of num_categories values per input value. find_category(i) returns the category of input i or -1
+// when it is unknown. Each task clears and fills its own rows of the output.
+template <typename FindCategory>
+static common::Status EncodeInParallel(OpKernelContext* context, int64_t x_size, int64_t num_categories, bool zeros,
+                                       float* y_data, FindCategory find_category) {
+  std::atomic<bool> unknown_category{false};
+  const TensorOpCost cost{static_cast<double>(sizeof(int64_t)), static_cast<double>(num_categories * sizeof(float)),
+                          static_cast<double>(num_categories + 32)};
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), onnxruntime::narrow<ptrdiff_t>(x_size), cost,
+      [&](ptrdiff_t first, ptrdiff_t last) {
+        std::fill(y_data + first * num_categories, y_data + last * num_categories, 0.0f);
+        for (ptrdiff_t i = first; i < last; ++i) {
+          const int64_t category = find_category(i);
+          if (category >= 0) {
+            y_data[i * num_categories + category] = 1.0f;
+          } else if (!zeros) {
+            unknown_category = true;
+          }
+        }
+      });
+
+  if (unknown_category) {
+    return Status(ONNXRUNTIME, FAIL, "Unknown Category and zeros = 0.");
+  }
+  return Status::OK();
+}
+
 template <typename T>
 common::Status OneHotEncoderOp<T>::Compute(OpKernelContext* context) const {
   const auto* X = context->Input<Tensor>(0);
@@ -78,19 +109,13 @@ common::Status OneHotEncoderOp<T>::Compute(OpKernelContext* context) const {
 
   Tensor* Y = context->Output(0, TensorShape(output_shape));
   auto* y_data = Y->MutableData<float>();
-  std::fill_n(y_data, Y->Shape().Size(), 0.0f);
 
   const auto* x_data = X->Data<T>();
-  const auto x_size = input_shape.Size();
-  std::unordered_map<int64_t, size_t>::const_iterator idx;
-  for (int64_t i = 0; i < x_size; ++i) {
-    auto int_idx = cats_int64s_.find(static_cast<int64_t>(x_data[i]));
-    if (int_idx != cats_int64s_.cend())
-      y_data[i * num_categories_ + int_idx->second] = 1.0f;
-    else if (!zeros_)
-      return Status(ONNXRUNTIME, FAIL, "Unknown Category and zeros = 0.");
-  }
-  return Status::OK();
+  return EncodeInParallel(context, input_shape.Size(), num_categories_, zeros_ != 0, y_data,
+                          [this, x_data](int64_t i) {
+                            auto int_idx = cats_int64s_.find(static_cast<int64_t>(x_data[i]));
+                            return int_idx != cats_int64s_.cend() ? static_cast<int64_t>(int_idx->second) : -1;
+                          });
 }
 
 template <>
@@ -103,18 +128,13 @@ common::Status OneHotEncoderOp<std::string>::Compute(OpKernelContext* context) c
 
   Tensor* Y = context->Output(0, TensorShape(output_shape));
   auto* y_data = Y->MutableData<float>();
-  std::fill_n(y_data, Y->Shape().Size(), 0.0f);
 
   const auto* x_data = X->Data<std::string>();
-  const auto x_size = input_shape.Size();
-  for (int64_t i = 0; i < x_size; ++i) {
-    auto str_idx = cats_strings_.find(x_data[i]);
-    if (str_idx != cats_strings_.cend())
-      y_data[i * num_categories_ + str_idx->second] = 1.0f;
-    else if (!zeros_)
-      return Status(ONNXRUNTIME, FAIL, "Unknown Category and zeros = 0.");
-  }
-  return Status::OK();
+  return EncodeInParallel(context, input_shape.Size(), num_categories_, zeros_ != 0, y_data,
+                          [this, x_data](int64_t i) {
+                            auto str_idx = cats_strings_.find(x_data[i]);
+                            return str_idx != cats_strings_.cend() ? static_cast<int64_t>(str_idx->second) : -1;
+                          });
 }
 
 }  // namespace ml
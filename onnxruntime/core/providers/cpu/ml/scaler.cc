@@ -60,8 +60,6 @@ ONNX_CPU_OPERATOR_TYPED_ML_KERNEL(
     KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<int32_t>()).MayInplace(0, 0),
     ScalerOp<int32_t>);
 
-static constexpr int kParallelizationThreshold = 10 * 1000;
-
 template <typename T>
 ScalerOp<T>::ScalerOp(const OpKernelInfo& info) : OpKernel(info),
                                                   scale_(info.GetAttrsOrDefault<float>("scale")),
@@ -85,33 +83,55 @@ common::Status ScalerOp<T>::Compute(OpKernelContext* context) const {
 
   size_t x_size = onnxruntime::narrow<size_t>(x_shape.Size());
   int64_t stride = x_dims.size() == 1 ? x_dims[0] : x_dims[1];
-  auto* ttp = context->GetOperatorThreadPool();
-  auto conditional_batch_call = [ttp, x_size](std::function<void(ptrdiff_t)> f) {
-    if (x_size < kParallelizationThreshold) {  // TODO: tune this, arbitrary threshold
-      for (size_t i = 0; i < x_size; ++i) {
-        f(i);
-      }
-    } else {
-      concurrency::ThreadPool::TryBatchParallelFor(ttp, x_size, f, 0);
-    }
-  };
 
-  if (static_cast<int64_t>(offset_.size()) == stride &&
-      static_cast<int64_t>(scale_.size()) == stride) {
-    auto fn = [this, y_data, x_data, stride](ptrdiff_t i) {
-      y_data[i] = static_cast<float>((x_data[i] - offset_[i % stride]) * scale_[i % stride]);
-    };
-    conditional_batch_call(fn);
-  } else if (offset_.size() == 1 && scale_.size() == 1) {
-    auto fn = [this, y_data, x_data](ptrdiff_t i) {
-      y_data[i] = static_cast<float>((x_data[i] - offset_[0]) * scale_[0]);
-    };
-    conditional_batch_call(fn);
-  } else {
+  const bool per_feature = static_cast<int64_t>(offset_.size()) == stride &&
+                           static_cast<int64_t>(scale_.size()) == stride;
+  if (!per_feature && !(offset_.size() == 1 && scale_.size() == 1)) {
     std::ostringstream err_msg;
     err_msg << "Either both scale and offset can be of feature size (" << stride << ") or 1";
     return Status(ONNXRUNTIME, INVALID_ARGUMENT, err_msg.str());
   }
+
+  if (x_size == 0) {
+    return Status::OK();
+  }
+
+  auto* ttp = context->GetOperatorThreadPool();
+  const float* offset = offset_.data();
+  const float* scale = scale_.data();
+
+  if (per_feature) {
+    // Process whole rows so that the inner loop reads the offsets and scales sequentially and can be vectorized.
+    // X and Y may share a buffer, every value is read before it is written.
+    const ptrdiff_t row_size = onnxruntime::narrow<ptrdiff_t>(stride);
+    const ptrdiff_t num_rows = onnxruntime::narrow<ptrdiff_t>(x_size) / row_size;
+    const TensorOpCost cost{static_cast<double>(row_size * sizeof(T)), static_cast<double>(row_size * sizeof(float)),
+                            static_cast<double>(row_size * 2)};
+    concurrency::ThreadPool::TryParallelFor(ttp, num_rows, cost, [&](ptrdiff_t first, ptrdiff_t last) {
+      for (ptrdiff_t row = first; row < last; ++row) {
+        const T* x = x_data + row * row_size;
+        float* y = y_data + row * row_size;
+        for (ptrdiff_t i = 0; i < row_size; ++i) {
+          y[i] = static_cast<float>((x[i] - offset[i]) * scale[i]);
+        }
+      }
+    });
+  } else {
+    constexpr ptrdiff_t block_size = 4096;
+    const ptrdiff_t total = onnxruntime::narrow<ptrdiff_t>(x_size);
+    const ptrdiff_t num_blocks = (total + block_size - 1) / block_size;
+    const TensorOpCost cost{static_cast<double>(block_size * sizeof(T)), static_cast<double>(block_size * sizeof(float)),
+                            static_cast<double>(block_size * 2)};
+    concurrency::ThreadPool::TryParallelFor(ttp, num_blocks, cost, [&](ptrdiff_t first, ptrdiff_t last) {
+      const float offset_value = offset[0];
+      const float scale_value = scale[0];
+      const ptrdiff_t end = std::min(last * block_size, total);
+      for (ptrdiff_t i = first * block_size; i < end; ++i) {
+        y_data[i] = static_cast<float>((x_data[i] - offset_value) * scale_value);
+      }
+    });
+  }
+
   return Status::OK();
 }
 }  // namespace ml
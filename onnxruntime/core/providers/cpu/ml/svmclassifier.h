@@ -5,6 +5,7 @@
 
 #include "core/common/common.h"
 #include "core/framework/op_kernel.h"
+#include "core/platform/threadpool.h"
 #include "core/util/math_cpuonly.h"
 #include "ml_common.h"
 #include "core/providers/cpu/math/gemm.h"
@@ -30,37 +31,93 @@ class SVMCommon {
   void set_kernel_type(KERNEL new_kernel_type) { kernel_type_ = new_kernel_type; }
   KERNEL get_kernel_type() const { return kernel_type_; }
 
+  // Support vectors prepared for evaluating the RBF kernel with a GEMM.
+  // The vectors are shifted by their mean. That does not change the distances between the inputs and the support
+  // vectors, but it keeps the norms small so that expanding the squared distance into norms and a dot product
+  // does not lose precision when the features share a large offset.
+  struct RbfSupportVectors {
+    std::vector<float> center;
+    std::vector<float> vectors;
+    std::vector<float> squared_norms;
+  };
+
+  static RbfSupportVectors PrepareRbfSupportVectors(gsl::span<const float> support_vectors, ptrdiff_t count) {
+    RbfSupportVectors rbf;
+    if (count > 0) {
+      const ptrdiff_t feature_count = narrow<ptrdiff_t>(support_vectors.size()) / count;
+      ConstEigenMatrixMapRowMajor<float> vectors(support_vectors.data(), count, feature_count);
+
+      rbf.center.resize(narrow<size_t>(feature_count));
+      rbf.vectors.resize(narrow<size_t>(count * feature_count));
+      rbf.squared_norms.resize(narrow<size_t>(count));
+
+      EigenVectorMap<float>(rbf.center.data(), feature_count) = vectors.cast<double>().colwise().mean().cast<float>().transpose();
+      EigenMatrixMapRowMajor<float> centered(rbf.vectors.data(), count, feature_count);
+      centered = vectors.rowwise() - ConstEigenVectorMap<float>(rbf.center.data(), feature_count).transpose();
+      EigenVectorMap<float>(rbf.squared_norms.data(), count) = centered.rowwise().squaredNorm();
+    }
+    return rbf;
+  }
+
   template <typename T>
   void batched_kernel_dot(const gsl::span<const T> a, const gsl::span<const T> b,
                           ptrdiff_t m, ptrdiff_t n, ptrdiff_t k,
                           float scalar_C,
                           const gsl::span<T> out,
-                          concurrency::ThreadPool* threadpool) const {
+                          concurrency::ThreadPool* threadpool,
+                          const RbfSupportVectors* rbf = nullptr) const {
     assert(a.size() == size_t(m * k) && b.size() == size_t(k * n) && out.size() == size_t(m * n));
 
     if (kernel_type_ == KERNEL::RBF) {
-      T* cur_out = out.data();
-      const T* cur_batch = a.data();
+      ORT_ENFORCE(rbf != nullptr && rbf->vectors.size() == size_t(n * k), "RBF kernel requires the prepared support vectors");
+      if (m == 0 || n == 0) {
+        return;
+      }
 
-      // each batch has 'k' features
-      for (int64_t batch = 0; batch < m; ++batch) {
-        const T* cur_support_vector = b.data();
+      // shift the inputs by the same offset as the support vectors
+      std::vector<T> centered_input(a.size());
+      ConstEigenMatrixMapRowMajor<T> input_map(a.data(), m, k);
+      EigenMatrixMapRowMajor<T>(centered_input.data(), m, k) =
+          input_map.rowwise() - ConstEigenVectorMap<T>(rbf->center.data(), k).transpose();
 
-        // broadcast the support vectors against the k features in each batch. output is one value per support vector
-        for (int64_t support_vector = 0; support_vector < n; ++support_vector) {
-          T sum = 0.f;
-          const T* cur_input = cur_batch;
+      // |a - b|^2 = |a|^2 + |b|^2 - 2 a.b, so the cross terms for all the rows and support vectors are one GEMM.
+      // The distances and the exponential are then applied to each row of the GEMM output in one pass.
+      onnxruntime::Gemm<T>::ComputeGemm(CBLAS_TRANSPOSE::CblasNoTrans, CBLAS_TRANSPOSE::CblasTrans,
+                                        m, n, k,
+                                        -2.f, centered_input.data(), rbf->vectors.data(), 0.f,
+                                        nullptr, nullptr,
+                                        out.data(),
+                                        threadpool);
 
-          for (int64_t feature = 0; feature < k; ++feature) {
-            T val = *cur_input++ - *cur_support_vector++;
-            sum += val * val;
+      const TensorOpCost cost{static_cast<double>((n + k) * sizeof(T)), static_cast<double>(n * sizeof(T)),
+                              static_cast<double>(n * 8 + k * 2)};
+      concurrency::ThreadPool::TryParallelFor(threadpool, m, cost, [&](ptrdiff_t first, ptrdiff_t last) {
+        for (ptrdiff_t row = first; row < last; ++row) {
+          const T* cur_input = centered_input.data() + row * k;
+          T* cur_out = out.data() + row * n;
+          const T input_norm = ConstEigenVectorMap<T>(cur_input, k).squaredNorm();
+
+          for (ptrdiff_t support_vector = 0; support_vector < n; ++support_vector) {
+            const T norms = input_norm + rbf->squared_norms[support_vector];
+            T sum = norms + cur_out[support_vector];
+
+            // the expansion cancels when the vectors are close compared to their length,
+            // so compute the distance directly in that case.
+            if (sum < norms * kRbfCancellationRatio) {
+              const T* cur_support_vector = rbf->vectors.data() + support_vector * k;
+              sum = 0.f;
+              for (ptrdiff_t feature = 0; feature < k; ++feature) {
+                T val = cur_input[feature] - cur_support_vector[feature];
+                sum += val * val;
+              }
+            }
+
+            cur_out[support_vector] = -gamma_ * sum;
           }
 
-          *cur_out++ = std::exp(-gamma_ * sum);
+          MlasComputeExp(cur_out, cur_out, onnxruntime::narrow<size_t>(n));
         }
-
-        cur_batch += k;  // move to start of next batch
-      }
+      });
     } else {
       float alpha = 1.f;
       float beta = 1.f;
@@ -96,6 +153,8 @@ class SVMCommon {
   }
 
  private:
+  static constexpr float kRbfCancellationRatio = 1.f / 64;
+
   KERNEL kernel_type_;
   float gamma_{0.f};
   float coef0_{0.f};
@@ -106,6 +165,7 @@ class SVMClassifier final : public OpKernel, private SVMCommon {
   using SVMCommon::batched_kernel_dot;
   using SVMCommon::get_kernel_type;
   using SVMCommon::set_kernel_type;
+  using SVMCommon::PrepareRbfSupportVectors;
 
  public:
   SVMClassifier(const OpKernelInfo& info);
@@ -126,6 +186,7 @@ class SVMClassifier final : public OpKernel, private SVMCommon {
   std::vector<float> probb_;
   std::vector<float> coefficients_;
   std::vector<float> support_vectors_;
+  RbfSupportVectors rbf_support_vectors_;
   std::vector<int64_t> classlabels_ints_;
   std::vector<std::string> classlabels_strings_;
   POST_EVAL_TRANSFORM post_transform_;
@@ -34,6 +34,17 @@ class TreeEnsembleCommonAttributes {
   int parallel_N_;       // starts parallelizing the computing by rows if n_rows <= parallel_N_
 };
 
+// Node of the flattened trees (see TreeEnsembleCommon::InitLockstep).
+// Everything needed to move to the next node is in the same cache line.
+template <typename ThresholdType>
+struct TreeNodeLockstep {
+  ThresholdType threshold;
+  uint32_t feature_id;   // the highest bit is set if a missing value follows the true branch
+  uint32_t children[2];  // false child, true child
+
+  static constexpr uint32_t kMissingTrackTrue = 0x80000000u;
+};
+
 // TI: input type
 // TH: tree type (types of the node values and targets)
 // TO: output type, usually float
@@ -48,6 +59,22 @@ class TreeEnsembleCommon : public TreeEnsembleCommonAttributes {
   std::vector<SparseValue<ThresholdType>> weights_;
   std::vector<TreeNodeElement<ThresholdType>*> roots_;
 
+  // Flattened copy of nodes_ used to evaluate a block of rows through the same tree, or a single row
+  // through a block of trees, in lockstep (see ProcessTreeNodeLeaves, ProcessTreeNodeLeavesForRow). Both children of a leaf are the leaf itself so that every row
+  // can walk the tree for its full depth without any data dependent branch.
+  // The engine is only built when all the nodes share the same comparison (same_mode_).
+  bool use_lockstep_;
+  NODE_MODE lockstep_mode_;
+  std::vector<TreeNodeLockstep<ThresholdType>> lockstep_nodes_;
+  std::vector<uint32_t> lockstep_depths_;  // number of comparisons on the longest path of every tree
+
+  // Trees deeper than this are walked node by node, a balanced tree of this depth already has 64K leaves.
+  static constexpr uint32_t kLockstepMaxDepth = 16;
+  // Number of rows evaluated together through the same tree, or of trees evaluated together for one row.
+  static constexpr int64_t kLockstepRows = 8;
+  // Below this number of rows (or trees), the lockstep evaluation is not worth the padding.
+  static constexpr int64_t kLockstepMinRows = 4;
+
  public:
   TreeEnsembleCommon() {}
 
@@ -83,6 +110,14 @@ class TreeEnsembleCommon : public TreeEnsembleCommonAttributes {
   TreeNodeElement<ThresholdType>* ProcessTreeNodeLeave(TreeNodeElement<ThresholdType>* root,
                                                        const InputType* x_data) const;
 
+  // Retrieves the leaves reached by one row in trees j, j + 1, ..., j + n_trees - 1.
+  void ProcessTreeNodeLeavesForRow(size_t j, size_t n_trees, const InputType* x_data,
+                                   const TreeNodeElement<ThresholdType>** leaves) const;
+
+  // Retrieves the leaves reached by n_rows consecutive rows (x_data, x_data + stride, ...) in tree j.
+  void ProcessTreeNodeLeaves(size_t j, const InputType* x_data, int64_t stride, int64_t n_rows,
+                             const TreeNodeElement<ThresholdType>** leaves) const;
+
   template <typename AGG>
   void ComputeAgg(concurrency::ThreadPool* ttp, const Tensor* X, Tensor* Y, Tensor* label, const AGG& agg) const;
 
@@ -92,6 +127,18 @@ class TreeEnsembleCommon : public TreeEnsembleCommonAttributes {
                   const std::vector<ThresholdType>& nodes_values_as_tensor, const std::vector<float>& node_values,
                   const std::vector<int64_t>& nodes_missing_value_tracks_true, std::vector<size_t>& updated_mapping,
                   int64_t tree_id, const InlinedVector<TreeNodeElementId>& node_tree_ids);
+
+  void InitLockstep();
+
+  uint32_t ComputeTreeDepth(size_t i, std::vector<uint32_t>& depths) const;
+
+  template <NODE_MODE Mode, bool HasMissingTracks>
+  void ProcessTreeNodeLeavesForRowLockstep(size_t j, size_t n_trees, const InputType* x_data,
+                                           const TreeNodeElement<ThresholdType>** leaves) const;
+
+  template <NODE_MODE Mode, bool HasMissingTracks>
+  void ProcessTreeNodeLeavesLockstep(size_t j, const InputType* x_data, int64_t stride, int64_t n_rows,
+                                     const TreeNodeElement<ThresholdType>** leaves) const;
 };
 
 template <typename InputType, typename ThresholdType, typename OutputType>
@@ -338,9 +385,66 @@ Status TreeEnsembleCommon<InputType, ThresholdType, OutputType>::Init(
     }
   }
 
+  InitLockstep();
   return Status::OK();
 }
 
+template <typename InputType, typename ThresholdType, typename OutputType>
+void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::InitLockstep() {
+  // Every comparison must be the same to pick the comparison at compile time.
+  use_lockstep_ = same_mode_;
+  lockstep_mode_ = NODE_MODE::LEAF;
+  lockstep_nodes_.clear();
+  lockstep_depths_.clear();
+  if (!use_lockstep_) {
+    return;
+  }
+
+  size_t n_nodes = nodes_.size();
+  lockstep_nodes_.resize(n_nodes);
+  for (size_t i = 0; i < n_nodes; ++i) {
+    const auto& node = nodes_[i];
+    uint32_t index = static_cast<uint32_t>(i);
+    if (node.is_not_leaf()) {
+      lockstep_mode_ = node.mode();
+      auto& flat = lockstep_nodes_[i];
+      flat.threshold = node.value_or_unique_weight;
+      flat.feature_id = static_cast<uint32_t>(node.feature_id);
+      if (node.is_missing_track_true()) {
+        flat.feature_id |= TreeNodeLockstep<ThresholdType>::kMissingTrackTrue;
+      }
+      flat.children[0] = index + 1;
+      flat.children[1] = static_cast<uint32_t>(node.truenode_or_weight.ptr - nodes_.data());
+    } else {
+      // Feature 0 always exists, the comparison result does not matter.
+      auto& flat = lockstep_nodes_[i];
+      flat.threshold = 0;
+      flat.feature_id = 0;
+      flat.children[0] = index;
+      flat.children[1] = index;
+    }
+  }
+
+  // LGBM converted models may share nodes between branches, depths are memoized.
+  std::vector<uint32_t> depths(n_nodes, std::numeric_limits<uint32_t>::max());
+  lockstep_depths_.reserve(roots_.size());
+  for (auto* root : roots_) {
+    lockstep_depths_.push_back(ComputeTreeDepth(static_cast<size_t>(root - nodes_.data()), depths));
+  }
+}
+
+template <typename InputType, typename ThresholdType, typename OutputType>
+uint32_t TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeTreeDepth(
+    size_t i, std::vector<uint32_t>& depths) const {
+  if (depths[i] == std::numeric_limits<uint32_t>::max()) {
+    depths[i] = nodes_[i].is_not_leaf()
+                    ? 1 + std::max(ComputeTreeDepth(lockstep_nodes_[i].children[0], depths),
+                                   ComputeTreeDepth(lockstep_nodes_[i].children[1], depths))
+                    : 0;
+  }
+  return depths[i];
+}
+
 template <typename InputType, typename ThresholdType, typename OutputType>
 size_t TreeEnsembleCommon<InputType, ThresholdType, OutputType>::AddNodes(
     const size_t i, const InlinedVector<NODE_MODE>& cmodes, const InlinedVector<size_t>& truenode_ids,
@@ -459,18 +563,31 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
     if (N == 1) {
       ScoreValue<ThresholdType> score = {0, 0};
       if (n_trees_ <= parallel_tree_ || max_num_threads == 1) { /* section A: 1 output, 1 row and not enough trees to parallelize */
-        for (int64_t j = 0; j < n_trees_; ++j) {
-          agg.ProcessTreeNodePrediction1(score, *ProcessTreeNodeLeave(roots_[onnxruntime::narrow<size_t>(j)], x_data));
+        const TreeNodeElement<ThresholdType>* leaves[kLockstepRows];
+        for (size_t j = 0; j < static_cast<size_t>(n_trees_); j += kLockstepRows) {
+          size_t count = std::min(static_cast<size_t>(kLockstepRows), static_cast<size_t>(n_trees_) - j);
+          ProcessTreeNodeLeavesForRow(j, count, x_data, leaves);
+          for (size_t t = 0; t < count; ++t) {
+            agg.ProcessTreeNodePrediction1(score, *leaves[t]);
+          }
         }
       } else { /* section B: 1 output, 1 row and enough trees to parallelize */
+        auto num_threads = std::min<int32_t>(max_num_threads, SafeInt<int32_t>(n_trees_));
         std::vector<ScoreValue<ThresholdType>> scores(onnxruntime::narrow<size_t>(n_trees_), {0, 0});
-        concurrency::ThreadPool::TryBatchParallelFor(
+        concurrency::ThreadPool::TrySimpleParallelFor(
             ttp,
-            SafeInt<int32_t>(n_trees_),
-            [this, &scores, &agg, x_data](ptrdiff_t j) {
-              agg.ProcessTreeNodePrediction1(scores[j], *ProcessTreeNodeLeave(roots_[j], x_data));
-            },
-            max_num_threads);
+            num_threads,
+            [this, &scores, &agg, num_threads, x_data](ptrdiff_t batch_num) {
+              const TreeNodeElement<ThresholdType>* leaves[kLockstepRows];
+              auto work = concurrency::ThreadPool::PartitionWork(batch_num, num_threads, onnxruntime::narrow<ptrdiff_t>(n_trees_));
+              for (auto j = work.start; j < work.end; j += kLockstepRows) {
+                size_t count = static_cast<size_t>(std::min<ptrdiff_t>(kLockstepRows, work.end - j));
+                ProcessTreeNodeLeavesForRow(static_cast<size_t>(j), count, x_data, leaves);
+                for (size_t t = 0; t < count; ++t) {
+                  agg.ProcessTreeNodePrediction1(scores[j + t], *leaves[t]);
+                }
+              }
+            });
 
         for (auto it = scores.cbegin(); it != scores.cend(); ++it) {
           agg.MergePrediction1(score, *it);
@@ -489,6 +606,7 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
       // split into batch so that every batch holds on caches, then loop on trees and finally loop
       // on the batch rows.
       std::vector<ScoreValue<ThresholdType>> scores(parallel_tree_N_);
+      std::vector<const TreeNodeElement<ThresholdType>*> leaves(parallel_tree_N_);
       size_t j;
       int64_t i, batch, batch_end;
 
@@ -498,8 +616,9 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
           scores[SafeInt<ptrdiff_t>(i - batch)] = {0, 0};
         }
         for (j = 0; j < static_cast<size_t>(n_trees_); ++j) {
+          ProcessTreeNodeLeaves(j, x_data + batch * stride, stride, batch_end - batch, leaves.data());
           for (i = batch; i < batch_end; ++i) {
-            agg.ProcessTreeNodePrediction1(scores[SafeInt<ptrdiff_t>(i - batch)], *ProcessTreeNodeLeave(roots_[j], x_data + i * stride));
+            agg.ProcessTreeNodePrediction1(scores[SafeInt<ptrdiff_t>(i - batch)], *leaves[SafeInt<ptrdiff_t>(i - batch)]);
           }
         }
         for (i = batch; i < batch_end; ++i) {
@@ -518,13 +637,14 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
             num_threads,
             [this, &agg, &scores, num_threads, x_data, N, begin_n, end_n, stride](ptrdiff_t batch_num) {
               auto work = concurrency::ThreadPool::PartitionWork(batch_num, num_threads, onnxruntime::narrow<size_t>(this->n_trees_));
+              std::vector<const TreeNodeElement<ThresholdType>*> leaves(onnxruntime::narrow<size_t>(end_n - begin_n));
               for (int64_t i = begin_n; i < end_n; ++i) {
                 scores[batch_num * SafeInt<ptrdiff_t>(N) + i] = {0, 0};
               }
               for (auto j = work.start; j < work.end; ++j) {
+                ProcessTreeNodeLeaves(static_cast<size_t>(j), x_data + begin_n * stride, stride, end_n - begin_n, leaves.data());
                 for (int64_t i = begin_n; i < end_n; ++i) {
-                  agg.ProcessTreeNodePrediction1(scores[batch_num * SafeInt<ptrdiff_t>(N) + i],
-                                                 *ProcessTreeNodeLeave(roots_[j], x_data + i * stride));
+                  agg.ProcessTreeNodePrediction1(scores[batch_num * SafeInt<ptrdiff_t>(N) + i], *leaves[i - begin_n]);
                 }
               }
             });
@@ -544,26 +664,45 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
             }
           });
     } else { /* section E: 1 output, 2+ rows, parallelization by rows */
-      concurrency::ThreadPool::TryBatchParallelFor(
+      // Every thread evaluates its rows by blocks so that a tree is evaluated on several rows at once.
+      auto num_threads = std::min<int32_t>(max_num_threads, SafeInt<int32_t>(N));
+      concurrency::ThreadPool::TrySimpleParallelFor(
           ttp,
-          SafeInt<int32_t>(N),
-          [this, &agg, x_data, z_data, stride, label_data](ptrdiff_t i) {
-            ScoreValue<ThresholdType> score = {0, 0};
-            for (size_t j = 0; j < static_cast<size_t>(n_trees_); ++j) {
-              agg.ProcessTreeNodePrediction1(score, *ProcessTreeNodeLeave(roots_[j], x_data + i * stride));
-            }
+          num_threads,
+          [this, &agg, num_threads, x_data, z_data, stride, label_data, N](ptrdiff_t batch_num) {
+            std::vector<ScoreValue<ThresholdType>> scores(parallel_tree_N_);
+            std::vector<const TreeNodeElement<ThresholdType>*> leaves(parallel_tree_N_);
+            auto work = concurrency::ThreadPool::PartitionWork(batch_num, num_threads, onnxruntime::narrow<ptrdiff_t>(N));
 
-            agg.FinalizeScores1(z_data + i, score,
-                                label_data == nullptr ? nullptr : (label_data + i));
-          },
-          max_num_threads);
+            for (int64_t batch = work.start; batch < static_cast<int64_t>(work.end); batch += parallel_tree_N_) {
+              int64_t batch_end = std::min(static_cast<int64_t>(work.end), batch + parallel_tree_N_);
+              for (int64_t i = batch; i < batch_end; ++i) {
+                scores[SafeInt<ptrdiff_t>(i - batch)] = {0, 0};
+              }
+              for (size_t j = 0; j < static_cast<size_t>(n_trees_); ++j) {
+                ProcessTreeNodeLeaves(j, x_data + batch * stride, stride, batch_end - batch, leaves.data());
+                for (int64_t i = batch; i < batch_end; ++i) {
+                  agg.ProcessTreeNodePrediction1(scores[SafeInt<ptrdiff_t>(i - batch)], *leaves[SafeInt<ptrdiff_t>(i - batch)]);
+                }
+              }
+              for (int64_t i = batch; i < batch_end; ++i) {
+                agg.FinalizeScores1(z_data + i, scores[SafeInt<ptrdiff_t>(i - batch)],
+                                    label_data == nullptr ? nullptr : (label_data + i));
+              }
+            }
+          });
     }
   } else {
     if (N == 1) {                                               /* section A2: 2+ outputs, 1 row, not enough trees to parallelize */
       if (n_trees_ <= parallel_tree_ || max_num_threads == 1) { /* section A2 */
         InlinedVector<ScoreValue<ThresholdType>> scores(onnxruntime::narrow<size_t>(n_targets_or_classes_), {0, 0});
-        for (int64_t j = 0; j < n_trees_; ++j) {
-          agg.ProcessTreeNodePrediction(scores, *ProcessTreeNodeLeave(roots_[onnxruntime::narrow<size_t>(j)], x_data), weights_);
+        const TreeNodeElement<ThresholdType>* leaves[kLockstepRows];
+        for (size_t j = 0; j < static_cast<size_t>(n_trees_); j += kLockstepRows) {
+          size_t count = std::min(static_cast<size_t>(kLockstepRows), static_cast<size_t>(n_trees_) - j);
+          ProcessTreeNodeLeavesForRow(j, count, x_data, leaves);
+          for (size_t t = 0; t < count; ++t) {
+            agg.ProcessTreeNodePrediction(scores, *leaves[t], weights_);
+          }
         }
         agg.FinalizeScores(scores, z_data, -1, label_data);
       } else { /* section B2: 2+ outputs, 1 row, enough trees to parallelize */
@@ -573,10 +712,15 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
             ttp,
             num_threads,
             [this, &agg, &scores, num_threads, x_data](ptrdiff_t batch_num) {
+              const TreeNodeElement<ThresholdType>* leaves[kLockstepRows];
               scores[batch_num].resize(onnxruntime::narrow<size_t>(n_targets_or_classes_), {0, 0});
               auto work = concurrency::ThreadPool::PartitionWork(batch_num, num_threads, onnxruntime::narrow<size_t>(n_trees_));
-              for (auto j = work.start; j < work.end; ++j) {
-                agg.ProcessTreeNodePrediction(scores[batch_num], *ProcessTreeNodeLeave(roots_[j], x_data), weights_);
+              for (auto j = work.start; j < work.end; j += kLockstepRows) {
+                size_t count = static_cast<size_t>(std::min<ptrdiff_t>(kLockstepRows, work.end - j));
+                ProcessTreeNodeLeavesForRow(static_cast<size_t>(j), count, x_data, leaves);
+                for (size_t t = 0; t < count; ++t) {
+                  agg.ProcessTreeNodePrediction(scores[batch_num], *leaves[t], weights_);
+                }
               }
             });
         for (size_t i = 1, limit = scores.size(); i < limit; ++i) {
@@ -586,6 +730,7 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
       }
     } else if (N <= parallel_N_ || max_num_threads == 1) { /* section C2: 2+ outputs, 2+ rows, not enough rows to parallelize */
       std::vector<InlinedVector<ScoreValue<ThresholdType>>> scores(parallel_tree_N_);
+      std::vector<const TreeNodeElement<ThresholdType>*> leaves(parallel_tree_N_);
       size_t j, limit;
       int64_t i, batch, batch_end;
       batch_end = std::min(N, static_cast<int64_t>(parallel_tree_N_));
@@ -598,8 +743,9 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
           std::fill(scores[SafeInt<ptrdiff_t>(i - batch)].begin(), scores[SafeInt<ptrdiff_t>(i - batch)].end(), ScoreValue<ThresholdType>({0, 0}));
         }
         for (j = 0, limit = roots_.size(); j < limit; ++j) {
+          ProcessTreeNodeLeaves(j, x_data + batch * stride, stride, batch_end - batch, leaves.data());
           for (i = batch; i < batch_end; ++i) {
-            agg.ProcessTreeNodePrediction(scores[SafeInt<ptrdiff_t>(i - batch)], *ProcessTreeNodeLeave(roots_[j], x_data + i * stride), weights_);
+            agg.ProcessTreeNodePrediction(scores[SafeInt<ptrdiff_t>(i - batch)], *leaves[SafeInt<ptrdiff_t>(i - batch)], weights_);
           }
         }
         for (i = batch; i < batch_end; ++i) {
@@ -619,13 +765,14 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
             num_threads,
             [this, &agg, &scores, num_threads, x_data, N, stride, begin_n, end_n](ptrdiff_t batch_num) {
               auto work = concurrency::ThreadPool::PartitionWork(batch_num, num_threads, onnxruntime::narrow<size_t>(this->n_trees_));
+              std::vector<const TreeNodeElement<ThresholdType>*> leaves(onnxruntime::narrow<size_t>(end_n - begin_n));
               for (int64_t i = begin_n; i < end_n; ++i) {
                 scores[batch_num * SafeInt<ptrdiff_t>(N) + i].resize(onnxruntime::narrow<size_t>(n_targets_or_classes_), {0, 0});
               }
               for (auto j = work.start; j < work.end; ++j) {
+                ProcessTreeNodeLeaves(static_cast<size_t>(j), x_data + begin_n * stride, stride, end_n - begin_n, leaves.data());
                 for (int64_t i = begin_n; i < end_n; ++i) {
-                  agg.ProcessTreeNodePrediction(scores[batch_num * SafeInt<ptrdiff_t>(N) + i],
-                                                *ProcessTreeNodeLeave(roots_[j], x_data + i * stride), weights_);
+                  agg.ProcessTreeNodePrediction(scores[batch_num * SafeInt<ptrdiff_t>(N) + i], *leaves[i - begin_n], weights_);
                 }
               }
             });
@@ -651,18 +798,26 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
           num_threads,
           [this, &agg, num_threads, x_data, z_data, label_data, N, stride](ptrdiff_t batch_num) {
             size_t j, limit;
-            InlinedVector<ScoreValue<ThresholdType>> scores(onnxruntime::narrow<size_t>(n_targets_or_classes_));
+            std::vector<InlinedVector<ScoreValue<ThresholdType>>> scores(parallel_tree_N_);
+            std::vector<const TreeNodeElement<ThresholdType>*> leaves(parallel_tree_N_);
             auto work = concurrency::ThreadPool::PartitionWork(batch_num, onnxruntime::narrow<ptrdiff_t>(num_threads), onnxruntime::narrow<ptrdiff_t>(N));
 
-            for (auto i = work.start; i < work.end; ++i) {
-              std::fill(scores.begin(), scores.end(), ScoreValue<ThresholdType>({0, 0}));
+            for (int64_t batch = work.start; batch < static_cast<int64_t>(work.end); batch += parallel_tree_N_) {
+              int64_t batch_end = std::min(static_cast<int64_t>(work.end), batch + parallel_tree_N_);
+              for (int64_t i = batch; i < batch_end; ++i) {
+                scores[SafeInt<ptrdiff_t>(i - batch)].assign(onnxruntime::narrow<size_t>(n_targets_or_classes_), ScoreValue<ThresholdType>({0, 0}));
+              }
               for (j = 0, limit = roots_.size(); j < limit; ++j) {
-                agg.ProcessTreeNodePrediction(scores, *ProcessTreeNodeLeave(roots_[j], x_data + i * stride), weights_);
+                ProcessTreeNodeLeaves(j, x_data + batch * stride, stride, batch_end - batch, leaves.data());
+                for (int64_t i = batch; i < batch_end; ++i) {
+                  agg.ProcessTreeNodePrediction(scores[SafeInt<ptrdiff_t>(i - batch)], *leaves[SafeInt<ptrdiff_t>(i - batch)], weights_);
+                }
+              }
+              for (int64_t i = batch; i < batch_end; ++i) {
+                agg.FinalizeScores(scores[SafeInt<ptrdiff_t>(i - batch)],
+                                   z_data + i * n_targets_or_classes_, -1,
+                                   label_data == nullptr ? nullptr : (label_data + i));
               }
-
-              agg.FinalizeScores(scores,
-                                 z_data + i * n_targets_or_classes_, -1,
-                                 label_data == nullptr ? nullptr : (label_data + i));
             }
           });
     }
@@ -767,6 +922,202 @@ TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ProcessTreeNodeLeave(
   return root;
 }
 
+template <NODE_MODE Mode, typename InputType, typename ThresholdType>
+inline bool _compare_(InputType val, ThresholdType threshold) {
+  if constexpr (Mode == NODE_MODE::BRANCH_LEQ) {
+    return val <= threshold;
+  } else if constexpr (Mode == NODE_MODE::BRANCH_LT) {
+    return val < threshold;
+  } else if constexpr (Mode == NODE_MODE::BRANCH_GTE) {
+    return val >= threshold;
+  } else if constexpr (Mode == NODE_MODE::BRANCH_GT) {
+    return val > threshold;
+  } else if constexpr (Mode == NODE_MODE::BRANCH_EQ) {
+    return val == threshold;
+  } else {
+    return val != threshold;
+  }
+}
+
+template <NODE_MODE Mode, bool HasMissingTracks, typename InputType, typename ThresholdType>
+inline uint32_t NextNodeLockstep(const TreeNodeLockstep<ThresholdType>& node, const InputType* x_data) {
+  bool cond;
+  if constexpr (HasMissingTracks) {
+    InputType val = x_data[node.feature_id & ~TreeNodeLockstep<ThresholdType>::kMissingTrackTrue];
+    cond = _compare_<Mode>(val, node.threshold) ||
+           ((node.feature_id & TreeNodeLockstep<ThresholdType>::kMissingTrackTrue) && _isnan_(val));
+  } else {
+    cond = _compare_<Mode>(x_data[node.feature_id], node.threshold);
+  }
+  return node.children[cond ? 1 : 0];
+}
+
+template <typename InputType, typename ThresholdType, typename OutputType>
+template <NODE_MODE Mode, bool HasMissingTracks>
+void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ProcessTreeNodeLeavesLockstep(
+    size_t j, const InputType* x_data, int64_t stride, int64_t n_rows,
+    const TreeNodeElement<ThresholdType>** leaves) const {
+  const TreeNodeLockstep<ThresholdType>* nodes = lockstep_nodes_.data();
+  const uint32_t root = static_cast<uint32_t>(roots_[j] - nodes_.data());
+  const uint32_t depth = lockstep_depths_[j];
+
+  const InputType* rows[kLockstepRows];
+  uint32_t index[kLockstepRows];
+
+  for (int64_t begin = 0; begin < n_rows; begin += kLockstepRows) {
+    int64_t count = std::min(kLockstepRows, n_rows - begin);
+
+    // The last block is padded with the last row so that the inner loop has a constant trip count.
+    for (int64_t r = 0; r < kLockstepRows; ++r) {
+      rows[r] = x_data + (begin + std::min(r, count - 1)) * stride;
+      index[r] = root;
+    }
+
+    // Rows are independent from each other, every step issues kLockstepRows loads which
+    // the processor can resolve in parallel instead of waiting for one path at a time.
+    for (uint32_t d = 0; d < depth; ++d) {
+      for (int64_t r = 0; r < kLockstepRows; ++r) {
+        index[r] = NextNodeLockstep<Mode, HasMissingTracks>(nodes[index[r]], rows[r]);
+      }
+    }
+
+    for (int64_t r = 0; r < count; ++r) {
+      leaves[begin + r] = &nodes_[index[r]];
+    }
+  }
+}
+
+template <typename InputType, typename ThresholdType, typename OutputType>
+template <NODE_MODE Mode, bool HasMissingTracks>
+void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ProcessTreeNodeLeavesForRowLockstep(
+    size_t j, size_t n_trees, const InputType* x_data, const TreeNodeElement<ThresholdType>** leaves) const {
+  const TreeNodeLockstep<ThresholdType>* nodes = lockstep_nodes_.data();
+
+  uint32_t index[kLockstepRows];
+
+  for (size_t begin = 0; begin < n_trees; begin += kLockstepRows) {
+    size_t count = std::min(static_cast<size_t>(kLockstepRows), n_trees - begin);
+
+    // The last block is padded with the last tree so that the inner loop has a constant trip count.
+    uint32_t depth = 0;
+    for (size_t t = 0; t < static_cast<size_t>(kLockstepRows); ++t) {
+      size_t tree = j + begin + std::min(t, count - 1);
+      index[t] = static_cast<uint32_t>(roots_[tree] - nodes_.data());
+      depth = std::max(depth, lockstep_depths_[tree]);
+    }
+
+    // Same as ProcessTreeNodeLeavesLockstep with one row and several trees, the paths are independent.
+    for (uint32_t d = 0; d < depth; ++d) {
+      for (size_t t = 0; t < static_cast<size_t>(kLockstepRows); ++t) {
+        index[t] = NextNodeLockstep<Mode, HasMissingTracks>(nodes[index[t]], x_data);
+      }
+    }
+
+    for (size_t t = 0; t < count; ++t) {
+      leaves[begin + t] = &nodes_[index[t]];
+    }
+  }
+}
+
+template <typename InputType, typename ThresholdType, typename OutputType>
+void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ProcessTreeNodeLeavesForRow(
+    size_t j, size_t n_trees, const InputType* x_data, const TreeNodeElement<ThresholdType>** leaves) const {
+  bool lockstep = use_lockstep_ && n_trees >= static_cast<size_t>(kLockstepMinRows);
+  for (size_t t = 0; lockstep && t < n_trees; ++t) {
+    lockstep = lockstep_depths_[j + t] <= kLockstepMaxDepth;
+  }
+  if (!lockstep) {
+    for (size_t t = 0; t < n_trees; ++t) {
+      leaves[t] = ProcessTreeNodeLeave(roots_[j + t], x_data);
+    }
+    return;
+  }
+
+#define TREE_FIND_LEAVES(MODE)                                                    \
+  if (has_missing_tracks_) {                                                      \
+    ProcessTreeNodeLeavesForRowLockstep<MODE, true>(j, n_trees, x_data, leaves);  \
+  } else {                                                                        \
+    ProcessTreeNodeLeavesForRowLockstep<MODE, false>(j, n_trees, x_data, leaves); \
+  }
+
+  switch (lockstep_mode_) {
+    case NODE_MODE::BRANCH_LEQ:
+      TREE_FIND_LEAVES(NODE_MODE::BRANCH_LEQ)
+      break;
+    case NODE_MODE::BRANCH_LT:
+      TREE_FIND_LEAVES(NODE_MODE::BRANCH_LT)
+      break;
+    case NODE_MODE::BRANCH_GTE:
+      TREE_FIND_LEAVES(NODE_MODE::BRANCH_GTE)
+      break;
+    case NODE_MODE::BRANCH_GT:
+      TREE_FIND_LEAVES(NODE_MODE::BRANCH_GT)
+      break;
+    case NODE_MODE::BRANCH_EQ:
+      TREE_FIND_LEAVES(NODE_MODE::BRANCH_EQ)
+      break;
+    case NODE_MODE::BRANCH_NEQ:
+      TREE_FIND_LEAVES(NODE_MODE::BRANCH_NEQ)
+      break;
+    case NODE_MODE::LEAF:
+      // Every tree is a single leaf.
+      for (size_t t = 0; t < n_trees; ++t) {
+        leaves[t] = roots_[j + t];
+      }
+      break;
+  }
+
+#undef TREE_FIND_LEAVES
+}
+
+template <typename InputType, typename ThresholdType, typename OutputType>
+void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ProcessTreeNodeLeaves(
+    size_t j, const InputType* x_data, int64_t stride, int64_t n_rows,
+    const TreeNodeElement<ThresholdType>** leaves) const {
+  if (!use_lockstep_ || n_rows < kLockstepMinRows || lockstep_depths_[j] > kLockstepMaxDepth) {
+    for (int64_t i = 0; i < n_rows; ++i) {
+      leaves[i] = ProcessTreeNodeLeave(roots_[j], x_data + i * stride);
+    }
+    return;
+  }
+
+#define TREE_FIND_LEAVES(MODE)                                                    \
+  if (has_missing_tracks_) {                                                      \
+    ProcessTreeNodeLeavesLockstep<MODE, true>(j, x_data, stride, n_rows, leaves);  \
+  } else {                                                                        \
+    ProcessTreeNodeLeavesLockstep<MODE, false>(j, x_data, stride, n_rows, leaves); \
+  }
+
+  switch (lockstep_mode_) {
+    case NODE_MODE::BRANCH_LEQ:
+      TREE_FIND_LEAVES(NODE_MODE::BRANCH_LEQ)
+      break;
+    case NODE_MODE::BRANCH_LT:
+      TREE_FIND_LEAVES(NODE_MODE::BRANCH_LT)
+      break;
+    case NODE_MODE::BRANCH_GTE:
+      TREE_FIND_LEAVES(NODE_MODE::BRANCH_GTE)
+      break;
+    case NODE_MODE::BRANCH_GT:
+      TREE_FIND_LEAVES(NODE_MODE::BRANCH_GT)
+      break;
+    case NODE_MODE::BRANCH_EQ:
+      TREE_FIND_LEAVES(NODE_MODE::BRANCH_EQ)
+      break;
+    case NODE_MODE::BRANCH_NEQ:
+      TREE_FIND_LEAVES(NODE_MODE::BRANCH_NEQ)
+      break;
+    case NODE_MODE::LEAF:
+      // Every tree is a single leaf.
+      for (int64_t i = 0; i < n_rows; ++i) {
+        leaves[i] = roots_[j];
+      }
+      break;
+  }
+
+#undef TREE_FIND_LEAVES
+}
+
 // TI: input type
 // TH: threshold type, double if T==double, float otherwise
 // TO: output type
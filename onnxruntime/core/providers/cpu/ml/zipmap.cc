@@ -3,6 +3,10 @@
 
 #include "core/providers/cpu/ml/zipmap.h"
 #include "core/util/math_cpuonly.h"
+
+#include <algorithm>
+#include <numeric>
+
 /**
 https://github.com/onnx/onnx/blob/main/onnx/defs/traditionalml/defs.cc
 ONNX_OPERATOR_SCHEMA(ZipMap)
@@ -42,6 +46,48 @@ ZipMapOp::ZipMapOp(const OpKernelInfo& info)
   ORT_ENFORCE(classlabels_strings_.empty() ^ classlabels_int64s_.empty(),
               "Must provide classlabels_strings or classlabels_int64s but not both.");
   using_strings_ = !classlabels_strings_.empty();
+
+  auto sort_labels = [this](const auto& labels) {
+    std::vector<size_t> indices(labels.size());
+    std::iota(indices.begin(), indices.end(), size_t{0});
+    // stable sort keeps repeated keys in their original order, so the last one of each run is the one to keep
+    std::stable_sort(indices.begin(), indices.end(), [&labels](size_t a, size_t b) { return labels[a] < labels[b]; });
+    for (size_t i = 0; i < indices.size(); ++i) {
+      if (i + 1 == indices.size() || labels[indices[i]] != labels[indices[i + 1]]) {
+        sorted_label_indices_.push_back(indices[i]);
+      }
+    }
+  };
+
+  if (using_strings_) {
+    sort_labels(classlabels_strings_);
+  } else {
+    sort_labels(classlabels_int64s_);
+  }
+}
+
+// Builds one map per row. The keys are inserted in ascending order with the end of the map as the hint,
+// so each insertion is amortized constant time instead of a search of the tree.
+template <typename TKey>
+static void ZipRows(OpKernelContext* context, const float* x_data, int64_t batch_size, int64_t features_per_batch,
+                    const std::vector<TKey>& labels, const std::vector<size_t>& sorted_label_indices,
+                    std::vector<std::map<TKey, float>>& y_data) {
+  y_data.resize(onnxruntime::narrow<size_t>(batch_size));
+  const TensorOpCost cost{static_cast<double>(features_per_batch * sizeof(float)),
+                          static_cast<double>(features_per_batch * (sizeof(TKey) + sizeof(float))),
+                          static_cast<double>(features_per_batch * 64)};
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), onnxruntime::narrow<ptrdiff_t>(batch_size), cost,
+      [&](ptrdiff_t first, ptrdiff_t last) {
+        for (ptrdiff_t n = first; n < last; ++n) {
+          const float* row = x_data + n * features_per_batch;
+          std::map<TKey, float> map;
+          for (size_t index : sorted_label_indices) {
+            map.emplace_hint(map.end(), labels[index], row[index]);
+          }
+          y_data[static_cast<size_t>(n)] = std::move(map);
+        }
+      });
 }
 
 common::Status ZipMapOp::Compute(OpKernelContext* context) const {
@@ -77,17 +123,7 @@ common::Status ZipMapOp::Compute(OpKernelContext* context) const {
     auto* y_data = context->Output<std::vector<std::map<std::string, float>>>(0);
     if (y_data == nullptr) return Status(common::ONNXRUNTIME, common::FAIL, "input count mismatch");
 
-    // auto* y_data = Y->MutableData<std::vector<std::map<std::string, float>>>();
-    y_data->resize(onnxruntime::narrow<size_t>(batch_size));
-    int64_t current_weight_0 = 0;
-    for (int64_t n = 0; n < batch_size; n++) {
-      std::map<std::string, float> map1;
-      for (int64_t j = 0; j < features_per_batch; j++) {
-        map1[classlabels_strings_[onnxruntime::narrow<size_t>(j)]] = x_data[current_weight_0 + j];
-      }
-      current_weight_0 += features_per_batch;
-      (*y_data)[onnxruntime::narrow<size_t>(n)] = std::move(map1);
-    }
+    ZipRows(context, x_data, batch_size, features_per_batch, classlabels_strings_, sorted_label_indices_, *y_data);
   } else {
     if (features_per_batch != static_cast<int64_t>(classlabels_int64s_.size())) {
       return Status(ONNXRUNTIME,
@@ -97,17 +133,7 @@ common::Status ZipMapOp::Compute(OpKernelContext* context) const {
     }
     auto* y_data = context->Output<std::vector<std::map<std::int64_t, float>>>(0);
     if (y_data == nullptr) return Status(common::ONNXRUNTIME, common::FAIL, "input count mismatch");
-    // auto* y_data = Y->MutableData<std::vector<std::map<int64_t, float>>>();
-    y_data->resize(onnxruntime::narrow<size_t>(batch_size));
-    int64_t current_weight_0 = 0;
-    for (int n = 0; n < batch_size; n++) {
-      std::map<int64_t, float> map2;
-      for (int j = 0; j < features_per_batch; j++) {
-        map2[classlabels_int64s_[j]] = x_data[current_weight_0 + j];
-      }
-      current_weight_0 += features_per_batch;
-      (*y_data)[n] = std::move(map2);
-    }
+    ZipRows(context, x_data, batch_size, features_per_batch, classlabels_int64s_, sorted_label_indices_, *y_data);
   }
   return common::Status::OK();
 }
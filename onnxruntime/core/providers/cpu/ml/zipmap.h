@@ -16,6 +16,10 @@ class ZipMapOp final : public OpKernel {
   bool using_strings_;
   std::vector<int64_t> classlabels_int64s_;
   std::vector<std::string> classlabels_strings_;
+
+  // Index of the label for each distinct key, in ascending key order. When a key is repeated the last label wins,
+  // as it would when inserting the labels into the map in their original order.
+  std::vector<size_t> sorted_label_indices_;
 };
 
 }  // namespace ml
@@ -17,6 +17,8 @@
 
 #include "core/providers/cpu/nn/conv_transpose.h"
 
+#include <algorithm>
+
 #include "core/mlas/inc/mlas.h"
 #include "core/common/safeint.h"
 #include "core/util/math.h"
@@ -24,6 +26,9 @@
 
 namespace onnxruntime {
 
+// Upper bound of the column buffers of all tasks when (image, group) pairs run in parallel.
+constexpr size_t kMaxColumnBufferBytes = 64 * 1024 * 1024;
+
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     ConvTranspose,
     1, 10,
@@ -218,6 +223,59 @@ Status ConvTranspose<T>::DoConvTranspose(OpKernelContext* context, bool dynamic_
   return Status::OK();
 }
 
+namespace {
+
+// Computes one channel of a depthwise (one input and one output channel per group) 2D transposed
+// convolution by scattering each input row straight into the output image. With a single input channel
+// the weight GEMM degenerates into an outer product, so skipping the column buffer and Col2im avoids
+// materializing kernel_h * kernel_w copies of the input.
+void DepthwiseConvTranspose2D(const float* X, const float* W, float bias, float* Y,
+                              int64_t input_h, int64_t input_w, int64_t output_h, int64_t output_w,
+                              int64_t kernel_h, int64_t kernel_w, int64_t dilation_h, int64_t dilation_w,
+                              int64_t pad_t, int64_t pad_l, int64_t stride_h, int64_t stride_w) {
+  std::fill_n(Y, SafeInt<size_t>(output_h) * output_w, bias);
+
+  for (int64_t kh = 0; kh < kernel_h; ++kh) {
+    for (int64_t kw = 0; kw < kernel_w; ++kw) {
+      const float w = W[kh * kernel_w + kw];
+      const int64_t w_offset = kw * dilation_w - pad_l;
+
+      // Range of input columns that land inside the output row for this kernel column.
+      int64_t iw_begin = 0;
+      if (w_offset < 0) {
+        iw_begin = (-w_offset + stride_w - 1) / stride_w;
+      }
+      int64_t iw_end = 0;
+      if (output_w - w_offset > 0) {
+        iw_end = std::min(input_w, (output_w - w_offset + stride_w - 1) / stride_w);
+      }
+      if (iw_begin >= iw_end) {
+        continue;
+      }
+
+      for (int64_t ih = 0; ih < input_h; ++ih) {
+        const int64_t oh = ih * stride_h + kh * dilation_h - pad_t;
+        if (oh < 0 || oh >= output_h) {
+          continue;
+        }
+        const float* x_row = X + ih * input_w;
+        float* y_row = Y + oh * output_w;
+        if (stride_w == 1) {
+          for (int64_t iw = iw_begin; iw < iw_end; ++iw) {
+            y_row[iw + w_offset] += x_row[iw] * w;
+          }
+        } else {
+          for (int64_t iw = iw_begin; iw < iw_end; ++iw) {
+            y_row[iw * stride_w + w_offset] += x_row[iw] * w;
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
 template <>
 Status ConvTranspose<float>::DoConvTranspose(OpKernelContext* context, bool dynamic_padding) const {
   concurrency::ThreadPool* thread_pool = context->GetOperatorThreadPool();
@@ -233,86 +291,168 @@ Status ConvTranspose<float>::DoConvTranspose(OpKernelContext* context, bool dyna
     return Status::OK();
   }
 
+  const int64_t group = conv_transpose_attrs_.group;
   const int64_t input_image_size = p.input_shape.Size();
-  const int64_t X_offset = p.num_input_channels / conv_transpose_attrs_.group * input_image_size;
-  const int64_t Y_offset = p.Y->Shape().Size() / p.Y->Shape()[0] / conv_transpose_attrs_.group;
-  const int64_t W_offset = (p.F ? p.F->Shape().Size() : filter_shape_.Size()) / conv_transpose_attrs_.group;
+  const int64_t X_offset = p.num_input_channels / group * input_image_size;
+  const int64_t Y_offset = p.Y->Shape().Size() / p.Y->Shape()[0] / group;
+  const int64_t W_offset = (p.F ? p.F->Shape().Size() : filter_shape_.Size()) / group;
   const int64_t kernel_size = TensorShape(p.kernel_shape).Size();
-  const int64_t kernel_dim = p.num_output_channels / conv_transpose_attrs_.group * kernel_size;
+  const int64_t input_channels_per_group = p.num_input_channels / group;
+  const int64_t output_channels_per_group = p.num_output_channels / group;
+  const int64_t kernel_dim = output_channels_per_group * kernel_size;
   const int64_t output_size = (p.Y->Shape().Slice(2)).Size();
-
-  AllocatorPtr alloc;
-  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
-
-  const int64_t col_buffer_size = kernel_dim * p.input_shape.Size();
-  auto col_data = alloc->Alloc(SafeInt<size_t>(sizeof(float)) * col_buffer_size);
-  BufferUniquePtr col_buffer(col_data, BufferDeleter(std::move(alloc)));
-  float* col_buffer_data = static_cast<float*>(col_buffer.get());
+  const bool is_2d = p.X->Shape().NumDimensions() == 4;
 
   const float* Xdata = p.X->Data<float>();
   const float* filter_data = p.F ? p.F->Data<float>() : static_cast<float*>(transposed_filter_.get());
+  const float* Bdata = p.B != nullptr ? p.B->Data<float>() : nullptr;
   float* Ydata = p.Y->MutableData<float>();
   TensorShape output_shape = p.Y->Shape().Slice(2);
 
-  for (auto image_id = 0; image_id < p.N; ++image_id) {
-    for (int group_id = 0; group_id < conv_transpose_attrs_.group; ++group_id) {
-      // Weight term
-      math::Gemm<float>(
-          p.F ? CblasTrans : CblasNoTrans,
-          CblasNoTrans,
-          onnxruntime::narrow<ptrdiff_t>(kernel_dim),
-          onnxruntime::narrow<ptrdiff_t>(input_image_size),
-          onnxruntime::narrow<ptrdiff_t>(p.num_input_channels / conv_transpose_attrs_.group),
-          1,
-          filter_data + group_id * W_offset,
-          Xdata + group_id * X_offset,
-          0,
-          col_buffer_data,
-          thread_pool);
+  if (is_2d && input_channels_per_group == 1 && output_channels_per_group == 1) {
+    const double cost_per_channel = static_cast<double>(input_image_size * kernel_size);
+    concurrency::ThreadPool::TryParallelFor(
+        thread_pool, onnxruntime::narrow<ptrdiff_t>(p.N * group),
+        TensorOpCost{static_cast<double>(input_image_size * sizeof(float)),
+                     static_cast<double>(output_size * sizeof(float)), cost_per_channel},
+        [&](ptrdiff_t first, ptrdiff_t last) {
+          for (ptrdiff_t channel = first; channel < last; ++channel) {
+            const int64_t group_id = channel % group;
+            DepthwiseConvTranspose2D(Xdata + channel * input_image_size,
+                                     filter_data + group_id * W_offset,
+                                     Bdata != nullptr ? Bdata[group_id] : 0.0f,
+                                     Ydata + channel * output_size,
+                                     p.input_shape[0], p.input_shape[1], output_shape[0], output_shape[1],
+                                     p.kernel_shape[0], p.kernel_shape[1], p.dilations[0], p.dilations[1],
+                                     p.pads[0], p.pads[1], p.strides[0], p.strides[1]);
+          }
+        });
+    return Status::OK();
+  }
 
-      if (p.X->Shape().NumDimensions() == 4) {
-        math::Col2im<float, CPUMathUtil, StorageOrder::NCHW>(
-            col_buffer_data,
-            p.num_output_channels / conv_transpose_attrs_.group,
-            p.Y->Shape()[2],
-            p.Y->Shape()[3],
-            p.kernel_shape[0],
-            p.kernel_shape[1],
-            p.dilations[0],
-            p.dilations[1],
-            p.pads[0],
-            p.pads[1],
-            p.pads[2],
-            p.pads[3],
-            p.strides[0],
-            p.strides[1],
-            Ydata + group_id * Y_offset,
-            &CPUMathUtil::Instance());
-      } else {
-        math::Col2imNd<float, CPUMathUtil, StorageOrder::NCHW>(
-            col_buffer_data,
-            output_shape.GetDims().data(),
-            p.input_shape.GetDims().data(),
-            kernel_dim,
-            Y_offset,
-            p.kernel_shape.data(),
-            p.strides.data(),
-            p.dilations.data(),
-            p.pads.data(),
-            static_cast<int>(p.kernel_shape.size()),
-            Ydata + group_id * Y_offset,
-            &CPUMathUtil::Instance());
-      }
+  // Col2im accumulates each output channel from its own rows of the column buffer, so a group can be
+  // split into independent ranges of output channels.
+  auto col2im = [&](const float* col_data, float* Y_group, int64_t channel_begin, int64_t channel_count) {
+    const float* col = col_data + channel_begin * kernel_size * input_image_size;
+    float* Y = Y_group + channel_begin * output_size;
+    if (is_2d) {
+      math::Col2im<float, CPUMathUtil, StorageOrder::NCHW>(
+          col,
+          channel_count,
+          output_shape[0],
+          output_shape[1],
+          p.kernel_shape[0],
+          p.kernel_shape[1],
+          p.dilations[0],
+          p.dilations[1],
+          p.pads[0],
+          p.pads[1],
+          p.pads[2],
+          p.pads[3],
+          p.strides[0],
+          p.strides[1],
+          Y,
+          &CPUMathUtil::Instance());
+    } else {
+      math::Col2imNd<float, CPUMathUtil, StorageOrder::NCHW>(
+          col,
+          output_shape.GetDims().data(),
+          p.input_shape.GetDims().data(),
+          channel_count * kernel_size,
+          channel_count * output_size,
+          p.kernel_shape.data(),
+          p.strides.data(),
+          p.dilations.data(),
+          p.pads.data(),
+          static_cast<int>(p.kernel_shape.size()),
+          Y,
+          &CPUMathUtil::Instance());
     }
-
-    if (p.B != nullptr) {
-      auto Ymatrix = EigenMatrixMap<float>(Ydata, onnxruntime::narrow<size_t>(output_size), onnxruntime::narrow<size_t>(p.num_output_channels));
-      auto Bvec = ConstEigenVectorMap<float>(p.B->Data<float>(), onnxruntime::narrow<size_t>(p.num_output_channels));
+  };
+
+  auto add_bias = [&](float* Y_group, int64_t group_id) {
+    if (Bdata != nullptr) {
+      auto Ymatrix = EigenMatrixMap<float>(Y_group, onnxruntime::narrow<size_t>(output_size),
+                                           onnxruntime::narrow<size_t>(output_channels_per_group));
+      auto Bvec = ConstEigenVectorMap<float>(Bdata + group_id * output_channels_per_group,
+                                             onnxruntime::narrow<size_t>(output_channels_per_group));
       Ymatrix.rowwise() += Bvec.transpose();
     }
+  };
+
+  auto gemm = [&](const float* X_group, int64_t group_id, float* col_data, concurrency::ThreadPool* gemm_pool) {
+    // Weight term
+    math::Gemm<float>(
+        p.F ? CblasTrans : CblasNoTrans,
+        CblasNoTrans,
+        onnxruntime::narrow<ptrdiff_t>(kernel_dim),
+        onnxruntime::narrow<ptrdiff_t>(input_image_size),
+        onnxruntime::narrow<ptrdiff_t>(input_channels_per_group),
+        1,
+        filter_data + group_id * W_offset,
+        X_group,
+        0,
+        col_data,
+        gemm_pool);
+  };
 
-    Xdata += X_offset * conv_transpose_attrs_.group;
-    Ydata += Y_offset * conv_transpose_attrs_.group;
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+
+  const int64_t col_buffer_size = kernel_dim * input_image_size;
+  const int64_t work_count = p.N * group;
+  const int64_t degree_of_parallelism = concurrency::ThreadPool::DegreeOfParallelism(thread_pool);
+
+  // Each task of the batched path needs its own column buffer, so the number of tasks is capped to keep the
+  // buffers of all tasks within kMaxColumnBufferBytes.
+  const size_t col_buffer_bytes = SafeInt<size_t>(sizeof(float)) * col_buffer_size;
+  const int64_t max_task_count = col_buffer_bytes == 0 ? degree_of_parallelism
+                                                       : static_cast<int64_t>(kMaxColumnBufferBytes / col_buffer_bytes);
+  const int64_t task_count = std::min(degree_of_parallelism, max_task_count);
+
+  if (task_count > 1 && work_count >= task_count) {
+    // Enough images and groups to keep every task busy: each task runs whole (image, group) pairs with a
+    // single threaded GEMM and Col2im into its own column buffer. With fewer than two tasks the pairs are
+    // processed one after the other below, where the GEMM and Col2im of each pair use the thread pool.
+    auto col_data = alloc->Alloc(SafeInt<size_t>(sizeof(float)) * col_buffer_size * task_count);
+    BufferUniquePtr col_buffer(col_data, BufferDeleter(std::move(alloc)));
+    float* col_buffer_data = static_cast<float*>(col_buffer.get());
+
+    concurrency::ThreadPool::TrySimpleParallelFor(
+        thread_pool, onnxruntime::narrow<ptrdiff_t>(task_count),
+        [&](ptrdiff_t task_id) {
+          float* task_col_data = col_buffer_data + task_id * col_buffer_size;
+          const int64_t work_begin = work_count * task_id / task_count;
+          const int64_t work_end = work_count * (task_id + 1) / task_count;
+          for (int64_t work = work_begin; work < work_end; ++work) {
+            const int64_t group_id = work % group;
+            float* Y_group = Ydata + work * Y_offset;
+            gemm(Xdata + work * X_offset, group_id, task_col_data, nullptr);
+            col2im(task_col_data, Y_group, 0, output_channels_per_group);
+            add_bias(Y_group, group_id);
+          }
+        });
+    return Status::OK();
+  }
+
+  auto col_data = alloc->Alloc(SafeInt<size_t>(sizeof(float)) * col_buffer_size);
+  BufferUniquePtr col_buffer(col_data, BufferDeleter(std::move(alloc)));
+  float* col_buffer_data = static_cast<float*>(col_buffer.get());
+
+  const TensorOpCost col2im_cost{static_cast<double>(kernel_size * input_image_size * sizeof(float)),
+                                 static_cast<double>(output_size * sizeof(float)),
+                                 static_cast<double>(kernel_size * input_image_size)};
+
+  for (int64_t work = 0; work < work_count; ++work) {
+    const int64_t group_id = work % group;
+    float* Y_group = Ydata + work * Y_offset;
+    gemm(Xdata + work * X_offset, group_id, col_buffer_data, thread_pool);
+    concurrency::ThreadPool::TryParallelFor(
+        thread_pool, onnxruntime::narrow<ptrdiff_t>(output_channels_per_group), col2im_cost,
+        [&](ptrdiff_t first, ptrdiff_t last) {
+          col2im(col_buffer_data, Y_group, first, last - first);
+        });
+    add_bias(Y_group, group_id);
   }
 
   return Status::OK();
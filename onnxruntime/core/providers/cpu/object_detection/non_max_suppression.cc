@@ -13,10 +13,14 @@ limitations under the License.
 
 #include "non_max_suppression.h"
 
-#include <queue>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <utility>
+#include <vector>
 
 #include "core/common/narrow.h"
+#include "core/platform/threadpool.h"
 #include "non_max_suppression_helper.h"
 
 // TODO:fix the warnings
@@ -118,6 +122,268 @@ Status NonMaxSuppressionBase::GetThresholdsFromInputs(const PrepareContext& pc,
   return Status::OK();
 }
 
+namespace {
+
+// Corner coordinates and areas of the boxes of a batch, kept as structure-of-arrays.
+// SuppressByIOU() derives these for both boxes on every call - computing them once per box up front
+// lets the IoU of a candidate be evaluated against a whole block of selected boxes with vectorizable code.
+struct BoxCorners {
+  std::vector<float> x_min;
+  std::vector<float> y_min;
+  std::vector<float> x_max;
+  std::vector<float> y_max;
+  std::vector<float> area;
+
+  void Reserve(size_t count) {
+    x_min.reserve(count);
+    y_min.reserve(count);
+    x_max.reserve(count);
+    y_max.reserve(count);
+    area.reserve(count);
+  }
+
+  void Resize(size_t count) {
+    x_min.resize(count);
+    y_min.resize(count);
+    x_max.resize(count);
+    y_max.resize(count);
+    area.resize(count);
+  }
+
+  void Clear() {
+    x_min.clear();
+    y_min.clear();
+    x_max.clear();
+    y_max.clear();
+    area.clear();
+  }
+
+  void Append(const BoxCorners& other, size_t index) {
+    x_min.push_back(other.x_min[index]);
+    y_min.push_back(other.y_min[index]);
+    x_max.push_back(other.x_max[index]);
+    y_max.push_back(other.y_max[index]);
+    area.push_back(other.area[index]);
+  }
+
+  size_t Size() const { return area.size(); }
+};
+
+// Same corner and area arithmetic as SuppressByIOU() so that both select the same boxes
+void ComputeBoxCorners(const float* boxes, int64_t center_point_box, size_t begin, size_t end, BoxCorners& corners) {
+  for (size_t i = begin; i < end; ++i) {
+    const float* box = boxes + 4 * i;
+    float x_min{};
+    float y_min{};
+    float x_max{};
+    float y_max{};
+    if (0 == center_point_box) {
+      // boxes data format [y1, x1, y2, x2]
+      MaxMin(box[1], box[3], x_min, x_max);
+      MaxMin(box[0], box[2], y_min, y_max);
+    } else {
+      // boxes data format [x_center, y_center, width, height]
+      const float width_half = box[2] / 2;
+      const float height_half = box[3] / 2;
+      x_min = box[0] - width_half;
+      x_max = box[0] + width_half;
+      y_min = box[1] - height_half;
+      y_max = box[1] + height_half;
+    }
+    corners.x_min[i] = x_min;
+    corners.y_min[i] = y_min;
+    corners.x_max[i] = x_max;
+    corners.y_max[i] = y_max;
+    corners.area[i] = (x_max - x_min) * (y_max - y_min);
+  }
+}
+
+// Returns true if the IoU of box `index` of `boxes` with any of `selected` exceeds `iou_threshold`.
+// Blocks of selected boxes are evaluated without branches so the compiler can vectorize the loop,
+// and the scan stops at the first block that suppresses the box.
+bool SuppressBySelectedBoxes(const BoxCorners& boxes, size_t index, const BoxCorners& selected, float iou_threshold) {
+  constexpr size_t block_size = 16;
+
+  const float x_min = boxes.x_min[index];
+  const float y_min = boxes.y_min[index];
+  const float x_max = boxes.x_max[index];
+  const float y_max = boxes.y_max[index];
+  const float area = boxes.area[index];
+
+  // A box without area is never suppressed
+  if (area <= .0f) {
+    return false;
+  }
+
+  const float* selected_x_min = selected.x_min.data();
+  const float* selected_y_min = selected.y_min.data();
+  const float* selected_x_max = selected.x_max.data();
+  const float* selected_y_max = selected.y_max.data();
+  const float* selected_area = selected.area.data();
+  const size_t selected_count = selected.Size();
+
+  for (size_t block_start = 0; block_start < selected_count; block_start += block_size) {
+    const size_t block_end = std::min(block_start + block_size, selected_count);
+    int suppressed = 0;
+    for (size_t i = block_start; i < block_end; ++i) {
+      const float intersection_x_min = std::max(x_min, selected_x_min[i]);
+      const float intersection_x_max = std::min(x_max, selected_x_max[i]);
+      const float intersection_y_min = std::max(y_min, selected_y_min[i]);
+      const float intersection_y_max = std::min(y_max, selected_y_max[i]);
+      const float intersection_area = (intersection_x_max - intersection_x_min) *
+                                      (intersection_y_max - intersection_y_min);
+      const float union_area = area + selected_area[i] - intersection_area;
+      suppressed |= static_cast<int>(intersection_x_max > intersection_x_min) &
+                    static_cast<int>(intersection_y_max > intersection_y_min) &
+                    static_cast<int>(intersection_area > .0f) &
+                    static_cast<int>(selected_area[i] > .0f) &
+                    static_cast<int>(union_area > .0f) &
+                    static_cast<int>(intersection_area / union_area > iou_threshold);
+    }
+    if (suppressed != 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+struct ScoredBox {
+  float score;
+  int64_t index;
+};
+
+// Highest score first, lowest index first among equal scores (the order the boxes used to be popped from a heap)
+inline bool IsRankedHigher(const ScoredBox& lhs, const ScoredBox& rhs) {
+  return lhs.score > rhs.score || (lhs.score == rhs.score && lhs.index < rhs.index);
+}
+
+// Per task scratch buffers re-used across the (batch, class) pairs a task processes
+struct ClassSelectionScratch {
+  std::vector<ScoredBox> candidates;
+  BoxCorners selected;
+};
+
+void SelectBoxesOfClass(const float* class_scores, const BoxCorners& boxes, int num_boxes,
+                        bool has_score_threshold, float score_threshold,
+                        int64_t max_output_boxes_per_class, float iou_threshold,
+                        ClassSelectionScratch& scratch, std::vector<int64_t>& selected_box_indices) {
+  auto& candidates = scratch.candidates;
+  auto& selected = scratch.selected;
+  candidates.clear();
+  selected.Clear();
+
+  // Filter by score_threshold before doing any ordering work
+  if (has_score_threshold) {
+    for (int box_index = 0; box_index < num_boxes; ++box_index) {
+      if (class_scores[box_index] > score_threshold) {
+        candidates.push_back({class_scores[box_index], box_index});
+      }
+    }
+  } else {
+    for (int box_index = 0; box_index < num_boxes; ++box_index) {
+      // NaN scores would break the strict weak ordering the sorting below relies on - rank them last
+      const float score = std::isnan(class_scores[box_index]) ? -std::numeric_limits<float>::infinity()
+                                                               : class_scores[box_index];
+      candidates.push_back({score, box_index});
+    }
+  }
+
+  const size_t max_selected = static_cast<size_t>(std::min<int64_t>(max_output_boxes_per_class, num_boxes));
+
+  // Only the leading candidates are ever visited when max_output_boxes_per_class is small, so order the
+  // candidates a chunk at a time and only order the next chunk when the current one got exhausted
+  const size_t chunk_size = std::max<size_t>(2 * max_selected, 64);
+  size_t sorted_end = 0;
+
+  for (size_t candidate = 0; candidate < candidates.size() && selected.Size() < max_selected; ++candidate) {
+    if (candidate == sorted_end) {
+      const auto chunk_begin = candidates.begin() + static_cast<ptrdiff_t>(sorted_end);
+      sorted_end = std::min(sorted_end + chunk_size, candidates.size());
+      const auto chunk_end = candidates.begin() + static_cast<ptrdiff_t>(sorted_end);
+      if (chunk_end != candidates.end()) {
+        std::nth_element(chunk_begin, chunk_end, candidates.end(), IsRankedHigher);
+      }
+      std::sort(chunk_begin, chunk_end, IsRankedHigher);
+    }
+
+    const auto box_index = static_cast<size_t>(candidates[candidate].index);
+    if (!SuppressBySelectedBoxes(boxes, box_index, selected, iou_threshold)) {
+      selected.Append(boxes, box_index);
+      selected_box_indices.push_back(candidates[candidate].index);
+    }
+  }
+}
+
+}  // namespace
+
+void NonMaxSuppression::SelectBoxes(const PrepareContext& pc, int64_t center_point_box,
+                                    int64_t max_output_boxes_per_class, float iou_threshold, float score_threshold,
+                                    concurrency::ThreadPool* tp, std::vector<SelectedIndex>& selected_indices) {
+  const auto num_batches = narrow<size_t>(pc.num_batches_);
+  const auto num_classes = narrow<size_t>(pc.num_classes_);
+  const auto num_boxes = narrow<size_t>(pc.num_boxes_);
+  const bool has_score_threshold = pc.score_threshold_ != nullptr;
+
+  // Corner coordinates of all the boxes, shared by the classes of a batch
+  std::vector<BoxCorners> batch_boxes(num_batches);
+  for (auto& boxes : batch_boxes) {
+    boxes.Resize(num_boxes);
+  }
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_batches * num_boxes),
+      TensorOpCost{static_cast<double>(4 * sizeof(float)), static_cast<double>(5 * sizeof(float)), 10.0},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        auto begin = static_cast<size_t>(first);
+        const auto end = static_cast<size_t>(last);
+        while (begin < end) {
+          const size_t batch_index = begin / num_boxes;
+          const size_t batch_end = std::min(end, (batch_index + 1) * num_boxes);
+          ComputeBoxCorners(pc.boxes_data_ + batch_index * num_boxes * 4, center_point_box,
+                            begin - batch_index * num_boxes, batch_end - batch_index * num_boxes,
+                            batch_boxes[batch_index]);
+          begin = batch_end;
+        }
+      });
+
+  // Each (batch, class) pair is independent. Collect the selections per pair so that the output
+  // keeps the same order irrespective of how the pairs got distributed across threads.
+  const size_t num_pairs = num_batches * num_classes;
+  std::vector<std::vector<int64_t>> selected_box_indices(num_pairs);
+
+  const size_t max_selected = static_cast<size_t>(std::min<int64_t>(max_output_boxes_per_class, pc.num_boxes_));
+  const double selection_cost = static_cast<double>(num_boxes) * std::log2(static_cast<double>(num_boxes) + 1) +
+                                static_cast<double>(max_selected) * static_cast<double>(max_selected);
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_pairs),
+      TensorOpCost{static_cast<double>(num_boxes * sizeof(float)), static_cast<double>(max_selected * sizeof(int64_t)),
+                   selection_cost},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        ClassSelectionScratch scratch;
+        scratch.candidates.reserve(num_boxes);
+        scratch.selected.Reserve(max_selected);
+        for (auto pair = static_cast<size_t>(first), end = static_cast<size_t>(last); pair < end; ++pair) {
+          const size_t batch_index = pair / num_classes;
+          SelectBoxesOfClass(pc.scores_data_ + pair * num_boxes, batch_boxes[batch_index], pc.num_boxes_,
+                             has_score_threshold, score_threshold, max_output_boxes_per_class, iou_threshold,
+                             scratch, selected_box_indices[pair]);
+        }
+      });
+
+  size_t num_selected = 0;
+  for (const auto& indices : selected_box_indices) {
+    num_selected += indices.size();
+  }
+  selected_indices.reserve(selected_indices.size() + num_selected);
+  for (size_t pair = 0; pair < num_pairs; ++pair) {
+    const auto batch_index = static_cast<int64_t>(pair / num_classes);
+    const auto class_index = static_cast<int64_t>(pair % num_classes);
+    for (int64_t box_index : selected_box_indices[pair]) {
+      selected_indices.emplace_back(batch_index, class_index, box_index);
+    }
+  }
+}
+
 Status NonMaxSuppression::Compute(OpKernelContext* ctx) const {
   PrepareContext pc;
   ORT_RETURN_IF_ERROR(PrepareCompute(ctx, pc));
@@ -133,70 +399,9 @@ Status NonMaxSuppression::Compute(OpKernelContext* ctx) const {
     return Status::OK();
   }
 
-  const auto* const boxes_data = pc.boxes_data_;
-  const auto* const scores_data = pc.scores_data_;
-
-  struct BoxInfoPtr {
-    float score_{};
-    int64_t index_{};
-
-    BoxInfoPtr() = default;
-    explicit BoxInfoPtr(float score, int64_t idx) : score_(score), index_(idx) {}
-    inline bool operator<(const BoxInfoPtr& rhs) const {
-      return score_ < rhs.score_ || (score_ == rhs.score_ && index_ > rhs.index_);
-    }
-  };
-
-  const auto center_point_box = GetCenterPointBox();
-
   std::vector<SelectedIndex> selected_indices;
-  std::vector<BoxInfoPtr> selected_boxes_inside_class;
-  selected_boxes_inside_class.reserve(std::min<size_t>(static_cast<size_t>(max_output_boxes_per_class), pc.num_boxes_));
-
-  for (int64_t batch_index = 0; batch_index < pc.num_batches_; ++batch_index) {
-    for (int64_t class_index = 0; class_index < pc.num_classes_; ++class_index) {
-      int64_t box_score_offset = (batch_index * pc.num_classes_ + class_index) * pc.num_boxes_;
-      const float* batch_boxes = boxes_data + (batch_index * pc.num_boxes_ * 4);
-      std::vector<BoxInfoPtr> candidate_boxes;
-      candidate_boxes.reserve(pc.num_boxes_);
-
-      // Filter by score_threshold_
-      const auto* class_scores = scores_data + box_score_offset;
-      if (pc.score_threshold_ != nullptr) {
-        for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
-          if (*class_scores > score_threshold) {
-            candidate_boxes.emplace_back(*class_scores, box_index);
-          }
-        }
-      } else {
-        for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
-          candidate_boxes.emplace_back(*class_scores, box_index);
-        }
-      }
-      std::priority_queue<BoxInfoPtr, std::vector<BoxInfoPtr>> sorted_boxes(std::less<BoxInfoPtr>(), std::move(candidate_boxes));
-
-      selected_boxes_inside_class.clear();
-      // Get the next box with top score, filter by iou_threshold
-      while (!sorted_boxes.empty() && static_cast<int64_t>(selected_boxes_inside_class.size()) < max_output_boxes_per_class) {
-        const BoxInfoPtr& next_top_score = sorted_boxes.top();
-
-        bool selected = true;
-        // Check with existing selected boxes for this class, suppress if exceed the IOU (Intersection Over Union) threshold
-        for (const auto& selected_index : selected_boxes_inside_class) {
-          if (SuppressByIOU(batch_boxes, next_top_score.index_, selected_index.index_, center_point_box, iou_threshold)) {
-            selected = false;
-            break;
-          }
-        }
-
-        if (selected) {
-          selected_boxes_inside_class.push_back(next_top_score);
-          selected_indices.emplace_back(batch_index, class_index, next_top_score.index_);
-        }
-        sorted_boxes.pop();
-      }  // while
-    }    // for class_index
-  }      // for batch_index
+  SelectBoxes(pc, GetCenterPointBox(), max_output_boxes_per_class, iou_threshold, score_threshold,
+              ctx->GetOperatorThreadPool(), selected_indices);
 
   constexpr auto last_dim = 3;
   const auto num_selected = selected_indices.size();
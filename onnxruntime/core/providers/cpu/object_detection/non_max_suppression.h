@@ -9,6 +9,7 @@
 namespace onnxruntime {
 
 struct PrepareContext;
+struct SelectedIndex;
 
 class NonMaxSuppressionBase {
  protected:
@@ -38,5 +39,11 @@ class NonMaxSuppression final : public OpKernel, public NonMaxSuppressionBase {
   }
 
   Status Compute(OpKernelContext* context) const override;
+
+  // Runs the suppression for every (batch, class) pair, in parallel over the pairs when a thread pool is given.
+  // The selections are appended to `selected_indices` ordered by batch, class and decreasing score.
+  static void SelectBoxes(const PrepareContext& pc, int64_t center_point_box, int64_t max_output_boxes_per_class,
+                          float iou_threshold, float score_threshold, concurrency::ThreadPool* tp,
+                          std::vector<SelectedIndex>& selected_indices);
 };
 }  // namespace onnxruntime
@@ -202,36 +202,91 @@ ONNX_CPU_OPERATOR_TYPED_MS_KERNEL(
 }  // namespace contrib
 #endif  // !defined(DISABLE_CONTRIB_OPS)
 
+// Number of elements of a quantization block that are converted by one unit of work.
+constexpr std::ptrdiff_t kQDQChunkSize = 128;
+
+// Splits the N x broadcast_dim blocks of a tensor into chunks of at most kQDQChunkSize elements
+// and calls fn(offset, count, bd) for each of them on the thread pool. A chunk never crosses a
+// block, so every chunk uses the single scale and zero point at index bd.
+template <typename Fn>
+static void ParallelForQDQChunks(concurrency::ThreadPool* thread_pool, int64_t N, int64_t broadcast_dim,
+                                 int64_t block_size, size_t input_element_size, size_t output_element_size,
+                                 Fn&& fn) {
+  const std::ptrdiff_t chunks_per_block = (onnxruntime::narrow<std::ptrdiff_t>(block_size) + kQDQChunkSize - 1) / kQDQChunkSize;
+  const std::ptrdiff_t num_chunks = SafeInt<std::ptrdiff_t>(N) * broadcast_dim * chunks_per_block;
+  if (num_chunks == 0) {
+    return;
+  }
+
+  const double chunk_size = static_cast<double>(std::min<int64_t>(block_size, kQDQChunkSize));
+  const TensorOpCost unit_cost{chunk_size * input_element_size, chunk_size * output_element_size, chunk_size * 2.0};
+  concurrency::ThreadPool::TryParallelFor(thread_pool, num_chunks, unit_cost, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (std::ptrdiff_t chunk = begin; chunk < end; chunk++) {
+      const std::ptrdiff_t block = chunk / chunks_per_block;
+      const std::ptrdiff_t block_offset = (chunk % chunks_per_block) * kQDQChunkSize;
+      fn(static_cast<size_t>(block * block_size + block_offset),
+         static_cast<size_t>(std::min<std::ptrdiff_t>(kQDQChunkSize, block_size - block_offset)),
+         static_cast<size_t>(block % broadcast_dim));
+    }
+  });
+}
+
+// Chunks shorter than this are dequantized inline, which is cheaper than an MLAS call when the
+// quantization axis is the innermost dimension and every block holds a handful of elements.
+constexpr size_t kQDQMinKernelSize = 16;
+
+template <typename T>
+static void DequantizeLinearChunk(const T* input, float* output, size_t count, float scale, T zero_point) {
+  if (count < kQDQMinKernelSize) {
+    for (size_t i = 0; i < count; i++) {
+      output[i] = static_cast<float>(static_cast<int32_t>(input[i]) - static_cast<int32_t>(zero_point)) * scale;
+    }
+    return;
+  }
+  MlasDequantizeLinear(input, output, count, scale, zero_point);
+}
+
+template <typename T>
+static void DequantizeLinearChunk(const T* input, MLFloat16* output, size_t count, MLFloat16 scale, T zero_point) {
+  if (count < kQDQMinKernelSize) {
+    const float sc = scale.ToFloat();
+    for (size_t i = 0; i < count; i++) {
+      output[i] = MLFloat16(static_cast<float>(static_cast<int32_t>(input[i]) - static_cast<int32_t>(zero_point)) * sc);
+    }
+    return;
+  }
+  float buffer[kQDQChunkSize];
+  MlasDequantizeLinear(input, buffer, count, scale.ToFloat(), zero_point);
+  MlasConvertFloatToHalfBuffer(buffer, &output->val, count);
+}
+
 template <typename T, typename OutT>
 struct DequantizeLinearApply {
-  void op(int64_t N, int64_t broadcast_dim, int64_t block_size, const T* input, const OutT* scale, OutT* output, const T* zero_point) {
-    for (size_t n = 0; n < static_cast<size_t>(N); n++) {
-      for (size_t bd = 0; bd < static_cast<size_t>(broadcast_dim); bd++) {
-        auto zp = zero_point ? static_cast<int32_t>(zero_point[bd]) : 0;
-        auto sc = static_cast<float>(scale[bd]);
-        for (size_t bs = 0; bs < static_cast<size_t>(block_size); bs++) {
-          *output++ = static_cast<OutT>(static_cast<float>(static_cast<int32_t>(*input++) - zp) * sc);
-        }
-      }
-    }
+  void op(concurrency::ThreadPool* thread_pool, int64_t N, int64_t broadcast_dim, int64_t block_size,
+          const T* input, const OutT* scale, OutT* output, const T* zero_point) {
+    ParallelForQDQChunks(thread_pool, N, broadcast_dim, block_size, sizeof(T), sizeof(OutT),
+                         [&](size_t offset, size_t count, size_t bd) {
+                           DequantizeLinearChunk(input + offset, output + offset, count, scale[bd],
+                                                 zero_point ? zero_point[bd] : T(0));
+                         });
   }
 };
 
 #if !defined(DISABLE_FLOAT8_TYPES)
 
-#define DEQUANTIZE_LINEAR_APPLY_FLOAT8(T)                                                                                      \
-  template <typename OutT>                                                                                                     \
-  struct DequantizeLinearApply<T, OutT> {                                                                                      \
-    void op(int64_t N, int64_t broadcast_dim, int64_t block_size, const T* input, const OutT* scale, OutT* output, const T*) { \
-      for (size_t n = 0; n < static_cast<size_t>(N); n++) {                                                                    \
-        for (size_t bd = 0; bd < static_cast<size_t>(broadcast_dim); bd++) {                                                   \
-          auto sc = scale[bd];                                                                                                 \
-          for (size_t bs = 0; bs < static_cast<size_t>(block_size); bs++, input++) {                                           \
-            *output++ = static_cast<OutT>(input->ToFloat() * sc);                                                              \
-          }                                                                                                                    \
-        }                                                                                                                      \
-      }                                                                                                                        \
-    }                                                                                                                          \
+#define DEQUANTIZE_LINEAR_APPLY_FLOAT8(T)                                                           \
+  template <typename OutT>                                                                          \
+  struct DequantizeLinearApply<T, OutT> {                                                           \
+    void op(concurrency::ThreadPool* thread_pool, int64_t N, int64_t broadcast_dim,                 \
+            int64_t block_size, const T* input, const OutT* scale, OutT* output, const T*) {        \
+      ParallelForQDQChunks(thread_pool, N, broadcast_dim, block_size, sizeof(T), sizeof(OutT),      \
+                           [&](size_t offset, size_t count, size_t bd) {                            \
+                             auto sc = scale[bd];                                                   \
+                             for (size_t i = offset; i < offset + count; i++) {                     \
+                               output[i] = static_cast<OutT>(input[i].ToFloat() * sc);              \
+                             }                                                                      \
+                           });                                                                      \
+    }                                                                                               \
   };
 
 DEQUANTIZE_LINEAR_APPLY_FLOAT8(Float8E4M3FN)
@@ -273,15 +328,16 @@ Status DequantizeLinear<T>::Compute(OpKernelContext* ctx) const {
 
   const auto to = x_scale.GetElementType();
   const T* input = x.Data<T>();
+  concurrency::ThreadPool* thread_pool = ctx->GetOperatorThreadPool();
 
   if (to == ONNX_NAMESPACE::TensorProto::FLOAT) {
     const float* scale = x_scale.Data<float>();
     float* output = y.MutableData<float>();
-    DequantizeLinearApply<T, float>().op(N, broadcast_dim, block_size, input, scale, output, zero_point);
+    DequantizeLinearApply<T, float>().op(thread_pool, N, broadcast_dim, block_size, input, scale, output, zero_point);
   } else if (to == ONNX_NAMESPACE::TensorProto::FLOAT16) {
     const MLFloat16* scale = x_scale.Data<MLFloat16>();
     MLFloat16* output = y.MutableData<MLFloat16>();
-    DequantizeLinearApply<T, MLFloat16>().op(N, broadcast_dim, block_size, input, scale, output, zero_point);
+    DequantizeLinearApply<T, MLFloat16>().op(thread_pool, N, broadcast_dim, block_size, input, scale, output, zero_point);
   } else if (to == ONNX_NAMESPACE::TensorProto::BFLOAT16) {
     ORT_THROW("DequantizeLinear into BFLOAT16 is not implemented yet.");
   } else {
@@ -430,13 +486,18 @@ void ParQuantizeLinear(const InputType* Input,
 
 template <typename T, typename InT>
 void ComputeLoop(OpKernelContext* ctx, const InT* input, const InT* scale, const T* zero_point, T* output, int64_t N, int64_t broadcast_dim, int64_t block_size, bool saturate) {
-  for (size_t n = 0; n < static_cast<size_t>(N); n++) {
-    for (size_t bd = 0; bd < static_cast<size_t>(broadcast_dim); bd++) {
-      ParQuantizeLinear(input, output, static_cast<size_t>(block_size), scale[bd], bd, zero_point, saturate, ctx->GetOperatorThreadPool());
-      input += block_size;
-      output += block_size;
-    }
+  if (N == 1 && broadcast_dim == 1) {
+    ParQuantizeLinear(input, output, static_cast<size_t>(block_size), scale[0], 0, zero_point, saturate, ctx->GetOperatorThreadPool());
+    return;
   }
+
+  // Each chunk is quantized inline by the task that owns it, so a per-axis tensor with many small
+  // blocks is split across the thread pool instead of scheduling one parallel loop per block.
+  ParallelForQDQChunks(ctx->GetOperatorThreadPool(), N, broadcast_dim, block_size, sizeof(InT), sizeof(T),
+                       [&](size_t offset, size_t count, size_t bd) {
+                         ParQuantizeLinear(input + offset, output + offset, count, scale[bd], bd, zero_point,
+                                           saturate, nullptr);
+                       });
 }
 
 // formula is Y = X / Scale + ZeroPoint
@@ -770,11 +770,22 @@ void UniDirectionalGru<T>::ComputeImpl(gsl::span<const T> inputs_arg,
     // affinity between iterations of successive loops.
     onnxruntime::concurrency::ThreadPool::ParallelSection ps(ttp_);
 
+    // rows after the last sequence that still has input at this step are padding. they are trimmed from the
+    // recurrent GEMMs and the reset gate, so batches sorted by decreasing length (as produced from packed
+    // sequences) only compute the live rows. the padding outputs are zeroed in the 2nd set of activations.
+    int active_rows = batch_size_;
+
     // for each item in sequence run all calculations
     for (int step = 0; step < max_sequence_length; step++) {
 #if defined(DUMP_MATRIXES)
       const std::string seqno_str = " [seqno=" + std::to_string(step) + "]";
 #endif
+
+      if (step >= min_sequence_length) {
+        while (active_rows > 0 && sequence_lengths[active_rows - 1] <= step) {
+          --active_rows;
+        }
+      }
       DumpMatrix("Ht-1" + seqno_str, &*prev_Ht, batch_size_, hidden_size_);
 
       out_added_offset = (step * batch_size_) * hidden_size_x3;
@@ -782,7 +793,7 @@ void UniDirectionalGru<T>::ComputeImpl(gsl::span<const T> inputs_arg,
       // calculate Ht-1*R[zr], and add to the weighted inputs that are in zrh
       // Ht-1 * R[zr] + Xt*(W[zr]^T)
       if (!recurrent_weightsZR_s.is_prepacked_) {
-        ComputeGemm(batch_size_, hidden_size_x2, hidden_size_, alpha,
+        ComputeGemm(active_rows, hidden_size_x2, hidden_size_, alpha,
                     prev_Ht, prev_Ht_end,
                     hidden_size_,
                     recurrent_weightsZR.begin(), recurrent_weightsZR.end(),
@@ -792,7 +803,7 @@ void UniDirectionalGru<T>::ComputeImpl(gsl::span<const T> inputs_arg,
       } else {
         MlasGemm(
             CblasNoTrans,
-            static_cast<size_t>(batch_size_), static_cast<size_t>(hidden_size_x2), static_cast<size_t>(hidden_size_), alpha,
+            static_cast<size_t>(active_rows), static_cast<size_t>(hidden_size_x2), static_cast<size_t>(hidden_size_), alpha,
             &*prev_Ht,
             static_cast<size_t>(hidden_size_),
             recurrent_weightsZR_s.buffer_,
@@ -814,7 +825,7 @@ void UniDirectionalGru<T>::ComputeImpl(gsl::span<const T> inputs_arg,
 
         // compute Ht-1 * (Rh^T) + Rbh
         if (!recurrent_weightsH_s.is_prepacked_) {
-          ComputeGemm(batch_size_, hidden_size_, hidden_size_, alpha,
+          ComputeGemm(active_rows, hidden_size_, hidden_size_, alpha,
                       prev_Ht, prev_Ht_end,  // Ht-1
                       hidden_size_,
                       recurrent_weightsH.begin(), recurrent_weightsH.end(),  // Rh^T
@@ -826,7 +837,7 @@ void UniDirectionalGru<T>::ComputeImpl(gsl::span<const T> inputs_arg,
         } else {
           MlasGemm(
               CblasNoTrans,
-              static_cast<size_t>(batch_size_), static_cast<size_t>(hidden_size_), static_cast<size_t>(hidden_size_), alpha,
+              static_cast<size_t>(active_rows), static_cast<size_t>(hidden_size_), static_cast<size_t>(hidden_size_), alpha,
               &*prev_Ht,
               static_cast<size_t>(hidden_size_),
               recurrent_weightsH_s.buffer_,
@@ -839,7 +850,7 @@ void UniDirectionalGru<T>::ComputeImpl(gsl::span<const T> inputs_arg,
       }
 
       // 1st Set Of Activations
-      for (int r = 0; r < batch_size_; r++) {
+      for (int r = 0; r < active_rows; r++) {
         const T* p_bias_r = use_bias_ ? SafeRawConstPointer<T>(batched_bias_WRr_local + r * hidden_size_,
                                                                batched_bias_WRr_local_end, hidden_size_)
                                       : nullptr;
@@ -880,7 +891,7 @@ void UniDirectionalGru<T>::ComputeImpl(gsl::span<const T> inputs_arg,
         // out_H currently contains Xt*(W[zrh]^T).
         auto out_H = zrh.begin() + out_added_offset;
 
-        for (int r = 0; r < batch_size_; r++) {
+        for (int r = 0; r < active_rows; r++) {
           // skip over the inputs with Z and R weights
           out_H += hidden_size_x2;
           for (int h = 0; h < hidden_size_; ++h) {
@@ -899,7 +910,7 @@ void UniDirectionalGru<T>::ComputeImpl(gsl::span<const T> inputs_arg,
 
         // Calculate Xt*(Wh^T) + rt (.) Ht-1 * Rh
         if (!recurrent_weightsH_s.is_prepacked_) {
-          ComputeGemm(batch_size_, hidden_size_, hidden_size_, alpha,
+          ComputeGemm(active_rows, hidden_size_, hidden_size_, alpha,
                       cur_h_local, cur_h_local_end,  // rt (.) Ht-1
                       hidden_size_,
                       recurrent_weightsH.begin(), recurrent_weightsH.end(),  // Rh^T
@@ -909,7 +920,7 @@ void UniDirectionalGru<T>::ComputeImpl(gsl::span<const T> inputs_arg,
         } else {
           MlasGemm(
               CblasNoTrans,
-              static_cast<size_t>(batch_size_), static_cast<size_t>(hidden_size_), static_cast<size_t>(hidden_size_), alpha,
+              static_cast<size_t>(active_rows), static_cast<size_t>(hidden_size_), static_cast<size_t>(hidden_size_), alpha,
               &*cur_h_local,
               static_cast<size_t>(hidden_size_),
               recurrent_weightsH_s.buffer_,
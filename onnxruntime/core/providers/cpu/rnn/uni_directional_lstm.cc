@@ -75,6 +75,9 @@ UniDirectionalLstm<T>::UniDirectionalLstm(
 
   clip_with_bias_ptr_ = use_bias_ ? deepcpu::clip_add_bias : deepcpu::clip_ignore_bias;
 
+  use_fused_gates_ = activation_func_f.name == "sigmoid" && activation_func_g.name == "tanh" &&
+                     activation_func_h.name == "tanh" && !use_peepholes_ && !input_forget_;
+
   SetNumThreads();
   AllocateBuffers();
   InitializeBuffers(initial_hidden_state, initial_cell_state);
@@ -103,10 +106,11 @@ void UniDirectionalLstm<T>::AllocateBuffers() {
   }
 
   if (use_bias_) {
-    bias_WRi_ = Allocate(allocator_, hidden_size_, bias_WRi_ptr_);
-    bias_WRf_ = Allocate(allocator_, hidden_size_, bias_WRf_ptr_);
-    bias_WRo_ = Allocate(allocator_, hidden_size_, bias_WRo_ptr_);
-    bias_WRc_ = Allocate(allocator_, hidden_size_, bias_WRc_ptr_);
+    bias_WR_ = Allocate(allocator_, 4 * hidden_size_, bias_WR_ptr_);
+    bias_WRi_ = bias_WR_.subspan(0 * hidden_size_, hidden_size_);
+    bias_WRo_ = bias_WR_.subspan(1 * hidden_size_, hidden_size_);
+    bias_WRf_ = bias_WR_.subspan(2 * hidden_size_, hidden_size_);
+    bias_WRc_ = bias_WR_.subspan(3 * hidden_size_, hidden_size_);
   }
 
   if (direction_ == kReverse) {
@@ -325,26 +329,39 @@ void UniDirectionalLstm<T>::ComputeImpl(const gsl::span<const T>& inputs_arg,
     // after the first step this will switch to the output from the previous step
     auto previous_state = batched_hidden_state_one_step.begin() + seq_start * hidden_size_;
 
+    // rows after the last sequence that still has input at this step are padding. they are trimmed from the
+    // recurrent GEMM and the gate computations, so batches sorted by decreasing length (as produced from
+    // packed sequences) only compute the live rows. the padding outputs are zeroed below.
+    int num_active_rows = num_seq_to_compute_adjusted;
+
     // run through steps sequentially
     for (int step = 0; step < max_sequence_length; step++) {
 #if defined(DUMP_MATRIXES)
       const std::string row_str = " [row=" + std::to_string(row) + ",seqno=" + std::to_string(step) + "]";
 #endif
 
+      if (step >= min_sequence_length) {
+        while (num_active_rows > 0 && sequence_lengths[seq_start + num_active_rows - 1] <= step) {
+          --num_active_rows;
+        }
+      }
+
       span_T_iter step_out_IOFC = output_iofc.begin() + (step * batch_size_ + seq_start) * hidden_size_x4;
 
       // calculate Xt*(W[iofc]^T) + Ht-t*R[iofc]
       // Do it sequentially to avoid nested parallelism
-      ComputeGemm(num_seq_to_compute_adjusted, hidden_size_x4, hidden_size_, alpha,
-                  gsl::span<const T>(&*previous_state, previous_state_end - previous_state),  // Ht-1
-                  recurrent_weights,                                                          // R[iofc]
-                  beta, gsl::span<T>(&*step_out_IOFC, output_iofc.end() - step_out_IOFC),     // input contains Xt*(W[iofc]^T)
-                  hidden_size_x4,
-                  quantized_input_or_a_.data() + (seq_start * hidden_size_),
-                  quantized_C_buffer_.data() + (seq_start * hidden_size_x4),
-                  ttp);
+      if (num_active_rows > 0) {
+        ComputeGemm(num_active_rows, hidden_size_x4, hidden_size_, alpha,
+                    gsl::span<const T>(&*previous_state, previous_state_end - previous_state),  // Ht-1
+                    recurrent_weights,                                                          // R[iofc]
+                    beta, gsl::span<T>(&*step_out_IOFC, output_iofc.end() - step_out_IOFC),     // input contains Xt*(W[iofc]^T)
+                    hidden_size_x4,
+                    quantized_input_or_a_.data() + (seq_start * hidden_size_),
+                    quantized_C_buffer_.data() + (seq_start * hidden_size_x4),
+                    ttp);
+      }
 
-      DumpMatrix("Xt*(W[iofc]^T) + Ht-t*R[iofc]" + row_str, &*step_out_IOFC, num_seq_to_compute_adjusted, hidden_size_x4);
+      DumpMatrix("Xt*(W[iofc]^T) + Ht-t*R[iofc]" + row_str, &*step_out_IOFC, num_active_rows, hidden_size_x4);
 
       span_T_iter batched_output;
       span_T_iter batched_output_end;
@@ -362,10 +379,10 @@ void UniDirectionalLstm<T>::ComputeImpl(const gsl::span<const T>& inputs_arg,
                                                        : all_cell_states.end();
       span_T_iter batched_cell_states_end = all_cell_states.end();
 
-      span_T_iter step_out_IOFC_end = step_out_IOFC + num_seq_to_compute_adjusted * hidden_size_x4;
+      span_T_iter step_out_IOFC_end = step_out_IOFC + num_active_rows * hidden_size_x4;
       GateComputations(step_out_IOFC, step_out_IOFC_end, c_prev, C_prev_end, c_prev_clipped, C_prev_clipped_end,
                        batched_output, batched_output_end, sequence_lengths, min_sequence_length, step, seq_start,
-                       num_seq_to_compute_adjusted, output_sequence, batched_cell_states, batched_cell_states_end);
+                       num_active_rows, output_sequence, batched_cell_states, batched_cell_states_end);
 
       // copy last row to final_cell_state
       for (int lrow = seq_start; lrow < seq_start + num_seq_to_compute_adjusted; ++lrow) {
@@ -485,6 +502,22 @@ void UniDirectionalLstm<T>::GateComputations(
 
     // check that we have hidden_size_x4 left starting at cur_out + b * hidden_size_x4, and get a raw pointer to that
     float* pi = SafeRawPointer<T>(out + b * hidden_size_x4, out_end, hidden_size_x4);
+
+    if (use_fused_gates_) {
+      // bias, clip, activations and the Ct/Ht updates in a single pass over the row
+      float* pC_cur = SafeRawPointer<T>(C_prev + b * hidden_size_, C_prev_end, hidden_size_);
+      float* pH = SafeRawPointer<T>(batched_output + row * hidden_size_ + b * hidden_size_, batched_output_end,
+                                    hidden_size_);
+      MlasLstmGates(pi, use_bias_ ? bias_WR_.data() : nullptr, pC_cur, pH, clip_, static_cast<size_t>(hidden_size_));
+
+      if (training_mode_) {
+        float* pC = SafeRawPointer<T>(batched_cell_states + row * hidden_size_ + b * hidden_size_,
+                                      batched_cell_states_end, hidden_size_);
+        std::copy_n(pC_cur, hidden_size_, pC);
+      }
+
+      continue;
+    }
     float* po = pi + hidden_size_;
     float* pf = po + hidden_size_;
     float* pc = pf + hidden_size_;
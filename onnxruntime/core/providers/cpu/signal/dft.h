@@ -3,6 +3,7 @@
 
 #include "core/common/common.h"
 #include "core/framework/op_kernel.h"
+#include "core/providers/cpu/signal/fft.h"
 
 namespace onnxruntime {
 
@@ -11,6 +12,8 @@ class DFT final : public OpKernel {
   bool is_onesided_ = true;
   int64_t axis_ = 0;
   bool is_inverse_ = false;
+  mutable signal::FftPlanCache<float> float_plans_;
+  mutable signal::FftPlanCache<double> double_plans_;
 
  public:
   explicit DFT(const OpKernelInfo& info) : OpKernel(info) {
@@ -27,6 +30,8 @@ class DFT final : public OpKernel {
 
 class STFT final : public OpKernel {
   bool is_onesided_ = true;
+  mutable signal::FftPlanCache<float> float_plans_;
+  mutable signal::FftPlanCache<double> double_plans_;
 
  public:
   explicit STFT(const OpKernelInfo& info) : OpKernel(info) {
@@ -0,0 +1,369 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/common/inlined_containers.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+namespace signal {
+
+// A precomputed FFT of a fixed length and direction.
+//
+// Lengths whose prime factors are all small use a mixed-radix Cooley-Tukey decimation in time with specialized
+// radix 2, 3, 4 and 5 butterflies and a generic butterfly for the other factors. Lengths with a large prime factor
+// use Bluestein's algorithm on top of a power of 2 mixed-radix plan.
+// Forward plans of even length also provide a real-input transform that runs a complex FFT of half the length.
+//
+// A plan is immutable once created so it can be shared between threads. Scratch space is provided by the caller.
+template <typename T>
+class FftPlan {
+ public:
+  // prime factors up to this size use the mixed-radix algorithm, larger ones use Bluestein's algorithm
+  static constexpr size_t kMaxRadix = 31;
+
+  // with_real_transform is only used to avoid creating real-input transforms for the internal plans
+  FftPlan(size_t length, bool inverse, bool with_real_transform = true) : length_(length), inverse_(inverse) {
+    ORT_ENFORCE(length_ > 0, "FFT length must be greater than zero.");
+
+    if (Factorize(length_, factors_)) {
+      twiddles_.resize(length_);
+      for (size_t i = 0; i < length_; ++i) {
+        twiddles_[i] = Exponential(i, length_);
+      }
+    } else {
+      InitializeBluestein();
+    }
+
+    if (with_real_transform && !inverse_ && length_ % 2 == 0) {
+      const size_t half_length = length_ / 2;
+      half_plan_ = std::make_unique<FftPlan<T>>(half_length, false, false);
+      real_twiddles_.resize(half_length + 1);
+      for (size_t k = 0; k <= half_length; ++k) {
+        real_twiddles_[k] = Exponential(k, length_);
+      }
+    }
+  }
+
+  size_t Length() const { return length_; }
+  bool IsInverse() const { return inverse_; }
+  bool HasRealTransform() const { return half_plan_ != nullptr; }
+
+  // Number of complex values of scratch space needed by Transform and TransformReal.
+  size_t ScratchSize() const {
+    const size_t complex_scratch_size = bluestein_forward_ ? 2 * bluestein_forward_->Length() : 0;
+    const size_t real_scratch_size = half_plan_ ? length_ + half_plan_->ScratchSize() : 0;
+    return std::max(complex_scratch_size, real_scratch_size);
+  }
+
+  // Computes the unscaled DFT of the `length` values in `input` into `output`. input and output must not overlap.
+  void Transform(const std::complex<T>* input, std::complex<T>* output, std::complex<T>* scratch) const {
+    if (bluestein_forward_) {
+      TransformBluestein(input, output, scratch);
+    } else if (factors_.empty()) {
+      output[0] = input[0];
+    } else {
+      MixedRadix(output, input, 1, factors_.data());
+    }
+  }
+
+  // Computes the first length / 2 + 1 values of the DFT of the `length` real values in `input`, which are all the
+  // unique values as the rest follow from conjugate symmetry. Requires HasRealTransform().
+  void TransformReal(const T* input, std::complex<T>* output, std::complex<T>* scratch) const {
+    const size_t half_length = length_ / 2;
+
+    // pack the even samples into the real part and the odd samples into the imaginary part
+    std::complex<T>* packed = scratch;
+    std::complex<T>* packed_fft = scratch + half_length;
+    for (size_t n = 0; n < half_length; ++n) {
+      packed[n] = std::complex<T>(input[2 * n], input[2 * n + 1]);
+    }
+
+    half_plan_->Transform(packed, packed_fft, scratch + length_);
+
+    // separate the transforms of the even and odd samples and combine them
+    for (size_t k = 0; k <= half_length; ++k) {
+      const std::complex<T> z = packed_fft[k == half_length ? 0 : k];
+      const std::complex<T> z_mirror = std::conj(packed_fft[k == 0 ? 0 : half_length - k]);
+      const std::complex<T> even = (z + z_mirror) * static_cast<T>(0.5);
+      const std::complex<T> difference = z - z_mirror;
+      const std::complex<T> odd(difference.imag() * static_cast<T>(0.5), -difference.real() * static_cast<T>(0.5));
+      output[k] = even + real_twiddles_[k] * odd;
+    }
+  }
+
+ private:
+  // Splits length into (radix, remaining length) pairs, radix 4 first. Returns false if it has a factor larger
+  // than kMaxRadix.
+  static bool Factorize(size_t length, InlinedVector<size_t>& factors) {
+    size_t radix = 4;
+    while (length > 1) {
+      while (length % radix != 0) {
+        radix = radix == 4 ? 2 : radix == 2 ? 3
+                                             : radix + 2;
+        if (radix > kMaxRadix) {
+          factors.clear();
+          return false;
+        }
+      }
+      length /= radix;
+      factors.push_back(radix);
+      factors.push_back(length);
+    }
+    return true;
+  }
+
+  // exp(-2 pi i index / length) for a forward plan, exp(2 pi i index / length) for an inverse one.
+  // Computed in double precision so float plans are as accurate as possible.
+  std::complex<T> Exponential(size_t index, size_t length) const {
+    const double angle = (inverse_ ? 2.0 : -2.0) * M_PI * static_cast<double>(index) / static_cast<double>(length);
+    return std::complex<T>(static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle)));
+  }
+
+  void MixedRadix(std::complex<T>* output, const std::complex<T>* input, size_t stride, const size_t* factors) const {
+    const size_t radix = factors[0];
+    const size_t m = factors[1];
+    std::complex<T>* const output_end = output + radix * m;
+
+    if (m == 1) {
+      for (std::complex<T>* out = output; out != output_end; ++out, input += stride) {
+        *out = *input;
+      }
+    } else {
+      // transform each of the `radix` interleaved subsequences of length m
+      for (std::complex<T>* out = output; out != output_end; out += m, input += stride) {
+        MixedRadix(out, input, stride * radix, factors + 2);
+      }
+    }
+
+    switch (radix) {
+      case 2:
+        Butterfly2(output, stride, m);
+        break;
+      case 3:
+        Butterfly3(output, stride, m);
+        break;
+      case 4:
+        Butterfly4(output, stride, m);
+        break;
+      case 5:
+        Butterfly5(output, stride, m);
+        break;
+      default:
+        ButterflyGeneric(output, stride, m, radix);
+        break;
+    }
+  }
+
+  void Butterfly2(std::complex<T>* data, size_t stride, size_t m) const {
+    std::complex<T>* data1 = data + m;
+    for (size_t k = 0; k < m; ++k) {
+      const std::complex<T> t = data1[k] * twiddles_[k * stride];
+      data1[k] = data[k] - t;
+      data[k] += t;
+    }
+  }
+
+  void Butterfly3(std::complex<T>* data, size_t stride, size_t m) const {
+    const T sin_third = twiddles_[stride * m].imag();
+    for (size_t k = 0; k < m; ++k) {
+      const std::complex<T> s1 = data[k + m] * twiddles_[k * stride];
+      const std::complex<T> s2 = data[k + 2 * m] * twiddles_[2 * k * stride];
+      const std::complex<T> sum = s1 + s2;
+      const std::complex<T> difference = (s1 - s2) * sin_third;
+
+      const std::complex<T> partial = data[k] - sum * static_cast<T>(0.5);
+      data[k] += sum;
+      data[k + m] = std::complex<T>(partial.real() - difference.imag(), partial.imag() + difference.real());
+      data[k + 2 * m] = std::complex<T>(partial.real() + difference.imag(), partial.imag() - difference.real());
+    }
+  }
+
+  void Butterfly4(std::complex<T>* data, size_t stride, size_t m) const {
+    for (size_t k = 0; k < m; ++k) {
+      const std::complex<T> s0 = data[k + m] * twiddles_[k * stride];
+      const std::complex<T> s1 = data[k + 2 * m] * twiddles_[2 * k * stride];
+      const std::complex<T> s2 = data[k + 3 * m] * twiddles_[3 * k * stride];
+      const std::complex<T> s3 = s0 + s2;
+      const std::complex<T> s4 = s0 - s2;
+      const std::complex<T> s5 = data[k] - s1;
+
+      data[k] += s1;
+      data[k + 2 * m] = data[k] - s3;
+      data[k] += s3;
+
+      // multiply s4 by -i for a forward transform and by i for an inverse one
+      const std::complex<T> rotated = inverse_ ? std::complex<T>(-s4.imag(), s4.real())
+                                               : std::complex<T>(s4.imag(), -s4.real());
+      data[k + m] = s5 + rotated;
+      data[k + 3 * m] = s5 - rotated;
+    }
+  }
+
+  void Butterfly5(std::complex<T>* data, size_t stride, size_t m) const {
+    const std::complex<T> ya = twiddles_[stride * m];
+    const std::complex<T> yb = twiddles_[stride * 2 * m];
+    for (size_t k = 0; k < m; ++k) {
+      const std::complex<T> s0 = data[k];
+      const std::complex<T> s1 = data[k + m] * twiddles_[k * stride];
+      const std::complex<T> s2 = data[k + 2 * m] * twiddles_[2 * k * stride];
+      const std::complex<T> s3 = data[k + 3 * m] * twiddles_[3 * k * stride];
+      const std::complex<T> s4 = data[k + 4 * m] * twiddles_[4 * k * stride];
+
+      const std::complex<T> s7 = s1 + s4;
+      const std::complex<T> s10 = s1 - s4;
+      const std::complex<T> s8 = s2 + s3;
+      const std::complex<T> s9 = s2 - s3;
+
+      data[k] = s0 + s7 + s8;
+
+      const std::complex<T> s5(s0.real() + s7.real() * ya.real() + s8.real() * yb.real(),
+                               s0.imag() + s7.imag() * ya.real() + s8.imag() * yb.real());
+      const std::complex<T> s6(s10.imag() * ya.imag() + s9.imag() * yb.imag(),
+                               -s10.real() * ya.imag() - s9.real() * yb.imag());
+      data[k + m] = s5 - s6;
+      data[k + 4 * m] = s5 + s6;
+
+      const std::complex<T> s11(s0.real() + s7.real() * yb.real() + s8.real() * ya.real(),
+                                s0.imag() + s7.imag() * yb.real() + s8.imag() * ya.real());
+      const std::complex<T> s12(-s10.imag() * yb.imag() + s9.imag() * ya.imag(),
+                                s10.real() * yb.imag() - s9.real() * ya.imag());
+      data[k + 2 * m] = s11 + s12;
+      data[k + 3 * m] = s11 - s12;
+    }
+  }
+
+  void ButterflyGeneric(std::complex<T>* data, size_t stride, size_t m, size_t radix) const {
+    InlinedVector<std::complex<T>, kMaxRadix> values(radix);
+    for (size_t u = 0; u < m; ++u) {
+      for (size_t q = 0, k = u; q < radix; ++q, k += m) {
+        values[q] = data[k];
+      }
+
+      for (size_t q = 0, k = u; q < radix; ++q, k += m) {
+        size_t twiddle_index = 0;
+        std::complex<T> sum = values[0];
+        for (size_t p = 1; p < radix; ++p) {
+          twiddle_index += stride * k;
+          if (twiddle_index >= length_) {
+            twiddle_index -= length_;
+          }
+          sum += values[p] * twiddles_[twiddle_index];
+        }
+        data[k] = sum;
+      }
+    }
+  }
+
+  // Bluestein's algorithm expresses the DFT as a convolution with a chirp, which is computed with power of 2 FFTs.
+  void InitializeBluestein() {
+    size_t convolution_length = 1;
+    while (convolution_length < 2 * length_ - 1) {
+      convolution_length <<= 1;
+    }
+
+    bluestein_forward_ = std::make_unique<FftPlan<T>>(convolution_length, false, false);
+    bluestein_inverse_ = std::make_unique<FftPlan<T>>(convolution_length, true, false);
+
+    // chirp[n] = exp(-+ pi i n^2 / length). n^2 is reduced modulo 2 * length to keep the angle accurate.
+    chirp_.resize(length_);
+    for (size_t n = 0; n < length_; ++n) {
+      chirp_[n] = Exponential((n * n) % (2 * length_), 2 * length_);
+    }
+
+    std::vector<std::complex<T>> b(convolution_length);
+    b[0] = std::conj(chirp_[0]);
+    for (size_t n = 1; n < length_; ++n) {
+      b[n] = b[convolution_length - n] = std::conj(chirp_[n]);
+    }
+
+    // fold the 1 / convolution_length scaling of the inverse FFT into the cached transform of b
+    b_fft_.resize(convolution_length);
+    std::vector<std::complex<T>> scratch(bluestein_forward_->ScratchSize());
+    bluestein_forward_->Transform(b.data(), b_fft_.data(), scratch.data());
+    const T scale = static_cast<T>(1) / static_cast<T>(convolution_length);
+    for (auto& value : b_fft_) {
+      value *= scale;
+    }
+  }
+
+  void TransformBluestein(const std::complex<T>* input, std::complex<T>* output, std::complex<T>* scratch) const {
+    const size_t convolution_length = bluestein_forward_->Length();
+    std::complex<T>* a = scratch;
+    std::complex<T>* a_fft = scratch + convolution_length;
+
+    for (size_t n = 0; n < length_; ++n) {
+      a[n] = input[n] * chirp_[n];
+    }
+    std::fill(a + length_, a + convolution_length, std::complex<T>{});
+
+    // the power of 2 plans never need scratch space
+    bluestein_forward_->Transform(a, a_fft, nullptr);
+    for (size_t n = 0; n < convolution_length; ++n) {
+      a_fft[n] *= b_fft_[n];
+    }
+    bluestein_inverse_->Transform(a_fft, a, nullptr);
+
+    for (size_t k = 0; k < length_; ++k) {
+      output[k] = a[k] * chirp_[k];
+    }
+  }
+
+  size_t length_;
+  bool inverse_;
+
+  // mixed-radix
+  InlinedVector<size_t> factors_;
+  std::vector<std::complex<T>> twiddles_;
+
+  // Bluestein
+  std::unique_ptr<FftPlan<T>> bluestein_forward_;
+  std::unique_ptr<FftPlan<T>> bluestein_inverse_;
+  std::vector<std::complex<T>> chirp_;
+  std::vector<std::complex<T>> b_fft_;
+
+  // real input
+  std::unique_ptr<FftPlan<T>> half_plan_;
+  std::vector<std::complex<T>> real_twiddles_;
+};
+
+// Plans keyed by length and direction, shared by all runs of a kernel so the twiddles are only computed once.
+template <typename T>
+class FftPlanCache {
+ public:
+  std::shared_ptr<const FftPlan<T>> Get(size_t length, bool inverse) {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    const size_t key = length * 2 + (inverse ? 1 : 0);
+    auto it = plans_.find(key);
+    if (it != plans_.end()) {
+      return it->second;
+    }
+
+    // models use a handful of lengths. bound the memory if the lengths keep changing.
+    if (plans_.size() >= kMaxCachedPlans) {
+      plans_.clear();
+    }
+
+    auto plan = std::make_shared<const FftPlan<T>>(length, inverse);
+    plans_.emplace(key, plan);
+    return plan;
+  }
+
+ private:
+  static constexpr size_t kMaxCachedPlans = 16;
+
+  OrtMutex mutex_;
+  InlinedHashMap<size_t, std::shared_ptr<const FftPlan<T>>> plans_;
+};
+
+}  // namespace signal
+}  // namespace onnxruntime
@@ -15,6 +15,8 @@
 #include "core/framework/data_types.h"
 #include "core/framework/element_type_lists.h"
 #include "core/framework/op_kernel.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/cpu/tensor/utils.h"
 #include "core/providers/op_kernel_type_control.h"
 #include "core/util/math_cpuonly.h"
@@ -22,10 +24,6 @@
 #include "Eigen/src/Core/arch/Default/BFloat16.h"
 #include "Eigen/src/Core/arch/Default/Half.h"
 
-#if defined(_M_AMD64) && !defined(_M_ARM64EC)
-#include "core/mlas/inc/mlas.h"
-#endif
-
 namespace onnxruntime {
 
 namespace op_kernel_type_control {
@@ -178,36 +176,89 @@ template <>
 struct EigenCastType<BFloat16> {
   using type = Eigen::bfloat16;
 };
+// splits an element-wise conversion of count elements into blocks run on the operator thread pool
+template <typename SrcType, typename DstType, typename Fn>
+void ParallelCast(const OpKernelContext& context, std::ptrdiff_t count, double compute_cost, const Fn& fn) {
+  concurrency::ThreadPool::TryParallelFor(
+      context.GetOperatorThreadPool(), count,
+      TensorOpCost{static_cast<double>(sizeof(SrcType)), static_cast<double>(sizeof(DstType)), compute_cost},
+      fn);
+}
+
+// conversions to and from float16 go through a float buffer of this many elements that stays in L1
+constexpr std::ptrdiff_t kFloat16CastBlockSize = 512;
+
+// converts count values to float, with MLAS for the types it has converters for and with Eigen otherwise
+template <typename SrcType>
+void CastToFloat(const SrcType* in, float* out, std::ptrdiff_t count) {
+  if constexpr (std::is_same_v<SrcType, MLFloat16>) {
+    MlasConvertHalfToFloatBuffer(&in->val, out, narrow<size_t>(count));
+  } else if constexpr (std::is_same_v<SrcType, BFloat16>) {
+    MlasConvertBFloat16ToFloatBuffer(&in->val, out, narrow<size_t>(count));
+  } else if constexpr (std::is_same_v<SrcType, int32_t>) {
+    MlasConvertInt32ToFloatBuffer(in, out, narrow<size_t>(count));
+  } else {
+    using SrcEigenCastType = typename EigenCastType<SrcType>::type;
+    EigenVectorMap<float>(out, count) =
+        ConstEigenVectorMap<SrcEigenCastType>(reinterpret_cast<const SrcEigenCastType*>(in), count)
+            .template cast<float>();
+  }
+}
+
+// converts count floats, with MLAS for the types it has converters for and with Eigen otherwise
+template <typename DstType>
+void CastFromFloat(const float* in, DstType* out, std::ptrdiff_t count) {
+  if constexpr (std::is_same_v<DstType, MLFloat16>) {
+    MlasConvertFloatToHalfBuffer(in, &out->val, narrow<size_t>(count));
+  } else if constexpr (std::is_same_v<DstType, BFloat16>) {
+    MlasConvertFloatToBFloat16Buffer(in, &out->val, narrow<size_t>(count));
+  } else if constexpr (std::is_same_v<DstType, int32_t>) {
+    MlasConvertFloatToInt32Buffer(in, out, narrow<size_t>(count));
+  } else {
+    using DstEigenCastType = typename EigenCastType<DstType>::type;
+    EigenVectorMap<DstEigenCastType>(reinterpret_cast<DstEigenCastType*>(out), count) =
+        ConstEigenVectorMap<float>(in, count).template cast<DstEigenCastType>();
+  }
+}
+
+template <typename T>
+using HasMlasFloatCast = boost::mp11::mp_contains<TypeList<BFloat16, MLFloat16, int32_t>, T>;
+
 // generic tensor X -> Y
 template <typename SrcType, typename DstType, typename Enable = void>
 struct TensorCaster {
-  void Cast(const OpKernelContext&, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
     using SrcEigenCastType = typename EigenCastType<SrcType>::type;
     using DstEigenCastType = typename EigenCastType<DstType>::type;
 
     const std::ptrdiff_t shape_size = narrow<std::ptrdiff_t>(shape.Size());
-    const auto in_vector =
-        ConstEigenVectorMap<SrcEigenCastType>(reinterpret_cast<const SrcEigenCastType*>(in.Data<SrcType>()), shape_size);
-    auto out_vector =
-        EigenVectorMap<DstEigenCastType>(reinterpret_cast<DstEigenCastType*>(out.MutableData<DstType>()), shape_size);
-    out_vector = in_vector.template cast<DstEigenCastType>();
+    const auto* in_data = reinterpret_cast<const SrcEigenCastType*>(in.Data<SrcType>());
+    auto* out_data = reinterpret_cast<DstEigenCastType*>(out.MutableData<DstType>());
+    ParallelCast<SrcType, DstType>(context, shape_size, 1.0, [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+      const auto in_vector = ConstEigenVectorMap<SrcEigenCastType>(in_data + first, last - first);
+      auto out_vector = EigenVectorMap<DstEigenCastType>(out_data + first, last - first);
+      out_vector = in_vector.template cast<DstEigenCastType>();
+    });
   }
 };
 
 // tensor X -> string
 template <typename SrcType>
 struct TensorCaster<SrcType, std::string> {
-  void Cast(const OpKernelContext&, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
     const std::ptrdiff_t shape_size = narrow<std::ptrdiff_t>(shape.Size());
     const auto* in_data = in.Data<SrcType>();
     auto* out_data = out.MutableData<std::string>();
-    for (std::ptrdiff_t i = 0; i < shape_size; ++i) {
-      CastToString(in_data[i], out_data[i]);
-    }
+    ParallelCast<SrcType, std::string>(context, shape_size, 64.0, [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+      for (std::ptrdiff_t i = first; i < last; ++i) {
+        CastToString(in_data[i], out_data[i]);
+      }
+    });
   }
 };
 
 // tensor string -> X
+// parsing throws on invalid input, so this stays on the calling thread where the exception becomes an error status
 template <typename DstType>
 struct TensorCaster<std::string, DstType> {
   void Cast(const OpKernelContext&, const TensorShape& shape, const Tensor& in, Tensor& out) const {
@@ -220,22 +271,72 @@ struct TensorCaster<std::string, DstType> {
   }
 };
 
+// tensor X -> float, for the types MLAS converts directly
+template <typename SrcType>
+struct TensorCaster<SrcType, float, std::enable_if_t<HasMlasFloatCast<SrcType>::value>> {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+    const std::ptrdiff_t shape_size = narrow<std::ptrdiff_t>(shape.Size());
+    const auto* in_data = in.Data<SrcType>();
+    auto* out_data = out.MutableData<float>();
+    ParallelCast<SrcType, float>(context, shape_size, 1.0, [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+      CastToFloat(in_data + first, out_data + first, last - first);
+    });
+  }
+};
+
+// tensor float -> X, for the types MLAS converts directly
+template <typename DstType>
+struct TensorCaster<float, DstType, std::enable_if_t<HasMlasFloatCast<DstType>::value>> {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+    const std::ptrdiff_t shape_size = narrow<std::ptrdiff_t>(shape.Size());
+    const auto* in_data = in.Data<float>();
+    auto* out_data = out.MutableData<DstType>();
+    ParallelCast<float, DstType>(context, shape_size, 1.0, [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+      CastFromFloat(in_data + first, out_data + first, last - first);
+    });
+  }
+};
+
+// tensor X -> Y where X or Y is a float16 type and neither is float or string, through a float buffer
+template <typename SrcType, typename DstType>
+struct TensorCaster<SrcType, DstType,
+                    std::enable_if_t<(IsOrtFloat16Type<SrcType>::value || IsOrtFloat16Type<DstType>::value) &&
+                                     !std::is_same_v<SrcType, float> && !std::is_same_v<DstType, float> &&
+                                     !std::is_same_v<SrcType, std::string> && !std::is_same_v<DstType, std::string>>> {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+    const std::ptrdiff_t shape_size = narrow<std::ptrdiff_t>(shape.Size());
+    const auto* in_data = in.Data<SrcType>();
+    auto* out_data = out.MutableData<DstType>();
+    ParallelCast<SrcType, DstType>(context, shape_size, 2.0, [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+      float buffer[kFloat16CastBlockSize];
+      for (std::ptrdiff_t i = first; i < last; i += kFloat16CastBlockSize) {
+        const std::ptrdiff_t count = std::min(kFloat16CastBlockSize, last - i);
+        CastToFloat(in_data + i, buffer, count);
+        CastFromFloat(buffer, out_data + i, count);
+      }
+    });
+  }
+};
+
 #if !defined(DISABLE_FLOAT8_TYPES)
 
 // tensor X -> float 8
 template <typename SrcType, typename DstType, typename Enable = void>
 struct TensorCasterNoSat {
-  void Cast(const OpKernelContext&, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
     const std::ptrdiff_t shape_size = narrow<std::ptrdiff_t>(shape.Size());
     const auto* in_data = in.Data<SrcType>();
     auto* out_data = out.MutableData<DstType>();
-    for (std::ptrdiff_t i = 0; i < shape_size; ++i) {
-      out_data[i] = DstType(static_cast<float>(in_data[i]), false);
-    }
+    ParallelCast<SrcType, DstType>(context, shape_size, 4.0, [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+      for (std::ptrdiff_t i = first; i < last; ++i) {
+        out_data[i] = DstType(static_cast<float>(in_data[i]), false);
+      }
+    });
   }
 };
 
 // tensor string -> float 8
+// parsing throws on invalid input, so this stays on the calling thread like the string -> X cast
 template <typename DstType>
 struct TensorCasterNoSat<std::string, DstType> {
   void Cast(const OpKernelContext&, const TensorShape& shape, const Tensor& in, Tensor& out) const {
@@ -252,55 +353,6 @@ struct TensorCasterNoSat<std::string, DstType> {
 
 #endif
 
-#if defined(_M_AMD64) && !defined(_M_ARM64EC)
-// specializations to use optimized and Windows x64-specific
-// MlasConvertHalfToFloatBuffer() routine for MLFloat16 -> float conversion
-
-// tensor MLFloat16 -> float
-template <>
-struct TensorCaster<MLFloat16, float> {
-  void Cast(const OpKernelContext&, const TensorShape& shape, const Tensor& in, Tensor& out) const {
-    auto out_data = out.MutableData<float>();
-    auto in_data = in.Data<MLFloat16>();
-    const size_t shape_size = narrow<size_t>(shape.Size());
-    MlasConvertHalfToFloatBuffer(&in_data[0].val, out_data, shape_size);
-  }
-};
-
-Tensor GetIntermediateMLFloat16ToFloatTensor(
-    const OpKernelContext& context, const TensorShape& shape, const Tensor& in) {
-  AllocatorPtr allocator;
-  ORT_THROW_IF_ERROR(context.GetTempSpaceAllocator(&allocator));
-  Tensor out{DataTypeImpl::GetType<float>(), shape, allocator};
-  TensorCaster<MLFloat16, float>{}.Cast(context, shape, in, out);
-  return out;
-}
-
-template <typename DstType>
-void CastMLFloat16ThroughFloatTensor(
-    const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) {
-  // use optimized MLFloat16 -> float, then float -> DstType
-  Tensor intermediate_tensor = GetIntermediateMLFloat16ToFloatTensor(context, shape, in);
-  TensorCaster<float, DstType>{}.Cast(context, shape, intermediate_tensor, out);
-}
-
-// tensor MLFloat16 -> X
-template <typename DstType>
-struct TensorCaster<MLFloat16, DstType> {
-  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
-    CastMLFloat16ThroughFloatTensor<DstType>(context, shape, in, out);
-  }
-};
-
-// tensor MLFloat16 -> string
-template <>
-struct TensorCaster<MLFloat16, std::string> {
-  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
-    CastMLFloat16ThroughFloatTensor<std::string>(context, shape, in, out);
-  }
-};
-#endif
-
 class Cast final : public OpKernel {
  public:
   Cast(const OpKernelInfo& info) : OpKernel(info) {
@@ -3,6 +3,9 @@
 
 #include "core/providers/cpu/tensor/concat.h"
 
+#include <algorithm>
+
+#include "core/common/safeint.h"
 #include "core/framework/element_type_lists.h"
 #include "core/framework/TensorSeq.h"
 #include "core/framework/copy.h"
@@ -249,6 +252,44 @@ TensorShapeVector StridesForStack(const TensorShapeVector& full_strides, uint64_
 
 // This method computes the output tensor for Concat/ConcatFromSequence ops
 Status ConcatBase::ComputeImpl(Prepare& p, OpKernelContext* ctx) const {
+  if (!p.is_string_type) {
+    // Every row of the output (the elements from the concat axis inwards) is one contiguous block from each input
+    // in turn, so the whole op is a single parallel copy over the output.
+    const size_t element_size = p.output_tensor->DataType()->Size();
+    const size_t output_row_size = SafeInt<size_t>(p.output_axis_pitch) * element_size;
+
+    // end offset of the block from each input within an output row
+    InlinedVector<size_t, Prepare::kExpectedNumberOfInputs> block_ends;
+    block_ends.reserve(p.inputs.size());
+    size_t block_end = 0;
+    size_t blocks_per_row = 0;
+    for (const auto& input : p.inputs) {
+      block_end += SafeInt<size_t>(input.axis_pitch) * element_size;
+      block_ends.push_back(block_end);
+      blocks_per_row += input.axis_pitch > 0 ? 1 : 0;
+    }
+
+    const size_t output_bytes = SafeInt<size_t>(p.output_num_elements) * element_size;
+    const size_t num_rows = output_row_size == 0 ? 0 : output_bytes / output_row_size;
+
+    auto* output = static_cast<uint8_t*>(p.output_tensor->MutableDataRaw());
+    ParallelCopy(ctx->GetOperatorThreadPool(), output_bytes, SafeInt<size_t>(num_rows) * blocks_per_row,
+                 [&p, &block_ends, output, output_row_size, element_size](size_t offset) {
+                   const size_t row = offset / output_row_size;
+                   const size_t offset_in_row = offset % output_row_size;
+                   // inputs with no data have an empty block that upper_bound skips over
+                   const size_t input_index = static_cast<size_t>(
+                       std::upper_bound(block_ends.begin(), block_ends.end(), offset_in_row) - block_ends.begin());
+                   const auto& input = p.inputs[input_index];
+                   const size_t block_size = static_cast<size_t>(input.axis_pitch) * element_size;
+                   const size_t offset_in_block = offset_in_row - (block_ends[input_index] - block_size);
+                   const auto* input_data = static_cast<const uint8_t*>(input.tensor->DataRaw());
+                   return CopySegment{output + offset, input_data + row * block_size + offset_in_block,
+                                      block_size - offset_in_block};
+                 });
+    return Status::OK();
+  }
+
   int input_count = static_cast<int>(p.inputs.size());
   int64_t initial_output_offset = 0;  // initial offset for each input
 
@@ -9,6 +9,7 @@
 #include "core/providers/op_kernel_type_control.h"
 #include "core/util/math.h"
 
+#include <algorithm>
 #include <functional>
 
 // there's no way to use a raw pointer as the copy destination with std::copy_n
@@ -389,6 +390,62 @@ static void PadAxisConstant(T* output, T constant, size_t size) {
   }
 }
 
+// Constant padding without any negative pads. Each row of the innermost axis of the output is either entirely
+// padding or a row of the input with the innermost pads around it, so the rows can be written independently.
+template <typename T>
+static void PadConstantParallel(concurrency::ThreadPool* thread_pool, T* output, const T* input,
+                                const TensorShapeVector& output_dims, const TensorShapeVector& input_dims,
+                                const PadsVector& pads, T value) {
+  const size_t dims_count = output_dims.size();
+  const size_t inner_axis = dims_count - 1;
+  const size_t output_row_size = onnxruntime::narrow<size_t>(output_dims[inner_axis]);
+  const size_t input_row_size = onnxruntime::narrow<size_t>(input_dims[inner_axis]);
+  const size_t pre_pad = onnxruntime::narrow<size_t>(pads[inner_axis]);
+  const size_t post_pad = onnxruntime::narrow<size_t>(pads[inner_axis + dims_count]);
+
+  // number of input rows to move one step along each outer axis
+  TensorShapeVector input_row_pitches(inner_axis, 1);
+  size_t num_rows = 1;
+  for (size_t axis = inner_axis; axis-- > 0;) {
+    if (axis + 1 < inner_axis) {
+      input_row_pitches[axis] = input_row_pitches[axis + 1] * input_dims[axis + 1];
+    }
+    num_rows *= onnxruntime::narrow<size_t>(output_dims[axis]);
+  }
+
+  concurrency::ThreadPool::TryParallelFor(
+      thread_pool, static_cast<std::ptrdiff_t>(num_rows),
+      {static_cast<double>(input_row_size * sizeof(T)), static_cast<double>(output_row_size * sizeof(T)),
+       static_cast<double>(inner_axis)},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t row = first; row < last; ++row) {
+          T* output_row = output + row * output_row_size;
+
+          // find the input row, if any, by walking the outer axes from the innermost one
+          int64_t input_row = 0;
+          bool is_pad_row = false;
+          int64_t remaining = row;
+          for (size_t axis = inner_axis; axis-- > 0;) {
+            const int64_t input_index = remaining % output_dims[axis] - pads[axis];
+            remaining /= output_dims[axis];
+            if (input_index < 0 || input_index >= input_dims[axis]) {
+              is_pad_row = true;
+              break;
+            }
+            input_row += input_index * input_row_pitches[axis];
+          }
+
+          if (is_pad_row) {
+            std::fill_n(output_row, output_row_size, value);
+          } else {
+            std::fill_n(output_row, pre_pad, value);
+            std::copy_n(input + input_row * input_row_size, input_row_size, output_row + pre_pad);
+            std::fill_n(output_row + pre_pad + input_row_size, post_pad, value);
+          }
+        }
+      });
+}
+
 template <typename T>
 static Status PadImpl(OpKernelContext* ctx,
                       const PadsVector& pads,
@@ -454,6 +511,13 @@ static Status PadImpl(OpKernelContext* ctx,
   auto& output_tensor = *ctx->Output(0, output_shape);
   auto* output = reinterpret_cast<T*>(output_tensor.MutableDataRaw());
 
+  if (mode == Mode::Constant &&
+      std::all_of(reshaped_slice.begin(), reshaped_slice.end(), [](int64_t slice) { return slice == 0; })) {
+    PadConstantParallel(ctx->GetOperatorThreadPool(), output, reinterpret_cast<const T*>(input_tensor.DataRaw()),
+                        reshaped_output_dims, reshaped_input_dims, reshaped_pad, value);
+    return Status::OK();
+  }
+
   TensorPitches output_pitches(reshaped_output_dims);
   size_t alignSkip = 0;  // Amount to skip to align to where the next input tensor data needs to be written
 
@@ -7,6 +7,7 @@
 
 #include "core/common/common.h"
 #include "core/common/narrow.h"
+#include "core/framework/copy.h"
 #include "core/framework/element_type_lists.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/op_kernel_type_control_utils.h"
@@ -266,7 +267,7 @@ template <class Tdata, typename FuncT>
 Status ScatterData(
     const FuncT& func,
     const Tensor* data_input, const std::vector<int64_t>& indices_data, const Tensor* updates_input, int64_t axis,
-    Tensor* data_output) {
+    Tensor* data_output, concurrency::ThreadPool* thread_pool = nullptr) {
   const TensorShape& input_data_shape = data_input->Shape();
 
   const auto input_elements = input_data_shape.Size();
@@ -286,7 +287,11 @@ Status ScatterData(
       auto* dst = data_output->MutableData<std::string>();
       std::copy(str_begin, str_end, dst);
     } else {
-      memcpy(static_cast<void*>(dst_base), static_cast<const void*>(src_base), total_input_bytes);
+      ParallelCopy(thread_pool, total_input_bytes, 1,
+                   [dst = reinterpret_cast<uint8_t*>(dst_base), src = reinterpret_cast<const uint8_t*>(src_base),
+                    total_input_bytes](size_t offset) {
+                     return CopySegment{dst + offset, src + offset, total_input_bytes - offset};
+                   });
     }
   }
 
@@ -296,7 +301,7 @@ Status ScatterData(
   const auto num_dims = input_data_shape.NumDimensions();
   ORT_RETURN_IF_NOT(num_dims > 0, "ScatterElements op: input tensor must have at least one dimension");
 
-  // Allocate and zero out counts. The input/output is of the same rank as
+  // dim_counters (allocated for each range of slices below) holds the counts. The input/output is of the same rank as
   // indices/updates but the actual dimensions of indices/updates must be less or equal
   // than that of input/output because we can update no more elements than
   // the input contains. As we walk through the indices/updates
@@ -306,7 +311,6 @@ Status ScatterData(
   // different cardinality according to the upd_shape dimensions.
   // As each counter reaches its max (upd_shape) it resets to zero
   // and we carry to the more significant dim (right to left)
-  std::vector<int64_t> dim_counters(num_dims);
 
   // This vector contains number of elements under the dimension.
   // For example, for the dimensions of [4, 2, 3] the vector
@@ -336,63 +340,89 @@ Status ScatterData(
   }
 
   const auto* update_data = static_cast<const Tdata*>(updates_input->DataRaw());
+
+  // Updates that differ in the first dimension write to different output elements unless that is the axis
+  // being scattered on, so slices along the first dimension can be processed in parallel. The updates within
+  // a slice are applied in order so duplicate indices behave the same as when run sequentially.
+  const int64_t num_slices = upd_shape[0];
+  const int64_t slice_size = num_slices == 0 ? 0 : num_indices / num_slices;
+
   // For every update we compute the destination offset and copy it there
-  for (int64_t index = 0; index < num_indices;) {
-    const auto axis_idx = indices_data[narrow<size_t>(index)];
-
-    // Compute the offset
-    // See comments above for dim_block_size
-    size_t dst_offset = 0;
-    for (size_t i = 0; i < num_dims; ++i) {
-      if (i == size_t(axis)) {
-        // replace the counter with the update index for this dim
-        dst_offset += narrow<size_t>(axis_idx * dim_block_size[narrow<size_t>(i)]);
-      } else {
-        dst_offset += narrow<size_t>(dim_counters[narrow<size_t>(i)] * dim_block_size[narrow<size_t>(i)]);
+  auto scatter_slices = [&](std::ptrdiff_t first_slice, std::ptrdiff_t last_slice) {
+    std::vector<int64_t> dim_counters(num_dims);
+    dim_counters[0] = first_slice;
+
+    const int64_t end = last_slice * slice_size;
+    for (int64_t index = first_slice * slice_size; index < end;) {
+      const auto axis_idx = indices_data[narrow<size_t>(index)];
+
+      // Compute the offset
+      // See comments above for dim_block_size
+      size_t dst_offset = 0;
+      for (size_t i = 0; i < num_dims; ++i) {
+        if (i == size_t(axis)) {
+          // replace the counter with the update index for this dim
+          dst_offset += narrow<size_t>(axis_idx * dim_block_size[narrow<size_t>(i)]);
+        } else {
+          dst_offset += narrow<size_t>(dim_counters[narrow<size_t>(i)] * dim_block_size[narrow<size_t>(i)]);
+        }
       }
-    }
 
-    func(dst_base + dst_offset, update_data + index);
+      func(dst_base + dst_offset, update_data + index);
 
-    if (++index == num_indices) {
-      break;
-    }
-    // Increment counters
-    // See comments for dim_counters above
-    for (auto i = int64_t(num_dims - 1); i >= 0; --i) {
-      auto v = ++dim_counters[narrow<size_t>(i)];
-      assert(v <= upd_shape[narrow<size_t>(i)]);
-      if (v < upd_shape[narrow<size_t>(i)]) {
-        // No carry, done
+      if (++index == end) {
         break;
       }
-      // No carry for the most significant dim
-      assert(i > 0);
-      dim_counters[narrow<size_t>(i)] = 0;
+      // Increment counters
+      // See comments for dim_counters above
+      for (auto i = int64_t(num_dims - 1); i >= 0; --i) {
+        auto v = ++dim_counters[narrow<size_t>(i)];
+        assert(v <= upd_shape[narrow<size_t>(i)]);
+        if (v < upd_shape[narrow<size_t>(i)]) {
+          // No carry, done
+          break;
+        }
+        // No carry for the most significant dim
+        assert(i > 0);
+        dim_counters[narrow<size_t>(i)] = 0;
+      }
     }
+  };
+
+  if (axis == 0) {
+    scatter_slices(0, narrow<std::ptrdiff_t>(num_slices));
+  } else if (num_slices > 0) {
+    // process the first slice on this thread so an unsupported reduction throws here and not on a worker thread
+    scatter_slices(0, 1);
+    concurrency::ThreadPool::TryParallelFor(
+        thread_pool, narrow<std::ptrdiff_t>(num_slices - 1),
+        {static_cast<double>(slice_size * sizeof(Tdata)), static_cast<double>(slice_size * sizeof(Tdata)),
+         static_cast<double>(slice_size * num_dims)},
+        [&scatter_slices](std::ptrdiff_t first, std::ptrdiff_t last) { scatter_slices(first + 1, last + 1); });
   }
+
   return Status::OK();
 }
 
 template <typename TData>
 struct ScatterDataDispatchTarget {
   Status operator()(const Tensor* data_input, const std::vector<int64_t>& indices_data, const Tensor* updates_input, int64_t axis,
-                    const std::string& reduction, Tensor* data_output) const {
+                    const std::string& reduction, Tensor* data_output, concurrency::ThreadPool* thread_pool) const {
     if (reduction == "add")
       return ScatterData<TData>(
-          Func_Add<TData>(), data_input, indices_data, updates_input, axis, data_output);
+          Func_Add<TData>(), data_input, indices_data, updates_input, axis, data_output, thread_pool);
     else if (reduction == "mul")
       return ScatterData<TData>(
-          Func_Mul<TData>(), data_input, indices_data, updates_input, axis, data_output);
+          Func_Mul<TData>(), data_input, indices_data, updates_input, axis, data_output, thread_pool);
     else if (reduction == "min")
       return ScatterData<TData>(
-          Func_Min<TData>(), data_input, indices_data, updates_input, axis, data_output);
+          Func_Min<TData>(), data_input, indices_data, updates_input, axis, data_output, thread_pool);
     else if (reduction == "max")
       return ScatterData<TData>(
-          Func_Max<TData>(), data_input, indices_data, updates_input, axis, data_output);
+          Func_Max<TData>(), data_input, indices_data, updates_input, axis, data_output, thread_pool);
     else  // if (reduction == "none")
       return ScatterData<TData>(
-          Func_Assignment<TData>(), data_input, indices_data, updates_input, axis, data_output);
+          Func_Assignment<TData>(), data_input, indices_data, updates_input, axis, data_output, thread_pool);
   }
 };
 
@@ -462,7 +492,7 @@ Status Scatter<EnabledDataTypes>::Compute(OpKernelContext* context) const {
 
   utils::MLTypeCallDispatcherFromTypeList<EnabledDataTypes> dispatcher{data_type};
   status = dispatcher.template InvokeRet<Status, ScatterDataDispatchTarget>(
-      data_input, indices_data, updates_input, axis, this->reduction_, data_output);
+      data_input, indices_data, updates_input, axis, this->reduction_, data_output, context->GetOperatorThreadPool());
 
   return status;
 }
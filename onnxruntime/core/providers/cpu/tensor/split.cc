@@ -3,6 +3,8 @@
 
 #include "core/providers/cpu/tensor/split.h"
 
+#include <algorithm>
+
 #include "core/common/narrow.h"
 #include "core/common/gsl.h"
 #include "core/common/safeint.h"
@@ -146,11 +148,51 @@ Status SplitImpl::Compute(OpKernelContext* context) const {
                                         after_dims_excluding_split,
                                         split_sizes));
 
-  const auto input_strides = StridesForTensor(input);
-
   // copy dimensions so we can update the selected axis in place
   auto output_dimensions = input_shape.AsShapeVector();
 
+  if (!input.IsDataTypeString()) {
+    // Every row of the input (the elements from the split axis inwards) is one contiguous block for each output
+    // in turn, so the whole op is a single parallel copy over the input.
+    const size_t element_size = input.DataType()->Size();
+    const size_t input_row_size = SafeInt<size_t>(after_dims_including_split_axis) * element_size;
+
+    InlinedVector<uint8_t*> outputs;
+    InlinedVector<size_t> block_ends;  // end offset of the block for each output within an input row
+    outputs.reserve(num_outputs);
+    block_ends.reserve(num_outputs);
+    size_t block_end = 0;
+    size_t blocks_per_row = 0;
+    for (int i = 0; i < num_outputs; ++i) {
+      output_dimensions[narrow<size_t>(axis)] = split_sizes[i];
+      Tensor* output = context->Output(i, TensorShape{output_dimensions});
+      outputs.push_back(static_cast<uint8_t*>(output->MutableDataRaw()));
+      block_end += SafeInt<size_t>(split_sizes[i]) * after_dims_excluding_split * element_size;
+      block_ends.push_back(block_end);
+      blocks_per_row += split_sizes[i] > 0 ? 1 : 0;
+    }
+
+    const size_t num_rows = input_row_size == 0 ? 0 : input.SizeInBytes() / input_row_size;
+
+    const auto* input_data = static_cast<const uint8_t*>(input.DataRaw());
+    ParallelCopy(context->GetOperatorThreadPool(), input.SizeInBytes(), SafeInt<size_t>(num_rows) * blocks_per_row,
+                 [&outputs, &block_ends, input_data, input_row_size](size_t offset) {
+                   const size_t row = offset / input_row_size;
+                   const size_t offset_in_row = offset % input_row_size;
+                   // outputs with no data have an empty block that upper_bound skips over
+                   const size_t output_index = static_cast<size_t>(
+                       std::upper_bound(block_ends.begin(), block_ends.end(), offset_in_row) - block_ends.begin());
+                   const size_t block_start = output_index == 0 ? 0 : block_ends[output_index - 1];
+                   const size_t block_size = block_ends[output_index] - block_start;
+                   const size_t offset_in_block = offset_in_row - block_start;
+                   return CopySegment{outputs[output_index] + row * block_size + offset_in_block,
+                                      input_data + offset, block_size - offset_in_block};
+                 });
+    return Status::OK();
+  }
+
+  const auto input_strides = StridesForTensor(input);
+
   SafeInt<ptrdiff_t> input_offset = 0;
 
   for (int i = 0; i < num_outputs; ++i) {
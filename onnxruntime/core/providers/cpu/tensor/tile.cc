@@ -10,6 +10,7 @@
 #endif
 
 #include "core/providers/cpu/tensor/tile.h"
+#include "core/framework/copy.h"
 #include "core/providers/cpu/tensor/utils.h"
 
 #ifdef _MSC_VER
@@ -214,7 +215,12 @@ Status Tile::Compute(OpKernelContext* ctx) const {
     if (input_tensor.IsDataType<std::string>())
       std::copy(input_tensor.Data<std::string>(), input_tensor.Data<std::string>() + input_shape.Size(), output_tensor.MutableData<std::string>());
     else
-      memcpy(output_tensor.MutableDataRaw(), input_tensor.DataRaw(), input_tensor.SizeInBytes());
+      ParallelCopy(ctx->GetOperatorThreadPool(), input_tensor.SizeInBytes(), 1,
+                   [output = static_cast<uint8_t*>(output_tensor.MutableDataRaw()),
+                    input = static_cast<const uint8_t*>(input_tensor.DataRaw()),
+                    size = input_tensor.SizeInBytes()](size_t offset) {
+                     return CopySegment{output + offset, input + offset, size - offset};
+                   });
     return Status::OK();
   }
 
@@ -230,42 +236,32 @@ Status Tile::Compute(OpKernelContext* ctx) const {
                            num_of_copies_per_batch,
                            num_of_batch_copies) &&
       !input_tensor.IsDataType<std::string>()) {
-    int8_t* output_data_casted = reinterpret_cast<int8_t*>(output_tensor.MutableDataRaw());
-    const int8_t* input_data_casted = reinterpret_cast<const int8_t*>(input_tensor.DataRaw());
-    const void* input_data_raw = input_tensor.DataRaw();
+    auto* output = static_cast<uint8_t*>(output_tensor.MutableDataRaw());
+    const auto* input = static_cast<const uint8_t*>(input_tensor.DataRaw());
 
     if (!is_batched_memcpy) {
-      size_t copy_bytes = input_tensor.SizeInBytes();
-      // TODO: Add multi-threading logic if num_of_copies_per_batch is large enough
-      for (size_t i = 0; i < num_of_copies_per_batch; ++i) {
-        memcpy(static_cast<void*>(output_data_casted), input_data_raw, copy_bytes);
-        output_data_casted += copy_bytes;
-      }
+      // the output is the whole input repeated num_of_copies_per_batch times
+      const size_t copy_bytes = input_tensor.SizeInBytes();
+      ParallelCopy(ctx->GetOperatorThreadPool(), output_tensor.SizeInBytes(), num_of_copies_per_batch,
+                   [output, input, copy_bytes](size_t offset) {
+                     const size_t offset_in_copy = offset % copy_bytes;
+                     return CopySegment{output + offset, input + offset_in_copy, copy_bytes - offset_in_copy};
+                   });
     } else {
-      size_t copy_bytes = num_of_elements_per_batch * input_tensor.DataType()->Size();
-      size_t batch_count = static_cast<size_t>(input_tensor.Shape()[0]);  // The tensor is atleast 1-D- this is safe
-
-      // TODO: Multi-thread if needed
-      for (size_t batch = 0; batch < batch_count; ++batch) {
-        for (size_t i = 0; i < num_of_copies_per_batch; ++i) {
-          memcpy(static_cast<void*>(output_data_casted), static_cast<const void*>(input_data_casted), copy_bytes);
-          output_data_casted += copy_bytes;
-        }
-        input_data_casted += copy_bytes;
-      }
-
-      // Now account for batch dim repeat
-      if (num_of_batch_copies > 1) {
-        // reset some values
-        output_data_casted = reinterpret_cast<int8_t*>(output_tensor.MutableDataRaw());
-        copy_bytes *= num_of_copies_per_batch * batch_count;
-        int8_t* copy_ptr = output_data_casted + copy_bytes;
-
-        for (size_t i = 1; i < num_of_batch_copies; ++i) {
-          memcpy(static_cast<void*>(copy_ptr), static_cast<const void*>(output_data_casted), copy_bytes);
-          copy_ptr += copy_bytes;
-        }
-      }
+      // the output is num_of_batch_copies repeats of: each batch of the input repeated num_of_copies_per_batch times
+      const size_t copy_bytes = num_of_elements_per_batch * input_tensor.DataType()->Size();
+      const size_t batch_bytes = copy_bytes * num_of_copies_per_batch;
+      const size_t batch_count = static_cast<size_t>(input_tensor.Shape()[0]);  // The tensor is atleast 1-D- this is safe
+      const size_t batches_bytes = batch_bytes * batch_count;
+      const size_t num_copies = num_of_copies_per_batch * batch_count * num_of_batch_copies;
+      ParallelCopy(ctx->GetOperatorThreadPool(), output_tensor.SizeInBytes(), num_copies,
+                   [output, input, copy_bytes, batch_bytes, batches_bytes](size_t offset) {
+                     const size_t offset_in_batches = offset % batches_bytes;
+                     const size_t batch = offset_in_batches / batch_bytes;
+                     const size_t offset_in_copy = offset_in_batches % copy_bytes;
+                     return CopySegment{output + offset, input + batch * copy_bytes + offset_in_copy,
+                                        copy_bytes - offset_in_copy};
+                   });
     }
 
     return Status::OK();
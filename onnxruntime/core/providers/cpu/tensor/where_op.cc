@@ -245,10 +245,73 @@ static void UntypedMerge(OpKernelContext& context,
 
   BroadcastLooper(broadcast_helper, functors);
 }
+
+// Handles the common case where condition, X and Y either all have the output shape or are a single value,
+// selecting directly into the output in one parallel pass.
+// Returns false if broadcasting is required, in which case nothing has been written.
+template <typename T>
+bool SelectWithoutBroadcast(OpKernelContext& context) {
+  const Tensor& condition = *context.Input<Tensor>(0);
+  const Tensor& X = *context.Input<Tensor>(1);
+  const Tensor& Y = *context.Input<Tensor>(2);
+
+  const TensorShape* output_shape = nullptr;
+  size_t max_single_value_rank = 0;
+  for (const Tensor* input : {&condition, &X, &Y}) {
+    const auto& shape = input->Shape();
+    if (shape.Size() == 1) {
+      max_single_value_rank = std::max(max_single_value_rank, shape.NumDimensions());
+    } else if (output_shape == nullptr) {
+      output_shape = &shape;
+    } else if (*output_shape != shape) {
+      return false;
+    }
+  }
+
+  // a single value with a higher rank would add leading 1s to the output shape
+  if (output_shape == nullptr || max_single_value_rank > output_shape->NumDimensions()) {
+    return false;
+  }
+
+  Tensor& output = *context.Output(0, *output_shape);
+  const std::ptrdiff_t num_elements = onnxruntime::narrow<std::ptrdiff_t>(output_shape->Size());
+
+  const bool* condition_data = condition.Data<bool>();
+  const T* X_data = X.Data<T>();
+  const T* Y_data = Y.Data<T>();
+  T* output_data = output.MutableData<T>();
+
+  // step of 0 repeats a single value
+  const std::ptrdiff_t condition_step = condition.Shape().Size() == 1 ? 0 : 1;
+  const std::ptrdiff_t X_step = X.Shape().Size() == 1 ? 0 : 1;
+  const std::ptrdiff_t Y_step = Y.Shape().Size() == 1 ? 0 : 1;
+
+  concurrency::ThreadPool::TryParallelFor(
+      context.GetOperatorThreadPool(), num_elements,
+      {static_cast<double>(sizeof(bool) + sizeof(T)), static_cast<double>(sizeof(T)), 1.0},
+      [=](std::ptrdiff_t first, std::ptrdiff_t last) {
+        if (condition_step == 1 && X_step == 1 && Y_step == 1) {
+          // simple loop the compiler can vectorize
+          for (std::ptrdiff_t i = first; i < last; ++i) {
+            output_data[i] = condition_data[i] ? X_data[i] : Y_data[i];
+          }
+        } else {
+          for (std::ptrdiff_t i = first; i < last; ++i) {
+            output_data[i] = condition_data[i * condition_step] ? X_data[i * X_step] : Y_data[i * Y_step];
+          }
+        }
+      });
+
+  return true;
+}
 }  // namespace
 
 template <typename T>
 Status Where<T>::Compute(OpKernelContext* context) const {
+  if (SelectWithoutBroadcast<T>(*context)) {
+    return Status::OK();
+  }
+
   // we use a func pointer to save the overhead of std::function, so we can't capture tensor_allocator here
   const auto typed_tensor_allocation = [](const TensorAllocator& allocator,
                                           const TensorShape& shape) {
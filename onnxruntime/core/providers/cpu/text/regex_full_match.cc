@@ -3,6 +3,7 @@
 
 #include "regex_full_match.h"
 #include "core/common/common.h"
+#include "core/platform/threadpool.h"
 
 namespace onnxruntime {
 ONNX_CPU_OPERATOR_KERNEL(
@@ -22,13 +23,26 @@ Status RegexFullMatch::Compute(OpKernelContext* context) const {
   const auto input_data = input_tensor->template DataAsSpan<std::string>();
   auto* output_tensor = context->Output(0, input_tensor->Shape());
   auto output_data = output_tensor->template MutableDataAsSpan<bool>();
-  auto output_iter = output_data.begin();
-  auto input_iter = input_data.begin();
-  while (input_iter != input_data.end()) {
-    *output_iter = RE2::FullMatch(*input_iter, re_);
-    input_iter++;
-    output_iter++;
+  if (input_data.empty()) {
+    return Status::OK();
   }
+
+  // The program is compiled once in the constructor and RE2 matching is thread safe,
+  // so the strings are matched in parallel.
+  size_t total_length = 0;
+  for (const auto& s : input_data) {
+    total_length += s.size();
+  }
+  const double average_length = static_cast<double>(total_length) / static_cast<double>(input_data.size()) + 1.0;
+
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), static_cast<std::ptrdiff_t>(input_data.size()),
+      TensorOpCost{average_length, 1.0, average_length * 8.0},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t i = first; i < last; ++i) {
+          output_data[i] = RE2::FullMatch(input_data[i], re_);
+        }
+      });
   return Status::OK();
 }
 
@@ -4,6 +4,7 @@
 #include "string_normalizer.h"
 #include "core/common/common.h"
 #include "core/framework/tensor.h"
+#include "core/platform/threadpool.h"
 // Used below HAS_DEPRECATED_DECLARATIONS
 #include "onnxruntime_config.h"
 
@@ -11,7 +12,9 @@
 #include <locale.h>
 #endif  // _MSC_VER
 
+#include <algorithm>
 #include <codecvt>
+#include <cstring>
 #include <locale>
 #include <functional>
 
@@ -435,6 +438,97 @@ const std::string default_locale("en_US.UTF-8");  // All non-MS and not Apple
 #endif
 
 #endif  // _MSC_VER
+
+// Checks 8 bytes at a time whether a string is plain ASCII.
+inline bool IsAscii(std::string_view str) {
+  constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+  const char* data = str.data();
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= str.size(); i += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, data + i, sizeof(word));
+    if (word & kHighBits) {
+      return false;
+    }
+  }
+  for (; i < str.size(); ++i) {
+    if (static_cast<unsigned char>(data[i]) & 0x80) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Changes the case of the letters of an ASCII string 8 bytes at a time. As all bytes are below 0x80, adding
+// (0x80 - bound) to every byte cannot carry into the next one and sets the high bit of the bytes >= bound.
+inline void ChangeAsciiCase(StringNormalizer::CaseAction caseaction, std::string_view src, std::string& dest) {
+  assert(caseaction != StringNormalizer::NONE);
+  constexpr uint64_t kOnes = 0x0101010101010101ULL;
+  constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+  const char first = caseaction == StringNormalizer::LOWER ? 'A' : 'a';
+  const char last = caseaction == StringNormalizer::LOWER ? 'Z' : 'z';
+  const uint64_t add_first = (0x80 - static_cast<uint64_t>(first)) * kOnes;
+  const uint64_t add_after_last = (0x80 - static_cast<uint64_t>(last) - 1) * kOnes;
+
+  dest.resize(src.size());
+  char* out = dest.data();
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= src.size(); i += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, src.data() + i, sizeof(word));
+    const uint64_t letters = (word + add_first) & ~(word + add_after_last) & kHighBits;
+    // 0x80 >> 2 is the 0x20 bit that distinguishes upper and lower case ASCII letters
+    word ^= letters >> 2;
+    memcpy(out + i, &word, sizeof(word));
+  }
+  for (; i < src.size(); ++i) {
+    const char ch = src[i];
+    out[i] = (ch >= first && ch <= last) ? static_cast<char>(ch ^ 0x20) : ch;
+  }
+}
+
+// Returns true if the locale changes the case of all ASCII characters exactly like the C locale.
+bool HasAsciiCaseMapping(const Locale& locale) {
+  std::wstring ascii;
+  for (wchar_t ch = 0; ch < 0x80; ++ch) {
+    ascii.push_back(ch);
+  }
+  for (auto caseaction : {StringNormalizer::LOWER, StringNormalizer::UPPER}) {
+    std::wstring changed = ascii;
+    locale.ChangeCase(caseaction, changed);
+    for (wchar_t ch = 0; ch < 0x80; ++ch) {
+      wchar_t expected = ch;
+      if (caseaction == StringNormalizer::LOWER && ch >= L'A' && ch <= L'Z') {
+        expected = static_cast<wchar_t>(ch + (L'a' - L'A'));
+      } else if (caseaction == StringNormalizer::UPPER && ch >= L'a' && ch <= L'z') {
+        expected = static_cast<wchar_t>(ch - (L'a' - L'A'));
+      }
+      if (changed[ch] != expected) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Runs fn(first, last) over blocks of strings in parallel and returns the first failure.
+template <typename Fn>
+Status ParallelForStrings(concurrency::ThreadPool* tp, size_t count, Fn&& fn) {
+  constexpr std::ptrdiff_t kMinStringsPerBlock = 64;
+  const auto total = narrow<std::ptrdiff_t>(count);
+  const std::ptrdiff_t num_blocks = std::clamp<std::ptrdiff_t>(total / kMinStringsPerBlock, 1,
+                                                               concurrency::ThreadPool::DegreeOfParallelism(tp));
+  std::vector<Status> statuses(num_blocks);
+  concurrency::ThreadPool::TrySimpleParallelFor(tp, num_blocks, [&](std::ptrdiff_t block) {
+    const auto work = concurrency::ThreadPool::PartitionWork(block, num_blocks, total);
+    statuses[block] = fn(static_cast<size_t>(work.start), static_cast<size_t>(work.end));
+  });
+  for (auto& status : statuses) {
+    ORT_RETURN_IF_ERROR(status);
+  }
+  return Status::OK();
+}
+
 }  // namespace string_normalizer
 
 using namespace string_normalizer;
@@ -459,6 +553,10 @@ StringNormalizer::StringNormalizer(const OpKernelInfo& info) : OpKernel(info) {
   }
 
   locale_name_ = info.GetAttrOrDefault("locale", default_locale);
+  if (case_change_action_ != NONE || !is_case_sensitive_) {
+    locale_ = std::make_unique<Locale>(locale_name_);
+    ascii_case_mapping_ = HasAsciiCaseMapping(*locale_);
+  }
 
   std::vector<std::string> stop_words = info.GetAttrsOrDefault<std::string>("stopwords");
   if (is_case_sensitive_) {
@@ -467,17 +565,18 @@ StringNormalizer::StringNormalizer(const OpKernelInfo& info) : OpKernel(info) {
       stopwords_.insert(std::move(s));
     }
   } else {
-    Locale locale(locale_name_);
     Utf8Converter converter;
     wstopwords_.reserve(stop_words.size());
     for (std::string& s : stop_words) {
       std::wstring wstr = converter.from_bytes(s);
-      locale.ChangeCase(compare_caseaction_, wstr);
+      locale_->ChangeCase(compare_caseaction_, wstr);
       wstopwords_.insert(std::move(wstr));
     }
   }
 }
 
+StringNormalizer::~StringNormalizer() = default;
+
 Status StringNormalizer::Compute(OpKernelContext* ctx) const {
   using namespace string_normalizer;
 
@@ -521,116 +620,107 @@ Status StringNormalizer::Compute(OpKernelContext* ctx) const {
   // and compare with the original strings. Otherwise, we need to convert the string
   // to widechar, lowercase it and then compare. Case-insensitive comparison is complicated
   // for UTF-8 and requires additional dependency.
+  // ASCII strings are case changed byte wise when the locale allows it, and the strings are
+  // processed in parallel blocks, each with its own converter and reusable buffers.
 
-  Locale locale(locale_name_);
-  Utf8Converter converter;
+  concurrency::ThreadPool* tp = ctx->GetOperatorThreadPool();
 
-  // Compute the largest widestring buffer needed.
-  size_t max_wide_buffer_len = 0;
-  for (const auto& s : input_span) {
+  // Converts s to wide chars in wstr, which also checks for invalid UTF-8 characters.
+  auto to_wide_char = [](Utf8Converter& converter, const std::string& s, std::wstring& wstr) {
     size_t wchars = 0;
-    // Checks for invalid UTF-8 characters on Windows
     ORT_RETURN_IF_ERROR(converter.ComputeRequiredSizeToWideChar(s, wchars));
-    max_wide_buffer_len = std::max(max_wide_buffer_len, wchars);
-  }
-
-  // Reuse reserved space
-  std::wstring wchar_buffer;
-  wchar_buffer.reserve(max_wide_buffer_len);
-
-  // Output everything and change case as required
-  auto output_no_filtering = [&](const TensorShape& output_shape) {
-    auto output_tensor = ctx->Output(0, output_shape);
-    auto const output_data = output_tensor->MutableData<std::string>();
-    for (size_t i = 0, lim = input_span.size(); i < lim; ++i) {
-      const std::string& s = input_span[i];
-      wchar_buffer.resize(max_wide_buffer_len);
-      ORT_RETURN_IF_ERROR(converter.ConvertToWideChar(s, wchar_buffer));
-      locale.ChangeCase(case_change_action_, wchar_buffer);
+    wstr.resize(wchars);
+    return converter.ConvertToWideChar(s, wstr);
+  };
 
-      auto& dest = output_data[i];
-      size_t utf8_buffer_len = converter.ComputeRequiredSizeToUtf8(wchar_buffer);
-      dest.resize(utf8_buffer_len);
-      ORT_RETURN_IF_ERROR(converter.ConvertToUtf8(wchar_buffer, dest));
+  auto change_case = [&](Utf8Converter& converter, const std::string& s, std::wstring& wchar_buffer,
+                         std::string& dest) {
+    if (ascii_case_mapping_ && IsAscii(s)) {
+      ChangeAsciiCase(case_change_action_, s, dest);
+      return Status::OK();
     }
-    return Status::OK();
+    ORT_RETURN_IF_ERROR(to_wide_char(converter, s, wchar_buffer));
+    locale_->ChangeCase(case_change_action_, wchar_buffer);
+    size_t utf8_buffer_len = converter.ComputeRequiredSizeToUtf8(wchar_buffer);
+    dest.resize(utf8_buffer_len);
+    return converter.ConvertToUtf8(wchar_buffer, dest);
   };
 
-  auto output_filtered = [&](const TensorShape& output_shape, gsl::span<const size_t> filtered_indices) {
+  // Output the input strings at the selected positions, or all of them, and change case as required
+  auto output_strings = [&](const TensorShape& output_shape, const size_t* selected_indices) {
     auto output_tensor = ctx->Output(0, output_shape);
     auto output_data = output_tensor->MutableData<std::string>();
-    for (size_t i : filtered_indices) {
-      const std::string& s = input_span[i];
-      if (case_change_action_ != NONE) {
-        wchar_buffer.resize(max_wide_buffer_len);
-        ORT_RETURN_IF_ERROR(converter.ConvertToWideChar(s, wchar_buffer));
-        locale.ChangeCase(case_change_action_, wchar_buffer);
-
-        auto& dest = *output_data++;
-        size_t utf8_buffer_len = converter.ComputeRequiredSizeToUtf8(wchar_buffer);
-        dest.resize(utf8_buffer_len);
-        ORT_RETURN_IF_ERROR(converter.ConvertToUtf8(wchar_buffer, dest));
-      } else {
-        *output_data++ = s;
+    const size_t count = selected_indices ? narrow<size_t>(output_shape.Size()) : input_span.size();
+    return ParallelForStrings(tp, count, [&](size_t first, size_t last) {
+      Utf8Converter converter;
+      std::wstring wchar_buffer;
+      for (size_t i = first; i < last; ++i) {
+        const std::string& s = input_span[selected_indices ? selected_indices[i] : i];
+        if (case_change_action_ != NONE) {
+          ORT_RETURN_IF_ERROR(change_case(converter, s, wchar_buffer, output_data[i]));
+        } else {
+          output_data[i] = s;
+        }
       }
-    }
-    return Status::OK();
+      return Status::OK();
+    });
   };
 
-  Status status;
+  if ((is_case_sensitive_ && stopwords_.empty()) || (!is_case_sensitive_ && wstopwords_.empty())) {
+    assert(case_change_action_ != NONE);
+    output_shape.push_back(C);
+    return output_strings(output_shape, nullptr);
+  }
 
-  if (is_case_sensitive_) {
-    if (stopwords_.empty()) {
-      assert(case_change_action_ != NONE);
-      output_shape.push_back(C);
-      status = output_no_filtering(output_shape);
-    } else {
-      // we need to filter
-      InlinedVector<size_t> filtered_strings_indices;
-      filtered_strings_indices.reserve(input_span.size());
-
-      for (size_t i = 0, lim = input_span.size(); i < lim; ++i) {
-        const std::string& s = input_span[i];
-        if (stopwords_.count(s) == 0) {
-          filtered_strings_indices.push_back(i);
+  // Mark the strings that are not stop words. This also validates the UTF-8 of every input string.
+  std::vector<uint8_t> keep(input_span.size(), 1);
+  ORT_RETURN_IF_ERROR(ParallelForStrings(tp, input_span.size(), [&](size_t first, size_t last) {
+    Utf8Converter converter;
+    std::wstring wchar_buffer;
+    std::string ascii_buffer;
+    for (size_t i = first; i < last; ++i) {
+      const std::string& s = input_span[i];
+      const bool is_ascii = IsAscii(s);
+      if (is_case_sensitive_) {
+        if (!is_ascii) {
+          size_t wchars = 0;
+          // Checks for invalid UTF-8 characters on Windows
+          ORT_RETURN_IF_ERROR(converter.ComputeRequiredSizeToWideChar(s, wchars));
         }
-      }
-
-      // According to the spec, if all strings are filtered out
-      // the output must have a shape of {1} with a single empty string.
-      const int64_t filtered_count = std::max<int64_t>(1, narrow<int64_t>(filtered_strings_indices.size()));
-      output_shape.push_back(filtered_count);
-      status = output_filtered(output_shape, filtered_strings_indices);
-    }
-  } else {
-    if (wstopwords_.empty()) {
-      assert(case_change_action_ != NONE);
-      output_shape.push_back(C);
-      status = output_no_filtering(output_shape);
-    } else {
-      // Case insensitive filtering is performed by converting the input strings
-      // to compare_caseaction_. For that we convert to wchar_t UNICODE.
-      // Otherwise, we need to pull ICU library on all platforms.
-      InlinedVector<size_t> filtered_strings_indices;
-      filtered_strings_indices.reserve(input_span.size());
-      for (size_t i = 0, lim = input_span.size(); i < lim; ++i) {
-        const std::string& s = input_span[i];
-        wchar_buffer.resize(max_wide_buffer_len);
-        ORT_RETURN_IF_ERROR(converter.ConvertToWideChar(s, wchar_buffer));
-        locale.ChangeCase(compare_caseaction_, wchar_buffer);
-        if (wstopwords_.count(wchar_buffer) == 0) {
-          filtered_strings_indices.push_back(i);
+        keep[i] = stopwords_.count(s) == 0;
+      } else {
+        // Case insensitive filtering is performed by converting the input strings
+        // to compare_caseaction_. For that we convert to wchar_t UNICODE.
+        // Otherwise, we need to pull ICU library on all platforms.
+        if (is_ascii && ascii_case_mapping_) {
+          ChangeAsciiCase(compare_caseaction_, s, ascii_buffer);
+          wchar_buffer.assign(ascii_buffer.begin(), ascii_buffer.end());
+        } else {
+          ORT_RETURN_IF_ERROR(to_wide_char(converter, s, wchar_buffer));
+          locale_->ChangeCase(compare_caseaction_, wchar_buffer);
         }
+        keep[i] = wstopwords_.count(wchar_buffer) == 0;
       }
+    }
+    return Status::OK();
+  }));
 
-      // According to the spec, if all strings are filtered out
-      // the output must have a shape of {1} with a single empty string.
-      const int64_t filtered_count = std::max<int64_t>(1, narrow<int64_t>(filtered_strings_indices.size()));
-      output_shape.push_back(filtered_count);
-      status = output_filtered(output_shape, filtered_strings_indices);
+  InlinedVector<size_t> filtered_strings_indices;
+  filtered_strings_indices.reserve(input_span.size());
+  for (size_t i = 0, lim = input_span.size(); i < lim; ++i) {
+    if (keep[i]) {
+      filtered_strings_indices.push_back(i);
     }
   }
 
-  return status;
+  // According to the spec, if all strings are filtered out
+  // the output must have a shape of {1} with a single empty string.
+  if (filtered_strings_indices.empty()) {
+    output_shape.push_back(1);
+    ctx->Output(0, output_shape);
+    return Status::OK();
+  }
+  output_shape.push_back(narrow<int64_t>(filtered_strings_indices.size()));
+  return output_strings(output_shape, filtered_strings_indices.data());
 }
 }  // namespace onnxruntime
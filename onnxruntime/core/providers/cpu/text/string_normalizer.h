@@ -7,10 +7,15 @@
 #include "core/framework/op_kernel.h"
 
 #include <locale>
+#include <memory>
 #include <string>
 
 namespace onnxruntime {
 
+namespace string_normalizer {
+class Locale;
+}  // namespace string_normalizer
+
 class StringNormalizer : public OpKernel {
  public:
   enum CaseAction {
@@ -20,7 +25,7 @@ class StringNormalizer : public OpKernel {
   };
 
   explicit StringNormalizer(const OpKernelInfo& info);
-  ~StringNormalizer() override = default;
+  ~StringNormalizer() override;
 
   Status Compute(OpKernelContext* ctx) const override;
 
@@ -31,6 +36,10 @@ class StringNormalizer : public OpKernel {
   // used for case-insensitive compare
   CaseAction compare_caseaction_{LOWER};
   std::string locale_name_;
+  // Created once when the case is changed or compared, it is only read by Compute.
+  std::unique_ptr<string_normalizer::Locale> locale_;
+  // Whether the locale maps ASCII letters like the C locale so ASCII strings can skip the wide char conversion
+  bool ascii_case_mapping_{false};
   // Either if these are populated but not both
   InlinedHashSet<std::string> stopwords_;
   InlinedHashSet<std::wstring> wstopwords_;
@@ -6,6 +6,7 @@
 #include <limits>
 #include <string>
 #include "core/common/common.h"
+#include "core/platform/threadpool.h"
 namespace onnxruntime {
 
 ONNX_CPU_OPERATOR_KERNEL(StringSplit, 20,
@@ -24,7 +25,7 @@ void ComputeSubstrings(std::string_view str, std::string_view delimiter, int64_t
   }
   if (delimiter.empty()) {
     // Count consecutive whitespace as one delimiter. Preceding and trailing whitespace is meant to be ignored.
-    size_t pos = str.find_first_not_of(" ");
+    size_t pos = str.find_first_not_of(' ');
     int64_t token_count = 0;
     while (pos != std::string::npos) {
       if (token_count++ == max_splits) {
@@ -36,9 +37,9 @@ void ComputeSubstrings(std::string_view str, std::string_view delimiter, int64_t
         out.push_back(str.substr(pos, next_pos - pos + 1));
         break;
       } else {
-        auto next_pos = str.find_first_of(" ", pos);
+        auto next_pos = str.find(' ', pos);
         out.push_back(str.substr(pos, next_pos - pos));
-        pos = str.find_first_not_of(" ", next_pos);
+        pos = str.find_first_not_of(' ', next_pos);
       }
     }
   } else {
@@ -64,22 +65,33 @@ StringSplit::StringSplit(const OpKernelInfo& info) : OpKernel(info) {
 Status StringSplit::Compute(OpKernelContext* context) const {
   const Tensor* input = context->Input<Tensor>(0);
   auto input_data = input->template DataAsSpan<std::string>();
+  const auto num_strings = static_cast<std::ptrdiff_t>(input_data.size());
 
   // Set up number of tokens output
   auto num_tokens_data = context->Output(1, input->Shape())->template MutableDataAsSpan<int64_t>();
-  auto num_tokens_iter = num_tokens_data.begin();
 
-  InlinedVector<InlinedVector<std::string_view>> input_slices;
-  input_slices.reserve(input_data.size());
-  size_t last_dim = 0;
+  // The substrings of each block of strings are kept as views in one contiguous buffer per block, addressed by the
+  // offset of the first substring of each string and its token count, instead of one small vector per string.
+  concurrency::ThreadPool* tp = context->GetOperatorThreadPool();
+  constexpr std::ptrdiff_t kMinStringsPerBlock = 256;
+  const std::ptrdiff_t num_blocks = std::clamp<std::ptrdiff_t>(num_strings / kMinStringsPerBlock, 1,
+                                                               concurrency::ThreadPool::DegreeOfParallelism(tp));
+  std::vector<InlinedVector<std::string_view>> block_slices(num_blocks);
+  std::vector<size_t> first_slice(input_data.size());
+
+  concurrency::ThreadPool::TrySimpleParallelFor(tp, num_blocks, [&](std::ptrdiff_t block) {
+    const auto work = concurrency::ThreadPool::PartitionWork(block, num_blocks, num_strings);
+    auto& slices = block_slices[block];
+    for (std::ptrdiff_t i = work.start; i < work.end; ++i) {
+      first_slice[i] = slices.size();
+      ComputeSubstrings(input_data[i], delimiter_, maxsplit_, slices);
+      num_tokens_data[i] = static_cast<int64_t>(slices.size() - first_slice[i]);
+    }
+  });
 
-  for (const auto& s : input_data) {
-    auto& substrs = input_slices.emplace_back();
-    ComputeSubstrings(s, delimiter_, maxsplit_, substrs);
-    auto substr_count = substrs.size();
-    last_dim = std::max(last_dim, substr_count);
-    *num_tokens_iter = static_cast<int64_t>(substr_count);
-    ++num_tokens_iter;
+  size_t last_dim = 0;
+  for (int64_t num_tokens : num_tokens_data) {
+    last_dim = std::max(last_dim, static_cast<size_t>(num_tokens));
   }
 
   // Set up splits output
@@ -87,11 +99,19 @@ Status StringSplit::Compute(OpKernelContext* context) const {
   splits_shape.push_back(last_dim);
 
   auto splits_data = context->Output(0, splits_shape)->template MutableDataAsSpan<std::string>();
-  auto slices_iter = input_slices.begin();
-  for (auto output_splits_iter = splits_data.begin(); output_splits_iter != splits_data.end(); output_splits_iter += last_dim, ++slices_iter) {
-    std::copy(slices_iter->begin(), slices_iter->end(), output_splits_iter);
+  if (last_dim == 0) {
+    return Status::OK();
   }
 
+  concurrency::ThreadPool::TrySimpleParallelFor(tp, num_blocks, [&](std::ptrdiff_t block) {
+    const auto work = concurrency::ThreadPool::PartitionWork(block, num_blocks, num_strings);
+    const auto& slices = block_slices[block];
+    for (std::ptrdiff_t i = work.start; i < work.end; ++i) {
+      auto slices_begin = slices.begin() + first_slice[i];
+      std::copy(slices_begin, slices_begin + num_tokens_data[i], splits_data.begin() + i * last_dim);
+    }
+  });
+
   return Status::OK();
 }
 
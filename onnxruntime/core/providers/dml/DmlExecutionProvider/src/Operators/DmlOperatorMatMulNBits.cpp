@@ -195,6 +195,12 @@ void CALLBACK QueryMatMulNBits(IMLOperatorSupportQueryContextPrivate* context, /
         return;
     }
 
+    // The optional lora_a (6) and lora_b (7) inputs are not supported, so nodes with an adapter stay on the CPU
+    if (context->IsInputValid(6) || context->IsInputValid(7))
+    {
+        return;
+    }
+
     *isSupported = true;
 }
 
@@ -4,6 +4,7 @@
 #include "core/session/environment.h"
 #include "core/session/allocator_adapters.h"
 #include "core/framework/allocator_utils.h"
+#include "core/framework/prepacked_weights_container.h"
 #include "core/graph/constants.h"
 #include "core/graph/op.h"
 
@@ -55,6 +56,12 @@ std::once_flag schemaRegistrationOnceFlag;
 ProviderInfo_CUDA& GetProviderInfo_CUDA();
 #endif  // USE_CUDA
 
+Environment::Environment()
+    : shared_weights_container_(std::make_unique<PrepackedWeightsContainer>(/*release_unused_weights*/ true)) {
+}
+
+Environment::~Environment() = default;
+
 Status Environment::Create(std::unique_ptr<logging::LoggingManager> logging_manager,
                            std::unique_ptr<Environment>& environment,
                            const OrtThreadingOptions* tp_options,
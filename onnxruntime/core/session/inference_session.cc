@@ -437,6 +437,13 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
   use_per_session_threads_ = session_options.use_per_session_threads;
   force_spinning_stop_between_runs_ = session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigForceSpinningStop, "0") == "1";
 
+#if !defined(ORT_MINIMAL_BUILD)
+  shape_specialization_min_runs_ = ParseStringWithClassicLocale<int64_t>(
+      session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigShapeSpecializationMinRuns, "0"));
+  shape_specialization_max_sessions_ = ParseStringWithClassicLocale<size_t>(
+      session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigShapeSpecializationMaxSessions, "4"));
+#endif
+
   if (use_per_session_threads_) {
     LOGS(*session_logger_, INFO) << "Creating and using per session threadpools since use_per_session_threads_ is true";
     {
@@ -654,6 +661,11 @@ InferenceSession::InferenceSession(const SessionOptions& session_options, const
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
 InferenceSession::~InferenceSession() {
+#if !defined(ORT_MINIMAL_BUILD)
+  // the builder threads use this session
+  WaitForShapeSpecializedSessions();
+#endif
+
   if (session_options_.enable_profiling) {
     ORT_TRY {
       EndProfiling();
@@ -1008,6 +1020,10 @@ common::Status InferenceSession::Load(const void* model_data, int model_data_len
       return Status(common::ONNXRUNTIME, common::INVALID_PROTOBUF,
                     "Failed to load model because protobuf parsing failed.");
     }
+
+    if (shape_specialization_min_runs_ > 0) {
+      shape_specialization_model_bytes_.assign(static_cast<const char*>(model_data), model_data_len);
+    }
 #ifdef ENABLE_LANGUAGE_INTEROP_OPS
     LoadInterOp(model_proto, interop_domains_, [&](const char* msg) { LOGS(*session_logger_, WARNING) << msg; });
     InlinedVector<OrtCustomOpDomain*> domain_ptrs;
@@ -1048,6 +1064,7 @@ common::Status InferenceSession::LoadOnnxModel(ModelProto model_proto) {
 #endif
     const bool strict_shape_type_inference = session_options_.config_options.GetConfigOrDefault(
                                                  kOrtSessionOptionsConfigStrictShapeTypeInference, "0") == "1";
+    SaveModelForShapeSpecialization(model_proto);
     // This call will move model_proto to the constructed model instance
     return onnxruntime::Model::Load(std::move(model_proto), PathString(), model,
                                     HasLocalSchema() ? &custom_schema_registries_ : nullptr, *session_logger_,
@@ -1085,6 +1102,7 @@ common::Status InferenceSession::Load(std::istream& model_istream, bool allow_re
                                                  kOrtSessionOptionsConfigStrictShapeTypeInference, "0") == "1";
     ModelOptions model_opts(allow_released_opsets_only,
                             strict_shape_type_inference);
+    SaveModelForShapeSpecialization(model_proto);
     return onnxruntime::Model::Load(std::move(model_proto), PathString(), model,
                                     HasLocalSchema() ? &custom_schema_registries_ : nullptr,
                                     *session_logger_, model_opts);
@@ -1113,6 +1131,7 @@ common::Status InferenceSession::Load() {
     const bool allow_released_opsets_only = session_options_.config_options.GetConfigOrDefault(
                                                 kOrtSessionOptionsConfigStrictAllowReleasedOpsetsOnly, "1") == "1";
 
+    SaveModelForShapeSpecialization(this->model_proto_);
     // Pass on ownership of the parsed ModelProto to the Model instance (its job here is done by this stage)
     return Model::Load(std::move(this->model_proto_), model_location_, model,
                        HasLocalSchema() ? &custom_schema_registries_ : nullptr, *session_logger_,
@@ -1523,6 +1542,63 @@ common::Status InferenceSession::AddPrePackedWeightsContainer(PrepackedWeightsCo
   return Status::OK();
 }
 
+common::Status InferenceSession::AddLoraAdapter(const std::string& adapter_name,
+                                                std::unordered_map<std::string, OrtValue> parameters) {
+  if (adapter_name.empty()) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "LoRA adapter name cannot be empty");
+  }
+
+  for (const auto& [name, value] : parameters) {
+    if (!value.IsAllocated() || !value.IsTensor()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "LoRA adapter '", adapter_name, "' parameter '", name,
+                             "' must be a tensor");
+    }
+  }
+
+  std::lock_guard<onnxruntime::OrtMutex> l(lora_adapters_->mutex);
+  if (!lora_adapters_->adapters.emplace(adapter_name, std::move(parameters)).second) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "A LoRA adapter named '", adapter_name,
+                           "' has already been added to the session");
+  }
+
+  return Status::OK();
+}
+
+common::Status InferenceSession::AppendLoraAdapterFeeds(const RunOptions& run_options,
+                                                        gsl::span<const std::string>& feed_names,
+                                                        gsl::span<const OrtValue>& feeds,
+                                                        InlinedVector<std::string>& adapter_feed_names,
+                                                        InlinedVector<OrtValue>& adapter_feeds) const {
+  const std::string& adapter_name =
+      run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigActiveLoraAdapter, "");
+  if (adapter_name.empty()) {
+    return Status::OK();
+  }
+
+  std::lock_guard<onnxruntime::OrtMutex> l(lora_adapters_->mutex);
+  auto adapter = lora_adapters_->adapters.find(adapter_name);
+  if (adapter == lora_adapters_->adapters.end()) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "LoRA adapter '", adapter_name,
+                           "' has not been added to the session");
+  }
+
+  const auto& parameters = adapter->second;
+  adapter_feed_names.reserve(feed_names.size() + parameters.size());
+  adapter_feeds.reserve(feeds.size() + parameters.size());
+  adapter_feed_names.assign(feed_names.begin(), feed_names.end());
+  adapter_feeds.assign(feeds.begin(), feeds.end());
+  for (const auto& [name, value] : parameters) {
+    if (std::find(feed_names.begin(), feed_names.end(), name) == feed_names.end()) {
+      adapter_feed_names.push_back(name);
+      adapter_feeds.push_back(value);
+    }
+  }
+
+  feed_names = adapter_feed_names;
+  feeds = adapter_feeds;
+  return Status::OK();
+}
+
 namespace {
 Status PartitionOrtFormatModel(onnxruntime::Graph& graph,
                                const ExecutionProviders& providers,
@@ -1668,6 +1744,14 @@ common::Status InferenceSession::Initialize() {
     session_activity_started_ = true;
 #endif
 
+    const bool share_initializers_across_sessions =
+        session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsShareInitializersAcrossSessions,
+                                                           "0") == "1";
+    if (share_initializers_across_sessions && prepacked_weights_container_ == nullptr) {
+      LOGS(*session_logger_, INFO) << "This session will share initializers with other sessions in the environment.";
+      prepacked_weights_container_ = &environment_.GetSharedWeightsContainer();
+    }
+
     // now that we have all the execution providers, create the session state
     session_state_ = std::make_unique<SessionState>(
         model_->MainGraph(),
@@ -1722,6 +1806,21 @@ common::Status InferenceSession::Initialize() {
       return false;
     }();
 
+#if !defined(ORT_MINIMAL_BUILD)
+    if (shape_specialization_min_runs_ > 0) {
+      // the specialized sessions are built from the ONNX model as loaded, and can only use the CPU EP
+      const bool has_model_to_specialize = !model_location_.empty() || !shape_specialization_model_bytes_.empty();
+      if (loading_ort_format || saving_model || execution_providers_.NumProviders() != 1 ||
+          !has_model_to_specialize) {
+        LOGS(*session_logger_, WARNING) << "Shape specialization requires an ONNX format model in a session that "
+                                           "only uses the CPU execution provider and does not save the optimized "
+                                           "model. It has been disabled.";
+        shape_specialization_min_runs_ = 0;
+        std::string().swap(shape_specialization_model_bytes_);
+      }
+    }
+#endif
+
     if (!loading_ort_format) {
 #if !defined(ORT_MINIMAL_BUILD)
       const auto minimal_build_opt_config_value = session_options_.config_options.GetConfigOrDefault(
@@ -1966,6 +2065,17 @@ common::Status InferenceSession::Initialize() {
                                              !saving_model,
                                              saving_ort_format));
 
+    if (share_initializers_across_sessions) {
+      const auto stats = prepacked_weights_container_->GetMemoryStats();
+      LOGS(*session_logger_, INFO) << "[Memory] Shared weights: " << stats.num_initializers << " initializers using "
+                                   << stats.initializers_size_in_bytes << " bytes, "
+                                   << stats.num_prepacked_weights << " pre-packed weights using "
+                                   << stats.prepacked_weights_size_in_bytes << " bytes. "
+                                   << stats.num_reused_initializers << " initializers using "
+                                   << stats.reused_initializers_size_in_bytes
+                                   << " bytes were shared instead of being copied.";
+    }
+
 #if !defined(ORT_MINIMAL_BUILD)
     if (saving_model) {
       if (session_state_->GetFuncMgr().NumFuncs() > 0) {
@@ -2017,6 +2127,9 @@ common::Status InferenceSession::Initialize() {
     ResolveMemoryPatternFlags(*session_state_);
 
     is_inited_ = true;
+#if !defined(ORT_MINIMAL_BUILD)
+    shape_specialization_enabled_ = shape_specialization_min_runs_ > 0 && shape_specialization_max_sessions_ > 0;
+#endif
 
     if (!using_ort_model_bytes_for_initializers_) {
       ort_format_model_bytes_ = gsl::span<const uint8_t>();
@@ -2405,6 +2518,20 @@ Status InferenceSession::Run(const RunOptions& run_options,
                              gsl::span<const std::string> feed_names, gsl::span<const OrtValue> feeds,
                              gsl::span<const std::string> output_names, std::vector<OrtValue>* p_fetches,
                              const std::vector<OrtDevice>* p_fetches_device_info) {
+#if !defined(ORT_MINIMAL_BUILD)
+  // The specialized session applies any LoRA adapter itself as it shares this session's adapters.
+  if (shape_specialization_enabled_) {
+    InferenceSession* specialized_session = GetShapeSpecializedSession(feed_names, feeds);
+    if (specialized_session != nullptr) {
+      return specialized_session->Run(run_options, feed_names, feeds, output_names, p_fetches, p_fetches_device_info);
+    }
+  }
+#endif
+
+  InlinedVector<std::string> adapter_feed_names;
+  InlinedVector<OrtValue> adapter_feeds;
+  ORT_RETURN_IF_ERROR(AppendLoraAdapterFeeds(run_options, feed_names, feeds, adapter_feed_names, adapter_feeds));
+
   TimePoint tp;
   if (session_profiler_.IsEnabled()) {
     tp = session_profiler_.Start();
@@ -2613,6 +2740,185 @@ Status InferenceSession::Run(const RunOptions& run_options,
   return retval;
 }
 
+#if !defined(ORT_MINIMAL_BUILD)
+// Upper bound on the number of distinct input shape sets tracked for shape specialization so that models
+// with highly variable input shapes don't grow the tracking map without limit.
+static constexpr size_t kMaxTrackedShapeSpecializations = 256;
+
+// Creates the key of the input shapes of the given feeds. Returns false if a feed isn't a tensor.
+static bool GetShapeSpecializationKey(gsl::span<const std::string> feed_names, gsl::span<const OrtValue> feeds,
+                                      std::string& key) {
+  for (size_t i = 0, end = feeds.size(); i < end; ++i) {
+    if (!feeds[i].IsTensor()) {
+      return false;
+    }
+
+    key.append(feed_names[i]).append(feeds[i].Get<Tensor>().Shape().ToString()).push_back(';');
+  }
+
+  return true;
+}
+
+void InferenceSession::SaveModelForShapeSpecialization(const ONNX_NAMESPACE::ModelProto& model_proto) {
+  if (shape_specialization_min_runs_ > 0 && model_location_.empty()) {
+    model_proto.SerializeToString(&shape_specialization_model_bytes_);
+  }
+}
+
+InferenceSession* InferenceSession::GetShapeSpecializedSession(gsl::span<const std::string> feed_names,
+                                                               gsl::span<const OrtValue> feeds) {
+  std::string key;
+  if (!GetShapeSpecializationKey(feed_names, feeds, key)) {
+    return nullptr;
+  }
+
+  std::lock_guard<onnxruntime::OrtMutex> l(shape_specialization_mutex_);
+  auto it = shape_specializations_.find(key);
+  if (it == shape_specializations_.end()) {
+    if (shape_specializations_.size() >= kMaxTrackedShapeSpecializations) {
+      return nullptr;
+    }
+
+    it = shape_specializations_.emplace(key, std::make_unique<ShapeSpecialization>()).first;
+  }
+
+  ShapeSpecialization& specialization = *it->second;
+  if (specialization.state == ShapeSpecialization::State::Ready) {
+    ++specialization.num_specialized_runs;
+    return specialization.session.get();
+  }
+
+  // runs with these shapes use the generic plan while the specialized session is being built
+  if (specialization.state != ShapeSpecialization::State::Counting ||
+      ++specialization.num_runs < shape_specialization_min_runs_) {
+    return nullptr;
+  }
+
+  if (num_shape_specialized_sessions_ >= shape_specialization_max_sessions_) {
+    specialization.state = ShapeSpecialization::State::Rejected;
+    return nullptr;
+  }
+
+  std::vector<std::pair<std::string, TensorShape>> input_shapes;
+  input_shapes.reserve(feeds.size());
+  for (size_t i = 0, end = feeds.size(); i < end; ++i) {
+    input_shapes.emplace_back(feed_names[i], feeds[i].Get<Tensor>().Shape());
+  }
+
+  // build the specialized session on a separate thread so that this run isn't delayed by it
+  shape_specialization_builders_.emplace_back(&InferenceSession::BuildShapeSpecializedSession, this, key,
+                                              std::move(input_shapes));
+  specialization.state = ShapeSpecialization::State::Building;
+  ++num_shape_specialized_sessions_;
+  return nullptr;
+}
+
+void InferenceSession::BuildShapeSpecializedSession(
+    const std::string& key, const std::vector<std::pair<std::string, TensorShape>>& input_shapes) {
+  LOGS(*session_logger_, INFO) << "Building shape-specialized session for input shapes: " << key;
+
+  std::unique_ptr<InferenceSession> specialized_session;
+  Status status;
+  ORT_TRY {
+    status = CreateShapeSpecializedSession(input_shapes, specialized_session);
+  }
+  ORT_CATCH(const std::exception& ex) {
+    ORT_HANDLE_EXCEPTION([&]() {
+      status = ORT_MAKE_STATUS(ONNXRUNTIME, RUNTIME_EXCEPTION, ex.what());
+    });
+  }
+
+  std::lock_guard<onnxruntime::OrtMutex> l(shape_specialization_mutex_);
+  ShapeSpecialization& specialization = *shape_specializations_.at(key);
+  if (!status.IsOK()) {
+    LOGS(*session_logger_, WARNING) << "Failed to build shape-specialized session for input shapes: " << key
+                                    << ". The generic plan will be used. Error: " << status.ErrorMessage();
+    specialization.state = ShapeSpecialization::State::Rejected;
+    --num_shape_specialized_sessions_;
+    return;
+  }
+
+  specialization.session = std::move(specialized_session);
+  specialization.state = ShapeSpecialization::State::Ready;
+}
+
+Status InferenceSession::CreateShapeSpecializedSession(
+    const std::vector<std::pair<std::string, TensorShape>>& input_shapes,
+    std::unique_ptr<InferenceSession>& specialized_session) const {
+  ONNX_NAMESPACE::ModelProto model_proto;
+  if (!shape_specialization_model_bytes_.empty()) {
+    ORT_RETURN_IF_NOT(model_proto.ParseFromString(shape_specialization_model_bytes_),
+                      "Failed to parse the model for shape specialization.");
+  } else {
+    ORT_RETURN_IF_ERROR(Model::Load(model_location_, model_proto));
+  }
+
+  auto& graph_inputs = *model_proto.mutable_graph()->mutable_input();
+  for (const auto& [input_name, input_shape] : input_shapes) {
+    auto input = std::find_if(graph_inputs.begin(), graph_inputs.end(),
+                              [&input_name](const ONNX_NAMESPACE::ValueInfoProto& value_info) {
+                                return value_info.name() == input_name;
+                              });
+    if (input == graph_inputs.end() || !input->type().has_tensor_type()) {
+      continue;
+    }
+
+    auto* shape_proto = input->mutable_type()->mutable_tensor_type()->mutable_shape();
+    shape_proto->clear_dim();
+    for (const auto dim : input_shape.GetDims()) {
+      shape_proto->add_dim()->set_dim_value(dim);
+    }
+  }
+
+  SessionOptions specialized_session_options = session_options_;
+  specialized_session_options.config_options.configurations[kOrtSessionOptionsConfigShapeSpecializationMinRuns] = "0";
+  specialized_session_options.enable_profiling = false;
+
+  // share the thread pools of this session
+  auto session = std::make_unique<InferenceSession>(specialized_session_options, environment_,
+                                                    GetIntraOpThreadPoolToUse(), GetInterOpThreadPoolToUse());
+  // external data is resolved relative to the model location
+  session->model_location_ = model_location_;
+  session->lora_adapters_ = lora_adapters_;
+  ORT_RETURN_IF_ERROR(session->LoadOnnxModel(std::move(model_proto)));
+  ORT_RETURN_IF_ERROR(session->Initialize());
+
+  specialized_session = std::move(session);
+  return Status::OK();
+}
+
+void InferenceSession::WaitForShapeSpecializedSessions() {
+  std::vector<std::thread> builders;
+  {
+    std::lock_guard<onnxruntime::OrtMutex> l(shape_specialization_mutex_);
+    builders.swap(shape_specialization_builders_);
+  }
+
+  for (auto& builder : builders) {
+    builder.join();
+  }
+}
+
+const InferenceSession* InferenceSession::FindShapeSpecializedSession(gsl::span<const std::string> feed_names,
+                                                                      gsl::span<const OrtValue> feeds,
+                                                                      size_t& num_runs) const {
+  num_runs = 0;
+  std::string key;
+  if (!GetShapeSpecializationKey(feed_names, feeds, key)) {
+    return nullptr;
+  }
+
+  std::lock_guard<onnxruntime::OrtMutex> l(shape_specialization_mutex_);
+  auto it = shape_specializations_.find(key);
+  if (it == shape_specializations_.end() || it->second->state != ShapeSpecialization::State::Ready) {
+    return nullptr;
+  }
+
+  num_runs = it->second->num_specialized_runs;
+  return it->second->session.get();
+}
+#endif  // !defined(ORT_MINIMAL_BUILD)
+
 Status InferenceSession::Run(const RunOptions& run_options,
                              gsl::span<const char* const> feed_names,
                              gsl::span<const OrtValue* const> feeds,
@@ -3118,7 +3424,7 @@ common::Status InferenceSession::AddPredefinedTransformers(
 
         if (use_full_build_optimizations) {
           return optimizer_utils::GenerateTransformers(level, session_options_, cpu_ep,
-                                                       optimizers_to_disable_);
+                                                       optimizers_to_disable_, GetIntraOpThreadPoolToUse());
         } else {
           const auto sat_context =
               minimal_build_optimization_handling ==
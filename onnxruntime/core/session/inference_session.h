@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <optional>
 #include <string>
+#include <thread>
 #include <unordered_map>
 
 #include "core/common/common.h"
@@ -529,6 +531,16 @@ class InferenceSession {
    */
   Status AddPrePackedWeightsContainer(PrepackedWeightsContainer* prepacked_weights_container);
 
+  /**
+   * Register the parameters of a LoRA adapter with the session.
+   * The adapter is applied to a Run by setting kOrtRunOptionsConfigActiveLoraAdapter to its name, which feeds each
+   * parameter to the graph input of the same name. Inputs not covered by the adapter keep their defaults.
+   * @param adapter_name Name used to select the adapter. Must be unique within the session.
+   * @param parameters Map of graph input name to value.
+   */
+  [[nodiscard]] common::Status AddLoraAdapter(const std::string& adapter_name,
+                                              std::unordered_map<std::string, OrtValue> parameters);
+
  protected:
 #if !defined(ORT_MINIMAL_BUILD)
 
@@ -555,6 +567,16 @@ class InferenceSession {
 
   bool IsInitialized() const;
 
+#if !defined(ORT_MINIMAL_BUILD)
+  // Waits for the shape-specialized sessions that are being built.
+  void WaitForShapeSpecializedSessions();
+
+  // Returns the shape-specialized session built for the shapes of the given feeds, or nullptr if there is none.
+  // num_runs is set to the number of Run() calls that were dispatched to it.
+  const InferenceSession* FindShapeSpecializedSession(gsl::span<const std::string> feed_names,
+                                                      gsl::span<const OrtValue> feeds, size_t& num_runs) const;
+#endif
+
   // Use these 2 threadpool methods to get access to the threadpools since they rely on
   // specific flags in session options
   // These methods assume that session options have been finalized before the call.
@@ -696,6 +718,28 @@ class InferenceSession {
 
   common::Status TransformGraph(onnxruntime::Graph& graph, bool saving_model_in_ort_format);
 
+  /*
+   * Returns the shape-specialized session to use for the given feeds, or nullptr if the generic plan of this
+   * session should be used. Counts the run towards the specialization threshold and starts building the
+   * specialized session on a separate thread once the threshold is reached.
+   * See kOrtSessionOptionsConfigShapeSpecializationMinRuns.
+   */
+  InferenceSession* GetShapeSpecializedSession(gsl::span<const std::string> feed_names,
+                                               gsl::span<const OrtValue> feeds);
+
+  // Builds the specialized session for the input shapes identified by key and makes it available to Run().
+  // Runs on one of shape_specialization_builders_.
+  void BuildShapeSpecializedSession(const std::string& key,
+                                    const std::vector<std::pair<std::string, TensorShape>>& input_shapes);
+
+  // Create a session from the model as loaded with the graph input dims fixed to the given shapes.
+  [[nodiscard]] common::Status CreateShapeSpecializedSession(
+      const std::vector<std::pair<std::string, TensorShape>>& input_shapes,
+      std::unique_ptr<InferenceSession>& specialized_session) const;
+
+  // Keeps the serialized model for building shape-specialized sessions if it wasn't loaded from model_location_.
+  void SaveModelForShapeSpecialization(const ONNX_NAMESPACE::ModelProto& model_proto);
+
   onnxruntime::GraphTransformerManager graph_transformer_mgr_;
 
   InlinedHashSet<gsl::not_null<const ONNX_NAMESPACE::OpSchema*>> saved_runtime_optimization_produced_node_op_schemas_;
@@ -890,6 +934,58 @@ class InferenceSession {
   };
 
   CachedExecutionProviderForGraphReplay cached_execution_provider_for_graph_replay_;
+
+#if !defined(ORT_MINIMAL_BUILD)
+  // Shape specialization. Enabled when shape_specialization_min_runs_ > 0.
+  struct ShapeSpecialization {
+    enum class State {
+      Counting,  // counting runs towards the threshold
+      Building,  // a builder thread is building the specialized session
+      Ready,     // session is valid
+      Rejected,  // building failed or the session limit was hit. the generic plan is used.
+    };
+
+    State state = State::Counting;
+    int64_t num_runs = 0;             // runs counted towards the threshold
+    size_t num_specialized_runs = 0;  // runs dispatched to session
+    std::unique_ptr<InferenceSession> session;
+  };
+
+  int64_t shape_specialization_min_runs_ = 0;
+  size_t shape_specialization_max_sessions_ = 0;
+  size_t num_shape_specialized_sessions_ = 0;  // GUARDED_BY(shape_specialization_mutex_)
+
+  // Set once Initialize() succeeds if the session can be specialized, so that Run() doesn't look at the input
+  // shapes otherwise.
+  std::atomic<bool> shape_specialization_enabled_{false};
+
+  // The serialized model as loaded, used to build the specialized sessions of a model that wasn't loaded from a
+  // file. Models loaded from a file are read again from model_location_.
+  std::string shape_specialization_model_bytes_;
+
+  // Keyed by the feed names and concrete input shapes.
+  InlinedHashMap<std::string, std::unique_ptr<ShapeSpecialization>> shape_specializations_;  // GUARDED_BY(shape_specialization_mutex_)
+  std::vector<std::thread> shape_specialization_builders_;  // GUARDED_BY(shape_specialization_mutex_)
+  mutable onnxruntime::OrtMutex shape_specialization_mutex_;
+#endif
+
+  // If run_options select a LoRA adapter, points feed_names/feeds at adapter_feed_names/adapter_feeds, which are
+  // filled with the caller's feeds followed by the adapter parameters. Parameters that are explicitly fed by the
+  // caller are not overridden. Without an active adapter feed_names/feeds are left untouched.
+  [[nodiscard]] common::Status AppendLoraAdapterFeeds(const RunOptions& run_options,
+                                                      gsl::span<const std::string>& feed_names,
+                                                      gsl::span<const OrtValue>& feeds,
+                                                      InlinedVector<std::string>& adapter_feed_names,
+                                                      InlinedVector<OrtValue>& adapter_feeds) const;
+
+  // LoRA adapters registered with AddLoraAdapter, keyed by name.
+  // Shared with the shape specialized sessions so they can apply the same adapters.
+  struct LoraAdapters {
+    InlinedHashMap<std::string, std::unordered_map<std::string, OrtValue>> adapters;  // GUARDED_BY(mutex)
+    onnxruntime::OrtMutex mutex;
+  };
+
+  std::shared_ptr<LoraAdapters> lora_adapters_ = std::make_shared<LoraAdapters>();
 };
 
 struct SessionIOBinding {
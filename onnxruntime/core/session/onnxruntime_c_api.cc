@@ -1363,6 +1363,31 @@ ORT_API_STATUS_IMPL(OrtApis::SessionEndProfiling, _In_ OrtSession* sess, _Inout_
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::SessionAddLoraAdapter, _Inout_ OrtSession* sess, _In_ const char* adapter_name,
+                    _In_reads_(num_parameters) const char* const* parameter_names,
+                    _In_reads_(num_parameters) const OrtValue* const* parameter_values,
+                    _In_ size_t num_parameters) {
+  API_IMPL_BEGIN
+  if (adapter_name == nullptr || (num_parameters > 0 && (parameter_names == nullptr || parameter_values == nullptr))) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "adapter_name, parameter_names and parameter_values must be provided");
+  }
+
+  std::unordered_map<std::string, OrtValue> parameters;
+  parameters.reserve(num_parameters);
+  for (size_t i = 0; i < num_parameters; ++i) {
+    if (parameter_names[i] == nullptr || parameter_values[i] == nullptr) {
+      return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "LoRA adapter parameter names and values cannot be null");
+    }
+
+    parameters.emplace(parameter_names[i], *parameter_values[i]);
+  }
+
+  auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
+  ORT_API_RETURN_IF_STATUS_NOT_OK(session->AddLoraAdapter(adapter_name, std::move(parameters)));
+  return nullptr;
+  API_IMPL_END
+}
+
 ORT_API_STATUS_IMPL(OrtApis::SessionGetModelMetadata, _In_ const OrtSession* sess,
                     _Outptr_ OrtModelMetadata** out) {
   API_IMPL_BEGIN
@@ -2259,6 +2284,19 @@ ORT_API(void, OrtApis::ReleasePrepackedWeightsContainer, _Frees_ptr_opt_ OrtPrep
   delete reinterpret_cast<PrepackedWeightsContainer*>(ptr);
 }
 
+ORT_API_STATUS_IMPL(OrtApis::PrepackedWeightsContainer_GetMemoryStats,
+                    _Inout_ OrtPrepackedWeightsContainer* prepacked_weights_container,
+                    _Out_ size_t* num_initializers, _Out_ size_t* initializers_size_in_bytes,
+                    _Out_ size_t* deduplicated_size_in_bytes) {
+  API_IMPL_BEGIN
+  const auto stats = reinterpret_cast<PrepackedWeightsContainer*>(prepacked_weights_container)->GetMemoryStats();
+  *num_initializers = stats.num_initializers;
+  *initializers_size_in_bytes = stats.initializers_size_in_bytes;
+  *deduplicated_size_in_bytes = stats.reused_initializers_size_in_bytes;
+  return nullptr;
+  API_IMPL_END
+}
+
 ORT_API_STATUS_IMPL(OrtApis::CreateSessionWithPrepackedWeightsContainer, _In_ const OrtEnv* env, _In_ const ORTCHAR_T* model_path,
                     _In_ const OrtSessionOptions* options, _Inout_ OrtPrepackedWeightsContainer* prepacked_weights_container,
                     _Outptr_ OrtSession** out) {
@@ -2730,6 +2768,9 @@ static constexpr OrtApi ort_api_1_to_19 = {
     &OrtApis::KernelInfoGetAllocator,
     &OrtApis::AddExternalInitializersFromFilesInMemory,
     // End of Version 18 - DO NOT MODIFY ABOVE (see above text for more information)
+
+    &OrtApis::SessionAddLoraAdapter,
+    &OrtApis::PrepackedWeightsContainer_GetMemoryStats,
 };
 
 // OrtApiBase can never change as there is no way to know what version of OrtApiBase is returned by OrtGetApiBase.
@@ -523,4 +523,14 @@ ORT_API_STATUS_IMPL(SessionOptionsAppendExecutionProvider_VitisAI, _In_ OrtSessi
 ORT_API_STATUS_IMPL(KernelContext_GetScratchBuffer, _In_ const OrtKernelContext* context, _In_ const OrtMemoryInfo* mem_info, _In_ size_t count_or_bytes, _Outptr_ void** out);
 
 ORT_API_STATUS_IMPL(KernelInfoGetAllocator, _In_ const OrtKernelInfo* info, _In_ OrtMemType mem_type, _Outptr_ OrtAllocator** out);
+
+ORT_API_STATUS_IMPL(SessionAddLoraAdapter, _Inout_ OrtSession* session, _In_ const char* adapter_name,
+                    _In_reads_(num_parameters) const char* const* parameter_names,
+                    _In_reads_(num_parameters) const OrtValue* const* parameter_values,
+                    _In_ size_t num_parameters);
+
+ORT_API_STATUS_IMPL(PrepackedWeightsContainer_GetMemoryStats,
+                    _Inout_ OrtPrepackedWeightsContainer* prepacked_weights_container,
+                    _Out_ size_t* num_initializers, _Out_ size_t* initializers_size_in_bytes,
+                    _Out_ size_t* deduplicated_size_in_bytes);
 }  // namespace OrtApis
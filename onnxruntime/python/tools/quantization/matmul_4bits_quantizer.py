@@ -132,12 +132,22 @@ class DefaultWeightOnlyQuantConfig(WeightOnlyQuantConfig):
         block_size: int = 128,
         is_symmetric: bool = False,
         accuracy_level: int | None = None,
+        op_types_to_quantize: tuple[str, ...] | None = None,
     ):
+        """
+        This is a class for the default blockwise 4b weight only quantization.
+
+        Args:
+            op_types_to_quantize:
+                types of the nodes whose constant weight is quantized. MatMul and Gemm nodes become MatMulNBits,
+                Conv nodes become ConvNBits. Defaults to ("MatMul",).
+        """
         super().__init__(algorithm="DEFAULT")
         self.block_size = block_size
         self.is_symmetric = is_symmetric
         self.bits = 4
         self.accuracy_level = accuracy_level
+        self.op_types_to_quantize = set(op_types_to_quantize) if op_types_to_quantize else {"MatMul"}
 
 
 def is_divisible(val1, val2):
@@ -405,11 +415,61 @@ class DefaultWeightOnlyQuantizer:
 
         return (packed, scales, zero_point)
 
+    def _add_quantized_weight(
+        self, weight: TensorProto, weight_graph: GraphProto, fp32weight: npt.ArrayLike, layout: str = ""
+    ) -> list[str]:
+        """Quantize a [K, N] weight, add it to the graph and return the names of the B, scales and zero_points
+        inputs of MatMulNBits/ConvNBits. The zero_points name is empty for symmetric quantization.
+
+        layout tells apart the different [K, N] matrices derived from the same weight, e.g. the transposed B of a
+        Gemm with transB=1. It is part of the names of the quantized tensors, so a weight shared by several nodes
+        is quantized once per layout and reused by every node with that layout."""
+        prefix = weight.name + layout
+        input_names = [prefix + "_Q4", prefix + "_scales", ""]
+        if not self.config.is_symmetric:
+            input_names[2] = prefix + "_zero_points"
+
+        if any(initializer.name == input_names[0] for initializer in weight_graph.initializer):
+            return input_names
+
+        packed, scales, zero_points = self.int4_block_quant(fp32weight)
+        B_quant = onnx.numpy_helper.from_array(packed)  # noqa: N806
+        B_quant.name = input_names[0]
+        for input in weight_graph.input:
+            if input.name == weight.name:
+                weight_graph.input.remove(input)
+                break
+
+        scales_tensor = onnx.numpy_helper.from_array(scales)
+        scales_tensor.name = input_names[1]
+        weight_graph.initializer.extend([B_quant, scales_tensor])
+
+        if not self.config.is_symmetric:
+            zp_tensor = onnx.numpy_helper.from_array(zero_points)
+            zp_tensor.name = input_names[2]
+            weight_graph.initializer.extend([zp_tensor])
+
+        return input_names
+
+    def _nbits_kwargs(self, k: int, n: int) -> dict:
+        kwargs = {"K": k, "N": n, "bits": 4, "block_size": self.config.block_size}
+        if self.config.accuracy_level is not None:
+            kwargs["accuracy_level"] = self.config.accuracy_level
+        return kwargs
+
     def quantize(self, node: NodeProto, graph_stack: list[GraphProto]) -> NodeProto:
-        """If the node is MatMul with fp32 const weight, quantize the weight with int4, and return the new node"""
+        """If the node is MatMul, Gemm or Conv with fp32 const weight, quantize the weight with int4, and return
+        the new node"""
+
+        if node.op_type not in self.config.op_types_to_quantize:
+            return node
 
+        if node.op_type == "Gemm":
+            return self._quantize_gemm(node, graph_stack)
+        if node.op_type == "Conv":
+            return self._quantize_conv(node, graph_stack)
         if node.op_type != "MatMul":
-            return node  # only care about MatMul for now
+            return node
 
         logger.info(f"start to quantize {node.name} ...")
         inputB = node.input[1]  # noqa: N806
@@ -423,46 +483,129 @@ class DefaultWeightOnlyQuantizer:
             logger.info("MatMul weight is not 2D. Skip to quantize")
             return node  # can only process 2-D matrix
 
-        packed, scales, zero_points = self.int4_block_quant(B_array)
-        B_quant = onnx.numpy_helper.from_array(packed)  # noqa: N806
-        B_quant.name = B.name + "_Q4"
-        for input in Bs_graph.input:
-            if input.name == inputB:
-                Bs_graph.input.remove(input)
-                break
+        quant_input_names = self._add_quantized_weight(B, Bs_graph, B_array)
+        input_names = [node.input[0], *quant_input_names]
+        if not input_names[-1]:
+            input_names.pop()
 
-        scales_tensor = onnx.numpy_helper.from_array(scales)
-        scales_tensor.name = B.name + "_scales"
-        Bs_graph.initializer.extend([B_quant, scales_tensor])
+        rows, cols = B_array.shape
+        matmul_q4_node = onnx.helper.make_node(
+            "MatMulNBits",
+            inputs=input_names,
+            outputs=[node.output[0]],
+            name=node.name + "_Q4" if node.name else "",
+            domain="com.microsoft",
+            **self._nbits_kwargs(rows, cols),
+        )
 
-        input_names = [node.input[0], B_quant.name, scales_tensor.name]
-        if not self.config.is_symmetric:
-            zp_tensor = onnx.numpy_helper.from_array(zero_points)
-            zp_tensor.name = B.name + "_zero_points"
-            Bs_graph.initializer.extend([zp_tensor])
-            input_names.append(zp_tensor.name)
+        logger.info(f"complete quantization of {node.name} ...")
 
-        kwargs = {}
-        rows, cols = B_array.shape
-        kwargs["K"] = rows
-        kwargs["N"] = cols
-        kwargs["bits"] = 4
-        kwargs["block_size"] = self.config.block_size
-        if self.config.accuracy_level is not None:
-            kwargs["accuracy_level"] = self.config.accuracy_level
+        return matmul_q4_node
 
-        matmul_q4_node = onnx.helper.make_node(
+    def _quantize_gemm(self, node: NodeProto, graph_stack: list[GraphProto]) -> NodeProto:
+        """Replace Gemm with a constant weight B by MatMulNBits. alpha is folded into the weight and beta * C into
+        the bias, so C must be a constant that broadcasts to [N]."""
+
+        attrs = {attr.name: onnx.helper.get_attribute_value(attr) for attr in node.attribute}
+        if attrs.get("transA", 0) != 0:
+            logger.info(f"Gemm {node.name} has transA=1. Skip to quantize")
+            return node
+
+        B, Bs_graph = get_initializer(node.input[1], graph_stack)  # noqa: N806
+        if B is None or B.data_type != TensorProto.FLOAT:
+            logger.info(f"Gemm {node.name} doesn't have a const fp32 weight. Skip to quantize")
+            return node
+
+        B_array = onnx.numpy_helper.to_array(B)  # noqa: N806
+        layout = ""
+        if attrs.get("transB", 0) != 0:
+            B_array = B_array.T  # noqa: N806
+            layout += "_T"
+        k, n = B_array.shape
+
+        bias = None
+        if len(node.input) > 2 and node.input[2]:
+            C, _ = get_initializer(node.input[2], graph_stack)  # noqa: N806
+            if C is None:
+                logger.info(f"Gemm {node.name} doesn't have a const C. Skip to quantize")
+                return node
+            C_array = onnx.numpy_helper.to_array(C)  # noqa: N806
+            if C_array.ndim > 2 or (C_array.ndim == 2 and C_array.shape[0] != 1) or C_array.size not in (1, n):
+                logger.info(f"Gemm {node.name} C does not broadcast to [N]. Skip to quantize")
+                return node
+            bias = (np.broadcast_to(C_array.reshape(-1), (n,)) * attrs.get("beta", 1.0)).astype(np.float32)
+
+        logger.info(f"start to quantize {node.name} ...")
+        alpha = attrs.get("alpha", 1.0)
+        if alpha != 1.0:
+            B_array = (B_array * alpha).astype(np.float32)  # noqa: N806
+            layout += f"_alpha_{alpha:g}"
+
+        quant_input_names = self._add_quantized_weight(B, Bs_graph, np.ascontiguousarray(B_array), layout)
+        input_names = [node.input[0], *quant_input_names]
+        if bias is not None:
+            beta = attrs.get("beta", 1.0)
+            bias_name = node.input[2] + (f"_beta_{beta:g}" if beta != 1.0 else "") + f"_bias_{n}"
+            if not any(initializer.name == bias_name for initializer in Bs_graph.initializer):
+                bias_tensor = onnx.numpy_helper.from_array(bias)
+                bias_tensor.name = bias_name
+                Bs_graph.initializer.extend([bias_tensor])
+            input_names.extend(["", bias_name])
+        elif not input_names[-1]:
+            input_names.pop()
+
+        gemm_q4_node = onnx.helper.make_node(
             "MatMulNBits",
             inputs=input_names,
             outputs=[node.output[0]],
             name=node.name + "_Q4" if node.name else "",
             domain="com.microsoft",
+            **self._nbits_kwargs(k, n),
+        )
+
+        logger.info(f"complete quantization of {node.name} ...")
+
+        return gemm_q4_node
+
+    def _quantize_conv(self, node: NodeProto, graph_stack: list[GraphProto]) -> NodeProto:
+        """Replace Conv with a constant weight W by ConvNBits. W [M, C / group, kernel_shape...] is quantized as
+        a [K, M] matrix with K = C / group * prod(kernel_shape)."""
+
+        W, Ws_graph = get_initializer(node.input[1], graph_stack)  # noqa: N806
+        if W is None or W.data_type != TensorProto.FLOAT or len(W.dims) < 3:
+            logger.info(f"Conv {node.name} doesn't have a const fp32 weight. Skip to quantize")
+            return node
+
+        logger.info(f"start to quantize {node.name} ...")
+        W_array = onnx.numpy_helper.to_array(W)  # noqa: N806
+        m = W_array.shape[0]
+        W_matrix = np.ascontiguousarray(W_array.reshape(m, -1).T)  # noqa: N806
+        k = W_matrix.shape[0]
+
+        quant_input_names = self._add_quantized_weight(W, Ws_graph, W_matrix)
+        input_names = [node.input[0], *quant_input_names]
+        if len(node.input) > 2 and node.input[2]:
+            input_names.append(node.input[2])
+        elif not input_names[-1]:
+            input_names.pop()
+
+        kwargs = self._nbits_kwargs(k, m)
+        for attr in node.attribute:
+            kwargs.update(attribute_to_kwarg(attr))
+        kwargs.setdefault("kernel_shape", list(W_array.shape[2:]))
+
+        conv_q4_node = onnx.helper.make_node(
+            "ConvNBits",
+            inputs=input_names,
+            outputs=[node.output[0]],
+            name=node.name + "_Q4" if node.name else "",
+            domain="com.microsoft",
             **kwargs,
         )
 
         logger.info(f"complete quantization of {node.name} ...")
 
-        return matmul_q4_node
+        return conv_q4_node
 
 
 class MatMul4BitsQuantizer:
@@ -476,6 +619,7 @@ class MatMul4BitsQuantizer:
         accuracy_level: int | None = None,
         nodes_to_exclude=None,
         algo_config: WeightOnlyQuantConfig = None,
+        op_types_to_quantize: tuple[str, ...] | None = None,
     ):
         if nodes_to_exclude is None:
             nodes_to_exclude = []
@@ -488,7 +632,10 @@ class MatMul4BitsQuantizer:
         self.node_quantizer = None
         if algo_config is None:
             algo_config = DefaultWeightOnlyQuantConfig(
-                block_size=block_size, is_symmetric=is_symmetric, accuracy_level=accuracy_level
+                block_size=block_size,
+                is_symmetric=is_symmetric,
+                accuracy_level=accuracy_level,
+                op_types_to_quantize=op_types_to_quantize,
             )
         self.algo_config = algo_config
         if algo_config.algorithm == "HQQ":
@@ -641,7 +788,7 @@ def ort_convert_str_to_bool(value):
 
 def parse_args():
     parser = argparse.ArgumentParser(
-        description="""Blockwise int4 quantization for MatMul 2D weight matrices.
+        description="""Blockwise int4 quantization for MatMul 2D weight matrices, and optionally Gemm and Conv weights.
 
 A weight matrix is partitioned into into blocks, where each block is a
 continguous subset inside each column. Each block is quantized into a
@@ -678,6 +825,16 @@ set of 4b integers with a scaling factor and an optional offset.
         "Refer to the MatMulNBits contrib op's 'accuracy_level' attribute for details "
         "(https://github.com/microsoft/onnxruntime/blob/main/docs/ContribOperators.md#commicrosoftmatmulnbits).",
     )
+    parser.add_argument(
+        "--op_types_to_quantize",
+        nargs="+",
+        type=str,
+        required=False,
+        default=["MatMul"],
+        choices=["MatMul", "Gemm", "Conv"],
+        help="Op types whose constant weight is quantized by the default method. "
+        "MatMul and Gemm become MatMulNBits, Conv becomes ConvNBits.",
+    )
     parser.add_argument("-v", "--verbose", required=False, action="store_true")
     parser.set_defaults(verbose=False)
     parser.add_argument(
@@ -713,7 +870,10 @@ if __name__ == "__main__":
         quant_config = HQQWeightOnlyQuantConfig(block_size=args.block_size, bits=args.bits)
     elif args.quant_method == "default":
         quant_config = DefaultWeightOnlyQuantConfig(
-            block_size=args.block_size, is_symmetric=args.symmetric, accuracy_level=args.accuracy_level
+            block_size=args.block_size,
+            is_symmetric=args.symmetric,
+            accuracy_level=args.accuracy_level,
+            op_types_to_quantize=tuple(args.op_types_to_quantize),
         )
     elif args.quant_method == "rtn":
         quant_config = RTNWeightOnlyQuantConfig()
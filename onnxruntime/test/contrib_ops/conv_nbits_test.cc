@@ -0,0 +1,228 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef ORT_MINIMAL_BUILD
+
+#include <optional>
+
+#include "gtest/gtest.h"
+
+#include "core/common/span_utils.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/mlas/inc/mlas_q4.h"
+#include "test/common/tensor_op_test_utils.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+constexpr int QBits = 4;
+
+struct ConvNBitsTestOptions {
+  int64_t batch{1};
+  int64_t channels{8};
+  int64_t output_channels{16};
+  std::vector<int64_t> input_spatial_shape{7, 9};
+  std::vector<int64_t> kernel_shape{3, 3};
+  std::vector<int64_t> pads{1, 1, 1, 1};
+  std::vector<int64_t> strides{1, 1};
+  std::vector<int64_t> dilations{1, 1};
+  int64_t group{1};
+  int64_t block_size{32};
+  int64_t accuracy_level{0};
+  bool has_zero_point{false};
+  bool has_bias{false};
+};
+
+// The expected output is computed from the dequantized weight, so only the quantization of the activations
+// with accuracy_level 4 adds error.
+void RunConvNBitsTest(const ConvNBitsTestOptions& opts) {
+  const size_t rank = opts.kernel_shape.size();
+  const int64_t M = opts.output_channels;
+  const int64_t group_channels = opts.channels / opts.group;
+  const int64_t group_output_channels = M / opts.group;
+
+  int64_t kernel_size = 1;
+  int64_t input_image_size = 1;
+  std::vector<int64_t> output_spatial_shape(rank);
+  int64_t output_image_size = 1;
+  for (size_t i = 0; i < rank; i++) {
+    kernel_size *= opts.kernel_shape[i];
+    input_image_size *= opts.input_spatial_shape[i];
+    const int64_t dilated_kernel = opts.dilations[i] * (opts.kernel_shape[i] - 1) + 1;
+    output_spatial_shape[i] =
+        (opts.input_spatial_shape[i] + opts.pads[i] + opts.pads[i + rank] - dilated_kernel) / opts.strides[i] + 1;
+    output_image_size *= output_spatial_shape[i];
+  }
+  const int64_t K = group_channels * kernel_size;
+
+  RandomValueGenerator random{1234};
+  std::vector<int64_t> X_dims{opts.batch, opts.channels};
+  X_dims.insert(X_dims.end(), opts.input_spatial_shape.begin(), opts.input_spatial_shape.end());
+  std::vector<float> X(random.Gaussian<float>(X_dims, 0.0f, 0.5f));
+
+  // the weight is quantized as a [K, M] matrix, one column per output channel
+  std::vector<float> W_t(random.Gaussian<float>(AsSpan({K, M}), 0.0f, 0.25f));
+
+  int q_rows, q_cols;
+  MlasBlockwiseQuantizedShape<float, QBits>(static_cast<int>(opts.block_size), /* columnwise */ true,
+                                            static_cast<int>(K), static_cast<int>(M), q_rows, q_cols);
+  size_t q_data_size_in_bytes, q_scale_size, q_zp_size_in_bytes;
+  MlasBlockwiseQuantizedBufferSizes(QBits, static_cast<int>(opts.block_size), /* columnwise */ true,
+                                    static_cast<int>(K), static_cast<int>(M),
+                                    q_data_size_in_bytes, q_scale_size, &q_zp_size_in_bytes);
+
+  std::vector<uint8_t> B(q_data_size_in_bytes);
+  std::vector<float> scales(q_scale_size);
+  std::vector<uint8_t> zero_points(q_zp_size_in_bytes);
+  MlasQuantizeBlockwise<float, QBits>(B.data(), scales.data(), opts.has_zero_point ? zero_points.data() : nullptr,
+                                      W_t.data(), static_cast<int>(opts.block_size), true,
+                                      static_cast<int>(K), static_cast<int>(M), static_cast<int>(M), nullptr);
+
+  // dequantized weight, [M, K]
+  std::vector<float> W(static_cast<size_t>(M * K));
+  MlasDequantizeBlockwise<float, QBits>(W.data(), B.data(), scales.data(),
+                                        opts.has_zero_point ? zero_points.data() : nullptr,
+                                        static_cast<int>(opts.block_size), true,
+                                        static_cast<int>(K), static_cast<int>(M), nullptr);
+
+  std::optional<std::vector<float>> bias;
+  if (opts.has_bias) {
+    bias = random.Uniform<float>(AsSpan({M}), -1.0f, 1.0f);
+  }
+
+  std::vector<float> Y(static_cast<size_t>(opts.batch * M * output_image_size));
+  std::vector<int64_t> output_index(rank);
+  for (int64_t n = 0; n < opts.batch; n++) {
+    for (int64_t m = 0; m < M; m++) {
+      const int64_t g = m / group_output_channels;
+      for (int64_t o = 0; o < output_image_size; o++) {
+        for (size_t i = rank, rest = static_cast<size_t>(o); i-- > 0;) {
+          output_index[i] = static_cast<int64_t>(rest % output_spatial_shape[i]);
+          rest /= output_spatial_shape[i];
+        }
+
+        float sum = bias.has_value() ? (*bias)[m] : 0.0f;
+        for (int64_t c = 0; c < group_channels; c++) {
+          for (int64_t k = 0; k < kernel_size; k++) {
+            int64_t input_offset = 0;
+            bool in_bounds = true;
+            for (size_t i = rank, rest = static_cast<size_t>(k); i-- > 0;) {
+              const int64_t kernel_index = static_cast<int64_t>(rest % opts.kernel_shape[i]);
+              rest /= opts.kernel_shape[i];
+              const int64_t input_index =
+                  output_index[i] * opts.strides[i] - opts.pads[i] + kernel_index * opts.dilations[i];
+              in_bounds = in_bounds && input_index >= 0 && input_index < opts.input_spatial_shape[i];
+              int64_t stride = 1;
+              for (size_t j = i + 1; j < rank; j++) {
+                stride *= opts.input_spatial_shape[j];
+              }
+              input_offset += input_index * stride;
+            }
+            if (in_bounds) {
+              const int64_t x_channel = g * group_channels + c;
+              sum += X[(n * opts.channels + x_channel) * input_image_size + input_offset] *
+                     W[m * K + c * kernel_size + k];
+            }
+          }
+        }
+        Y[(n * M + m) * output_image_size + o] = sum;
+      }
+    }
+  }
+
+  OpTester test("ConvNBits", 1, kMSDomain);
+  test.AddAttribute<int64_t>("K", K);
+  test.AddAttribute<int64_t>("N", M);
+  test.AddAttribute<int64_t>("bits", QBits);
+  test.AddAttribute<int64_t>("block_size", opts.block_size);
+  test.AddAttribute<int64_t>("accuracy_level", opts.accuracy_level);
+  test.AddAttribute("kernel_shape", opts.kernel_shape);
+  test.AddAttribute("pads", opts.pads);
+  test.AddAttribute("strides", opts.strides);
+  test.AddAttribute("dilations", opts.dilations);
+  test.AddAttribute<int64_t>("group", opts.group);
+
+  test.AddInput<float>("X", X_dims, X);
+  test.AddInput<uint8_t>("B", {q_cols, q_rows}, B, true);
+  test.AddInput<float>("scales", {static_cast<int64_t>(q_scale_size)}, scales, true);
+  if (opts.has_zero_point) {
+    test.AddInput<uint8_t>("zero_points", {static_cast<int64_t>(q_zp_size_in_bytes)}, zero_points, true);
+  } else {
+    test.AddOptionalInputEdge<uint8_t>();
+  }
+  if (bias.has_value()) {
+    test.AddInput<float>("bias", {M}, *bias, true);
+  }
+
+  std::vector<int64_t> Y_dims{opts.batch, M};
+  Y_dims.insert(Y_dims.end(), output_spatial_shape.begin(), output_spatial_shape.end());
+  test.AddOutput<float>("Y", Y_dims, Y);
+  test.SetOutputAbsErr("Y", opts.accuracy_level == 4 ? 0.1f : 0.002f);
+  test.Run();
+}
+
+}  // namespace
+
+TEST(ConvNBits, Float32_2D) {
+  for (auto accuracy_level : {0, 1, 4}) {
+    for (auto block_size : {16, 32, 64}) {
+      ConvNBitsTestOptions opts;
+      opts.accuracy_level = accuracy_level;
+      opts.block_size = block_size;
+      RunConvNBitsTest(opts);
+
+      opts.batch = 2;
+      opts.has_zero_point = true;
+      opts.has_bias = true;
+      opts.strides = {2, 1};
+      RunConvNBitsTest(opts);
+    }
+  }
+}
+
+TEST(ConvNBits, Float32_Group_Dilation) {
+  for (auto accuracy_level : {0, 1, 4}) {
+    ConvNBitsTestOptions opts;
+    opts.accuracy_level = accuracy_level;
+    opts.group = 2;
+    opts.dilations = {2, 2};
+    opts.pads = {2, 1, 2, 1};
+    opts.has_bias = true;
+    RunConvNBitsTest(opts);
+  }
+}
+
+TEST(ConvNBits, Float32_Pointwise) {
+  for (auto accuracy_level : {0, 4}) {
+    ConvNBitsTestOptions opts;
+    opts.accuracy_level = accuracy_level;
+    opts.channels = 48;
+    opts.output_channels = 24;
+    opts.kernel_shape = {1, 1};
+    opts.pads = {0, 0, 0, 0};
+    opts.has_zero_point = true;
+    RunConvNBitsTest(opts);
+  }
+}
+
+TEST(ConvNBits, Float32_1D) {
+  for (auto accuracy_level : {0, 1}) {
+    ConvNBitsTestOptions opts;
+    opts.accuracy_level = accuracy_level;
+    opts.input_spatial_shape = {20};
+    opts.kernel_shape = {5};
+    opts.pads = {2, 2};
+    opts.strides = {1};
+    opts.dilations = {1};
+    opts.has_bias = true;
+    RunConvNBitsTest(opts);
+  }
+}
+
+}  // namespace test
+}  // namespace onnxruntime
+
+#endif  // ORT_MINIMAL_BUILD
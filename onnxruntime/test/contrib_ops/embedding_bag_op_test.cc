@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+TEST(EmbeddingBagContribOpTest, SumFloat) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddInput<float>("table", {4, 2}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+  test.AddInput<int64_t>("indices", {3, 2}, {0, 2, 3, -1, 1, 1});
+  test.AddOutput<float>("output", {3, 2}, {6.f, 8.f, 14.f, 16.f, 6.f, 8.f});
+  test.Run();
+}
+
+TEST(EmbeddingBagContribOpTest, MeanFloat) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddAttribute<std::string>("mode", "mean");
+  test.AddInput<float>("table", {4, 2}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+  test.AddInput<int32_t>("indices", {3, 2}, {0, 2, 3, -1, 1, 1});
+  test.AddOutput<float>("output", {3, 2}, {3.f, 4.f, 7.f, 8.f, 3.f, 4.f});
+  test.Run();
+}
+
+TEST(EmbeddingBagContribOpTest, SumFloat16) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddInput<MLFloat16>("table", {3, 2},
+                           {MLFloat16(0.5f), MLFloat16(1.f), MLFloat16(1.5f), MLFloat16(2.f),
+                            MLFloat16(2.5f), MLFloat16(3.f)});
+  test.AddInput<int64_t>("indices", {2, 2}, {0, 0, 1, 2});
+  test.AddOutput<float>("output", {2, 2}, {1.f, 2.f, 4.f, 5.f});
+  test.Run();
+}
+
+TEST(EmbeddingBagContribOpTest, SumInt8WithScales) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddInput<int8_t>("table", {4, 2}, {1, -2, 3, 4, -5, 6, 7, 8});
+  test.AddInput<int64_t>("indices", {2, 2}, {0, 2, 1, 1});
+  test.AddInput<float>("scales", {4}, {0.5f, 1.f, 2.f, 0.25f});
+  test.AddOutput<float>("output", {2, 2}, {-9.5f, 11.f, 6.f, 8.f});
+  test.Run();
+}
+
+TEST(EmbeddingBagContribOpTest, MeanUInt8WithZeroPoints) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddAttribute<std::string>("mode", "mean");
+  test.AddInput<uint8_t>("table", {3, 2}, {10, 20, 130, 128, 0, 255});
+  test.AddInput<int64_t>("indices", {2, 3}, {0, 1, 2, 2, 2, 0});
+  test.AddInput<float>("scales", {3}, {0.1f, 0.5f, 1.f});
+  test.AddInput<uint8_t>("zero_points", {3}, {10, 128, 0});
+  test.AddOutput<float>("output", {2, 2}, {1.f / 3, 256.f / 3, 0.f, 511.f / 3});
+  test.Run();
+}
+
+TEST(EmbeddingBagContribOpTest, EmptyBags) {
+  // Gather followed by ReduceSum or ReduceMean over an empty axis gives 0 for the sum and NaN for the mean.
+  for (const char* mode : {"sum", "mean"}) {
+    const bool mean = std::string(mode) == "mean";
+    const float expected = mean ? std::numeric_limits<float>::quiet_NaN() : 0.f;
+    OpTester test("EmbeddingBag", 1, kMSDomain);
+    test.AddAttribute<std::string>("mode", mode);
+    test.AddInput<float>("table", {2, 2}, {1.f, 2.f, 3.f, 4.f});
+    test.AddInput<int64_t>("indices", {3, 0}, {});
+    test.AddOutput<float>("output", {3, 2}, std::vector<float>(6, expected));
+    test.Run();
+  }
+}
+
+TEST(EmbeddingBagContribOpTest, ConstantTableAndIndices) {
+  // hot rows are planned in the kernel constructor when the table and the indices are initializers
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddAttribute<std::string>("mode", "mean");
+  test.AddInput<uint8_t>("table", {3, 2}, {10, 20, 130, 128, 0, 255}, true);
+  test.AddInput<int64_t>("indices", {2, 3}, {0, 1, 2, 2, 2, 0}, true);
+  test.AddInput<float>("scales", {3}, {0.1f, 0.5f, 1.f}, true);
+  test.AddInput<uint8_t>("zero_points", {3}, {10, 128, 0}, true);
+  test.AddOutput<float>("output", {2, 2}, {1.f / 3, 256.f / 3, 0.f, 511.f / 3});
+  test.Run();
+}
+
+TEST(EmbeddingBagContribOpTest, InvalidIndex) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddInput<float>("table", {2, 2}, {1.f, 2.f, 3.f, 4.f});
+  test.AddInput<int64_t>("indices", {1, 2}, {0, 2});
+  test.AddOutput<float>("output", {1, 2}, {0.f, 0.f});
+  test.Run(OpTester::ExpectResult::kExpectFailure, "indices element out of data bounds");
+}
+
+TEST(EmbeddingBagContribOpTest, QuantizedTableWithoutScales) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddInput<int8_t>("table", {2, 2}, {1, 2, 3, 4});
+  test.AddInput<int64_t>("indices", {1, 2}, {0, 1});
+  test.AddOutput<float>("output", {1, 2}, {0.f, 0.f});
+  test.Run(OpTester::ExpectResult::kExpectFailure, "scales with one element per table row are required");
+}
+
+}  // namespace test
+}  // namespace onnxruntime
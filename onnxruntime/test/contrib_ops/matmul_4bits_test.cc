@@ -80,6 +80,7 @@ struct TestOptions {
   bool zp_is_4bit{true};
   bool has_g_idx{false};
   bool has_bias{false};
+  int64_t lora_rank{0};
 
   std::optional<float> output_abs_error{};
 };
@@ -91,7 +92,8 @@ std::ostream& operator<<(std::ostream& os, const TestOptions& opts) {
             << ", has_zero_point:" << opts.has_zero_point
             << ", zp_is_4bit:" << opts.zp_is_4bit
             << ", has_g_idx:" << opts.has_g_idx
-            << ", has_bias:" << opts.has_bias;
+            << ", has_bias:" << opts.has_bias
+            << ", lora_rank:" << opts.lora_rank;
 }
 
 template <typename T1>
@@ -159,6 +161,13 @@ void RunTest(const TestOptions& opts,
     return std::nullopt;
   }();
 
+  const int64_t rank = opts.lora_rank;
+  std::vector<float> lora_a_vals, lora_b_vals;
+  if (rank > 0) {
+    lora_a_vals = random.Gaussian<float>(AsSpan({K, rank}), 0.0f, 0.25f);
+    lora_b_vals = random.Gaussian<float>(AsSpan({rank, N}), 0.0f, 0.25f);
+  }
+
   std::vector<float> expected_vals(M * N);
   for (int64_t m = 0; m < M; m++) {
     for (int64_t n = 0; n < N; n++) {
@@ -166,6 +175,13 @@ void RunTest(const TestOptions& opts,
       for (int64_t k = 0; k < K; k++) {
         sum += input0_vals[m * K + k] * input1_f_vals[n * K + k];
       }
+      for (int64_t r = 0; r < rank; r++) {
+        float a_lora_a = 0.0f;
+        for (int64_t k = 0; k < K; k++) {
+          a_lora_a += input0_vals[m * K + k] * lora_a_vals[k * rank + r];
+        }
+        sum += a_lora_a * lora_b_vals[r * N + n];
+      }
       expected_vals[m * N + n] = sum + (bias.has_value() ? (*bias)[n] : 0.0f);
     }
   }
@@ -243,6 +259,16 @@ void RunTest(const TestOptions& opts,
     test.AddOptionalInputEdge<T1>();
   }
 
+  if (rank > 0) {
+    if constexpr (use_float16) {
+      test.AddInput<T1>("lora_a", {K, rank}, ToFloat16(lora_a_vals), true);
+      test.AddInput<T1>("lora_b", {rank, N}, ToFloat16(lora_b_vals), true);
+    } else {
+      test.AddInput<T1>("lora_a", {K, rank}, lora_a_vals, true);
+      test.AddInput<T1>("lora_b", {rank, N}, lora_b_vals, true);
+    }
+  }
+
   if constexpr (use_float16) {
     test.AddOutput<T1>("Y", {M, N}, ToFloat16(expected_vals));
   } else {
@@ -312,6 +338,18 @@ TEST(MatMulNBits, Float32) {
 
               RunTest<float>(opts, std::move(explicit_eps));
             }
+
+            {
+              TestOptions opts = base_opts;
+              opts.has_bias = true;
+              opts.lora_rank = 4;
+
+              // low-rank update is only implemented by the CPU EP
+              std::vector<std::unique_ptr<IExecutionProvider>> explicit_eps;
+              explicit_eps.emplace_back(DefaultCpuExecutionProvider());
+
+              RunTest<float>(opts, std::move(explicit_eps));
+            }
           }
         }
       }
@@ -319,6 +357,37 @@ TEST(MatMulNBits, Float32) {
   }
 }
 
+// The lora inputs are checked before the main GEMM runs.
+TEST(MatMulNBits, LowRankUpdateShapeMismatch) {
+  constexpr int64_t M = 2, N = 4, K = 32, block_size = 32, rank = 2;
+
+  int q_rows, q_cols;
+  MlasBlockwiseQuantizedShape<float, QBits>(static_cast<int>(block_size), /* columnwise */ true,
+                                            static_cast<int>(K), static_cast<int>(N), q_rows, q_cols);
+  size_t q_data_size_in_bytes, q_scale_size;
+  MlasBlockwiseQuantizedBufferSizes(QBits, static_cast<int>(block_size), /* columnwise */ true,
+                                    static_cast<int>(K), static_cast<int>(N),
+                                    q_data_size_in_bytes, q_scale_size, nullptr);
+
+  OpTester test("MatMulNBits", 1, kMSDomain);
+  test.AddAttribute<int64_t>("K", K);
+  test.AddAttribute<int64_t>("N", N);
+  test.AddAttribute<int64_t>("block_size", block_size);
+  test.AddAttribute<int64_t>("bits", QBits);
+  test.AddInput<float>("A", {M, K}, std::vector<float>(M * K, 1.0f));
+  test.AddInput<uint8_t>("B", {q_cols, q_rows}, std::vector<uint8_t>(q_data_size_in_bytes), true);
+  test.AddInput<float>("scales", {static_cast<int64_t>(q_scale_size)}, std::vector<float>(q_scale_size, 1.0f), true);
+  test.AddOptionalInputEdge<uint8_t>();
+  test.AddOptionalInputEdge<int32_t>();
+  test.AddOptionalInputEdge<float>();
+  test.AddInput<float>("lora_a", {K, rank}, std::vector<float>(K * rank, 1.0f));
+  test.AddInput<float>("lora_b", {rank + 1, N}, std::vector<float>((rank + 1) * N, 1.0f));
+  test.AddOutput<float>("Y", {M, N}, std::vector<float>(M * N, 0.0f));
+  test.Config(OpTester::ExpectResult::kExpectFailure, "lora_b must have shape [rank, N]")
+      .ConfigEp(DefaultCpuExecutionProvider())
+      .RunWithConfig();
+}
+
 #if defined(USE_CUDA) || defined(USE_ROCM) || defined(USE_DML)
 
 namespace {
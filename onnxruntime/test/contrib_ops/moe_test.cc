@@ -19,7 +19,9 @@ static void RunMoETest(const std::vector<float>& input, const std::vector<float>
   int min_cuda_architecture = use_float16 ? 700 : 0;
 
   bool enable_cuda = HasCudaEnvironment(min_cuda_architecture);
-  if (enable_cuda) {
+  // The CPU kernel only supports float.
+  bool enable_cpu = !use_float16;
+  if (enable_cuda || enable_cpu) {
     OpTester tester("MoE", 1, onnxruntime::kMSDomain);
     tester.AddAttribute<int64_t>("k", static_cast<int64_t>(top_k));
     tester.AddAttribute<std::string>("activation_type", activation_type);
@@ -77,7 +79,12 @@ static void RunMoETest(const std::vector<float>& input, const std::vector<float>
     }
 
     std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
-    execution_providers.push_back(DefaultCudaExecutionProvider());
+    if (enable_cuda) {
+      execution_providers.push_back(DefaultCudaExecutionProvider());
+    }
+    if (enable_cpu) {
+      execution_providers.push_back(DefaultCpuExecutionProvider());
+    }
     tester.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
   }
 }
@@ -626,6 +633,91 @@ TEST(MoETest, MoETest_Mixtral) {
              2 /*top_k*/);
 }
 
+TEST(MoETest, MoETest_NaNRouterProbs_Cpu) {
+  // A NaN router logit ranks below every other expert, so a row never selects the same expert twice.
+  // Every expert e has identity fc1 weights and (e + 1) * identity fc2 weights.
+  int num_rows = 2;
+  int num_experts = 4;
+  int hidden_size = 2;
+  int inter_size = 2;
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+
+  const std::vector<float> input = {1.0f, 2.0f, -1.0f, 0.5f};
+  const std::vector<float> router_probs = {nan, 1.0f, 0.5f, 2.0f,
+                                           nan, nan, 3.0f, nan};
+  std::vector<float> fc1_experts_weights;
+  std::vector<float> fc2_experts_weights;
+  for (int e = 0; e < num_experts; e++) {
+    const float scale = static_cast<float>(e + 1);
+    fc1_experts_weights.insert(fc1_experts_weights.end(), {1.0f, 0.0f, 0.0f, 1.0f});
+    fc2_experts_weights.insert(fc2_experts_weights.end(), {scale, 0.0f, 0.0f, scale});
+  }
+
+  // Row 0 goes to experts 3 and 1 with weights e / (e + 1) and 1 / (e + 1). Row 1 goes to expert 2 with
+  // weight 1 and to expert 0 with weight 0.
+  const std::vector<float> output = {3.4621172f, 6.9242343f, -3.0f, 1.5f};
+
+  OpTester tester("MoE", 1, onnxruntime::kMSDomain);
+  tester.AddAttribute<int64_t>("k", 2);
+  tester.AddAttribute<std::string>("activation_type", "identity");
+  tester.AddAttribute<int64_t>("normalize_routing_weights", 1);
+  tester.AddInput<float>("input", {num_rows, hidden_size}, input);
+  tester.AddInput<float>("router_probs", {num_rows, num_experts}, router_probs);
+  tester.AddInput<float>("fc1_experts_weights", {num_experts, hidden_size, inter_size}, fc1_experts_weights);
+  tester.AddOptionalInputEdge<float>();
+  tester.AddInput<float>("fc2_experts_weights", {num_experts, inter_size, hidden_size}, fc2_experts_weights);
+  tester.AddOutput<float>("output", {num_rows, hidden_size}, output);
+  tester.SetOutputTolerance(0.0001f);
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  tester.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+TEST(MoETest, MoETest_InfRouterProbs_Cpu) {
+  // With an infinite router logit the softmax is taken in the limit: the experts at the largest logit share the
+  // weight equally and every other expert gets 0. Every expert e has identity fc1 weights and (e + 1) * identity
+  // fc2 weights.
+  int num_rows = 3;
+  int num_experts = 4;
+  int hidden_size = 2;
+  int inter_size = 2;
+  const float inf = std::numeric_limits<float>::infinity();
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+
+  const std::vector<float> input = {1.0f, 2.0f, -1.0f, 0.5f, 2.0f, -4.0f};
+  const std::vector<float> router_probs = {inf, 1.0f, inf, 2.0f,
+                                           -1.0f, inf, 5.0f, nan,
+                                           -inf, -inf, -inf, -inf};
+  std::vector<float> fc1_experts_weights;
+  std::vector<float> fc2_experts_weights;
+  for (int e = 0; e < num_experts; e++) {
+    const float scale = static_cast<float>(e + 1);
+    fc1_experts_weights.insert(fc1_experts_weights.end(), {1.0f, 0.0f, 0.0f, 1.0f});
+    fc2_experts_weights.insert(fc2_experts_weights.end(), {scale, 0.0f, 0.0f, scale});
+  }
+
+  // Row 0 goes to experts 0 and 2 with weight 0.5 each. Row 1 goes to expert 1 with weight 1 and to expert 2
+  // with weight 0. Row 2 goes to experts 0 and 1 with weight 0.5 each.
+  const std::vector<float> output = {2.0f, 4.0f, -2.0f, 1.0f, 3.0f, -6.0f};
+
+  OpTester tester("MoE", 1, onnxruntime::kMSDomain);
+  tester.AddAttribute<int64_t>("k", 2);
+  tester.AddAttribute<std::string>("activation_type", "identity");
+  tester.AddAttribute<int64_t>("normalize_routing_weights", 1);
+  tester.AddInput<float>("input", {num_rows, hidden_size}, input);
+  tester.AddInput<float>("router_probs", {num_rows, num_experts}, router_probs);
+  tester.AddInput<float>("fc1_experts_weights", {num_experts, hidden_size, inter_size}, fc1_experts_weights);
+  tester.AddOptionalInputEdge<float>();
+  tester.AddInput<float>("fc2_experts_weights", {num_experts, inter_size, hidden_size}, fc2_experts_weights);
+  tester.AddOutput<float>("output", {num_rows, hidden_size}, output);
+  tester.SetOutputTolerance(0.0001f);
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  tester.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
 TEST(MoETest, QMoETest_Mixtral_Int4) {
   int num_rows = 2;
   int num_experts = 2;
@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+TEST(QLinearLayerNormalizationTest, UInt8) {
+  OpTester test("QLinearLayerNormalization", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<int64_t>("axis", -1);
+  test.AddAttribute<float>("epsilon", 1e-5f);
+
+  std::vector<int64_t> dims = {2, 2, 4};
+  test.AddInput<uint8_t>("X", dims, {12, 200, 90, 131, 0, 255, 128, 64, 100, 101, 102, 103, 40, 180, 30, 220});
+  test.AddInput<float>("X_scale", {}, {0.04f}, true);
+  test.AddInput<uint8_t>("X_zero_point", {}, {128}, true);
+  test.AddInput<float>("Scale", {4}, {1.0f, 0.5f, -1.5f, 2.0f}, true);
+  test.AddInput<float>("Y_scale", {}, {0.02f}, true);
+  test.AddInput<uint8_t>("Y_zero_point", {}, {120}, true);
+  test.AddInput<float>("B", {4}, {0.1f, -0.2f, 0.0f, 0.3f}, true);
+  test.AddOutput<uint8_t>("Y", dims, {54, 144, 140, 168, 66, 148, 107, 84, 58, 99, 87, 255, 79, 129, 198, 255});
+  test.Run();
+}
+
+// enough rows for several blocks of rows, checked against a double precision reference.
+static void RunQLinearLayerNormalizationInt8Test(const std::vector<int64_t>& dims, int64_t axis, bool has_bias) {
+  const size_t rank = dims.size();
+  const size_t normalized_axis = static_cast<size_t>(axis < 0 ? axis + static_cast<int64_t>(rank) : axis);
+  size_t norm_count = 1;
+  size_t norm_size = 1;
+  for (size_t i = 0; i < rank; i++) {
+    (i < normalized_axis ? norm_count : norm_size) *= static_cast<size_t>(dims[i]);
+  }
+
+  const float x_scale = 0.05f;
+  const int8_t x_zero_point = 3;
+  const float y_scale = 0.03f;
+  const int8_t y_zero_point = -7;
+  const float epsilon = 1e-5f;
+
+  std::vector<int8_t> X(norm_count * norm_size);
+  for (size_t i = 0; i < X.size(); i++) {
+    X[i] = static_cast<int8_t>(static_cast<int>((i * 37 + i / 7) % 256) - 128);
+  }
+  std::vector<float> scale(norm_size);
+  std::vector<float> bias(norm_size);
+  for (size_t i = 0; i < norm_size; i++) {
+    scale[i] = static_cast<float>(i % 11) / 8.0f - 0.5f;
+    bias[i] = has_bias ? static_cast<float>(i % 5) / 10.0f - 0.2f : 0.0f;
+  }
+
+  std::vector<int8_t> Y(X.size());
+  for (size_t n = 0; n < norm_count; n++) {
+    double mean = 0.0;
+    double mean_square = 0.0;
+    for (size_t d = 0; d < norm_size; d++) {
+      const double x = x_scale * (static_cast<int>(X[n * norm_size + d]) - x_zero_point);
+      mean += x;
+      mean_square += x * x;
+    }
+    mean /= norm_size;
+    const double inv_std_dev = 1.0 / std::sqrt(mean_square / norm_size - mean * mean + epsilon);
+    for (size_t d = 0; d < norm_size; d++) {
+      const double x = x_scale * (static_cast<int>(X[n * norm_size + d]) - x_zero_point);
+      const double y = (x - mean) * inv_std_dev * scale[d] + bias[d];
+      const double q = std::nearbyint(y / y_scale) + y_zero_point;
+      Y[n * norm_size + d] = static_cast<int8_t>(std::min(127.0, std::max(-128.0, q)));
+    }
+  }
+
+  OpTester test("QLinearLayerNormalization", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<int64_t>("axis", axis);
+  test.AddAttribute<float>("epsilon", epsilon);
+
+  std::vector<int64_t> norm_dims(dims.begin() + normalized_axis, dims.end());
+  test.AddInput<int8_t>("X", dims, X);
+  test.AddInput<float>("X_scale", {}, {x_scale});
+  test.AddInput<int8_t>("X_zero_point", {}, {x_zero_point});
+  test.AddInput<float>("Scale", norm_dims, scale, true);
+  test.AddInput<float>("Y_scale", {}, {y_scale});
+  test.AddInput<int8_t>("Y_zero_point", {}, {y_zero_point});
+  if (has_bias) {
+    test.AddInput<float>("B", norm_dims, bias, true);
+  }
+  test.AddOutput<int8_t>("Y", dims, Y);
+  // the kernel accumulates in float, values next to a rounding boundary can land on either side
+  test.SetOutputAbsErr("Y", 1.0f);
+  test.Run();
+}
+
+TEST(QLinearLayerNormalizationTest, Int8_ManyRows) {
+  RunQLinearLayerNormalizationInt8Test({3, 100, 96}, -1, true);
+}
+
+TEST(QLinearLayerNormalizationTest, Int8_Axis1_NoBias) {
+  RunQLinearLayerNormalizationInt8Test({4, 6, 50}, 1, false);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -121,6 +121,52 @@ TEST(QLinearLookupTableBasedOperatorTests, QLinearSigmoid_UInt8_0_Y_ZP) {
   run_test(true);
 }
 
+TEST(QLinearLookupTableBasedOperatorTests, QLinearGelu_UInt8) {
+  auto run_test = [](bool scales_and_zp_are_initializers) {
+    OpTester test("QLinearGelu", 1, onnxruntime::kMSDomain);
+    float X_scale = 0.03f;
+    uint8_t X_zero_point = 128;
+    float Y_scale = 0.02f;
+    uint8_t Y_zero_point = 30;
+
+    std::vector<int64_t> dims = {16};
+    test.AddInput<uint8_t>("X", dims, {0, 16, 40, 64, 90, 110, 127, 128, 136, 150, 170, 200, 216, 240, 250, 255});
+    test.AddInput<float>("X_scale", {}, {X_scale}, scales_and_zp_are_initializers);
+    test.AddInput<uint8_t>("X_zero_point", {}, {X_zero_point}, scales_and_zp_are_initializers);
+    test.AddInput<float>("Y_scale", {}, {Y_scale}, scales_and_zp_are_initializers);
+    test.AddInput<uint8_t>("Y_zero_point", {}, {Y_zero_point}, scales_and_zp_are_initializers);
+    test.AddOutput<uint8_t>("Y", dims, {30, 30, 29, 27, 23, 22, 29, 30, 37, 55, 86, 136, 161, 198, 213, 220});
+    auto origin_round_mode = std::fegetround();
+    std::fesetround(FE_TONEAREST);
+    test.Run();
+    std::fesetround(origin_round_mode);
+  };
+
+  run_test(false);
+  run_test(true);
+}
+
+// inputs around -2 round differently with the tanh approximation
+TEST(QLinearLookupTableBasedOperatorTests, QLinearGelu_Int8_Tanh) {
+  OpTester test("QLinearGelu", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<std::string>("approximate", "tanh");
+  float X_scale = 0.025f;
+  float Y_scale = 0.001f;
+  int8_t Y_zero_point = 60;
+
+  std::vector<int64_t> dims = {16};
+  test.AddInput<int8_t>("X", dims, {-128, -120, -110, -100, -90, -80, -70, -60, -40, -20, -4, 0, 2, 4, 6, 127});
+  test.AddInput<float>("X_scale", {}, {X_scale});
+  test.AddOptionalInputEdge<int8_t>();  // optional "X_zero_point" using default value here
+  test.AddInput<float>("Y_scale", {}, {Y_scale});
+  test.AddInput<int8_t>("Y_zero_point", {}, {Y_zero_point});
+  test.AddOutput<int8_t>("Y", dims, {58, 56, 52, 45, 33, 15, -10, -40, -99, -94, 14, 60, 86, 114, 127, 127});
+  auto origin_round_mode = std::fegetround();
+  std::fesetround(FE_TONEAREST);
+  test.Run();
+  std::fesetround(origin_round_mode);
+}
+
 /*
 \brief data is generated by pytorch script
 \details model defines
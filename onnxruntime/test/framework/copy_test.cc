@@ -109,6 +109,49 @@ TEST_F(CopyTest, Concat2D) {
   }
 }
 
+TEST_F(CopyTest, ParallelCopyInterleave) {
+  // interleave rows of two sources, large enough to be split across threads, including within a row
+  constexpr size_t rows = 1000, a_cols = 300, b_cols = 700, dst_cols = a_cols + b_cols;
+  std::vector<float> a(rows * a_cols), b(rows * b_cols), dst(rows * dst_cols, -1.f);
+  for (size_t i = 0; i < a.size(); ++i) a[i] = static_cast<float>(i);
+  for (size_t i = 0; i < b.size(); ++i) b[i] = -static_cast<float>(i);
+
+  constexpr size_t a_row_bytes = a_cols * sizeof(float), dst_row_bytes = dst_cols * sizeof(float);
+  ParallelCopy(tp.get(), dst.size() * sizeof(float), rows * 2, [&](size_t offset) {
+    const size_t row = offset / dst_row_bytes;
+    const size_t offset_in_row = offset % dst_row_bytes;
+    auto* dst_bytes = reinterpret_cast<uint8_t*>(dst.data()) + offset;
+    if (offset_in_row < a_row_bytes) {
+      return CopySegment{dst_bytes, reinterpret_cast<const uint8_t*>(a.data() + row * a_cols) + offset_in_row,
+                         a_row_bytes - offset_in_row};
+    }
+    return CopySegment{dst_bytes,
+                       reinterpret_cast<const uint8_t*>(b.data() + row * b_cols) + (offset_in_row - a_row_bytes),
+                       dst_row_bytes - offset_in_row};
+  });
+
+  for (size_t row = 0; row < rows; ++row) {
+    for (size_t col = 0; col < dst_cols; ++col) {
+      const float expected = col < a_cols ? a[row * a_cols + col] : b[row * b_cols + col - a_cols];
+      ASSERT_EQ(expected, dst[row * dst_cols + col]) << "row " << row << " col " << col;
+    }
+  }
+}
+
+TEST_F(CopyTest, ParallelCopySingleSegment) {
+  // one segment is still split into blocks that can run on different threads
+  std::vector<float> src(300000), dst(src.size(), -1.f);
+  for (size_t i = 0; i < src.size(); ++i) src[i] = static_cast<float>(i);
+
+  const size_t total_bytes = src.size() * sizeof(float);
+  ParallelCopy(tp.get(), total_bytes, 1, [&](size_t offset) {
+    return CopySegment{reinterpret_cast<uint8_t*>(dst.data()) + offset,
+                       reinterpret_cast<const uint8_t*>(src.data()) + offset, total_bytes - offset};
+  });
+
+  ASSERT_EQ(src, dst);
+}
+
 TEST_F(CopyTest, CoalesceTensorsTest) {
   {
     TensorShapeVector strides_a{3, 1};
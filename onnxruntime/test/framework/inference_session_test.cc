@@ -29,6 +29,7 @@
 #include "core/graph/op.h"
 #include "core/optimizer/rule_based_graph_transformer.h"
 #include "core/platform/env.h"
+#include "core/platform/path_lib.h"
 #include "core/providers/cpu/cpu_execution_provider.h"
 #include "core/providers/cpu/math/element_wise_ops.h"
 #ifdef USE_CUDA
@@ -55,6 +56,7 @@
 #include "test/optimizer/dummy_graph_transformer.h"
 #include "test/util/include/default_providers.h"
 #include "test/util/include/inference_session_wrapper.h"
+#include "test/util/include/temp_dir.h"
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -3008,5 +3010,299 @@ TEST(InferenceSessionTests, InterThreadPoolWithDenormalAsZero) {
 }
 #endif
 
+#if !defined(ORT_MINIMAL_BUILD)
+class InferenceSessionTestShapeSpecialization : public InferenceSessionWrapper {
+ public:
+  using InferenceSessionWrapper::InferenceSessionWrapper;
+  using InferenceSessionWrapper::FindShapeSpecializedSession;
+  using InferenceSessionWrapper::WaitForShapeSpecializedSessions;
+};
+
+TEST(InferenceSessionTests, ShapeSpecialization) {
+  // Y = Reshape(X, Shape(X)) * 2 with a symbolic input shape. Once specialized the Shape node can be constant folded.
+  onnxruntime::Model model("shape_specialization", false, ModelMetaData(), PathString(),
+                           IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 14}}, {},
+                           DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  ONNX_NAMESPACE::TypeProto float_tensor;
+  float_tensor.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("batch");
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("len");
+
+  auto& input = graph.GetOrCreateNodeArg("X", &float_tensor);
+  auto& shape = graph.GetOrCreateNodeArg("shape", nullptr);
+  auto& reshaped = graph.GetOrCreateNodeArg("reshaped", nullptr);
+  auto& output = graph.GetOrCreateNodeArg("Y", &float_tensor);
+
+  graph.AddNode("shape", "Shape", "", {&input}, {&shape});
+  graph.AddNode("reshape", "Reshape", "", {&input, &shape}, {&reshaped});
+  graph.AddNode("add", "Add", "", {&reshaped, &reshaped}, {&output});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  TemporaryDirectory tmp_dir{ORT_TSTR("shape_specialization_test_tmp_dir")};
+  const PathString model_path = ConcatPathComponent(tmp_dir.Path(), ORT_TSTR("shape_specialization_test.onnx"));
+  ASSERT_STATUS_OK(onnxruntime::Model::Save(model, model_path));
+
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.ShapeSpecialization";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigShapeSpecializationMinRuns, "2"));
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigShapeSpecializationMaxSessions, "1"));
+
+  InferenceSessionTestShapeSpecialization session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(model_path));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  const std::vector<std::string> feed_names{"X"};
+  auto make_feed = [](const std::vector<int64_t>& dims, std::vector<float>& expected_values) {
+    std::vector<float> values(static_cast<size_t>(dims[0] * dims[1]));
+    expected_values.resize(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = static_cast<float>(i);
+      expected_values[i] = 2.0f * values[i];
+    }
+
+    OrtValue ml_value;
+    CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0], dims, values, &ml_value);
+    return ml_value;
+  };
+
+  auto run_and_verify = [&](const std::vector<int64_t>& dims) {
+    std::vector<float> expected_values;
+    std::vector<OrtValue> feeds{make_feed(dims, expected_values)};
+    std::vector<std::string> output_names{"Y"};
+    std::vector<OrtValue> fetches;
+
+    ASSERT_STATUS_OK(session_object.Run(RunOptions{}, feed_names, feeds, output_names, &fetches, nullptr));
+    VerifyOutputs(fetches, dims, expected_values);
+  };
+
+  auto find_specialized_session = [&](const std::vector<int64_t>& dims, size_t& num_runs) {
+    std::vector<float> expected_values;
+    std::vector<OrtValue> feeds{make_feed(dims, expected_values)};
+    return session_object.FindShapeSpecializedSession(feed_names, feeds, num_runs);
+  };
+
+  // the second run with {2, 3} starts building the specialized session. {3, 2} stays on the generic plan as the
+  // session limit is hit.
+  for (int i = 0; i < 2; ++i) {
+    run_and_verify({2, 3});
+    run_and_verify({3, 2});
+  }
+
+  session_object.WaitForShapeSpecializedSessions();
+
+  size_t num_runs = 0;
+  const InferenceSession* specialized_session = find_specialized_session({2, 3}, num_runs);
+  ASSERT_NE(specialized_session, nullptr);
+  ASSERT_EQ(num_runs, static_cast<size_t>(0));
+  ASSERT_EQ(find_specialized_session({3, 2}, num_runs), nullptr);
+
+  // the specialized session has the input dims fixed
+  auto specialized_inputs = specialized_session->GetModelInputs();
+  ASSERT_STATUS_OK(specialized_inputs.first);
+  ASSERT_EQ(specialized_inputs.second->size(), static_cast<size_t>(1));
+  const auto* specialized_input_shape = specialized_inputs.second->front()->Shape();
+  ASSERT_NE(specialized_input_shape, nullptr);
+  ASSERT_EQ(specialized_input_shape->dim_size(), 2);
+  EXPECT_EQ(specialized_input_shape->dim(0).dim_value(), 2);
+  EXPECT_EQ(specialized_input_shape->dim(1).dim_value(), 3);
+
+  // later runs with {2, 3} are dispatched to it
+  for (int i = 0; i < 3; ++i) {
+    run_and_verify({2, 3});
+    run_and_verify({3, 2});
+  }
+
+  ASSERT_EQ(find_specialized_session({2, 3}, num_runs), specialized_session);
+  ASSERT_EQ(num_runs, static_cast<size_t>(3));
+}
+
+TEST(InferenceSessionTests, LoraAdapters) {
+  // Y = X + W where W is an overridable initializer that the adapters replace.
+  onnxruntime::Model model("lora_adapters", false, ModelMetaData(), PathString(),
+                           IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 14}}, {},
+                           DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  ONNX_NAMESPACE::TypeProto float_tensor;
+  float_tensor.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+
+  ONNX_NAMESPACE::TensorProto weight;
+  weight.set_name("W");
+  weight.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  weight.add_dims(3);
+  for (int i = 0; i < 3; ++i) {
+    weight.add_float_data(1.0f);
+  }
+  graph.AddInitializedTensor(weight);
+
+  auto& input = graph.GetOrCreateNodeArg("X", &float_tensor);
+  auto& weight_arg = graph.GetOrCreateNodeArg("W", &float_tensor);
+  auto& output = graph.GetOrCreateNodeArg("Y", &float_tensor);
+  graph.AddNode("add", "Add", "", {&input, &weight_arg}, {&output});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  std::string model_bytes;
+  model.ToProto().SerializeToString(&model_bytes);
+  std::stringstream model_stream(model_bytes);
+
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.LoraAdapters";
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(model_stream));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  auto allocator = TestCPUExecutionProvider()->CreatePreferredAllocators()[0];
+  auto make_value = [&allocator](float value) {
+    OrtValue ml_value;
+    CreateMLValue<float>(allocator, {3}, std::vector<float>(3, value), &ml_value);
+    return ml_value;
+  };
+
+  ASSERT_STATUS_OK(session_object.AddLoraAdapter("ten", {{"W", make_value(10.0f)}}));
+  ASSERT_STATUS_OK(session_object.AddLoraAdapter("hundred", {{"W", make_value(100.0f)}}));
+  ASSERT_STATUS_NOT_OK(session_object.AddLoraAdapter("ten", {{"W", make_value(10.0f)}}));
+
+  auto run_and_verify = [&](const std::string& adapter, float expected_value) {
+    RunOptions run_options;
+    if (!adapter.empty()) {
+      ASSERT_STATUS_OK(run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigActiveLoraAdapter,
+                                                                 adapter.c_str()));
+    }
+    NameMLValMap feeds{{"X", make_value(1.0f)}};
+    std::vector<std::string> output_names{"Y"};
+    std::vector<OrtValue> fetches;
+
+    ASSERT_STATUS_OK(session_object.Run(run_options, feeds, output_names, &fetches));
+    VerifyOutputs(fetches, {3}, std::vector<float>(3, expected_value));
+  };
+
+  run_and_verify("", 2.0f);
+  run_and_verify("ten", 11.0f);
+  run_and_verify("hundred", 101.0f);
+  run_and_verify("", 2.0f);
+
+  RunOptions run_options;
+  ASSERT_STATUS_OK(run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigActiveLoraAdapter, "unknown"));
+  NameMLValMap feeds{{"X", make_value(1.0f)}};
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_NOT_OK(session_object.Run(run_options, feeds, {"Y"}, &fetches));
+}
+
+// Two variants of a model, Y = (X + W) * V, that share W and differ in V keep a single copy of W.
+TEST(InferenceSessionTests, ShareInitializersAcrossModelVariants) {
+  constexpr int64_t size = 64;
+  constexpr size_t tensor_bytes = size * sizeof(float);
+
+  auto make_model_variant = [](float v_value) {
+    onnxruntime::Model model("model_variant", false, ModelMetaData(), PathString(),
+                             IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 14}}, {},
+                             DefaultLoggingManager().DefaultLogger());
+    auto& graph = model.MainGraph();
+
+    ONNX_NAMESPACE::TypeProto float_tensor;
+    float_tensor.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+    float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(size);
+
+    const std::vector<std::pair<std::string, float>> initializers{{"W", 1.0f}, {"V", v_value}};
+    for (const auto& [name, value] : initializers) {
+      ONNX_NAMESPACE::TensorProto initializer;
+      initializer.set_name(name);
+      initializer.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+      initializer.add_dims(size);
+      for (int64_t i = 0; i < size; ++i) {
+        initializer.add_float_data(value);
+      }
+      graph.AddInitializedTensor(initializer);
+    }
+
+    auto& input = graph.GetOrCreateNodeArg("X", &float_tensor);
+    auto& w = graph.GetOrCreateNodeArg("W", &float_tensor);
+    auto& v = graph.GetOrCreateNodeArg("V", &float_tensor);
+    auto& sum = graph.GetOrCreateNodeArg("sum", &float_tensor);
+    auto& output = graph.GetOrCreateNodeArg("Y", &float_tensor);
+    graph.AddNode("add", "Add", "", {&input, &w}, {&sum});
+    graph.AddNode("mul", "Mul", "", {&sum, &v}, {&output});
+    EXPECT_STATUS_OK(graph.Resolve());
+
+    std::string model_bytes;
+    model.ToProto().SerializeToString(&model_bytes);
+    return model_bytes;
+  };
+
+  const std::string model_1_bytes = make_model_variant(2.0f);
+  const std::string model_2_bytes = make_model_variant(3.0f);
+
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.ShareInitializersAcrossModelVariants";
+  so.graph_optimization_level = TransformerLevel::Default;
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsShareInitializersAcrossSessions, "1"));
+
+  auto create_session = [&so](const Environment& env, const std::string& model_bytes,
+                              PrepackedWeightsContainer* container) {
+    auto session = std::make_unique<InferenceSession>(so, env);
+    if (container != nullptr) {
+      EXPECT_STATUS_OK(session->AddPrePackedWeightsContainer(container));
+    }
+    std::stringstream model_stream(model_bytes);
+    EXPECT_STATUS_OK(session->Load(model_stream));
+    EXPECT_STATUS_OK(session->Initialize());
+    return session;
+  };
+
+  // Sessions without a container of their own share the one of their Environment
+  {
+    auto logging_manager = std::make_unique<logging::LoggingManager>(
+        std::make_unique<CLogSink>(), logging::Severity::kWARNING, false, LoggingManager::InstanceType::Temporal);
+    std::unique_ptr<Environment> env;
+    ASSERT_STATUS_OK(Environment::Create(std::move(logging_manager), env));
+
+    auto session_1 = create_session(*env, model_1_bytes, nullptr);
+    auto session_2 = create_session(*env, model_2_bytes, nullptr);
+
+    const auto stats = env->GetSharedWeightsContainer().GetMemoryStats();
+    ASSERT_EQ(stats.num_initializers, static_cast<size_t>(3));
+    ASSERT_EQ(stats.initializers_size_in_bytes, 3 * tensor_bytes);
+    ASSERT_EQ(stats.num_reused_initializers, static_cast<size_t>(1));
+    ASSERT_EQ(stats.reused_initializers_size_in_bytes, tensor_bytes);
+  }
+
+  // The same is reported through the C API for a container created by the user
+  {
+    const OrtApi* api = OrtGetApiBase()->GetApi(ORT_API_VERSION);
+    OrtPrepackedWeightsContainer* container = nullptr;
+    ASSERT_EQ(api->CreatePrepackedWeightsContainer(&container), nullptr);
+    std::unique_ptr<OrtPrepackedWeightsContainer, decltype(api->ReleasePrepackedWeightsContainer)>
+        container_holder(container, api->ReleasePrepackedWeightsContainer);
+
+    size_t num_initializers = 0, initializers_size_in_bytes = 0, deduplicated_size_in_bytes = 0;
+    {
+      auto* weights_container = reinterpret_cast<PrepackedWeightsContainer*>(container);
+      auto session_1 = create_session(GetEnvironment(), model_1_bytes, weights_container);
+      auto session_2 = create_session(GetEnvironment(), model_2_bytes, weights_container);
+
+      ASSERT_EQ(api->PrepackedWeightsContainer_GetMemoryStats(container, &num_initializers,
+                                                              &initializers_size_in_bytes,
+                                                              &deduplicated_size_in_bytes),
+                nullptr);
+      ASSERT_EQ(num_initializers, static_cast<size_t>(3));
+      ASSERT_EQ(initializers_size_in_bytes, 3 * tensor_bytes);
+      ASSERT_EQ(deduplicated_size_in_bytes, tensor_bytes);
+    }
+
+    // the initializers are released with the sessions, the bytes saved are still reported
+    ASSERT_EQ(api->PrepackedWeightsContainer_GetMemoryStats(container, &num_initializers,
+                                                            &initializers_size_in_bytes,
+                                                            &deduplicated_size_in_bytes),
+              nullptr);
+    ASSERT_EQ(num_initializers, static_cast<size_t>(0));
+    ASSERT_EQ(initializers_size_in_bytes, static_cast<size_t>(0));
+    ASSERT_EQ(deduplicated_size_in_bytes, tensor_bytes);
+  }
+}
+#endif  // !defined(ORT_MINIMAL_BUILD)
+
 }  // namespace test
 }  // namespace onnxruntime
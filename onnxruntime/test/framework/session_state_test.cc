@@ -344,6 +344,73 @@ TEST(SessionStateTest, TestInitializerMemoryAllocatedUsingNonArenaMemory) {
   }
 }
 
+// Test that no memory is allocated for an initializer with external data that is used on CPU, as the mmap'd
+// external data is used in place. This should hold with and without memory patterns.
+TEST(SessionStateTest, TestExternalInitializerNotAllocatedOnCpu) {
+  AllocatorPtr cpu_allocator = std::make_shared<CPUAllocator>();
+  for (const bool enable_mem_pattern : {true, false}) {
+    const ORTCHAR_T* model_path = ORT_TSTR("testdata/model_with_external_initializers.onnx");
+    std::shared_ptr<Model> model;
+    ASSERT_STATUS_OK(Model::Load(model_path, model, nullptr, DefaultLoggingManager().DefaultLogger()));
+    Graph& graph = model->MainGraph();
+
+    ExecutionProviders execution_providers;
+    CPUExecutionProviderInfo epi{true};  // use an arena-based allocator for this EP
+    ASSERT_STATUS_OK(execution_providers.Add(onnxruntime::kCpuExecutionProvider,
+                                             std::make_unique<CPUExecutionProvider>(epi)));
+
+    KernelRegistryManager krm;
+    ASSERT_STATUS_OK(krm.RegisterKernels(execution_providers));
+
+    DataTransferManager dtm;
+    profiling::Profiler profiler;
+
+    SessionOptions sess_options;
+    sess_options.enable_mem_pattern = enable_mem_pattern;
+    sess_options.execution_mode = ExecutionMode::ORT_SEQUENTIAL;
+    sess_options.use_deterministic_compute = false;
+    sess_options.enable_mem_reuse = true;
+
+    SessionState session_state(graph, execution_providers, nullptr, nullptr, dtm,
+                               DefaultLoggingManager().DefaultLogger(), profiler, sess_options);
+
+    GraphPartitioner partitioner(krm, execution_providers);
+    ASSERT_STATUS_OK(partitioner.Partition(
+        graph, session_state.GetMutableFuncMgr(),
+        [&cpu_allocator](Graph& graph, bool& modified, const IExecutionProvider& execution_provider,
+                         const layout_transformation::DebugGraphFn& debug_graph_fn) -> Status {
+          return layout_transformation::TransformLayoutForEP(graph, modified, execution_provider,
+                                                             cpu_allocator, debug_graph_fn);
+        },
+        sess_options.config_options,
+        DefaultLoggingManager().DefaultLogger()));
+
+    ASSERT_STATUS_OK(session_state.FinalizeSessionState(model_path, krm));
+
+    int pads_idx;
+    ASSERT_STATUS_OK(session_state.GetOrtValueNameIdxMap().GetIdx("Pads", pads_idx));
+    const auto& initialized_tensors = session_state.GetInitializedTensors();
+    auto pads = initialized_tensors.find(pads_idx);
+    ASSERT_NE(pads, initialized_tensors.cend());
+
+    auto pads_data = pads->second.Get<Tensor>().DataAsSpan<int64_t>();
+    ASSERT_EQ(pads_data.size(), size_t{4});
+    EXPECT_EQ(pads_data[2], 1);
+    EXPECT_EQ(pads_data[3], 1);
+
+    OrtMemoryInfo mem_info(CPU, OrtArenaAllocator);
+    AllocatorPtr alloc = session_state.GetAllocator(mem_info);
+    ASSERT_TRUE(alloc != nullptr);
+
+    AllocatorStats alloc_stats;
+    static_cast<BFCArena*>(alloc.get())->GetStats(&alloc_stats);
+
+    // neither a planned buffer nor a per-tensor buffer should have been created for the initializer
+    EXPECT_EQ(alloc_stats.num_reserves, 0);
+    EXPECT_EQ(alloc_stats.num_allocs, 0);
+  }
+}
+
 #endif
 
 INSTANTIATE_TEST_SUITE_P(SessionStateTests, SessionStateTestP, testing::ValuesIn(param_list));
@@ -983,6 +1050,150 @@ TEST_F(SessionStateTestSharedInitalizersWithPrePacking, test4) {
   ASSERT_EQ(if_node_branches_shared_prepack_counter_2, static_cast<size_t>(2));
 }
 
+// Initializers shared across sessions by content + pre-packed weights container =
+// identical initializers are stored once and their pre-packed weights are cached without AddInitializer
+TEST_F(SessionStateTestSharedInitalizersWithPrePacking, ShareInitializersAcrossSessions) {
+  // Configured like the container the Environment shares between sessions
+  PrepackedWeightsContainer prepacked_weights_container(/*release_unused_weights*/ true);
+
+  auto create_session_state = [&](Model& model, const SessionOptions& sess_options) {
+    CreateSimpleGraph(model.MainGraph());
+    PlaceAllNodesToCPUEP(model.MainGraph());
+    auto session_state = std::make_unique<SessionState>(model.MainGraph(),
+                                                        execution_providers,
+                                                        tp.get(),
+                                                        nullptr, /*inter_op_thread_pool*/
+                                                        dtm,
+                                                        DefaultLoggingManager().DefaultLogger(),
+                                                        profiler,
+                                                        sess_options,
+                                                        &prepacked_weights_container);
+    EXPECT_STATUS_OK(session_state->FinalizeSessionState(std::basic_string<PATH_CHAR_TYPE>(),
+                                                         kernel_registry_manager));
+    return session_state;
+  };
+
+  auto get_initializer_data = [](const SessionState& session_state) -> const void* {
+    int idx = -1;
+    EXPECT_STATUS_OK(session_state.GetOrtValueNameIdxMap().GetIdx("node_0_input_1", idx));
+    return session_state.GetInitializedTensors().at(idx).Get<Tensor>().DataRaw();
+  };
+
+  SessionOptions sess_options;
+  sess_options.enable_mem_pattern = true;
+  sess_options.execution_mode = ExecutionMode::ORT_SEQUENTIAL;
+  sess_options.use_deterministic_compute = false;
+  sess_options.enable_mem_reuse = true;
+  sess_options.config_options.configurations[kOrtSessionOptionsShareInitializersAcrossSessions] = "1";
+
+  // Without pre-packing both sessions hold the initializer, so check they hold the same copy
+  {
+    sess_options.config_options.configurations[kOrtSessionOptionsConfigDisablePrepacking] = "1";
+
+    Model model_1("graph_main", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                  domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                  DefaultLoggingManager().DefaultLogger());
+    auto session_state_1 = create_session_state(model_1, sess_options);
+
+    Model model_2("graph_main", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                  domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                  DefaultLoggingManager().DefaultLogger());
+    auto session_state_2 = create_session_state(model_2, sess_options);
+
+    ASSERT_EQ(get_initializer_data(*session_state_1), get_initializer_data(*session_state_2));
+
+    auto stats = prepacked_weights_container.GetMemoryStats();
+    ASSERT_EQ(stats.num_initializers, static_cast<size_t>(1));
+    ASSERT_EQ(stats.initializers_size_in_bytes, sizeof(float));
+    ASSERT_EQ(stats.num_reused_initializers, static_cast<size_t>(1));
+    ASSERT_EQ(stats.reused_initializers_size_in_bytes, sizeof(float));
+
+    // The container doesn't keep the initializer alive once no session uses it
+    session_state_1.reset();
+    session_state_2.reset();
+    ASSERT_EQ(prepacked_weights_container.GetMemoryStats().num_initializers, static_cast<size_t>(0));
+  }
+
+  // With pre-packing the second session uses the pre-packed weight cached by the first one
+  {
+    sess_options.config_options.configurations[kOrtSessionOptionsConfigDisablePrepacking] = "0";
+
+    Model model_1("graph_main", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                  domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                  DefaultLoggingManager().DefaultLogger());
+    auto session_state_1 = create_session_state(model_1, sess_options);
+    ASSERT_EQ(session_state_1->GetNumberOfPrepacksCounter(), static_cast<size_t>(1));
+    ASSERT_EQ(session_state_1->GetUsedSharedPrePackedWeightCounter(), static_cast<size_t>(0));
+
+    Model model_2("graph_main", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                  domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                  DefaultLoggingManager().DefaultLogger());
+    auto session_state_2 = create_session_state(model_2, sess_options);
+    ASSERT_EQ(session_state_2->GetNumberOfPrepacksCounter(), static_cast<size_t>(1));
+    ASSERT_EQ(session_state_2->GetUsedSharedPrePackedWeightCounter(), static_cast<size_t>(1));
+
+    auto stats = prepacked_weights_container.GetMemoryStats();
+    ASSERT_EQ(stats.num_initializers, static_cast<size_t>(1));
+    ASSERT_EQ(stats.num_prepacked_weights, static_cast<size_t>(1));
+    ASSERT_EQ(stats.prepacked_weights_size_in_bytes, static_cast<size_t>(8));
+
+    // The pre-packed weight is kept while a session still uses it
+    session_state_1.reset();
+    stats = prepacked_weights_container.GetMemoryStats();
+    ASSERT_EQ(stats.num_prepacked_weights, static_cast<size_t>(1));
+    ASSERT_EQ(stats.prepacked_weights_size_in_bytes, static_cast<size_t>(8));
+
+    // and the container shrinks back once the last session using it is destroyed
+    session_state_2.reset();
+    stats = prepacked_weights_container.GetMemoryStats();
+    ASSERT_EQ(stats.num_initializers, static_cast<size_t>(0));
+    ASSERT_EQ(stats.num_prepacked_weights, static_cast<size_t>(0));
+    ASSERT_EQ(stats.prepacked_weights_size_in_bytes, static_cast<size_t>(0));
+
+    // A new session pre-packs the weight again
+    Model model_3("graph_main", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                  domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                  DefaultLoggingManager().DefaultLogger());
+    auto session_state_3 = create_session_state(model_3, sess_options);
+    ASSERT_EQ(session_state_3->GetUsedSharedPrePackedWeightCounter(), static_cast<size_t>(0));
+    ASSERT_EQ(prepacked_weights_container.GetMemoryStats().num_prepacked_weights, static_cast<size_t>(1));
+  }
+}
+
+// A container created without release_unused_weights keeps pre-packed weights after the sessions are destroyed
+TEST_F(SessionStateTestSharedInitalizersWithPrePacking, KeepPrePackedWeightsAfterSessions) {
+  PrepackedWeightsContainer prepacked_weights_container;
+
+  SessionOptions sess_options;
+  sess_options.enable_mem_pattern = true;
+  sess_options.execution_mode = ExecutionMode::ORT_SEQUENTIAL;
+  sess_options.use_deterministic_compute = false;
+  sess_options.enable_mem_reuse = true;
+  sess_options.config_options.configurations[kOrtSessionOptionsShareInitializersAcrossSessions] = "1";
+
+  {
+    Model model("graph_main", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                DefaultLoggingManager().DefaultLogger());
+    CreateSimpleGraph(model.MainGraph());
+    PlaceAllNodesToCPUEP(model.MainGraph());
+    SessionState session_state(model.MainGraph(),
+                               execution_providers,
+                               tp.get(),
+                               nullptr, /*inter_op_thread_pool*/
+                               dtm,
+                               DefaultLoggingManager().DefaultLogger(),
+                               profiler,
+                               sess_options,
+                               &prepacked_weights_container);
+    ASSERT_STATUS_OK(session_state.FinalizeSessionState(std::basic_string<PATH_CHAR_TYPE>(),
+                                                        kernel_registry_manager));
+    ASSERT_EQ(session_state.GetNumberOfPrepacksCounter(), static_cast<size_t>(1));
+  }
+
+  ASSERT_EQ(prepacked_weights_container.GetNumberOfElements(), static_cast<size_t>(1));
+}
+
 INSTANTIATE_TEST_SUITE_P(SessionStateTests,
                          SessionStatePrepackingTest,
                          testing::Values(PrepackingTestParam{false, false},
@@ -0,0 +1,87 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "mlas.h"
+#include "bench_util.h"
+
+#include <cstdint>
+#include <stdexcept>
+
+static const std::vector<std::string> sparse_sgemm_bench_arg_names = {"M", "N", "K", "Sparsity"};
+
+// Returns B of K x N with the given percentage of its 1x16 blocks set to zero.
+static std::vector<float> RandomBlockSparseB(size_t N, size_t K, int64_t sparsity_percent) {
+  std::vector<float> B = RandomVectorUniform(N * K, -1.0f, 1.0f);
+  std::default_random_engine generator(static_cast<unsigned>(N * K));
+  std::uniform_int_distribution<int64_t> distribution(0, 99);
+  for (size_t k = 0; k < K; k++) {
+    for (size_t n = 0; n < N; n += 16) {
+      if (distribution(generator) < sparsity_percent) {
+        std::fill_n(B.begin() + k * N + n, std::min<size_t>(16, N - n), 0.0f);
+      }
+    }
+  }
+  return B;
+}
+
+// Returns the start of buffer, grown to hold size bytes at the preferred alignment of the packed formats.
+static void* AlignedPackBuffer(std::vector<uint8_t>& buffer, size_t size) {
+  const size_t alignment = MlasGetPreferredBufferAlignment();
+  buffer.resize(size + alignment);
+  return buffer.data() + (alignment - reinterpret_cast<uintptr_t>(buffer.data()) % alignment);
+}
+
+// Compares the block sparse SGEMM with the dense SGEMM on packed B for the same pruned matrix. Both run on the
+// calling thread so that the numbers compare the kernels. The sparsity where the two cross is what the default of
+// "mlas.sparse_gemm_block_sparsity_threshold" is based on.
+void SPARSE_SGEMM(benchmark::State& state, bool sparse) {
+  if (state.range(0) <= 0) throw std::invalid_argument("M must greater than 0!");
+  if (state.range(1) <= 0) throw std::invalid_argument("N must greater than 0!");
+  if (state.range(2) <= 0) throw std::invalid_argument("K must greater than 0!");
+  if (state.range(3) < 0 || state.range(3) > 100) throw std::invalid_argument("Sparsity must be in [0, 100]!");
+  const size_t M = static_cast<size_t>(state.range(0));
+  const size_t N = static_cast<size_t>(state.range(1));
+  const size_t K = static_cast<size_t>(state.range(2));
+
+  auto A = RandomVectorUniform(static_cast<size_t>(M * K), -1.0f, 1.0f);
+  auto B = RandomBlockSparseB(N, K, state.range(3));
+  std::vector<float> C(static_cast<size_t>(M * N));
+
+  std::vector<uint8_t> packed_b_buffer;
+
+  if (sparse) {
+    void* packed_b = AlignedPackBuffer(packed_b_buffer, MlasSparseGemmPackBSize(N, K));
+    MlasSparseGemmPackB(CblasNoTrans, N, K, B.data(), N, packed_b);
+
+    MLAS_SGEMM_DATA_PARAMS data;
+    data.A = A.data();
+    data.lda = K;
+    data.B = static_cast<const float*>(packed_b);
+    data.C = C.data();
+    data.ldc = N;
+
+    MlasSparseGemmBatch(CblasNoTrans, M, N, K, &data, 1, nullptr);
+
+    for (auto _ : state) {
+      MlasSparseGemmBatch(CblasNoTrans, M, N, K, &data, 1, nullptr);
+    }
+
+  } else {
+    void* packed_b = AlignedPackBuffer(packed_b_buffer, MlasGemmPackBSize(N, K));
+    MlasGemmPackB(CblasNoTrans, N, K, B.data(), N, packed_b);
+
+    MlasGemm(CblasNoTrans, M, N, K, 1.0f, A.data(), K, packed_b, 0.0f, C.data(), N, nullptr);
+
+    for (auto _ : state) {
+      MlasGemm(CblasNoTrans, M, N, K, 1.0f, A.data(), K, packed_b, 0.0f, C.data(), N, nullptr);
+    }
+  }
+}
+
+static void SparseGemmSizeProducts(benchmark::internal::Benchmark* b) {
+  b->ArgNames(sparse_sgemm_bench_arg_names);
+  b->ArgsProduct({{1, 16, 128}, {1024, 4096}, {1024, 4096}, {0, 50, 60, 70, 80, 85, 90, 95}});
+}
+
+BENCHMARK_CAPTURE(SPARSE_SGEMM, DENSE, false)->Apply(SparseGemmSizeProducts)->UseRealTime();
+BENCHMARK_CAPTURE(SPARSE_SGEMM, SPARSE, true)->Apply(SparseGemmSizeProducts)->UseRealTime();
@@ -0,0 +1,131 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+#include <cstring>
+
+class MlasCastTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferFloat;
+  MatrixGuardBuffer<float> BufferFloatOutput;
+  MatrixGuardBuffer<unsigned short> BufferBFloat16;
+  MatrixGuardBuffer<int32_t> BufferInt32;
+  MatrixGuardBuffer<int32_t> BufferInt32Output;
+
+  static uint32_t FloatBits(float Value) {
+    uint32_t Bits;
+    std::memcpy(&Bits, &Value, sizeof(Bits));
+    return Bits;
+  }
+
+  static float FloatFromBits(uint32_t Bits) {
+    float Value;
+    std::memcpy(&Value, &Bits, sizeof(Value));
+    return Value;
+  }
+
+  static unsigned short ReferenceFloatToBFloat16(float Value) {
+    const uint32_t Bits = FloatBits(Value);
+    if (std::isnan(Value)) {
+      return static_cast<unsigned short>((Bits >> 16) | 0x0040);
+    }
+    const uint32_t Upper = Bits >> 16;
+    const uint32_t Lower = Bits & 0xFFFF;
+    if (Lower > 0x8000 || (Lower == 0x8000 && (Upper & 1) != 0)) {
+      return static_cast<unsigned short>(Upper + 1);
+    }
+    return static_cast<unsigned short>(Upper);
+  }
+
+  void TestBFloat16(size_t N) {
+    float* Input = BufferFloat.GetBuffer(N);
+    unsigned short* BFloat16 = BufferBFloat16.GetBuffer(N);
+    float* Output = BufferFloatOutput.GetBuffer(N);
+
+    // Random bit patterns cover every exponent, including denormals, infinities and NaNs, and the rounding ties.
+    std::default_random_engine generator(static_cast<unsigned>(N));
+    std::uniform_int_distribution<uint32_t> bits_distribution;
+    std::uniform_int_distribution<int> tie_distribution(0, 3);
+    for (size_t n = 0; n < N; n++) {
+      uint32_t Bits = bits_distribution(generator);
+      if (tie_distribution(generator) == 0) {
+        Bits = (Bits & 0xFFFF0000) | 0x8000;
+      }
+      Input[n] = FloatFromBits(Bits);
+    }
+
+    MlasConvertFloatToBFloat16Buffer(Input, BFloat16, N);
+
+    for (size_t n = 0; n < N; n++) {
+      ASSERT_EQ(BFloat16[n], ReferenceFloatToBFloat16(Input[n]))
+          << " @" << n << " of " << N << ", input bits 0x" << std::hex << FloatBits(Input[n]);
+    }
+
+    MlasConvertBFloat16ToFloatBuffer(BFloat16, Output, N);
+
+    for (size_t n = 0; n < N; n++) {
+      ASSERT_EQ(FloatBits(Output[n]), uint32_t(BFloat16[n]) << 16) << " @" << n << " of " << N;
+    }
+  }
+
+  void TestInt32(size_t N) {
+    int32_t* Int32 = BufferInt32.GetBuffer(N);
+    float* Float = BufferFloat.GetBuffer(N);
+    int32_t* Int32Output = BufferInt32Output.GetBuffer(N);
+
+    std::default_random_engine generator(static_cast<unsigned>(N));
+    std::uniform_int_distribution<int32_t> int_distribution(std::numeric_limits<int32_t>::min(),
+                                                            std::numeric_limits<int32_t>::max());
+    for (size_t n = 0; n < N; n++) {
+      Int32[n] = int_distribution(generator);
+    }
+
+    MlasConvertInt32ToFloatBuffer(Int32, Float, N);
+
+    for (size_t n = 0; n < N; n++) {
+      ASSERT_EQ(Float[n], static_cast<float>(Int32[n])) << " @" << n << " of " << N;
+    }
+
+    // 2^31 is not representable as int32, so stay within the range below it.
+    std::uniform_real_distribution<float> float_distribution(-2147483520.0f, 2147483520.0f);
+    std::uniform_real_distribution<float> small_distribution(-100.0f, 100.0f);
+    for (size_t n = 0; n < N; n++) {
+      Float[n] = n % 2 == 0 ? float_distribution(generator) : small_distribution(generator);
+    }
+
+    MlasConvertFloatToInt32Buffer(Float, Int32Output, N);
+
+    for (size_t n = 0; n < N; n++) {
+      ASSERT_EQ(Int32Output[n], static_cast<int32_t>(Float[n])) << " @" << n << " of " << N << ", input " << Float[n];
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name("Cast");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    for (size_t n = 1; n < 128; n++) {
+      TestBFloat16(n);
+      TestInt32(n);
+    }
+    TestBFloat16(4099);
+    TestInt32(4099);
+  }
+};
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  return is_short_execute ? MlasDirectShortExecuteTests<MlasCastTest>::RegisterShortExecute() : 0;
+});
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
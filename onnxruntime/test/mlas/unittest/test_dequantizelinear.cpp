@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <typename QuantInt>
+class MlasDequantizeLinearTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<QuantInt> BufferInput;
+  MatrixGuardBuffer<float> BufferOutput;
+  MatrixGuardBuffer<float> BufferOutputReference;
+
+  void GenerateReference(const QuantInt* Input, float* OutputReference, size_t N, float Scale, QuantInt ZeroPoint) {
+    for (size_t n = 0; n < N; n++) {
+      OutputReference[n] = float(int32_t(Input[n]) - int32_t(ZeroPoint)) * Scale;
+    }
+  }
+
+  void Test(size_t N) {
+    QuantInt* Input = BufferInput.GetBuffer(N);
+    float* Output = BufferOutput.GetBuffer(N);
+    float* OutputReference = BufferOutputReference.GetBuffer(N);
+
+    std::default_random_engine generator(static_cast<unsigned>(N));
+
+    std::uniform_real_distribution<float> scale_distribution(10e-4f, 1.f);
+    float Scale = scale_distribution(generator);
+
+    // Halve the int32 range so that the difference to the zero point does not overflow.
+    constexpr int32_t MinimumValue = std::is_same_v<QuantInt, int32_t> ? std::numeric_limits<int32_t>::min() / 2
+                                                                       : std::numeric_limits<QuantInt>::min();
+    constexpr int32_t MaximumValue = std::is_same_v<QuantInt, int32_t> ? std::numeric_limits<int32_t>::max() / 2
+                                                                       : std::numeric_limits<QuantInt>::max();
+    std::uniform_int_distribution<int32_t> distribution(MinimumValue, MaximumValue);
+    QuantInt ZeroPoint = static_cast<QuantInt>(distribution(generator));
+
+    for (size_t n = 0; n < N; n++) {
+      Input[n] = static_cast<QuantInt>(distribution(generator));
+    }
+
+    GenerateReference(Input, OutputReference, N, Scale, ZeroPoint);
+    MlasDequantizeLinear(Input, Output, N, Scale, ZeroPoint);
+
+    for (size_t n = 0; n < N; n++) {
+      ASSERT_EQ(Output[n], OutputReference[n]) << ", size=" << N << ", index=" << n;
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    if constexpr (std::is_same_v<QuantInt, int8_t>) {
+      return "DequantizeLinearS8";
+    } else if (std::is_same_v<QuantInt, uint8_t>) {
+      return "DequantizeLinearU8";
+    } else if (std::is_same_v<QuantInt, int16_t>) {
+      return "DequantizeLinearS16";
+    } else if (std::is_same_v<QuantInt, uint16_t>) {
+      return "DequantizeLinearU16";
+    } else {
+      return "DequantizeLinearS32";
+    }
+  }
+
+  void ExecuteShort(void) override {
+    for (size_t n = 1; n <= 512; n++) {
+      Test(n);
+    }
+  }
+};
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasDequantizeLinearTest<int8_t>>::RegisterShortExecute();
+    count += MlasDirectShortExecuteTests<MlasDequantizeLinearTest<uint8_t>>::RegisterShortExecute();
+    count += MlasDirectShortExecuteTests<MlasDequantizeLinearTest<int16_t>>::RegisterShortExecute();
+    count += MlasDirectShortExecuteTests<MlasDequantizeLinearTest<uint16_t>>::RegisterShortExecute();
+    count += MlasDirectShortExecuteTests<MlasDequantizeLinearTest<int32_t>>::RegisterShortExecute();
+  }
+  return count;
+});
@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <bool Threaded>
+class MlasGroupedGemmTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferA;
+  MatrixGuardBuffer<float> BufferB;
+  MatrixGuardBuffer<float> BufferC;
+  MatrixGuardBuffer<float> BufferCReference;
+  MLAS_THREADPOOL* threadpool_;
+
+  void Test(const std::vector<size_t>& M, size_t N, size_t K, bool TransA, bool TransB, float alpha, float beta) {
+    const size_t GroupCount = M.size();
+
+    size_t TotalM = 0;
+    for (size_t g = 0; g < GroupCount; g++) {
+      TotalM += M[g];
+    }
+
+    //
+    // The groups are laid out back to back like the tokens of the experts of a
+    // mixture of experts layer, and every group has its own matrix B.
+    //
+
+    float* A = BufferA.GetBuffer(TotalM * K);
+    float* B = BufferB.GetBuffer(GroupCount * K * N);
+    float* C = BufferC.GetBuffer(TotalM * N);
+    float* CReference = BufferCReference.GetBuffer(TotalM * N);
+
+    std::default_random_engine generator(static_cast<unsigned>(TotalM * N * K + GroupCount));
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+    for (size_t i = 0; i < TotalM * K; i++) {
+      A[i] = distribution(generator);
+    }
+    for (size_t i = 0; i < GroupCount * K * N; i++) {
+      B[i] = distribution(generator);
+    }
+    for (size_t i = 0; i < TotalM * N; i++) {
+      C[i] = distribution(generator);
+      CReference[i] = C[i];
+    }
+
+    std::vector<MLAS_SGEMM_DATA_PARAMS> Data(GroupCount);
+    size_t RowOffset = 0;
+    for (size_t g = 0; g < GroupCount; g++) {
+      Data[g].A = A + RowOffset * K;
+      Data[g].lda = TransA ? M[g] : K;
+      Data[g].B = B + g * K * N;
+      Data[g].ldb = TransB ? K : N;
+      Data[g].C = C + RowOffset * N;
+      Data[g].ldc = N;
+      Data[g].alpha = alpha;
+      Data[g].beta = beta;
+      RowOffset += M[g];
+    }
+
+    MlasGemmGroupedBatch(TransA ? CblasTrans : CblasNoTrans, TransB ? CblasTrans : CblasNoTrans,
+                         M.data(), N, K, Data.data(), GroupCount, threadpool_);
+
+    for (size_t g = 0; g < GroupCount; g++) {
+      ReferenceGemm(M[g], N, K, TransA, TransB, Data[g].A, Data[g].lda, Data[g].B, Data[g].ldb, alpha, beta,
+                    CReference + (Data[g].C - C));
+    }
+
+    for (size_t i = 0; i < TotalM * N; i++) {
+      ASSERT_NEAR(C[i], CReference[i], 1e-4f)
+          << "@" << i << " of " << TotalM * N << " Groups=" << GroupCount << " N=" << N << " K=" << K
+          << " TransA=" << TransA << " TransB=" << TransB;
+    }
+  }
+
+  void ReferenceGemm(size_t M, size_t N, size_t K, bool TransA, bool TransB,
+                     const float* A, size_t lda, const float* B, size_t ldb,
+                     float alpha, float beta, float* C) {
+    for (size_t m = 0; m < M; m++) {
+      for (size_t n = 0; n < N; n++) {
+        double Sum = 0.0;
+        for (size_t k = 0; k < K; k++) {
+          const float AValue = TransA ? A[k * lda + m] : A[m * lda + k];
+          const float BValue = TransB ? B[n * ldb + k] : B[k * ldb + n];
+          Sum += double(AValue) * double(BValue);
+        }
+        const float Result = alpha * float(Sum);
+        C[m * N + n] = (beta != 0.0f) ? Result + beta * C[m * N + n] : Result;
+      }
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name(Threaded ? "GroupedGemm_Threaded" : "GroupedGemm_SingleThread");
+    return suite_name.c_str();
+  }
+
+  MlasGroupedGemmTest() : threadpool_(Threaded ? GetMlasThreadPool() : nullptr) {}
+
+  void ExecuteShort(void) override {
+    for (bool TransA : {false, true}) {
+      for (bool TransB : {false, true}) {
+        Test({3, 0, 5, 1, 0, 7}, 19, 13, TransA, TransB, 1.0f, 0.0f);
+        Test({0, 0, 0}, 8, 8, TransA, TransB, 1.0f, 0.0f);
+        Test({100, 1, 37, 0, 64}, 300, 70, TransA, TransB, 1.0f, 0.5f);
+        Test({1, 2}, 600, 33, TransA, TransB, 0.5f, 1.0f);
+        Test({200, 150, 300}, 40, 128, TransA, TransB, 1.0f, 0.0f);
+      }
+    }
+
+    Test({16, 0, 48, 3, 64, 1, 0, 124}, 1024, 256, false, true, 1.0f, 0.0f);
+  }
+};
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasGroupedGemmTest<false>>::RegisterShortExecute();
+    if (GetMlasThreadPool() != nullptr) {
+      count += MlasDirectShortExecuteTests<MlasGroupedGemmTest<true>>::RegisterShortExecute();
+    }
+  }
+  return count;
+});
@@ -0,0 +1,217 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_fp16.h"
+
+template <bool Threaded>
+class MlasLayerNormTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferInput;
+  MatrixGuardBuffer<float> BufferSkip;
+  MatrixGuardBuffer<float> BufferParameters;
+  MatrixGuardBuffer<float> BufferOutput;
+  MatrixGuardBuffer<float> BufferOutputReference;
+  MatrixGuardBuffer<float> BufferSum;
+  MatrixGuardBuffer<float> BufferSumReference;
+  MatrixGuardBuffer<float> BufferInvStdDev;
+  MatrixGuardBuffer<float> BufferInvStdDevReference;
+  MatrixGuardBuffer<MLFp16> BufferInputFp16;
+  MatrixGuardBuffer<MLFp16> BufferSkipFp16;
+  MatrixGuardBuffer<MLFp16> BufferParametersFp16;
+  MatrixGuardBuffer<MLFp16> BufferOutputFp16;
+  MatrixGuardBuffer<uint8_t> BufferOutputQuantized;
+  MLAS_THREADPOOL* threadpool_;
+
+  void Test(size_t N, size_t D, size_t SkipRows, bool Simplified) {
+    float* Input = BufferInput.GetBuffer(N * D);
+    float* Skip = BufferSkip.GetBuffer(SkipRows * D + 1);
+    float* Parameters = BufferParameters.GetBuffer(3 * D);
+    float* Output = BufferOutput.GetBuffer(N * D);
+    float* OutputReference = BufferOutputReference.GetBuffer(N * D);
+    float* Sum = BufferSum.GetBuffer(N * D);
+    float* SumReference = BufferSumReference.GetBuffer(N * D);
+    float* InvStdDev = BufferInvStdDev.GetBuffer(N);
+    float* InvStdDevReference = BufferInvStdDevReference.GetBuffer(N);
+
+    std::default_random_engine generator(static_cast<unsigned>(N * D + SkipRows));
+    std::uniform_real_distribution<float> distribution(-4.f, 6.f);
+
+    for (size_t nd = 0; nd < N * D; nd++) {
+      Input[nd] = distribution(generator);
+    }
+    for (size_t nd = 0; nd < SkipRows * D; nd++) {
+      Skip[nd] = distribution(generator);
+    }
+    for (size_t d = 0; d < 3 * D; d++) {
+      Parameters[d] = distribution(generator);
+    }
+
+    MLAS_LAYER_NORM_PARAMS<float> Params;
+    Params.Scale = Parameters;
+    Params.Bias = Simplified ? nullptr : Parameters + D;
+    Params.InvStdDev = InvStdDev;
+    Params.Epsilon = 1e-5f;
+    Params.Simplified = Simplified;
+    if (SkipRows != 0) {
+      Params.Skip = Skip;
+      Params.SkipRows = SkipRows;
+      Params.SkipBias = Parameters + 2 * D;
+      Params.SumOutput = Sum;
+    }
+
+    ReferenceLayerNorm(Input, OutputReference, SumReference, InvStdDevReference, N, D, Params);
+
+    MlasLayerNormalization(Input, Output, N, D, Params, threadpool_);
+    Compare(Output, OutputReference, N * D, 1e-4f, "Output", N, D);
+    Compare(InvStdDev, InvStdDevReference, N, 1e-4f, "InvStdDev", N, D);
+    if (SkipRows != 0) {
+      Compare(Sum, SumReference, N * D, 1e-6f, "Sum", N, D);
+    }
+
+    //
+    // Quantize the normalized values to uint8 in the same pass.
+    //
+
+    uint8_t* OutputQuantized = BufferOutputQuantized.GetBuffer(N * D);
+    Params.OutputScale = 0.05f;
+    Params.OutputZeroPoint = 128;
+    MlasLayerNormalization(Input, OutputQuantized, N, D, Params, threadpool_);
+
+    for (size_t nd = 0; nd < N * D; nd++) {
+      float q = std::nearbyint(OutputReference[nd] / Params.OutputScale) + Params.OutputZeroPoint;
+      q = (std::min)((std::max)(q, 0.f), 255.f);
+      ASSERT_LE(std::fabs(q - float(OutputQuantized[nd])), 1.f)
+          << "Quantized difference " << N << "/" << D << " @" << nd
+          << ", got: " << int(OutputQuantized[nd]) << ", expecting: " << q;
+    }
+
+    //
+    // Read and write the rows as fp16.
+    //
+
+    MLFp16* InputFp16 = BufferInputFp16.GetBuffer(N * D);
+    MLFp16* SkipFp16 = BufferSkipFp16.GetBuffer(SkipRows * D + 1);
+    MLFp16* ParametersFp16 = BufferParametersFp16.GetBuffer(3 * D);
+    MLFp16* OutputFp16 = BufferOutputFp16.GetBuffer(N * D);
+
+    for (size_t nd = 0; nd < N * D; nd++) {
+      InputFp16[nd] = MLFp16(Input[nd]);
+      Input[nd] = float(InputFp16[nd]);
+    }
+    for (size_t nd = 0; nd < SkipRows * D; nd++) {
+      SkipFp16[nd] = MLFp16(Skip[nd]);
+      Skip[nd] = float(SkipFp16[nd]);
+    }
+    for (size_t d = 0; d < 3 * D; d++) {
+      ParametersFp16[d] = MLFp16(Parameters[d]);
+      Parameters[d] = float(ParametersFp16[d]);
+    }
+
+    Params.OutputScale = 1.0f;
+    Params.OutputZeroPoint = 0;
+    Params.SumOutput = nullptr;
+    ReferenceLayerNorm(Input, OutputReference, SumReference, InvStdDevReference, N, D, Params);
+
+    MLAS_LAYER_NORM_PARAMS<MLAS_FP16> ParamsFp16;
+    ParamsFp16.Scale = reinterpret_cast<const MLAS_FP16*>(ParametersFp16);
+    ParamsFp16.Bias = Simplified ? nullptr : reinterpret_cast<const MLAS_FP16*>(ParametersFp16 + D);
+    ParamsFp16.InvStdDev = InvStdDev;
+    ParamsFp16.Epsilon = Params.Epsilon;
+    ParamsFp16.Simplified = Simplified;
+    if (SkipRows != 0) {
+      ParamsFp16.Skip = reinterpret_cast<const MLAS_FP16*>(SkipFp16);
+      ParamsFp16.SkipRows = SkipRows;
+      ParamsFp16.SkipBias = reinterpret_cast<const MLAS_FP16*>(ParametersFp16 + 2 * D);
+    }
+
+    MlasLayerNormalization(reinterpret_cast<const MLAS_FP16*>(InputFp16), reinterpret_cast<MLAS_FP16*>(OutputFp16),
+                           N, D, ParamsFp16, threadpool_);
+
+    for (size_t nd = 0; nd < N * D; nd++) {
+      Output[nd] = float(OutputFp16[nd]);
+    }
+    Compare(Output, OutputReference, N * D, 1e-2f, "OutputFp16", N, D);
+    Compare(InvStdDev, InvStdDevReference, N, 1e-4f, "InvStdDevFp16", N, D);
+  }
+
+  void Compare(const float* Output, const float* OutputReference, size_t Count, float Tolerance,
+               const char* What, size_t N, size_t D) {
+    for (size_t i = 0; i < Count; i++) {
+      float diff = std::fabs(Output[i] - OutputReference[i]);
+      ASSERT_TRUE(diff <= Tolerance || diff <= std::fabs(OutputReference[i]) * Tolerance)
+          << What << " difference " << N << "/" << D << " @" << i
+          << ", got: " << Output[i] << ", expecting: " << OutputReference[i];
+    }
+  }
+
+  void ReferenceLayerNorm(const float* Input, float* Output, float* Sum, float* InvStdDev, size_t N, size_t D,
+                          const MLAS_LAYER_NORM_PARAMS<float>& Params) {
+    for (size_t n = 0; n < N; n++) {
+      float* Row = Sum + n * D;
+
+      for (size_t d = 0; d < D; d++) {
+        Row[d] = Input[n * D + d];
+        if (Params.Skip != nullptr) {
+          Row[d] += Params.Skip[(n % Params.SkipRows) * D + d] + Params.SkipBias[d];
+        }
+      }
+
+      double Mean = 0.0;
+      if (!Params.Simplified) {
+        for (size_t d = 0; d < D; d++) {
+          Mean += Row[d];
+        }
+        Mean /= D;
+      }
+
+      double Variance = 0.0;
+      for (size_t d = 0; d < D; d++) {
+        Variance += (Row[d] - Mean) * (Row[d] - Mean);
+      }
+      Variance /= D;
+
+      double Inverse = 1.0 / std::sqrt(Variance + Params.Epsilon);
+      InvStdDev[n] = float(Inverse);
+
+      for (size_t d = 0; d < D; d++) {
+        double Value = (Row[d] - Mean) * Inverse * Params.Scale[d];
+        if (Params.Bias != nullptr) {
+          Value += Params.Bias[d];
+        }
+        Output[n * D + d] = float(Value);
+      }
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name(Threaded ? "LayerNorm_Threaded" : "LayerNorm_SingleThread");
+    return suite_name.c_str();
+  }
+
+  MlasLayerNormTest() : threadpool_(Threaded ? GetMlasThreadPool() : nullptr) {}
+
+  void ExecuteShort(void) override {
+    for (size_t d = 1; d < 70; d++) {
+      Test(1, d, 0, false);
+      Test(3, d, 1, true);
+    }
+
+    Test(16, 211, 0, true);
+    Test(16, 211, 16, false);
+    Test(63, 768, 0, false);
+    Test(64, 1031, 8, false);
+    Test(64, 1031, 8, true);
+  }
+};
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasLayerNormTest<false>>::RegisterShortExecute();
+    if (GetMlasThreadPool() != nullptr) {
+      count += MlasDirectShortExecuteTests<MlasLayerNormTest<true>>::RegisterShortExecute();
+    }
+  }
+  return count;
+});
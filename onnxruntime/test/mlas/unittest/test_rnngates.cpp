@@ -0,0 +1,117 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+class MlasLstmGatesTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferGates;
+  MatrixGuardBuffer<float> BufferBias;
+  MatrixGuardBuffer<float> BufferCellState;
+  MatrixGuardBuffer<float> BufferHiddenState;
+  MatrixGuardBuffer<float> BufferCellStateReference;
+  MatrixGuardBuffer<float> BufferHiddenStateReference;
+
+  void Test(size_t HiddenSize, bool HasBias, float Clip, float MinimumValue, float MaximumValue) {
+    float* Gates = BufferGates.GetBuffer(4 * HiddenSize);
+    float* Bias = HasBias ? BufferBias.GetBuffer(4 * HiddenSize) : nullptr;
+    float* CellState = BufferCellState.GetBuffer(HiddenSize);
+    float* HiddenState = BufferHiddenState.GetBuffer(HiddenSize);
+    float* CellStateReference = BufferCellStateReference.GetBuffer(HiddenSize);
+    float* HiddenStateReference = BufferHiddenStateReference.GetBuffer(HiddenSize);
+
+    std::default_random_engine generator(static_cast<unsigned>(HiddenSize * 4 + (HasBias ? 1 : 0)));
+    std::uniform_real_distribution<float> distribution(MinimumValue, MaximumValue);
+
+    for (size_t n = 0; n < 4 * HiddenSize; n++) {
+      Gates[n] = distribution(generator);
+      if (HasBias) {
+        Bias[n] = distribution(generator) * 0.5f;
+      }
+    }
+
+    for (size_t n = 0; n < HiddenSize; n++) {
+      CellState[n] = distribution(generator);
+      CellStateReference[n] = CellState[n];
+    }
+
+    MlasLstmGates(Gates, Bias, CellState, HiddenState, Clip, HiddenSize);
+    ReferenceLstmGates(Gates, Bias, CellStateReference, HiddenStateReference, Clip, HiddenSize);
+
+    // MlasComputeLogistic and MlasComputeTanh may use kernels with fused multiply add, so the saturated gate
+    // values round differently and the difference is scaled by the cell state.
+    constexpr float AbsoluteTolerance = 1e-5f;
+    constexpr float RelativeTolerance = 1e-5f;
+
+    for (size_t n = 0; n < HiddenSize; n++) {
+      float CellDiff = std::fabs(CellState[n] - CellStateReference[n]);
+      ASSERT_TRUE(CellDiff <= AbsoluteTolerance || CellDiff <= std::fabs(CellStateReference[n]) * RelativeTolerance)
+          << "Cell state @" << n << " of " << HiddenSize << " HasBias=" << HasBias << " Clip=" << Clip
+          << ", got: " << CellState[n] << ", expecting: " << CellStateReference[n];
+
+      float HiddenDiff = std::fabs(HiddenState[n] - HiddenStateReference[n]);
+      ASSERT_TRUE(HiddenDiff <= AbsoluteTolerance ||
+                  HiddenDiff <= std::fabs(HiddenStateReference[n]) * RelativeTolerance)
+          << "Hidden state @" << n << " of " << HiddenSize << " HasBias=" << HasBias << " Clip=" << Clip
+          << ", got: " << HiddenState[n] << ", expecting: " << HiddenStateReference[n];
+    }
+  }
+
+  //
+  // The reference applies the activations one gate at a time with
+  // MlasComputeLogistic and MlasComputeTanh, like the unfused LSTM path.
+  //
+
+  void ReferenceLstmGates(const float* Gates, const float* Bias, float* CellState, float* HiddenState,
+                          float Clip, size_t HiddenSize) {
+    std::vector<float> GateValues(4 * HiddenSize);
+    for (size_t n = 0; n < 4 * HiddenSize; n++) {
+      float Value = Gates[n] + (Bias != nullptr ? Bias[n] : 0.0f);
+      GateValues[n] = (std::max)(-Clip, (std::min)(Clip, Value));
+    }
+
+    // the gates are laid out as input, output, forget and cell
+    float* i = GateValues.data();
+    float* o = i + HiddenSize;
+    float* f = o + HiddenSize;
+    float* c = f + HiddenSize;
+
+    MlasComputeLogistic(i, i, 3 * HiddenSize);
+    MlasComputeTanh(c, c, HiddenSize);
+
+    for (size_t n = 0; n < HiddenSize; n++) {
+      CellState[n] = CellState[n] * f[n] + i[n] * c[n];
+    }
+
+    MlasComputeTanh(CellState, HiddenState, HiddenSize);
+
+    for (size_t n = 0; n < HiddenSize; n++) {
+      HiddenState[n] *= o[n];
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name("LstmGates");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    for (size_t n = 1; n < 40; n++) {
+      Test(n, false, std::numeric_limits<float>::max(), -5.f, 5.f);
+      Test(n, true, std::numeric_limits<float>::max(), -5.f, 5.f);
+    }
+
+    Test(64, true, 3.f, -10.f, 10.f);
+    Test(257, true, std::numeric_limits<float>::max(), -30.f, 30.f);
+    Test(1023, false, 1.f, -2.f, 2.f);
+  }
+};
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasLstmGatesTest>::RegisterShortExecute();
+  }
+  return count;
+});
@@ -0,0 +1,214 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <bool Threaded>
+class MlasSparseGemmTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferA;
+  MatrixGuardBuffer<float> BufferB;
+  MatrixGuardBuffer<uint8_t> BufferPackedB;
+  MatrixGuardBuffer<uint8_t> BufferCompactB;
+  MatrixGuardBuffer<float> BufferC;
+  MatrixGuardBuffer<float> BufferCReference;
+  MLAS_THREADPOOL* threadpool_;
+
+  void Test(size_t BatchSize, size_t M, size_t N, size_t K, bool TransA, bool TransB,
+            float Sparsity, float alpha, float beta) {
+    const size_t lda = TransA ? M : K;
+    const size_t ldb = TransB ? K : N;
+
+    float* A = BufferA.GetBuffer(BatchSize * M * K);
+    float* B = BufferB.GetBuffer(K * N);
+    float* C = BufferC.GetBuffer(BatchSize * M * N);
+    float* CReference = BufferCReference.GetBuffer(BatchSize * M * N);
+
+    std::default_random_engine generator(static_cast<unsigned>(M * N * K + BatchSize));
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    std::uniform_real_distribution<float> block_distribution(0.f, 1.f);
+
+    for (size_t i = 0; i < BatchSize * M * K; i++) {
+      A[i] = distribution(generator);
+    }
+
+    //
+    // Prune B in the 1x16 blocks of the packed format, and zero some single
+    // elements of the kept blocks as well.
+    //
+
+    size_t ZeroBlockCount = 0;
+    size_t TotalBlockCount = 0;
+    for (size_t k = 0; k < K; k++) {
+      for (size_t n = 0; n < N; n += 16) {
+        const bool KeepBlock = block_distribution(generator) >= Sparsity;
+        bool NonZero = false;
+        for (size_t i = n; i < std::min(N, n + 16); i++) {
+          float Value = KeepBlock ? distribution(generator) : 0.0f;
+          if (block_distribution(generator) < 0.1f) {
+            Value = 0.0f;
+          }
+          NonZero = NonZero || Value != 0.0f;
+          (TransB ? B[i * ldb + k] : B[k * ldb + i]) = Value;
+        }
+        ZeroBlockCount += NonZero ? 0 : 1;
+        TotalBlockCount++;
+      }
+    }
+
+    for (size_t i = 0; i < BatchSize * M * N; i++) {
+      C[i] = distribution(generator);
+      CReference[i] = C[i];
+    }
+
+    const CBLAS_TRANSPOSE TransposeA = TransA ? CblasTrans : CblasNoTrans;
+    const CBLAS_TRANSPOSE TransposeB = TransB ? CblasTrans : CblasNoTrans;
+
+    const size_t PackedBSize = MlasSparseGemmPackBSize(N, K);
+    ASSERT_GT(PackedBSize, size_t(0));
+
+    void* PackedB = BufferPackedB.GetBuffer(PackedBSize, true);
+    const size_t UsedPackedBSize = MlasSparseGemmPackB(TransposeB, N, K, B, ldb, PackedB);
+    ASSERT_LE(UsedPackedBSize, PackedBSize);
+
+    const float BlockSparsity = MlasSparseGemmPackedBBlockSparsity(PackedB);
+    ASSERT_EQ(BlockSparsity, float(ZeroBlockCount) / float(TotalBlockCount))
+        << "M=" << M << " N=" << N << " K=" << K;
+
+    //
+    // Multiply with a copy of the used prefix of the packing buffer, which is
+    // placed against a guard page so any access past it faults.
+    //
+
+    uint8_t* CompactB = BufferCompactB.GetBuffer(UsedPackedBSize);
+    std::copy_n(static_cast<const uint8_t*>(PackedB), UsedPackedBSize, CompactB);
+    PackedB = CompactB;
+
+    std::vector<MLAS_SGEMM_DATA_PARAMS> Data(BatchSize);
+    for (size_t b = 0; b < BatchSize; b++) {
+      Data[b].A = A + b * M * K;
+      Data[b].lda = lda;
+      Data[b].B = static_cast<const float*>(PackedB);
+      Data[b].C = C + b * M * N;
+      Data[b].ldc = N;
+      Data[b].alpha = alpha;
+      Data[b].beta = beta;
+    }
+
+    MlasSparseGemmBatch(TransposeA, M, N, K, Data.data(), BatchSize, threadpool_);
+
+    ReferenceGemm(BatchSize, M, N, K, TransA, TransB, A, lda, B, ldb, alpha, beta, CReference);
+
+    for (size_t i = 0; i < BatchSize * M * N; i++) {
+      ASSERT_NEAR(C[i], CReference[i], 1e-4f)
+          << "@" << i << " of " << BatchSize * M * N << " M=" << M << " N=" << N << " K=" << K
+          << " TransA=" << TransA << " TransB=" << TransB;
+    }
+  }
+
+  //
+  // The zero blocks of B are skipped rather than multiplied, so an Inf in A
+  // that only meets zero blocks leaves C finite. The dense SGEMM would produce
+  // NaN from Inf * 0 instead.
+  //
+
+  void TestInfInput(size_t N, size_t K) {
+    float* A = BufferA.GetBuffer(K);
+    float* B = BufferB.GetBuffer(K * N);
+    float* C = BufferC.GetBuffer(N);
+    float* CReference = BufferCReference.GetBuffer(N);
+
+    for (size_t k = 0; k < K; k++) {
+      A[k] = float(k % 5) - 2.0f;
+      for (size_t n = 0; n < N; n++) {
+        B[k * N + n] = (k % 2 == 0) ? 0.0f : float((k + n) % 7) - 3.0f;
+      }
+    }
+
+    const size_t PackedBSize = MlasSparseGemmPackBSize(N, K);
+    void* PackedB = BufferPackedB.GetBuffer(PackedBSize, true);
+    MlasSparseGemmPackB(CblasNoTrans, N, K, B, N, PackedB);
+
+    // row 0 of B is zero, so the reference is computed before A[0] becomes Inf
+    ReferenceGemm(1, 1, N, K, false, false, A, K, B, N, 1.0f, 0.0f, CReference);
+
+    A[0] = std::numeric_limits<float>::infinity();
+
+    MLAS_SGEMM_DATA_PARAMS Data;
+    Data.A = A;
+    Data.lda = K;
+    Data.B = static_cast<const float*>(PackedB);
+    Data.C = C;
+    Data.ldc = N;
+    Data.alpha = 1.0f;
+    Data.beta = 0.0f;
+
+    MlasSparseGemmBatch(CblasNoTrans, 1, N, K, &Data, 1, threadpool_);
+
+    for (size_t n = 0; n < N; n++) {
+      ASSERT_NEAR(C[n], CReference[n], 1e-4f) << "@" << n << " N=" << N << " K=" << K;
+    }
+  }
+
+  void ReferenceGemm(size_t BatchSize, size_t M, size_t N, size_t K, bool TransA, bool TransB,
+                     const float* A, size_t lda, const float* B, size_t ldb,
+                     float alpha, float beta, float* C) {
+    for (size_t b = 0; b < BatchSize; b++) {
+      const float* a = A + b * M * K;
+      float* c = C + b * M * N;
+      for (size_t m = 0; m < M; m++) {
+        for (size_t n = 0; n < N; n++) {
+          double Sum = 0.0;
+          for (size_t k = 0; k < K; k++) {
+            const float AValue = TransA ? a[k * lda + m] : a[m * lda + k];
+            const float BValue = TransB ? B[n * ldb + k] : B[k * ldb + n];
+            Sum += double(AValue) * double(BValue);
+          }
+          const float Result = alpha * float(Sum);
+          c[m * N + n] = (beta != 0.0f) ? Result + beta * c[m * N + n] : Result;
+        }
+      }
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name(Threaded ? "SparseGemm_Threaded" : "SparseGemm_SingleThread");
+    return suite_name.c_str();
+  }
+
+  MlasSparseGemmTest() : threadpool_(Threaded ? GetMlasThreadPool() : nullptr) {}
+
+  void ExecuteShort(void) override {
+    for (size_t n = 1; n < 40; n++) {
+      Test(1, 3, n, 17, false, false, 0.5f, 1.0f, 0.0f);
+      Test(1, 2, n, 9, false, true, 0.8f, 1.0f, 0.0f);
+    }
+
+    for (bool TransA : {false, true}) {
+      for (bool TransB : {false, true}) {
+        Test(1, 1, 64, 128, TransA, TransB, 0.7f, 1.0f, 0.0f);
+        Test(1, 7, 50, 33, TransA, TransB, 0.0f, 0.5f, 1.0f);
+        Test(2, 16, 96, 64, TransA, TransB, 0.9f, 1.0f, 0.5f);
+        Test(3, 65, 33, 80, TransA, TransB, 1.0f, 1.0f, 0.0f);
+      }
+    }
+
+    Test(1, 128, 768, 768, false, false, 0.8f, 1.0f, 0.0f);
+    Test(4, 33, 1024, 256, false, true, 0.6f, 1.0f, 0.0f);
+
+    TestInfInput(16, 8);
+    TestInfInput(40, 33);
+  }
+};
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasSparseGemmTest<false>>::RegisterShortExecute();
+    if (GetMlasThreadPool() != nullptr) {
+      count += MlasDirectShortExecuteTests<MlasSparseGemmTest<true>>::RegisterShortExecute();
+    }
+  }
+  return count;
+});
@@ -383,6 +383,12 @@ class SQNBitGemmShortExecuteTest : public MlasTestFixture<MlasSQNBitGemmTest<Blk
           }
           tests_registered += RegisterSingleTest(43, 500, 401, ComputeType, WithThreadpool, Symmetric, true);
 
+          // M spans several of the 128 row tiles of MlasSQNBitGemmBatch and K has an odd tail, so the tiles
+          // quantize rows of A that start past row 0 and end in a partial block.
+          tests_registered += RegisterSingleTest(129, 67, 97, ComputeType, WithThreadpool, Symmetric, false);
+          tests_registered += RegisterSingleTest(257, 35, 401, ComputeType, WithThreadpool, Symmetric, true);
+          tests_registered += RegisterSingleTest(300, 20, 33, ComputeType, WithThreadpool, Symmetric, true);
+
           tests_registered += RegisterSingleTest(1, 2, 16, ComputeType, WithThreadpool, Symmetric, true);
           tests_registered += RegisterSingleTest(1, 2, 16, ComputeType, WithThreadpool, Symmetric, false);
           tests_registered += RegisterSingleTest(1, 1027, 1031, ComputeType, WithThreadpool, Symmetric, false);
@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "common.h"
+
+#include <benchmark/benchmark.h>
+#include "core/providers/cpu/object_detection/non_max_suppression.h"
+#include "core/providers/cpu/object_detection/non_max_suppression_helper.h"
+#include "core/util/thread_utils.h"
+
+using namespace onnxruntime;
+
+// Detector-like workload: num_boxes anchors in [y1, x1, y2, x2] format scored for num_classes classes
+static void BM_NonMaxSuppression(benchmark::State& state) {
+  const int num_boxes = static_cast<int>(state.range(0));
+  const int64_t num_classes = state.range(1);
+  const bool use_thread_pool = state.range(2) != 0;
+  constexpr int64_t num_batches = 1;
+  constexpr int64_t max_output_boxes_per_class = 100;
+  constexpr float iou_threshold = 0.5f;
+  constexpr float score_threshold = 0.05f;
+
+  const size_t boxes_size = static_cast<size_t>(num_batches * num_boxes * 4);
+  const size_t scores_size = static_cast<size_t>(num_batches * num_classes * num_boxes);
+  float* boxes = GenerateArrayWithRandomValue<float>(boxes_size, 0.0f, 512.0f);
+  float* scores = GenerateArrayWithRandomValue<float>(scores_size, 0.0f, 1.0f);
+  // Make the boxes 16 to 64 pixels wide and high so that neighbouring anchors overlap
+  for (size_t i = 0; i < boxes_size; i += 4) {
+    boxes[i + 2] = boxes[i] + 16.0f + boxes[i + 2] / 8.0f;
+    boxes[i + 3] = boxes[i + 1] + 16.0f + boxes[i + 3] / 8.0f;
+  }
+
+  PrepareContext pc;
+  pc.boxes_data_ = boxes;
+  pc.boxes_size_ = static_cast<int64_t>(boxes_size);
+  pc.scores_data_ = scores;
+  pc.scores_size_ = static_cast<int64_t>(scores_size);
+  pc.score_threshold_ = &score_threshold;
+  pc.num_batches_ = num_batches;
+  pc.num_classes_ = num_classes;
+  pc.num_boxes_ = num_boxes;
+
+  OrtThreadPoolParams tpo;
+  tpo.auto_set_affinity = true;
+  std::unique_ptr<concurrency::ThreadPool> tp(
+      concurrency::CreateThreadPool(&onnxruntime::Env::Default(), tpo, concurrency::ThreadPoolType::INTRA_OP));
+
+  std::vector<SelectedIndex> selected_indices;
+  for (auto _ : state) {
+    selected_indices.clear();
+    NonMaxSuppression::SelectBoxes(pc, 0, max_output_boxes_per_class, iou_threshold, score_threshold,
+                                   use_thread_pool ? tp.get() : nullptr, selected_indices);
+    benchmark::DoNotOptimize(selected_indices.data());
+  }
+
+  aligned_free(boxes);
+  aligned_free(scores);
+}
+
+BENCHMARK(BM_NonMaxSuppression)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->ArgNames({"boxes", "classes", "threaded"})
+    ->Args({1000, 1, 0})
+    ->Args({10000, 1, 0})
+    ->Args({1000, 80, 0})
+    ->Args({1000, 80, 1})
+    ->Args({10000, 80, 0})
+    ->Args({10000, 80, 1});
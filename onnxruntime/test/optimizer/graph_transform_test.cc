@@ -38,6 +38,7 @@
 #include "core/optimizer/double_qdq_pairs_remover.h"
 #include "core/optimizer/dropout_elimination.h"
 #include "core/optimizer/dynamic_quantize_matmul_fusion.h"
+#include "core/optimizer/embedding_bag_fusion.h"
 #include "core/optimizer/expand_elimination.h"
 #include "core/optimizer/fast_gelu_fusion.h"
 #include "core/optimizer/gather_fusion.h"
@@ -1050,6 +1051,105 @@ TEST_F(GraphTransformationTests, ConstantFoldingStringInitializer) {
   ASSERT_EQ(op_to_count.size(), 0U) << "Identity node should have been removed";
 }
 
+// Expand of a single constant value into a 64x64 float tensor (16KB) is only folded if it fits in the budget.
+TEST_F(GraphTransformationTests, ConstantFoldingMaxOutputSize) {
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({{64, 64}});
+    auto* value_arg = builder.MakeInitializer<float>({1}, {1.0f});
+    auto* shape_arg = builder.MakeInitializer<int64_t>({2}, {64, 64});
+    auto* expand_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+
+    builder.AddNode("Expand", {value_arg, shape_arg}, {expand_out});
+    builder.AddNode("Add", {input_arg, expand_out}, {output_arg});
+  };
+
+  auto pre_graph_checker = [](Graph& graph) {
+    TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Expand"] == 1);
+    return Status::OK();
+  };
+
+  std::unique_ptr<CPUExecutionProvider> e = std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo());
+
+  // Outputs larger than the limit are not folded.
+  {
+    ConfigOptions config_options;
+    ASSERT_STATUS_OK(config_options.AddConfigEntry(kOrtSessionOptionsConstantFoldingMaxOutputSizeInBytes, "1024"));
+
+    auto post_graph_checker = [](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Expand"] == 1);
+      return Status::OK();
+    };
+
+    ASSERT_STATUS_OK(TestGraphTransformer(
+        build_test_case, 13, *logger_,
+        std::make_unique<ConstantFolding>(*e.get(), false /*skip_dequantize_linear*/, config_options),
+        TransformerLevel::Level1, 1, pre_graph_checker, post_graph_checker));
+  }
+
+  // Outputs within the limit are folded.
+  for (const char* max_output_size : {"0", "65536"}) {
+    ConfigOptions config_options;
+    ASSERT_STATUS_OK(config_options.AddConfigEntry(kOrtSessionOptionsConstantFoldingMaxOutputSizeInBytes,
+                                                   max_output_size));
+
+    auto post_graph_checker = [](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Expand"] == 0);
+      return Status::OK();
+    };
+
+    ASSERT_STATUS_OK(TestGraphTransformer(
+        build_test_case, 13, *logger_,
+        std::make_unique<ConstantFolding>(*e.get(), false /*skip_dequantize_linear*/, config_options),
+        TransformerLevel::Level1, 1, pre_graph_checker, post_graph_checker));
+  }
+}
+
+// A DQ -> Transpose -> Q node unit on a 64x64 int8 weight has 16KB float tensors in between but its output is no
+// larger than its constant inputs, so the budget of the unit is met and the whole unit is folded.
+TEST_F(GraphTransformationTests, ConstantFoldingMaxOutputSizeQDQNodeUnit) {
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({{64, 64}});
+    auto* weight_arg = builder.MakeInitializer<int8_t>({64, 64}, std::vector<int8_t>(64 * 64, 3));
+    auto* dq_out = builder.MakeIntermediate();
+    auto* transpose_out = builder.MakeIntermediate();
+    auto* q_out = builder.MakeIntermediate();
+    auto* dq2_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+
+    builder.AddDequantizeLinearNode<int8_t>(weight_arg, 0.5f, 1, dq_out);
+    builder.AddNode("Transpose", {dq_out}, {transpose_out});
+    builder.AddQuantizeLinearNode<int8_t>(transpose_out, 0.5f, 1, q_out);
+    builder.AddDequantizeLinearNode<int8_t>(q_out, 0.5f, 1, dq2_out);
+    builder.AddNode("Add", {input_arg, dq2_out}, {output_arg});
+  };
+
+  auto pre_graph_checker = [](Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    TEST_RETURN_IF_NOT(op_to_count["DequantizeLinear"] == 2);
+    TEST_RETURN_IF_NOT(op_to_count["Transpose"] == 1);
+    TEST_RETURN_IF_NOT(op_to_count["QuantizeLinear"] == 1);
+    return Status::OK();
+  };
+
+  auto post_graph_checker = [](Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    TEST_RETURN_IF_NOT(op_to_count["DequantizeLinear"] == 1);
+    TEST_RETURN_IF_NOT(op_to_count["Transpose"] == 0);
+    TEST_RETURN_IF_NOT(op_to_count["QuantizeLinear"] == 0);
+    return Status::OK();
+  };
+
+  ConfigOptions config_options;
+  ASSERT_STATUS_OK(config_options.AddConfigEntry(kOrtSessionOptionsConstantFoldingMaxOutputSizeInBytes, "1024"));
+
+  std::unique_ptr<CPUExecutionProvider> e = std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo());
+  ASSERT_STATUS_OK(TestGraphTransformer(
+      build_test_case, 13, *logger_,
+      std::make_unique<ConstantFolding>(*e.get(), true /*skip_dequantize_linear*/, config_options),
+      TransformerLevel::Level1, 1, pre_graph_checker, post_graph_checker));
+}
+
 TEST_F(GraphTransformationTests, ConstantFoldingIfConstantInlining) {
   // This test covers the following necessary cases:
   // The input refers to the explicit or implicit inputs of If node.
@@ -7691,6 +7791,94 @@ TEST_F(GraphTransformationTests, GatherToSliceFusion) {
   }
 }
 
+TEST_F(GraphTransformationTests, EmbeddingBagFusion) {
+  auto pre_graph_checker = [&](Graph& graph) {
+    auto op_count_map = CountOpsInGraph(graph);
+    TEST_RETURN_IF_NOT(op_count_map["Gather"] == 1);
+    return Status::OK();
+  };
+
+  auto check_fused = [&](const std::string& mode) {
+    return [mode](Graph& graph) {
+      auto op_count_map = CountOpsInGraph(graph);
+      TEST_RETURN_IF_NOT(op_count_map["Gather"] == 0);
+      TEST_RETURN_IF_NOT(op_count_map["ReduceSum"] == 0);
+      TEST_RETURN_IF_NOT(op_count_map["ReduceMean"] == 0);
+      TEST_RETURN_IF_NOT(op_count_map["com.microsoft.EmbeddingBag"] == 1);
+      for (auto& node : graph.Nodes()) {
+        if (node.OpType() == "EmbeddingBag") {
+          TEST_RETURN_IF_NOT(node.GetAttributes().at("mode").s() == mode);
+        }
+      }
+      return Status::OK();
+    };
+  };
+
+  // OpSet-13 ReduceSum with axes input, Tind is int64.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* table_arg = builder.MakeInitializer<float>({16, 8}, 0.0f, 1.0f);
+      auto* indices_arg = builder.MakeInput<int64_t>({{4, 3}});
+      auto* axes_arg = builder.MakeInitializer<int64_t>({1}, {static_cast<int64_t>(1)});
+      auto* gather_output = builder.MakeIntermediate();
+      auto* reduce_output = builder.MakeOutput();
+
+      builder.AddNode("Gather", {table_arg, indices_arg}, {gather_output});
+      builder.AddNode("ReduceSum", {gather_output, axes_arg}, {reduce_output})
+          .AddAttribute("keepdims", static_cast<int64_t>(0));
+    };
+
+    std::unique_ptr<GraphTransformer> transformer = std::make_unique<EmbeddingBagFusion>();
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 13, *logger_, std::move(transformer),
+                                          TransformerLevel::Level2, 1, pre_graph_checker, check_fused("sum")));
+  }
+
+  // OpSet-13 ReduceMean with axes attribute, Tind is int32.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* table_arg = builder.MakeInput<float>({{16, 8}});
+      auto* indices_arg = builder.MakeInput<int32_t>({{4, 3}});
+      auto* gather_output = builder.MakeIntermediate();
+      auto* reduce_output = builder.MakeOutput();
+
+      builder.AddNode("Gather", {table_arg, indices_arg}, {gather_output});
+      auto& reduce_node = builder.AddNode("ReduceMean", {gather_output}, {reduce_output});
+      reduce_node.AddAttribute("axes", std::vector<int64_t>{-2});
+      reduce_node.AddAttribute("keepdims", static_cast<int64_t>(0));
+    };
+
+    std::unique_ptr<GraphTransformer> transformer = std::make_unique<EmbeddingBagFusion>();
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 13, *logger_, std::move(transformer),
+                                          TransformerLevel::Level2, 1, pre_graph_checker, check_fused("mean")));
+  }
+
+  // The reduction keeps the bag axis, so there is nothing to fuse.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* table_arg = builder.MakeInput<float>({{16, 8}});
+      auto* indices_arg = builder.MakeInput<int64_t>({{4, 3}});
+      auto* axes_arg = builder.MakeInitializer<int64_t>({1}, {static_cast<int64_t>(1)});
+      auto* gather_output = builder.MakeIntermediate();
+      auto* reduce_output = builder.MakeOutput();
+
+      builder.AddNode("Gather", {table_arg, indices_arg}, {gather_output});
+      builder.AddNode("ReduceSum", {gather_output, axes_arg}, {reduce_output});
+    };
+
+    auto post_graph_checker = [&](Graph& graph) {
+      auto op_count_map = CountOpsInGraph(graph);
+      TEST_RETURN_IF_NOT(op_count_map["Gather"] == 1);
+      TEST_RETURN_IF_NOT(op_count_map["ReduceSum"] == 1);
+      TEST_RETURN_IF_NOT(op_count_map["com.microsoft.EmbeddingBag"] == 0);
+      return Status::OK();
+    };
+
+    std::unique_ptr<GraphTransformer> transformer = std::make_unique<EmbeddingBagFusion>();
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 13, *logger_, std::move(transformer),
+                                          TransformerLevel::Level2, 1, pre_graph_checker, post_graph_checker));
+  }
+}
+
 TEST_F(GraphTransformationTests, ShapeInputMerge) {
   auto build_test_case = [&](ModelTestBuilder& builder) {
     std::vector<std::variant<int64_t, std::string>> input_shape;
@@ -2234,6 +2234,146 @@ TEST(QDQTransformerTests, Sigmoid_U8S8) {
   QDQTransformerSigmoidTests<uint8_t, int8_t>();
 }
 
+template <typename InputType, typename OutputType>
+void QDQTransformerGeluTests(const std::string& domain, int opset_version, const std::string& approximate) {
+  auto test_case = [&](const std::vector<int64_t>& input_shape, bool use_contrib_qdq) {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input_arg = builder.MakeInput<float>(input_shape, -3.f, 3.f);
+      auto* output_arg = builder.MakeOutput();
+      // add QDQ + Gelu
+      auto* dq_output = AddQDQNodePair<InputType>(builder, input_arg, .025f, 1, use_contrib_qdq);
+      auto* gelu_output = builder.MakeIntermediate();
+      Node& gelu_node = builder.AddNode("Gelu", {dq_output}, {gelu_output}, domain);
+      if (!approximate.empty()) {
+        gelu_node.AddAttribute("approximate", approximate);
+      }
+
+      // add QDQ output
+      auto* q_output = builder.MakeIntermediate();
+      builder.AddQuantizeLinearNode<OutputType>(gelu_output, .02f, 2, q_output, use_contrib_qdq);
+      builder.AddDequantizeLinearNode<OutputType>(q_output, .02f, 2, output_arg, use_contrib_qdq);
+    };
+
+    auto check_graph = [&](InferenceSessionWrapper& session) {
+      auto op_to_count = CountOpsInGraph(session.GetGraph());
+      const QDQOpKeys qdq_keys = GetQDQOpKeys(use_contrib_qdq);
+      const std::string gelu_key = domain.empty() ? "Gelu" : domain + ".Gelu";
+      if constexpr (std::is_same<InputType, OutputType>::value) {
+        EXPECT_EQ(op_to_count["com.microsoft.QLinearGelu"], 1);
+        EXPECT_EQ(op_to_count[gelu_key], 0);
+        EXPECT_EQ(op_to_count[qdq_keys.quantize_linear], 1);
+        EXPECT_EQ(op_to_count[qdq_keys.dequantize_linear], 1);
+      } else {
+        EXPECT_EQ(op_to_count["com.microsoft.QLinearGelu"], 0);
+        EXPECT_EQ(op_to_count[gelu_key], 1);
+        EXPECT_EQ(op_to_count[qdq_keys.quantize_linear], 2);
+        EXPECT_EQ(op_to_count[qdq_keys.dequantize_linear], 2);
+      }
+    };
+
+    TransformerTester(build_test_case,
+                      check_graph,
+                      TransformerLevel::Level1,
+                      TransformerLevel::Level2,
+                      opset_version,
+                      0.025 /*per_sample_tolerance*/,
+                      0.025 /*relative_per_sample_tolerance*/,
+                      std::make_unique<QDQSelectorActionTransformer>(QDQIsInt8Allowed()));
+  };
+
+  test_case({1, 12, 37}, false /*use_contrib_qdq*/);
+  test_case({1, 12, 37}, true /*use_contrib_qdq*/);
+  test_case({1, 23, 13, 13}, false /*use_contrib_qdq*/);
+}
+
+TEST(QDQTransformerTests, Gelu_S8S8) {
+  QDQTransformerGeluTests<int8_t, int8_t>("", 20, "");
+  QDQTransformerGeluTests<int8_t, int8_t>("", 20, "tanh");
+}
+
+TEST(QDQTransformerTests, Gelu_U8U8) {
+  QDQTransformerGeluTests<uint8_t, uint8_t>("", 20, "none");
+  QDQTransformerGeluTests<uint8_t, uint8_t>(kMSDomain, 18, "");
+}
+
+TEST(QDQTransformerTests, Gelu_S8U8) {
+  QDQTransformerGeluTests<int8_t, uint8_t>("", 20, "");
+}
+
+template <typename QuantType>
+void QDQTransformerLayerNormTests(bool has_bias, bool quantize_scale) {
+  auto test_case = [&](const std::vector<int64_t>& input_shape, int64_t axis, bool use_contrib_qdq) {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input_arg = builder.MakeInput<float>(input_shape, -4.f, 4.f);
+      auto* output_arg = builder.MakeOutput();
+
+      const size_t normalized_axis = static_cast<size_t>(axis < 0 ? axis + input_shape.size() : axis);
+      std::vector<int64_t> norm_shape(input_shape.begin() + normalized_axis, input_shape.end());
+
+      // add QDQ + LayerNormalization
+      auto* dq_output = AddQDQNodePair<QuantType>(builder, input_arg, .035f, 3, use_contrib_qdq);
+      std::vector<NodeArg*> layer_norm_inputs{dq_output};
+      if (quantize_scale) {
+        // EPs that take a quantized scale see DQ -> Scale, which the CPU kernel does not handle
+        auto* scale = builder.MakeInitializer<QuantType>(norm_shape, QuantType(1), QuantType(100));
+        auto* dq_scale = builder.MakeIntermediate();
+        builder.AddDequantizeLinearNode<QuantType>(scale, .02f, 0, dq_scale, use_contrib_qdq);
+        layer_norm_inputs.push_back(dq_scale);
+      } else {
+        layer_norm_inputs.push_back(builder.MakeInitializer<float>(norm_shape, -1.5f, 1.5f));
+      }
+      if (has_bias) {
+        layer_norm_inputs.push_back(builder.MakeInitializer<float>(norm_shape, -0.5f, 0.5f));
+      }
+      auto* layer_norm_output = builder.MakeIntermediate();
+      Node& layer_norm_node = builder.AddNode("LayerNormalization", layer_norm_inputs, {layer_norm_output});
+      layer_norm_node.AddAttribute("axis", axis);
+
+      // add QDQ output
+      auto* q_output = builder.MakeIntermediate();
+      builder.AddQuantizeLinearNode<QuantType>(layer_norm_output, .04f, 4, q_output, use_contrib_qdq);
+      builder.AddDequantizeLinearNode<QuantType>(q_output, .04f, 4, output_arg, use_contrib_qdq);
+    };
+
+    auto check_graph = [&](InferenceSessionWrapper& session) {
+      auto op_to_count = CountOpsInGraph(session.GetGraph());
+      const QDQOpKeys qdq_keys = GetQDQOpKeys(use_contrib_qdq);
+      if (!quantize_scale) {
+        EXPECT_EQ(op_to_count["com.microsoft.QLinearLayerNormalization"], 1);
+        EXPECT_EQ(op_to_count["LayerNormalization"], 0);
+        EXPECT_EQ(op_to_count[qdq_keys.quantize_linear], 1);
+        EXPECT_EQ(op_to_count[qdq_keys.dequantize_linear], 1);
+      } else {
+        EXPECT_EQ(op_to_count["com.microsoft.QLinearLayerNormalization"], 0);
+        EXPECT_EQ(op_to_count["LayerNormalization"], 1);
+      }
+    };
+
+    TransformerTester(build_test_case,
+                      check_graph,
+                      TransformerLevel::Level1,
+                      TransformerLevel::Level2,
+                      17 /*opset_version*/,
+                      0.05 /*per_sample_tolerance*/,
+                      0.05 /*relative_per_sample_tolerance*/,
+                      std::make_unique<QDQSelectorActionTransformer>(QDQIsInt8Allowed()));
+  };
+
+  test_case({2, 8, 48}, -1, false /*use_contrib_qdq*/);
+  test_case({2, 8, 48}, -1, true /*use_contrib_qdq*/);
+  test_case({3, 5, 4, 6}, 2, false /*use_contrib_qdq*/);
+}
+
+TEST(QDQTransformerTests, LayerNorm_S8) {
+  QDQTransformerLayerNormTests<int8_t>(true /*has_bias*/, false /*quantize_scale*/);
+  QDQTransformerLayerNormTests<int8_t>(false /*has_bias*/, false /*quantize_scale*/);
+}
+
+TEST(QDQTransformerTests, LayerNorm_U8) {
+  QDQTransformerLayerNormTests<uint8_t>(true /*has_bias*/, false /*quantize_scale*/);
+  QDQTransformerLayerNormTests<uint8_t>(true /*has_bias*/, true /*quantize_scale*/);
+}
+
 TEST(QDQTransformerTests, ConvTranspose_QBackward) {
   auto test_case = [&](const std::vector<int64_t>& input_shape, const std::vector<int64_t>& weights_shape,
                        const std::vector<int64_t>& perms, bool use_contrib_qdq) {
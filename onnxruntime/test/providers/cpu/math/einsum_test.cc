@@ -591,6 +591,50 @@ TEST(Einsum, ImplicitEinsumAsTensorContraction) {
   test.Run();
 }
 
+// Theme: Contraction path and transposed MatMul operands
+
+// Contracting the last two operands first is cheaper than the left-to-right order
+TEST(Einsum, ExplicitEinsumAsMatmulChain_OptimalPath) {
+  OpTester test("Einsum", 12, onnxruntime::kOnnxDomain);
+  test.AddAttribute<std::string>("equation", "ij,jk,kl->il");
+  test.AddInput<float>("x", {2, 3}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f});
+  test.AddInput<float>("y", {3, 4}, {0.5f, 1.f, 1.5f, 2.f, 2.5f, 3.f, 3.5f, 4.f, 4.5f, 5.f, 5.5f, 6.f});
+  test.AddInput<float>("z", {4, 2}, {-3.f, -2.f, -1.f, 0.f, 1.f, 2.f, 3.f, 4.f});
+  test.AddOutput<float>("o", {2, 2}, {30.f, 124.f, 75.f, 286.f});
+  test.Run();
+}
+
+// More operands than the exhaustive search handles - uses the greedy path
+TEST(Einsum, ExplicitEinsumAsMatmulChain_GreedyPath) {
+  OpTester test("Einsum", 12, onnxruntime::kOnnxDomain);
+  test.AddAttribute<std::string>("equation", "ab,bc,cd,de,ef->af");
+  test.AddInput<float>("x0", {2, 2}, {1.f, 2.f, 3.f, 4.f});
+  test.AddInput<float>("x1", {2, 2}, {2.f, 3.f, 4.f, 5.f});
+  test.AddInput<float>("x2", {2, 2}, {3.f, 4.f, 5.f, 6.f});
+  test.AddInput<float>("x3", {2, 2}, {4.f, 5.f, 6.f, 7.f});
+  test.AddInput<float>("x4", {2, 2}, {5.f, 6.f, 7.f, 8.f});
+  test.AddOutput<float>("o", {2, 2}, {14547.f, 16936.f, 32303.f, 37608.f});
+  test.Run();
+}
+
+TEST(Einsum, ExplicitEinsumAsMatmulTransposeB_int32) {
+  OpTester test("Einsum", 12, onnxruntime::kOnnxDomain);
+  test.AddAttribute<std::string>("equation", "ij,kj->ik");
+  test.AddInput<int32_t>("x", {2, 3}, {0, 1, 2, 3, 4, 5});
+  test.AddInput<int32_t>("y", {4, 3}, {-5, -4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 6});
+  test.AddOutput<int32_t>("o", {2, 4}, {-10, -1, 8, 17, -46, -10, 26, 62});
+  test.Run();
+}
+
+TEST(Einsum, ExplicitEinsumAsMatmulTransposeAB_int64) {
+  OpTester test("Einsum", 12, onnxruntime::kOnnxDomain);
+  test.AddAttribute<std::string>("equation", "ji,kj->ik");
+  test.AddInput<int64_t>("x", {3, 2}, {0, 1, 2, 3, 4, 5});
+  test.AddInput<int64_t>("y", {4, 3}, {-5, -4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 6});
+  test.AddOutput<int64_t>("o", {2, 4}, {-20, -2, 16, 34, -32, -5, 22, 49});
+  test.Run();
+}
+
 // Theme: Half support
 
 TEST(Einsum, ExplicitEinsumAsIdentity_1D_input_Half) {
@@ -4,6 +4,7 @@
 #include "gtest/gtest.h"
 #include "core/mlas/inc/mlas.h"
 #include "core/framework/run_options.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #include "test/common/cuda_op_test_utils.h"
 #include "test/providers/provider_test_utils.h"
 #include "test/common/dnnl_op_test_utils.h"
@@ -683,6 +684,69 @@ TYPED_TEST(GemmOpTypedTests, TestGemmWithAlphaOpset11) {
       .RunWithConfig();
 }
 
+// Most of the 1x16 blocks of B are zero, so the CPU EP pre-packs it for the block sparse SGEMM once that is enabled.
+// The same model is run with the default options to cover the dense SGEMM as well.
+TEST(GemmOpTest, GemmBlockSparseWeight) {
+  constexpr int64_t M = 3, K = 40, N = 36;
+  constexpr float alpha = 0.5f, beta = 2.0f;
+
+  std::vector<float> A(M * K);
+  for (size_t i = 0; i < A.size(); i++) {
+    A[i] = static_cast<float>(static_cast<int>(i * 3 % 7) - 3) * 0.25f;
+  }
+
+  // B is transposed, [N, K]
+  std::vector<float> B(N * K, 0.0f);
+  for (int64_t k = 0; k < K; k++) {
+    for (int64_t n = 0; n < N; n++) {
+      if ((k + 2 * (n / 16)) % 4 == 0) {
+        B[n * K + k] = static_cast<float>((k + 3 * n) % 9 - 4) * 0.5f;
+      }
+    }
+  }
+
+  std::vector<float> C(N);
+  for (int64_t n = 0; n < N; n++) {
+    C[n] = static_cast<float>(n % 5) - 2.0f;
+  }
+
+  std::vector<float> Y(M * N);
+  for (int64_t m = 0; m < M; m++) {
+    for (int64_t n = 0; n < N; n++) {
+      float sum = 0.0f;
+      for (int64_t k = 0; k < K; k++) {
+        sum += A[m * K + k] * B[n * K + k];
+      }
+      Y[m * N + n] = alpha * sum + beta * C[n];
+    }
+  }
+
+  for (bool enable_sparse_gemm : {true, false}) {
+    OpTester test("Gemm", 13);
+    test.AddAttribute("transA", static_cast<int64_t>(0));
+    test.AddAttribute("transB", static_cast<int64_t>(1));
+    test.AddAttribute("alpha", alpha);
+    test.AddAttribute("beta", beta);
+    test.AddInput<float>("A", {M, K}, A);
+    test.AddInput<float>("B", {N, K}, B, true);
+    test.AddInput<float>("C", {N}, C, true);
+    test.AddOutput<float>("Y", {M, N}, Y);
+
+    SessionOptions so;
+    if (enable_sparse_gemm) {
+      ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsMlasEnableSparseGemm, "1"));
+      ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsMlasSparseGemmBlockSparsityThreshold,
+                                                        "0.7"));
+    }
+
+    std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+    execution_providers.push_back(DefaultCpuExecutionProvider());
+    test.Config(so)
+        .ConfigEps(std::move(execution_providers))
+        .RunWithConfig();
+  }
+}
+
 #ifndef ENABLE_TRAINING
 // Prepacking is disabled in training builds so no need to test the feature in a training build.
 TEST(GemmOpTest, SharedPrepackedWeights) {
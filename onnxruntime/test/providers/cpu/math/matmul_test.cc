@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
 #include "test/providers/run_options_config_keys.h"
@@ -226,6 +227,94 @@ TEST(MathOpTest, MatMulUint64Type) {
   RunMatMulTest<uint64_t>(9);
 }
 
+// Most of the 1x16 blocks of the weight are zero, so the CPU EP pre-packs it for the block sparse SGEMM once that is
+// enabled. The same model is run with the default options to cover the dense SGEMM as well.
+TEST(MathOpTest, MatMulBlockSparseWeight) {
+  constexpr int64_t batch = 2, M = 5, K = 48, N = 40;
+
+  std::vector<float> A(batch * M * K);
+  for (size_t i = 0; i < A.size(); i++) {
+    A[i] = static_cast<float>(static_cast<int>(i * 5 % 11) - 5) * 0.1f;
+  }
+
+  std::vector<float> B(K * N, 0.0f);
+  for (int64_t k = 0; k < K; k++) {
+    for (int64_t n = 0; n < N; n++) {
+      if ((k * 3 + n / 16) % 5 == 0) {
+        B[k * N + n] = static_cast<float>((k * 7 + n) % 13 - 6) * 0.1f;
+      }
+    }
+  }
+
+  std::vector<float> Y(batch * M * N);
+  for (int64_t m = 0; m < batch * M; m++) {
+    for (int64_t n = 0; n < N; n++) {
+      float sum = 0.0f;
+      for (int64_t k = 0; k < K; k++) {
+        sum += A[m * K + k] * B[k * N + n];
+      }
+      Y[m * N + n] = sum;
+    }
+  }
+
+  for (bool enable_sparse_gemm : {true, false}) {
+    OpTester test("MatMul", 13);
+    test.AddInput<float>("A", {batch, M, K}, A);
+    test.AddInput<float>("B", {K, N}, B, true);
+    test.AddOutput<float>("Y", {batch, M, N}, Y);
+
+    SessionOptions so;
+    if (enable_sparse_gemm) {
+      ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsMlasEnableSparseGemm, "1"));
+      ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsMlasSparseGemmBlockSparsityThreshold,
+                                                        "0.7"));
+    }
+
+    std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+    execution_providers.push_back(DefaultCpuExecutionProvider());
+    test.Config(so)
+        .ConfigEps(std::move(execution_providers))
+        .RunWithConfig();
+  }
+}
+
+// The block sparse SGEMM skips the zero blocks of the weight, so an Inf in A that only meets zeros of B does not turn
+// into NaN the way it does with the dense SGEMM. This is why the block sparse SGEMM has to be enabled explicitly.
+TEST(MathOpTest, MatMulBlockSparseWeightInfInput) {
+  constexpr int64_t M = 1, K = 8, N = 16;
+
+  const std::vector<float> A{std::numeric_limits<float>::infinity(), 1.0f, -1.0f, 3.0f, 0.5f, -2.0f, 1.0f, 2.0f};
+
+  // only the last row of B is non-zero
+  std::vector<float> B(K * N, 0.0f);
+  for (int64_t n = 0; n < N; n++) {
+    B[(K - 1) * N + n] = static_cast<float>(n) - 8.0f;
+  }
+
+  for (bool enable_sparse_gemm : {true, false}) {
+    std::vector<float> Y(M * N);
+    for (int64_t n = 0; n < N; n++) {
+      Y[n] = enable_sparse_gemm ? 2.0f * B[(K - 1) * N + n] : std::numeric_limits<float>::quiet_NaN();
+    }
+
+    OpTester test("MatMul", 13);
+    test.AddInput<float>("A", {M, K}, A);
+    test.AddInput<float>("B", {K, N}, B, true);
+    test.AddOutput<float>("Y", {M, N}, Y);
+
+    SessionOptions so;
+    if (enable_sparse_gemm) {
+      ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsMlasEnableSparseGemm, "1"));
+    }
+
+    std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+    execution_providers.push_back(DefaultCpuExecutionProvider());
+    test.Config(so)
+        .ConfigEps(std::move(execution_providers))
+        .RunWithConfig();
+  }
+}
+
 #if defined(USE_CUDA) || defined(USE_ROCM)
 TEST(MathOpTest, MatMul_Float16) {
 #ifdef USE_CUDA
@@ -1,6 +1,9 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <cmath>
+#include <limits>
+
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
 
@@ -55,5 +58,41 @@ TEST(MLOpTest, ImputerOpInts) {
   test.Run();
 }
 
+// The inputs are just large enough for the cost model in imputer.cc to use two threads. The int64 case has a partial
+// last block.
+TEST(MLOpTest, ImputerOpParallelMatchesSerial) {
+  const std::vector<float> impute_floats = {10.0f, 20.0f, 30.0f, 40.0f};
+  const std::vector<int64_t> float_dims{15600, 4};
+  std::vector<float> float_input(15600 * 4);
+  std::vector<float> float_expected;
+  for (size_t i = 0; i < float_input.size(); ++i) {
+    float_input[i] = i % 3 == 0 ? std::numeric_limits<float>::quiet_NaN() : static_cast<float>(i % 101);
+    float_expected.push_back(std::isnan(float_input[i]) ? impute_floats[i % 4] : float_input[i]);
+  }
+
+  const int64_t replace = 2;
+  const std::vector<int64_t> int_dims{40963};
+  std::vector<int64_t> int_input(40963);
+  std::vector<int64_t> int_expected;
+  for (size_t i = 0; i < int_input.size(); ++i) {
+    int_input[i] = static_cast<int64_t>(i % 5);
+    int_expected.push_back(int_input[i] == replace ? -1 : int_input[i]);
+  }
+
+  OpTester float_test("Imputer", 1, onnxruntime::kMLDomain);
+  float_test.AddAttribute("imputed_value_floats", impute_floats);
+  float_test.AddAttribute("replaced_value_float", std::numeric_limits<float>::quiet_NaN());
+  float_test.AddInput<float>("X", float_dims, float_input);
+  float_test.AddOutput<float>("Y", float_dims, float_expected);
+  RunWithIntraOpThreads(float_test);
+
+  OpTester int_test("Imputer", 1, onnxruntime::kMLDomain);
+  int_test.AddAttribute("imputed_value_int64s", std::vector<int64_t>{-1});
+  int_test.AddAttribute("replaced_value_int64", replace);
+  int_test.AddInput<int64_t>("X", int_dims, int_input);
+  int_test.AddOutput<int64_t>("Y", int_dims, int_expected);
+  RunWithIntraOpThreads(int_test);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
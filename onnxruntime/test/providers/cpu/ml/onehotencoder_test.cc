@@ -122,5 +122,42 @@ TEST(OneHotEncoderOpTest, String) {
   test_multiD.Run(OpTester::ExpectResult::kExpectFailure);
 }
 
+// The input is just large enough for the cost model in onehotencoder.cc to use two threads. An unknown category in
+// the last row must still fail.
+TEST(OneHotEncoderOpTest, ParallelMatchesSerial) {
+  const std::vector<int64_t> categories{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+  const int64_t num_rows = 3500;
+  std::vector<int64_t> input(num_rows);
+  std::vector<float> expected_output(num_rows * categories.size(), 0.0f);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    // every 7th value is not a category and leaves its row empty
+    input[i] = i % 7 == 0 ? 100 : i % 16;
+    if (input[i] < 16) {
+      expected_output[i * categories.size() + input[i]] = 1.0f;
+    }
+  }
+
+  std::vector<int64_t> known_input(num_rows);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    known_input[i] = i % 16;
+  }
+  known_input.back() = 100;
+
+  OpTester test("OneHotEncoder", 1, onnxruntime::kMLDomain);
+  test.AddAttribute("cats_int64s", categories);
+  test.AddAttribute("zeros", int64_t{1});
+  test.AddInput<int64_t>("X", {num_rows}, input);
+  test.AddOutput<float>("Y", {num_rows, 16}, expected_output);
+  RunWithIntraOpThreads(test);
+
+  OpTester failing_test("OneHotEncoder", 1, onnxruntime::kMLDomain);
+  failing_test.AddAttribute("cats_int64s", categories);
+  failing_test.AddAttribute("zeros", int64_t{0});
+  failing_test.AddInput<int64_t>("X", {num_rows}, known_input);
+  failing_test.AddOutput<float>("Y", {num_rows, 16}, std::vector<float>(num_rows * 16, 0.0f));
+  failing_test.Config(OpTester::ExpectResult::kExpectFailure, "Unknown Category and zeros = 0.");
+  RunWithIntraOpThreads(failing_test);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
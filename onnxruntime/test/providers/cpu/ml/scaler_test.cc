@@ -88,5 +88,46 @@ TEST(MLOpTest, ScalerOpScaleOffsetSize1BigInput) {
   test.Run();
 }
 
+// The inputs are just large enough for the cost model in scaler.cc to use two threads. The single scale and offset
+// case has a partial last block.
+TEST(MLOpTest, ScalerOpParallelMatchesSerial) {
+  const vector<float> feature_scale{3.f, -4.f, 0.5f, 1.f, 2.5f};
+  const vector<float> feature_offset{4.8f, -0.5f, 77.0f, 0.f, -1.f};
+  const vector<int64_t> feature_dims{12500, 5};
+  const vector<int64_t> single_dims{7, 8779};
+
+  vector<float> feature_input(12500 * 5);
+  vector<float> single_input(7 * 8779);
+  for (size_t i = 0; i < feature_input.size(); ++i) {
+    feature_input[i] = static_cast<float>(static_cast<int64_t>(i * 37 % 1001) - 500) * 0.25f;
+  }
+  for (size_t i = 0; i < single_input.size(); ++i) {
+    single_input[i] = static_cast<float>(static_cast<int64_t>(i * 53 % 997) - 498) * 0.5f;
+  }
+
+  vector<float> feature_expected;
+  for (size_t i = 0; i < feature_input.size(); ++i) {
+    feature_expected.push_back((feature_input[i] - feature_offset[i % 5]) * feature_scale[i % 5]);
+  }
+  vector<float> single_expected;
+  for (size_t i = 0; i < single_input.size(); ++i) {
+    single_expected.push_back((single_input[i] - 4.8f) * 3.f);
+  }
+
+  OpTester feature_test("Scaler", 1, onnxruntime::kMLDomain);
+  feature_test.AddAttribute("scale", feature_scale);
+  feature_test.AddAttribute("offset", feature_offset);
+  feature_test.AddInput<float>("X", feature_dims, feature_input);
+  feature_test.AddOutput<float>("Y", feature_dims, feature_expected);
+  RunWithIntraOpThreads(feature_test);
+
+  OpTester single_test("Scaler", 1, onnxruntime::kMLDomain);
+  single_test.AddAttribute("scale", vector<float>{3.f});
+  single_test.AddAttribute("offset", vector<float>{4.8f});
+  single_test.AddInput<float>("X", single_dims, single_input);
+  single_test.AddOutput<float>("Y", single_dims, single_expected);
+  RunWithIntraOpThreads(single_test);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -114,6 +114,64 @@ TEST(MLOpTest, SVMRegressorNuSVCPolyKernel) {
   test.Run();
 }
 
+// enough rows and support vectors for the RBF kernel to go through the GEMM with several row tasks.
+// some rows are copies of support vectors, where the distance has to be computed without cancellation.
+TEST(MLOpTest, SVMRegressorSVCLargeBatch) {
+  constexpr int64_t num_rows = 97;
+  constexpr int64_t num_features = 11;
+  constexpr int64_t num_support_vectors = 45;
+  const float gamma = 0.05f;
+  const float rho = 0.25f;
+
+  std::vector<float> support_vectors;
+  std::vector<float> coefficients;
+  for (int64_t i = 0; i < num_support_vectors * num_features; i++) {
+    support_vectors.push_back(static_cast<float>(i * 37 % 41) / 8.f - 2.5f + (i % num_features == 0 ? 100.f : 0.f));
+  }
+  for (int64_t i = 0; i < num_support_vectors; i++) {
+    coefficients.push_back(static_cast<float>(i * 7 % 13) / 6.f - 1.f);
+  }
+
+  std::vector<float> X;
+  for (int64_t row = 0; row < num_rows; row++) {
+    for (int64_t feature = 0; feature < num_features; feature++) {
+      if (row % 10 == 0) {
+        X.push_back(support_vectors[static_cast<size_t>((row / 10) * num_features + feature)]);
+      } else {
+        X.push_back(static_cast<float>((row * num_features + feature) * 29 % 43) / 9.f - 2.f +
+                    (feature == 0 ? 100.f : 0.f));
+      }
+    }
+  }
+
+  std::vector<float> predictions;
+  for (int64_t row = 0; row < num_rows; row++) {
+    double prediction = rho;
+    for (int64_t sv = 0; sv < num_support_vectors; sv++) {
+      double distance = 0;
+      for (int64_t feature = 0; feature < num_features; feature++) {
+        double diff = X[static_cast<size_t>(row * num_features + feature)] -
+                      support_vectors[static_cast<size_t>(sv * num_features + feature)];
+        distance += diff * diff;
+      }
+      prediction += coefficients[static_cast<size_t>(sv)] * std::exp(-gamma * distance);
+    }
+    predictions.push_back(static_cast<float>(prediction));
+  }
+
+  OpTester test("SVMRegressor", 1, onnxruntime::kMLDomain);
+  test.AddAttribute("kernel_type", std::string("RBF"));
+  test.AddAttribute("coefficients", coefficients);
+  test.AddAttribute("support_vectors", support_vectors);
+  test.AddAttribute("rho", std::vector<float>{rho});
+  test.AddAttribute("kernel_params", std::vector<float>{gamma, 0.f, 3.f});
+  test.AddAttribute("n_supports", num_support_vectors);
+
+  test.AddInput<float>("X", {num_rows, num_features}, X);
+  test.AddOutput<float>("Y", {num_rows, 1}, predictions);
+  test.Run();
+}
+
 TEST(MLOpTest, SVMRegressorLinear) {
   OpTester test("SVMRegressor", 1, onnxruntime::kMLDomain);
   std::vector<float> coefficients = {0.28290501f, -0.0266512f, 0.01674867f};
@@ -760,5 +760,83 @@ TEST(MLOpTest, TreeRegressorTrueNodeBeforeNode) {
   test.Run();
 }
 
+void GenTreeMissingTrackAndRunTest(const std::vector<float>& X, const std::vector<float>& Y, int n_trees) {
+  OpTester test("TreeEnsembleRegressor", 3, onnxruntime::kMLDomain);
+
+  std::vector<int64_t> nodes_treeids = {0, 0, 0, 0, 0, 1, 1, 1};
+  std::vector<int64_t> nodes_nodeids = {0, 1, 2, 3, 4, 0, 1, 2};
+  std::vector<int64_t> nodes_featureids = {0, 1, 0, 0, 0, 1, 0, 0};
+  std::vector<float> nodes_values = {1.f, 0.f, 0.f, 0.f, 0.f, 5.f, 0.f, 0.f};
+  std::vector<std::string> nodes_modes = {"BRANCH_LT", "BRANCH_LT", "LEAF", "LEAF", "LEAF",
+                                          "BRANCH_LT", "LEAF", "LEAF"};
+  std::vector<int64_t> nodes_truenodeids = {1, 3, 0, 0, 0, 1, 0, 0};
+  std::vector<int64_t> nodes_falsenodeids = {2, 4, 0, 0, 0, 2, 0, 0};
+  std::vector<int64_t> nodes_missing_value_tracks_true = {1, 0, 0, 0, 0, 1, 0, 0};
+
+  std::vector<int64_t> target_treeids = {0, 0, 0, 1, 1};
+  std::vector<int64_t> target_nodeids = {2, 3, 4, 1, 2};
+  std::vector<int64_t> target_ids = {0, 0, 0, 0, 0};
+  std::vector<float> target_weights = {10.f, 1.f, 2.f, 100.f, 200.f};
+
+  if (n_trees > 1) {
+    // Replicates the two trees to evaluate several trees at once for the same row.
+    _multiply_update_array(nodes_treeids, n_trees, (int64_t)2);
+    _multiply_update_array(nodes_nodeids, n_trees);
+    _multiply_update_array(nodes_featureids, n_trees);
+    _multiply_update_array(nodes_values, n_trees);
+    _multiply_update_array_string(nodes_modes, n_trees);
+    _multiply_update_array(nodes_truenodeids, n_trees);
+    _multiply_update_array(nodes_falsenodeids, n_trees);
+    _multiply_update_array(nodes_missing_value_tracks_true, n_trees);
+    _multiply_update_array(target_treeids, n_trees, (int64_t)2);
+    _multiply_update_array(target_nodeids, n_trees);
+    _multiply_update_array(target_ids, n_trees);
+    _multiply_update_array(target_weights, n_trees);
+  }
+
+  test.AddAttribute("nodes_truenodeids", nodes_truenodeids);
+  test.AddAttribute("nodes_falsenodeids", nodes_falsenodeids);
+  test.AddAttribute("nodes_treeids", nodes_treeids);
+  test.AddAttribute("nodes_nodeids", nodes_nodeids);
+  test.AddAttribute("nodes_featureids", nodes_featureids);
+  test.AddAttribute("nodes_values", nodes_values);
+  test.AddAttribute("nodes_modes", nodes_modes);
+  test.AddAttribute("nodes_missing_value_tracks_true", nodes_missing_value_tracks_true);
+  test.AddAttribute("target_treeids", target_treeids);
+  test.AddAttribute("target_nodeids", target_nodeids);
+  test.AddAttribute("target_ids", target_ids);
+  test.AddAttribute("target_weights", target_weights);
+  test.AddAttribute("n_targets", (int64_t)1);
+
+  int64_t n_rows = static_cast<int64_t>(Y.size());
+  std::vector<float> expected(Y);
+  for (auto& y : expected) {
+    y *= n_trees;
+  }
+  test.AddInput<float>("X", {n_rows, 2}, X);
+  test.AddOutput<float>("Y", {n_rows, 1}, expected);
+  test.Run();
+}
+
+TEST(MLOpTest, TreeRegressorMissingTrackBatch) {
+  // Enough rows to evaluate every tree on a block of rows at once, including a partial block,
+  // with missing values sent to the true branch on some nodes only.
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  std::vector<float> X = {0.f, -1.f, 0.f, 1.f, 2.f, 0.f, nan, -1.f, nan, nan,
+                          2.f, nan, 0.f, 6.f, 2.f, 6.f, nan, 7.f, 1.f, -3.f};
+  std::vector<float> Y = {101.f, 102.f, 110.f, 101.f, 102.f, 110.f, 202.f, 210.f, 202.f, 110.f};
+  GenTreeMissingTrackAndRunTest(X, Y, 1);
+  GenTreeMissingTrackAndRunTest(X, Y, 5);
+}
+
+TEST(MLOpTest, TreeRegressorMissingTrackOneRow) {
+  // One row evaluated on a block of trees at once.
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  GenTreeMissingTrackAndRunTest({nan, nan}, {102.f}, 5);
+  GenTreeMissingTrackAndRunTest({2.f, nan}, {110.f}, 5);
+  GenTreeMissingTrackAndRunTest({nan, 7.f}, {202.f}, 5);
+  GenTreeMissingTrackAndRunTest({0.f, 6.f}, {202.f}, 5);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -55,6 +55,15 @@ TEST(MLOpTest, ZipMapOpInt64Float1D) {
   TestHelper<int64_t>({10, 20, 30, 40, 50, 60}, "int64_t", {6});
 }
 
+// labels out of order, a repeated label keeps the value of its last column
+TEST(MLOpTest, ZipMapOpStringFloatUnsortedRepeatedLabels) {
+  OpTester test("ZipMap", 1, onnxruntime::kMLDomain);
+  test.AddAttribute("classlabels_strings", std::vector<std::string>{"c", "a", "c"});
+  test.AddInput<float>("X", {2, 3}, {1.f, 0.f, 3.f, 44.f, 23.f, 11.3f});
+  test.AddOutput<std::string, float>("Z", {{{"a", 0.f}, {"c", 3.f}}, {{"a", 23.f}, {"c", 11.3f}}});
+  test.Run();
+}
+
 // Negative test cases
 TEST(MLOpTest, ZipMapOpStringFloatStrideMoreThanNumLabels) {
   TestHelper<string>({"class1", "class2", "class3"}, "string", {1, 6}, OpTester::ExpectResult::kExpectFailure);
@@ -570,6 +570,38 @@ TEST(ConvTransposeTest, ConvTranspose_onnx_group) {
   TestConvTransposeOp(attrs, {X, W}, {X_shape, W_shape}, expected_vals, Y_shape);
 }
 
+// One input and one output channel per group takes the direct depthwise path on CPU.
+TEST(ConvTransposeTest, ConvTranspose_2D_Depthwise_Strides2_Bias) {
+  ConvTransposeOpAttributes attrs = {
+      vector<int64_t>{3, 3},        // kernel_shape
+      {},                           // output_padding
+      {},                           // output_shape
+      vector<int64_t>{1, 0, 0, 1},  // pads
+      vector<int64_t>{2, 2},        // strides
+      vector<int64_t>{1, 1},        // dilations
+      2,                            // group
+      "NOTSET"                      // auto_pad
+  };
+  vector<float> X = {-3.f, -2.f, -1.f, 0.f, 1.f, 2.f, 3.f, -3.f, -2.f, -1.f, 0.f, 1.f,
+                     2.f, 3.f, -3.f, -2.f, -1.f, 0.f, 1.f, 2.f, 3.f, -3.f, -2.f, -1.f};
+  vector<int64_t> X_shape = {2, 2, 2, 3};
+  vector<float> W = {-2.f, 1.f, -1.f, 2.f, 0.f, -2.f, 1.f, -1.f, 2.f,
+                     0.f, -2.f, 1.f, -1.f, 2.f, 0.f, -2.f, 1.f, -1.f};
+  vector<int64_t> W_shape = {2, 1, 3, 3};
+  vector<float> B = {1.f, -1.f};
+  vector<int64_t> B_shape = {2};
+  vector<int64_t> Y_shape = {2, 2, 4, 6};
+  auto expected_vals = {-5.f, 1.f, 3.f, 1.f, 3.f, 1.f, -2.f, 4.f, -9.f, 4.f, -9.f, 4.f,
+                        1.f, 1.f, 3.f, 1.f, 3.f, 1.f, 1.f, 1.f, 2.f, 0.f, 5.f, -1.f,
+                        -4.f, 5.f, 2.f, -7.f, 1.f, -5.f, -7.f, 4.f, 1.f, -4.f, 6.f, -5.f,
+                        0.f, -3.f, -1.f, -1.f, -2.f, 1.f, 1.f, -2.f, 0.f, -1.f, -3.f, 0.f,
+                        5.f, 1.f, 3.f, 1.f, -11.f, 1.f, 7.f, -3.f, 12.f, -3.f, 5.f, 4.f,
+                        -3.f, 1.f, 3.f, 1.f, 3.f, 1.f, -1.f, 3.f, -4.f, 2.f, -1.f, 1.f,
+                        -2.f, 1.f, -3.f, 3.f, -4.f, 5.f, -3.f, 6.f, -9.f, 5.f, -11.f, 4.f,
+                        2.f, -7.f, 1.f, -5.f, 0.f, -3.f, 5.f, -4.f, 6.f, -3.f, 3.f, -2.f};
+  TestConvTransposeOp(attrs, {X, W, B}, {X_shape, W_shape, B_shape}, expected_vals, Y_shape);
+}
+
 TEST(ConvTransposeTest, ConvTranspose_2D_Dilation_1) {
   ConvTransposeOpAttributes attrs = {
       vector<int64_t>{2, 2},
@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <limits>
+
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
 
@@ -383,5 +385,50 @@ TEST(NonMaxSuppressionOpTest, WithIOUThresholdOpset11) {
   test.Run();
 }
 
+TEST(NonMaxSuppressionOpTest, NaNScores) {
+  // NaN scores rank below every finite score, ties are broken by the box index, and a score_threshold drops them.
+  // The boxes do not overlap so that the order is decided by the scores alone.
+  constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+  const std::vector<float> boxes = {0.0f, 0.0f, 1.0f, 1.0f,
+                                    0.0f, 10.0f, 1.0f, 11.0f,
+                                    0.0f, 20.0f, 1.0f, 21.0f,
+                                    0.0f, 30.0f, 1.0f, 31.0f,
+                                    0.0f, 40.0f, 1.0f, 41.0f,
+                                    0.0f, 50.0f, 1.0f, 51.0f};
+  const std::vector<float> scores = {nan, 0.5f, nan, 0.9f, 0.1f, nan};
+
+  {
+    OpTester test("NonMaxSuppression", 11, kOnnxDomain);
+    test.AddInput<float>("boxes", {1, 6, 4}, boxes);
+    test.AddInput<float>("scores", {1, 1, 6}, scores);
+    test.AddInput<int64_t>("max_output_boxes_per_class", {}, {6L});
+    test.AddInput<float>("iou_threshold", {}, {0.5f});
+    test.AddOutput<int64_t>("selected_indices", {6, 3},
+                            {0L, 0L, 3L,
+                             0L, 0L, 1L,
+                             0L, 0L, 4L,
+                             0L, 0L, 0L,
+                             0L, 0L, 2L,
+                             0L, 0L, 5L});
+    test.Run(OpTester::ExpectResult::kExpectSuccess, "",
+             {kCudaExecutionProvider, kRocmExecutionProvider, kDmlExecutionProvider, kTensorrtExecutionProvider});
+  }
+
+  {
+    OpTester test("NonMaxSuppression", 11, kOnnxDomain);
+    test.AddInput<float>("boxes", {1, 6, 4}, boxes);
+    test.AddInput<float>("scores", {1, 1, 6}, scores);
+    test.AddInput<int64_t>("max_output_boxes_per_class", {}, {6L});
+    test.AddInput<float>("iou_threshold", {}, {0.5f});
+    test.AddInput<float>("score_threshold", {}, {0.0f});
+    test.AddOutput<int64_t>("selected_indices", {3, 3},
+                            {0L, 0L, 3L,
+                             0L, 0L, 1L,
+                             0L, 0L, 4L});
+    test.Run(OpTester::ExpectResult::kExpectSuccess, "",
+             {kCudaExecutionProvider, kRocmExecutionProvider, kDmlExecutionProvider, kTensorrtExecutionProvider});
+  }
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -1120,6 +1120,160 @@ TEST(GRUTest, ONNXRuntime_TestGRUOpSequenceLengthAllZeros) {
   ctx.RunTest(X, batch, seq_length, sequence_length, &initial_h, expected_Y, expected_Y_h);
 }
 
+TEST(GRUTest, ONNXRuntime_TestGRUOpForwardSequenceLengthDecreasingInBatch) {
+  // TODO: Unskip when fixed #41968513
+  if (DefaultDmlExecutionProvider().get() != nullptr) {
+    GTEST_SKIP() << "Skipping because of the following error: MLOperatorAuthorImpl.cpp(1817): The parameter is incorrect.";
+  }
+
+  const std::string direction = "forward";
+  const std::vector<std::string> activations = {"sigmoid", "tanh"};
+
+  DeepCpuGruOpTestContext ctx(direction, activations);
+
+  constexpr int batch = 4;
+  constexpr int seq_length = 3;
+  std::vector<float> X = {-0.455351f, -0.276391f,
+                          0.855351f, 0.676391f,
+                          -0.185934f, -0.269585f,
+                          -0.585934f, 0.669585f,
+
+                          -0.351455f, -0.391276f,
+                          0.670351f, 0.894676f,
+                          0.987653f, 1.876567f,
+                          -1.234357f, -0.775668f,
+
+                          0.213425f, -0.562345f,
+                          -0.734521f, 0.112354f,
+                          0.456712f, 0.345234f,
+                          0.998734f, -0.674321f};
+  // the lengths decrease along the batch, so fewer rows are active at every step
+  std::vector<int> sequence_length = {3, 2, 2, 1};
+  std::vector<float> initial_h(batch * 2, 0.0f);
+
+  std::vector<float> expected_Y = {-0.0325528602f, 0.0774837992f,
+                                   -0.275918532f, -0.00228558835f,
+                                   -0.0456649923f, 0.0462125237f,
+                                   -0.149407104f, 0.135634878f,
+
+                                   -0.0296092678f, 0.0888017912f,
+                                   -0.42056434f, 0.0630278056f,
+                                   -0.434033873f, 0.111476844f,
+                                   0.0f, 0.0f,
+
+                                   -0.0161053302f, -0.0180457669f,
+                                   0.0f, 0.0f,
+                                   0.0f, 0.0f,
+                                   0.0f, 0.0f};
+
+  std::vector<float> expected_Y_h = {-0.0161053302f, -0.0180457669f,
+                                     -0.42056434f, 0.0630278056f,
+                                     -0.434033873f, 0.111476844f,
+                                     -0.149407104f, 0.135634878f};
+
+  ctx.RunTest(X, batch, seq_length, sequence_length, &initial_h, expected_Y, expected_Y_h);
+
+  std::vector<float> expected_Y_linear_before_reset = {-0.0325528602f, 0.0774837992f,
+                                                       -0.275918532f, -0.00228558835f,
+                                                       -0.0456649923f, 0.0462125237f,
+                                                       -0.149407104f, 0.135634878f,
+
+                                                       -0.0317345391f, 0.089868215f,
+                                                       -0.420526723f, 0.0689489973f,
+                                                       -0.434483988f, 0.112410983f,
+                                                       0.0f, 0.0f,
+
+                                                       -0.0196923125f, -0.01637081f,
+                                                       0.0f, 0.0f,
+                                                       0.0f, 0.0f,
+                                                       0.0f, 0.0f};
+
+  std::vector<float> expected_Y_h_linear_before_reset = {-0.0196923125f, -0.01637081f,
+                                                         -0.420526723f, 0.0689489973f,
+                                                         -0.434483988f, 0.112410983f,
+                                                         -0.149407104f, 0.135634878f};
+
+  ctx.RunTest(X, batch, seq_length, sequence_length, &initial_h,
+              expected_Y_linear_before_reset, expected_Y_h_linear_before_reset, true);
+}
+
+TEST(GRUTest, ONNXRuntime_TestGRUOpReverseSequenceLengthDecreasingInBatch) {
+  // TODO: Unskip when fixed #41968513
+  if (DefaultDmlExecutionProvider().get() != nullptr) {
+    GTEST_SKIP() << "Skipping because of the following error: MLOperatorAuthorImpl.cpp(1817): The parameter is incorrect.";
+  }
+
+  const std::string direction = "reverse";
+  const std::vector<std::string> activations = {"sigmoid", "tanh"};
+
+  DeepCpuGruOpTestContext ctx(direction, activations);
+
+  constexpr int batch = 4;
+  constexpr int seq_length = 3;
+  std::vector<float> X = {-0.455351f, -0.276391f,
+                          0.855351f, 0.676391f,
+                          -0.185934f, -0.269585f,
+                          -0.585934f, 0.669585f,
+
+                          -0.351455f, -0.391276f,
+                          0.670351f, 0.894676f,
+                          0.987653f, 1.876567f,
+                          -1.234357f, -0.775668f,
+
+                          0.213425f, -0.562345f,
+                          -0.734521f, 0.112354f,
+                          0.456712f, 0.345234f,
+                          0.998734f, -0.674321f};
+  // the lengths decrease along the batch, so fewer rows are active at every step
+  std::vector<int> sequence_length = {3, 2, 2, 1};
+  std::vector<float> initial_h(batch * 2, 0.0f);
+
+  std::vector<float> expected_Y = {-0.0467601186f, 0.0962100042f,
+                                   -0.400469483f, 0.0382424308f,
+                                   -0.253458786f, 0.116621045f,
+                                   -0.149407104f, 0.135634878f,
+
+                                   -0.0307573976f, 0.0390016835f,
+                                   -0.286650009f, 0.044850663f,
+                                   -0.412174019f, 0.0858790953f,
+                                   0.0f, 0.0f,
+
+                                   -0.01253324f, -0.0466096471f,
+                                   0.0f, 0.0f,
+                                   0.0f, 0.0f,
+                                   0.0f, 0.0f};
+
+  std::vector<float> expected_Y_h = {-0.0467601186f, 0.0962100042f,
+                                     -0.400469483f, 0.0382424308f,
+                                     -0.253458786f, 0.116621045f,
+                                     -0.149407104f, 0.135634878f};
+
+  ctx.RunTest(X, batch, seq_length, sequence_length, &initial_h, expected_Y, expected_Y_h);
+
+  std::vector<float> expected_Y_linear_before_reset = {-0.0470167169f, 0.097211551f,
+                                                       -0.401283422f, 0.0447379794f,
+                                                       -0.255236353f, 0.125862477f,
+                                                       -0.149407104f, 0.135634878f,
+
+                                                       -0.0294399821f, 0.0394293013f,
+                                                       -0.286650009f, 0.044850663f,
+                                                       -0.412174019f, 0.0858790953f,
+                                                       0.0f, 0.0f,
+
+                                                       -0.01253324f, -0.0466096471f,
+                                                       0.0f, 0.0f,
+                                                       0.0f, 0.0f,
+                                                       0.0f, 0.0f};
+
+  std::vector<float> expected_Y_h_linear_before_reset = {-0.0470167169f, 0.097211551f,
+                                                         -0.401283422f, 0.0447379794f,
+                                                         -0.255236353f, 0.125862477f,
+                                                         -0.149407104f, 0.135634878f};
+
+  ctx.RunTest(X, batch, seq_length, sequence_length, &initial_h,
+              expected_Y_linear_before_reset, expected_Y_h_linear_before_reset, true);
+}
+
 TEST(GRUTest, ONNXRuntime_TestGRUOpSingleBatchMultipleHiddenThreads) {
   // TODO: Unskip when fixed #41968513
   if (DefaultDmlExecutionProvider().get() != nullptr) {
@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <cmath>
 #include <functional>
 #include <vector>
 
@@ -116,6 +117,43 @@ TEST(SignalOpsTest, DFT20_Float_inverse) {
   TestInverseFloat(kOpsetVersion20);
 }
 
+// Compares against a naive DFT for lengths covering the mixed-radix path (radix 2/3/4/5 and generic
+// prime butterflies), Bluestein's algorithm for large prime factors and the real-input half-length path.
+TEST(SignalOpsTest, DFT20_Float_mixed_radix) {
+  RandomValueGenerator random(GetTestRandomSeed());
+  for (int64_t length : {6, 12, 30, 49, 400, 480, 97, 202, 1009}) {
+    for (bool onesided : {false, true}) {
+      OpTester test("DFT", kOpsetVersion20);
+      vector<int64_t> shape{2, length, 1};
+      vector<float> input = random.Uniform<float>(shape, -1.f, 1.f);
+      const int64_t bins = onesided ? (1 + (length >> 1)) : length;
+
+      vector<float> expected_output;
+      expected_output.reserve(static_cast<size_t>(2 * bins * 2));
+      for (int64_t b = 0; b < 2; b++) {
+        for (int64_t k = 0; k < bins; k++) {
+          double re = 0, im = 0;
+          for (int64_t n = 0; n < length; n++) {
+            const double theta = -2.0 * 3.14159265358979323846 * static_cast<double>((k * n) % length) / length;
+            re += input[static_cast<size_t>(b * length + n)] * std::cos(theta);
+            im += input[static_cast<size_t>(b * length + n)] * std::sin(theta);
+          }
+          expected_output.push_back(static_cast<float>(re));
+          expected_output.push_back(static_cast<float>(im));
+        }
+      }
+
+      test.AddInput<float>("input", shape, input);
+      test.AddInput<int64_t>("dft_length", {}, {length});
+      test.AddInput<int64_t>("axis", {}, {1});
+      test.AddAttribute<int64_t>("onesided", static_cast<int64_t>(onesided));
+      test.AddOutput<float>("output", {2, bins, 2}, expected_output);
+      test.SetOutputAbsErr("output", 0.0005f);
+      test.Run();
+    }
+  }
+}
+
 // Tests that FFT(FFT(x), inverse=true) == x
 static void TestDFTInvertible(bool complex, int since_version) {
   // TODO: test dft_length
@@ -233,6 +271,34 @@ TEST(SignalOpsTest, STFTFloat) {
   test.Run();
 }
 
+TEST(SignalOpsTest, STFTComplexFloat) {
+  OpTester test("STFT", kMinOpsetVersion);
+  test.AddAttribute<int64_t>("onesided", static_cast<int64_t>(0));
+
+  // Every sample is distinct so that frames starting at the wrong sample give different spectra.
+  vector<float> signal = {1.0f, 0.0f, 2.0f, 1.0f, 3.0f, 4.0f, 4.0f, 4.0f,
+                          5.0f, 1.0f, 6.0f, 0.0f, 7.0f, 1.0f, 8.0f, 4.0f,
+
+                          9.0f, -2.0f, 10.0f, -1.0f, 11.0f, 2.0f, 12.0f, 2.0f,
+                          13.0f, -1.0f, 14.0f, -2.0f, 15.0f, -1.0f, 16.0f, 2.0f};
+  test.AddInput<float>("signal", {2, 8, 2}, signal);
+  test.AddInput<int64_t>("frame_step", {}, {2});
+  test.AddInput<float>("window", {4}, {0.5f, 1.0f, 1.0f, 0.5f});
+  test.AddInput<int64_t>("frame_length", {}, {4});
+
+  vector<int64_t> output_shape = {2, 3, 4, 2};
+  vector<float> expected_output = {
+      7.5f, 7.0f, -3.5f, -4.0f, -0.5f, 1.0f, -1.5f, -4.0f,
+      13.5f, 7.0f, 0.5f, 0.0f, -0.5f, -1.0f, -7.5f, 2.0f,
+      19.5f, 3.5f, -6.5f, -2.5f, -0.5f, -0.5f, -2.5f, 1.5f,
+
+      31.5f, 1.0f, -8.5f, -7.0f, -0.5f, 1.0f, -4.5f, 1.0f,
+      37.5f, 1.0f, -4.5f, -3.0f, -0.5f, -1.0f, -10.5f, 7.0f,
+      43.5f, -2.5f, -11.5f, -5.5f, -0.5f, -0.5f, -5.5f, 6.5f};
+  test.AddOutput<float>("output", output_shape, expected_output);
+  test.Run();
+}
+
 TEST(SignalOpsTest, HannWindowFloat) {
   OpTester test("HannWindow", kMinOpsetVersion);
 
@@ -158,6 +158,84 @@ TEST(CastOpTest, NonStringTypes) {
       CastNonStringTester{});
 }
 
+// large enough to be split over threads and to leave a remainder after the vectorized float16 conversions
+TEST(CastOpTest, Float16LargeTensor) {
+  const std::vector<int64_t> shape{3, 1027};
+  std::vector<float> float_values(3 * 1027);
+  for (size_t i = 0; i < float_values.size(); ++i) {
+    float_values[i] = (static_cast<float>(i % 2053) - 1000.5f) / 7.0f;
+  }
+
+  const std::vector<MLFloat16> float16_values = CastedValues<float, MLFloat16>(gsl::make_span(float_values));
+  TestCastOp<float, MLFloat16>(gsl::make_span(float_values), gsl::make_span(float16_values), shape);
+
+  const std::vector<float> widened_values = CastedValues<MLFloat16, float>(gsl::make_span(float16_values));
+  TestCastOp<MLFloat16, float>(gsl::make_span(float16_values), gsl::make_span(widened_values), shape);
+
+  const std::vector<int32_t> int_values = CastedValues<MLFloat16, int32_t>(gsl::make_span(float16_values));
+  TestCastOp<MLFloat16, int32_t>(gsl::make_span(float16_values), gsl::make_span(int_values), shape);
+
+  const std::vector<double> double_values = CastedValues<float, double>(gsl::make_span(float_values));
+  const std::vector<MLFloat16> narrowed_values = CastedValues<double, MLFloat16>(gsl::make_span(double_values));
+  TestCastOp<double, MLFloat16>(gsl::make_span(double_values), gsl::make_span(narrowed_values), shape);
+}
+
+template <typename SrcType, typename DstType>
+void TestCastOpWithIntraOpThreads(const std::vector<SrcType>& input, const std::vector<int64_t>& shape) {
+  SCOPED_TRACE(
+      onnxruntime::MakeString(
+          "Cast from type ", utils::ToTensorProtoElementType<SrcType>(),
+          " to type ", utils::ToTensorProtoElementType<DstType>()));
+
+  OpTester test("Cast", 13);
+  test.AddAttribute<int64_t>("to", utils::ToTensorProtoElementType<DstType>());
+  test.AddInput<SrcType>("input", shape, input);
+  test.AddOutput<DstType>("output", shape, CastedValues<SrcType, DstType>(gsl::make_span(input)));
+  RunWithIntraOpThreads(test);
+}
+
+// large enough for the cost model to split each conversion over two threads, and checked against the serial run.
+// the special float values add rounding ties, infinities and denormals for the conversions to bfloat16.
+TEST(CastOpTest, ParallelMatchesSerial) {
+  const std::vector<int64_t> shape{3, 35001};
+  std::vector<float> float_values(3 * 35001);
+  for (size_t i = 0; i < float_values.size(); ++i) {
+    float_values[i] = (static_cast<float>(i % 2053) - 1000.5f) / 7.0f;
+  }
+
+  std::vector<float> special_float_values = float_values;
+  special_float_values[1] = 1.00390625f;  // halfway between two bfloat16 values, rounds to even
+  special_float_values[2] = 1.01171875f;
+  special_float_values[3] = std::numeric_limits<float>::infinity();
+  special_float_values[4] = -std::numeric_limits<float>::infinity();
+  special_float_values[5] = std::numeric_limits<float>::denorm_min() * 12345;
+  special_float_values.back() = -std::numeric_limits<float>::denorm_min() * 54321;
+
+  std::vector<int32_t> int32_values(float_values.size());
+  for (size_t i = 0; i < int32_values.size(); ++i) {
+    int32_values[i] = static_cast<int32_t>(i * 2654435761u);
+  }
+  std::vector<int64_t> int64_values(float_values.size());
+  for (size_t i = 0; i < int64_values.size(); ++i) {
+    int64_values[i] = static_cast<int64_t>(i) * 40503 - 1000000000;
+  }
+
+  const std::vector<BFloat16> bfloat16_values = CastedValues<float, BFloat16>(gsl::make_span(float_values));
+  const std::vector<BFloat16> special_bfloat16_values =
+      CastedValues<float, BFloat16>(gsl::make_span(special_float_values));
+  const std::vector<MLFloat16> float16_values = CastedValues<float, MLFloat16>(gsl::make_span(float_values));
+
+  TestCastOpWithIntraOpThreads<float, BFloat16>(special_float_values, shape);
+  TestCastOpWithIntraOpThreads<BFloat16, float>(special_bfloat16_values, shape);
+  TestCastOpWithIntraOpThreads<float, MLFloat16>(special_float_values, shape);
+  TestCastOpWithIntraOpThreads<MLFloat16, float>(float16_values, shape);
+  TestCastOpWithIntraOpThreads<MLFloat16, BFloat16>(float16_values, shape);
+  TestCastOpWithIntraOpThreads<BFloat16, int32_t>(bfloat16_values, shape);
+  TestCastOpWithIntraOpThreads<int64_t, BFloat16>(int64_values, shape);
+  TestCastOpWithIntraOpThreads<int32_t, float>(int32_values, shape);
+  TestCastOpWithIntraOpThreads<float, int32_t>(float_values, shape);
+}
+
 TEST(CastOpTest, FromString) {
   const std::vector<int64_t> shape{2, 2, 2};
   const std::vector<std::string> string_data = {"-inf", "+INF", "0.9767611", "0.28280696",
@@ -186,6 +264,24 @@ TEST(CastOpTest, FromString) {
   TestCastOp(gsl::make_span(int_64_string_data), gsl::make_span(int_64_output), shape);
 }
 
+#if !defined(ORT_NO_EXCEPTIONS)
+// a string that can't be parsed must fail the Run instead of terminating the process, including when the
+// tensor is large enough to be split over threads
+TEST(CastOpTest, FromInvalidString) {
+  const std::vector<int64_t> shape{4, 1024};
+  std::vector<std::string> string_data(4 * 1024, "1.5");
+  string_data[3 * 1024 + 7] = "not a number";
+
+  const std::vector<float> float_output(string_data.size(), 1.5f);
+  TestCastOp(gsl::make_span(string_data), gsl::make_span(float_output), shape,
+             OpTester::ExpectResult::kExpectFailure, "stod");
+
+  const std::vector<int64_t> int_64_output(string_data.size(), 1);
+  TestCastOp(gsl::make_span(string_data), gsl::make_span(int_64_output), shape,
+             OpTester::ExpectResult::kExpectFailure, "stoll");
+}
+#endif
+
 TEST(CastOpTest, ToString) {
   const std::vector<int64_t> shape{2, 2, 2};
   const std::vector<float> float_input = {NAN, -1.f, 0.0391877927f, 0.296140194f, -0.120196559f, 5.0f,
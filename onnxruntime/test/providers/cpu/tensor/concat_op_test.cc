@@ -426,5 +426,25 @@ TEST(ConcatOpTest, Concat4D_2) {
   test.Run();
 }
 
+// the output is large enough for the parallel copy to be split over two threads, including within the rows
+TEST(ConcatOpTest, Concat2D_Parallel) {
+  constexpr int64_t rows = 256, cols1 = 300, cols2 = 724;
+  std::vector<float> input1(rows * cols1), input2(rows * cols2), output;
+  output.reserve(rows * (cols1 + cols2));
+  for (size_t i = 0; i < input1.size(); ++i) input1[i] = static_cast<float>(i);
+  for (size_t i = 0; i < input2.size(); ++i) input2[i] = -static_cast<float>(i);
+  for (int64_t row = 0; row < rows; ++row) {
+    output.insert(output.end(), input1.begin() + row * cols1, input1.begin() + (row + 1) * cols1);
+    output.insert(output.end(), input2.begin() + row * cols2, input2.begin() + (row + 1) * cols2);
+  }
+
+  OpTester test("Concat");
+  test.AddAttribute("axis", int64_t{1});
+  test.AddInput<float>("input1", {rows, cols1}, input1);
+  test.AddInput<float>("input2", {rows, cols2}, input2);
+  test.AddOutput<float>("concat_result", {rows, cols1 + cols2}, output);
+  RunWithIntraOpThreads(test);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
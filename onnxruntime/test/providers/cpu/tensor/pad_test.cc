@@ -1089,5 +1089,26 @@ TEST(PadOpTest, ConstantPadNegativeAxes) {
   test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kNnapiExecutionProvider});
 }
 
+// the output is large enough for the rows to be written by two threads, with whole rows of padding before and after
+TEST(PadOpTest, ConstantPadParallel) {
+  constexpr int64_t rows = 256, cols = 1000, row_pad = 1, col_pad = 12;
+  constexpr int64_t output_rows = rows + 2 * row_pad, output_cols = cols + 2 * col_pad;
+  std::vector<float> input(rows * cols);
+  for (size_t i = 0; i < input.size(); ++i) input[i] = static_cast<float>(i);
+
+  std::vector<float> output(output_rows * output_cols, -1.0f);
+  for (int64_t row = 0; row < rows; ++row) {
+    std::copy_n(input.begin() + row * cols, cols, output.begin() + (row + row_pad) * output_cols + col_pad);
+  }
+
+  OpTester test("Pad", 13);
+  test.AddAttribute("mode", "constant");
+  test.AddInput<float>("data", {rows, cols}, input);
+  test.AddInput<int64_t>("pads", {4}, {row_pad, col_pad, row_pad, col_pad}, true /* pads_is_initializer */);
+  test.AddInput<float>("value", {}, {-1.0f}, true /* value_is_initializer */);
+  test.AddOutput<float>("output", {output_rows, output_cols}, output);
+  RunWithIntraOpThreads(test);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -510,6 +510,104 @@ TEST(QuantizeLinearOpTest, Per_Channel_Axis_neg) {
   test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  // TensorRT doesn't support support UINT8 for quantization
 }
 
+// per-channel blocks that are split into several chunks, with a partial chunk at the end of each block
+TEST(DequantizeLinearOpTest, Per_Channel_Large_Blocks) {
+  constexpr int64_t block_size = 300;
+  const std::vector<float> scales{0.5f, 2.0f, 0.125f};
+  const std::vector<int8_t> zero_points{-3, 0, 7};
+  std::vector<int64_t> dims{2, 3, block_size};
+
+  std::vector<int8_t> x;
+  std::vector<float> y;
+  std::vector<MLFloat16> y_fp16;
+  for (int64_t i = 0; i < 2 * 3 * block_size; i++) {
+    const size_t channel = static_cast<size_t>((i / block_size) % 3);
+    const int8_t value = static_cast<int8_t>(i * 7 % 256 - 128);
+    x.push_back(value);
+    y.push_back(static_cast<float>(value - zero_points[channel]) * scales[channel]);
+    y_fp16.push_back(MLFloat16(y.back()));
+  }
+
+  OpTester test("DequantizeLinear", 13);
+  test.AddAttribute<int64_t>("axis", 1);
+  test.AddInput<int8_t>("x", dims, x);
+  test.AddInput<float>("x_scale", {3}, scales);
+  test.AddInput<int8_t>("x_zero_point", {3}, zero_points);
+  test.AddOutput<float>("y", dims, y);
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+
+  OpTester test_fp16("DequantizeLinear", 19);
+  test_fp16.AddAttribute<int64_t>("axis", 1);
+  test_fp16.AddInput<int8_t>("x", dims, x);
+  test_fp16.AddInput<MLFloat16>("x_scale", {3}, {MLFloat16(0.5f), MLFloat16(2.0f), MLFloat16(0.125f)});
+  test_fp16.AddInput<int8_t>("x_zero_point", {3}, zero_points);
+  test_fp16.AddOutput<MLFloat16>("y", dims, y_fp16);
+  test_fp16.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+}
+
+// int32 values of bias magnitude, per tensor and per channel, in blocks long enough for the vectorized kernel
+TEST(DequantizeLinearOpTest, Int32_Large_Blocks) {
+  constexpr int64_t block_size = 150;
+  const std::vector<float> scales{0.001f, 0.25f, 3.0f};
+  const std::vector<int32_t> zero_points{-1000, 0, 123456};
+  std::vector<int64_t> dims{2, 3, block_size};
+
+  std::vector<int32_t> x;
+  std::vector<float> y_per_tensor;
+  std::vector<float> y_per_channel;
+  for (int64_t i = 0; i < 2 * 3 * block_size; i++) {
+    const size_t channel = static_cast<size_t>((i / block_size) % 3);
+    const int32_t value = static_cast<int32_t>((i * 7919) % 2000001) - 1000000;
+    x.push_back(value);
+    y_per_tensor.push_back(static_cast<float>(value - zero_points[0]) * scales[0]);
+    y_per_channel.push_back(static_cast<float>(value - zero_points[channel]) * scales[channel]);
+  }
+
+  // Disable Tensorrt EP due to error, only activation types allowed as input to this layer.
+  // Disable CUDA, ROCm EP, there is no implementation for int32_t.
+  OpTester test("DequantizeLinear", 13);
+  test.AddInput<int32_t>("x", dims, x);
+  test.AddInput<float>("x_scale", {}, {scales[0]});
+  test.AddInput<int32_t>("x_zero_point", {}, {zero_points[0]});
+  test.AddOutput<float>("y", dims, y_per_tensor);
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "",
+           {kTensorrtExecutionProvider, kCudaExecutionProvider, kRocmExecutionProvider});
+
+  OpTester test_per_channel("DequantizeLinear", 13);
+  test_per_channel.AddAttribute<int64_t>("axis", 1);
+  test_per_channel.AddInput<int32_t>("x", dims, x);
+  test_per_channel.AddInput<float>("x_scale", {3}, scales);
+  test_per_channel.AddInput<int32_t>("x_zero_point", {3}, zero_points);
+  test_per_channel.AddOutput<float>("y", dims, y_per_channel);
+  test_per_channel.Run(OpTester::ExpectResult::kExpectSuccess, "",
+                       {kTensorrtExecutionProvider, kCudaExecutionProvider, kRocmExecutionProvider});
+}
+
+// per-channel quantization of many blocks, each split into several chunks
+TEST(QuantizeLinearOpTest, Per_Channel_Large_Blocks) {
+  constexpr int64_t block_size = 300;
+  const std::vector<float> scales{0.5f, 2.0f, 0.25f};
+  const std::vector<uint8_t> zero_points{10, 128, 200};
+  std::vector<int64_t> dims{4, 3, block_size};
+
+  std::vector<float> x;
+  std::vector<uint8_t> y;
+  for (int64_t i = 0; i < 4 * 3 * block_size; i++) {
+    const size_t channel = static_cast<size_t>((i / block_size) % 3);
+    const int32_t q = static_cast<int32_t>(i * 13 % 300) - 20;
+    x.push_back(static_cast<float>(q - zero_points[channel]) * scales[channel]);
+    y.push_back(static_cast<uint8_t>(std::min(255, std::max(0, q))));
+  }
+
+  OpTester test("QuantizeLinear", 13);
+  test.AddAttribute<int64_t>("axis", 1);
+  test.AddInput<float>("x", dims, x);
+  test.AddInput<float>("y_scale", {3}, scales);
+  test.AddInput<uint8_t>("y_zero_point", {3}, zero_points);
+  test.AddOutput<uint8_t>("y", dims, y);
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  // TensorRT doesn't support support UINT8 for quantization
+}
+
 #if !defined(DISABLE_FLOAT8_TYPES)
 
 template <typename InT, typename OutT>
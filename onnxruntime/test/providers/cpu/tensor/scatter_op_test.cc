@@ -452,5 +452,33 @@ TEST(ScatterElements, MinReduction_Double) {
   test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});
 }
 
+// large enough for the copy of the data and the updates along axis 1 to be split over two threads. The indices
+// repeat within each row, so the additions for a row must still be applied in order.
+TEST(ScatterElements, AddReductionAxis1Parallel) {
+  constexpr int64_t rows = 512, cols = 512, updates_per_row = 256;
+  std::vector<float> data(rows * cols), updates(rows * updates_per_row);
+  std::vector<int64_t> indices(rows * updates_per_row);
+  for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<float>(i % 1000);
+
+  std::vector<float> output = data;
+  for (int64_t row = 0; row < rows; ++row) {
+    for (int64_t i = 0; i < updates_per_row; ++i) {
+      const size_t update = static_cast<size_t>(row * updates_per_row + i);
+      indices[update] = (row * 7 + i * 13) % 64;
+      updates[update] = static_cast<float>(i % 5);
+      output[static_cast<size_t>(row * cols + indices[update])] += updates[update];
+    }
+  }
+
+  OpTester test("ScatterElements", 18);
+  test.AddAttribute<int64_t>("axis", 1);
+  test.AddAttribute<std::string>("reduction", "add");
+  test.AddInput<float>("data", {rows, cols}, data);
+  test.AddInput<int64_t>("indices", {rows, updates_per_row}, indices);
+  test.AddInput<float>("updates", {rows, updates_per_row}, updates);
+  test.AddOutput<float>("y", {rows, cols}, output);
+  RunWithIntraOpThreads(test);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -815,5 +815,27 @@ TEST(SplitOperatorTest, Split18_NumOutputsUnevenSplitAxis1) {
   RunTest<float>(axis, {}, input, outputs, {kTensorrtExecutionProvider, kQnnExecutionProvider}, false, true, num_outputs, false);
 }
 
+// the input is large enough for the parallel copy to be split over two threads, including within the rows
+TEST(SplitOperatorTest, Axis1Parallel) {
+  constexpr int64_t rows = 256, cols1 = 300, cols2 = 724;
+  std::vector<float> input, output1, output2;
+  input.reserve(rows * (cols1 + cols2));
+  for (int64_t row = 0; row < rows; ++row) {
+    for (int64_t col = 0; col < cols1 + cols2; ++col) {
+      const float value = static_cast<float>(row * 10000 + col);
+      input.push_back(value);
+      (col < cols1 ? output1 : output2).push_back(value);
+    }
+  }
+
+  OpTester test("Split", 13);
+  test.AddAttribute<int64_t>("axis", 1);
+  test.AddInput<float>("input", {rows, cols1 + cols2}, input);
+  test.AddInput<int64_t>("split", {2}, {cols1, cols2}, true);
+  test.AddOutput<float>("output1", {rows, cols1}, output1);
+  test.AddOutput<float>("output2", {rows, cols2}, output2);
+  RunWithIntraOpThreads(test);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
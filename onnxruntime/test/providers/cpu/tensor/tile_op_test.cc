@@ -257,5 +257,37 @@ TEST(TensorOpTest, TileBoolType) { RunTestWrapperForBool(); }
 TEST(TensorOpTest, TileMLFloat16Type) { RunTestWrapper<MLFloat16>(); }
 #endif
 
+// the outputs are large enough for the parallel copy to be split over two threads, for a repeat of the whole input
+// and for a repeat of each row
+TEST(TensorOpTest, TileParallel) {
+  constexpr int64_t rows = 256, cols = 256, copies = 4;
+  std::vector<float> input(rows * cols);
+  for (size_t i = 0; i < input.size(); ++i) input[i] = static_cast<float>(i);
+
+  std::vector<float> output_repeat_input;
+  for (int64_t copy = 0; copy < copies; ++copy) {
+    output_repeat_input.insert(output_repeat_input.end(), input.begin(), input.end());
+  }
+
+  std::vector<float> output_repeat_rows;
+  for (int64_t row = 0; row < rows; ++row) {
+    for (int64_t copy = 0; copy < copies; ++copy) {
+      output_repeat_rows.insert(output_repeat_rows.end(), input.begin() + row * cols, input.begin() + (row + 1) * cols);
+    }
+  }
+
+  OpTester repeat_input_test("Tile");
+  repeat_input_test.AddInput<float>("input", {rows, cols}, input);
+  repeat_input_test.AddInput<int64_t>("repeats", {2}, {copies, 1}, true);
+  repeat_input_test.AddOutput<float>("output", {rows * copies, cols}, output_repeat_input);
+  RunWithIntraOpThreads(repeat_input_test);
+
+  OpTester repeat_rows_test("Tile");
+  repeat_rows_test.AddInput<float>("input", {rows, cols}, input);
+  repeat_rows_test.AddInput<int64_t>("repeats", {2}, {1, copies}, true);
+  repeat_rows_test.AddOutput<float>("output", {rows, cols * copies}, output_repeat_rows);
+  RunWithIntraOpThreads(repeat_rows_test);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
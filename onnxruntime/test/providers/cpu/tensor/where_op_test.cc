@@ -146,5 +146,24 @@ TEST(WhereOpTest, BroadcastWithScalar) {
   test.Run();
 }
 
+// large enough for the select to be split over two threads, with a single value for Y
+TEST(WhereOpTest, Parallel) {
+  constexpr int64_t rows = 256, cols = 512;
+  std::vector<float> X(rows * cols), output(rows * cols);
+  std::unique_ptr<bool[]> condition = std::make_unique<bool[]>(rows * cols);
+  for (size_t i = 0; i < X.size(); ++i) {
+    X[i] = static_cast<float>(i);
+    condition[i] = i % 3 != 0;
+    output[i] = condition[i] ? X[i] : -1.0f;
+  }
+
+  OpTester test("Where", 16);
+  test.AddInput<bool>("condition", {rows, cols}, condition.get(), rows * cols);
+  test.AddInput<float>("X", {rows, cols}, X);
+  test.AddInput<float>("Y", {}, {-1.0f});
+  test.AddOutput<float>("output", {rows, cols}, output);
+  RunWithIntraOpThreads(test);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
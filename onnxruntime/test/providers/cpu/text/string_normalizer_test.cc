@@ -194,6 +194,29 @@ TEST(ContribOpTest, StringNormalizerInsensitiveFilterOutUpperWithLocale) {
   test.Run(OpTester::ExpectResult::kExpectSuccess);
 }
 
+TEST(ContribOpTest, StringNormalizerInsensitiveFilterOutLowerManyStrings) {
+  // - case-INSENSITIVE approach en_US locale
+  // - enough strings to be processed in several blocks, mixing ASCII strings longer
+  //   than 8 bytes with non-ASCII strings
+  // - filter out monday in any case
+  OpTester test("StringNormalizer", opset_ver, domain);
+  InitTestAttr(test, "LOWER", false, {"MONDAY"}, test_locale);
+  const std::vector<std::string> words = {"The Quick Brown Fox Jumps Over", "Monday", "mOnDaY", "ÉCOLE Élémentaire",
+                                          "TUESDAY 123 [@`{]"};
+  const std::vector<std::string> lowered = {"the quick brown fox jumps over", "école élémentaire",
+                                            "tuesday 123 [@`{]"};
+  constexpr int64_t repeats = 100;
+  std::vector<std::string> input;
+  std::vector<std::string> output;
+  for (int64_t i = 0; i < repeats; ++i) {
+    input.insert(input.end(), words.begin(), words.end());
+    output.insert(output.end(), lowered.begin(), lowered.end());
+  }
+  test.AddInput<std::string>("T", {static_cast<int64_t>(input.size())}, input);
+  test.AddOutput<std::string>("Y", {static_cast<int64_t>(output.size())}, output);
+  test.Run(OpTester::ExpectResult::kExpectSuccess);
+}
+
 TEST(ContribOpTest, StringNormalizerSensitiveFilterOutUpperEmptyCase) {
   // Empty output case
   // - casesensitive approach
@@ -122,5 +122,33 @@ TEST(StringSplit, NoInputTest) {
   test.Run();
 }
 
+TEST(StringSplit, ManyStringsTest) {
+  // enough strings to be split in several blocks with a varying number of tokens
+  constexpr int64_t num_strings = 1000;
+  std::vector<std::string> input;
+  std::vector<std::string> splits;
+  std::vector<int64_t> num_tokens;
+  for (int64_t i = 0; i < num_strings; ++i) {
+    const int64_t count = i % 4;
+    std::string str;
+    for (int64_t t = 0; t < 3; ++t) {
+      if (t < count) {
+        splits.push_back("t" + std::to_string(i) + "_" + std::to_string(t));
+        str += (t == 0 ? "" : " ") + splits.back();
+      } else {
+        splits.emplace_back();
+      }
+    }
+    input.push_back(str);
+    num_tokens.push_back(count);
+  }
+
+  OpTester test("StringSplit", 20);
+  test.AddInput<std::string>("X", {num_strings}, input);
+  test.AddOutput<std::string>("Y", {num_strings, 3}, splits);
+  test.AddOutput<int64_t>("Z", {num_strings}, num_tokens);
+  test.Run();
+}
+
 }  // namespace test
 }  // namespace onnxruntime
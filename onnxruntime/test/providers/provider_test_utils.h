@@ -6,6 +6,7 @@
 #include "test/providers/checkers.h"
 #include "test/providers/op_tester.h"
 #include "test/providers/model_tester.h"
+#include "test/util/include/default_providers.h"
 
 namespace onnxruntime {
 namespace test {
@@ -39,5 +40,16 @@ inline std::vector<BFloat16> FloatsToBFloat16s(const std::vector<float>& input)
   std::transform(input.begin(), input.end(), std::back_inserter(output), [](float f) { return BFloat16(f); });
   return output;
 }
+
+// Runs the test on the CPU execution provider once for each intra-op thread pool size. A kernel that splits its work
+// with TryParallelFor runs serially on a single thread, so checking every run against the same expected outputs
+// compares the parallel path with the serial one. The inputs must be large enough for the cost model to split them.
+inline void RunWithIntraOpThreads(BaseTester& test, std::initializer_list<int> thread_pool_sizes = {1, 4}) {
+  for (int thread_pool_size : thread_pool_sizes) {
+    SessionOptions so;
+    so.intra_op_param.thread_pool_size = thread_pool_size;
+    test.Config(so).ConfigEp(DefaultCpuExecutionProvider()).RunWithConfig();
+  }
+}
 }  // namespace test
 }  // namespace onnxruntime
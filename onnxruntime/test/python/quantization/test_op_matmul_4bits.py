@@ -110,15 +110,102 @@ class TestOpMatMul4Bits(unittest.TestCase):
 
         onnx.save(model, output_model_path)
 
+    def construct_model_gemm(self, output_model_path: str, symmetric: bool) -> None:
+        #      (input)
+        #         |
+        #        Gemm (transB=1, with C)
+        #         |
+        #      (output)
+        in_features = 64
+        out_features = 48
+        weight_data = self.fill_int4_data([out_features, in_features], symmetric).astype(np.float32)
+        bias_data = np.linspace(-1.0, 1.0, out_features).astype(np.float32)
+        initializers = [
+            onnx.numpy_helper.from_array(weight_data, name="gemm.weight"),
+            onnx.numpy_helper.from_array(bias_data, name="gemm.bias"),
+        ]
+        gemm_node = onnx.helper.make_node(
+            "Gemm", ["input", "gemm.weight", "gemm.bias"], ["output"], "Gemm_0", beta=0.5, transB=1
+        )
+
+        input_tensor = helper.make_tensor_value_info("input", TensorProto.FLOAT, [-1, in_features])
+        output_tensor = helper.make_tensor_value_info("output", TensorProto.FLOAT, [-1, out_features])
+        graph = helper.make_graph(
+            [gemm_node], "gemm_4bits_test", [input_tensor], [output_tensor], initializer=initializers
+        )
+        model = helper.make_model(graph, opset_imports=[helper.make_opsetid("", 13)])
+        model.ir_version = 7  # use stable onnx ir version
+
+        onnx.save(model, output_model_path)
+
+    def construct_model_shared_weight(self, output_model_path: str, symmetric: bool) -> None:
+        #      (input)
+        #         |
+        #       MatMul (shared.weight)
+        #         |
+        #        Gemm (transB=1, shared.weight)
+        #         |
+        #      (output)
+        features = 32
+        weight_data = self.fill_int4_data([features, features], symmetric).astype(np.float32)
+        initializers = [onnx.numpy_helper.from_array(weight_data, name="shared.weight")]
+        matmul_node = onnx.helper.make_node("MatMul", ["input", "shared.weight"], ["hidden"], "MatMul_0")
+        gemm_node = onnx.helper.make_node("Gemm", ["hidden", "shared.weight"], ["output"], "Gemm_0", transB=1)
+
+        input_tensor = helper.make_tensor_value_info("input", TensorProto.FLOAT, [-1, features])
+        output_tensor = helper.make_tensor_value_info("output", TensorProto.FLOAT, [-1, features])
+        graph = helper.make_graph(
+            [matmul_node, gemm_node],
+            "shared_weight_4bits_test",
+            [input_tensor],
+            [output_tensor],
+            initializer=initializers,
+        )
+        model = helper.make_model(graph, opset_imports=[helper.make_opsetid("", 13)])
+        model.ir_version = 7  # use stable onnx ir version
+
+        onnx.save(model, output_model_path)
+
+    def construct_model_conv(self, output_model_path: str, symmetric: bool) -> None:
+        #      (input)
+        #         |
+        #        Conv
+        #         |
+        #      (output)
+        in_channels = 8
+        out_channels = 16
+        weight_data = self.fill_int4_data([out_channels, in_channels, 2, 2], symmetric).astype(np.float32)
+        bias_data = np.linspace(-1.0, 1.0, out_channels).astype(np.float32)
+        initializers = [
+            onnx.numpy_helper.from_array(weight_data, name="conv.weight"),
+            onnx.numpy_helper.from_array(bias_data, name="conv.bias"),
+        ]
+        conv_node = onnx.helper.make_node(
+            "Conv", ["input", "conv.weight", "conv.bias"], ["output"], "Conv_0", pads=[1, 0, 0, 1], strides=[1, 2]
+        )
+
+        input_tensor = helper.make_tensor_value_info("input", TensorProto.FLOAT, [1, in_channels, 10, 12])
+        output_tensor = helper.make_tensor_value_info("output", TensorProto.FLOAT, [1, out_channels, 10, 6])
+        graph = helper.make_graph(
+            [conv_node], "conv_4bits_test", [input_tensor], [output_tensor], initializer=initializers
+        )
+        model = helper.make_model(graph, opset_imports=[helper.make_opsetid("", 13)])
+        model.ir_version = 7  # use stable onnx ir version
+
+        onnx.save(model, output_model_path)
+
     def quant_test(
         self,
         model_fp32_path: str,
         data_reader: TestDataFeeds,
         block_size: int,
         is_symmetric: bool,
-    ):
+        op_types_to_quantize: Tuple[str, ...] = ("MatMul",),
+        quant_node_type: str = "MatMulNBits",
+        quant_node_count: int = 1,
+    ) -> str:
         model_int4_path = str(
-            Path(self._tmp_model_dir.name).joinpath(f"MatMulNBits_{block_size}_{is_symmetric}.onnx").absolute()
+            Path(self._tmp_model_dir.name).joinpath(f"{quant_node_type}_{block_size}_{is_symmetric}.onnx").absolute()
         )
 
         # Quantize fp32 model to int4 model
@@ -126,13 +213,13 @@ class TestOpMatMul4Bits(unittest.TestCase):
 
         model = quant_utils.load_model_with_shape_infer(Path(model_fp32_path))
         quant_config = matmul_4bits_quantizer.DefaultWeightOnlyQuantConfig(
-            block_size=block_size, is_symmetric=is_symmetric
+            block_size=block_size, is_symmetric=is_symmetric, op_types_to_quantize=op_types_to_quantize
         )
         quant = matmul_4bits_quantizer.MatMul4BitsQuantizer(model, algo_config=quant_config)
         quant.process()
         quant.model.save_model_to_file(model_int4_path, False)
 
-        quant_nodes = {"MatMulNBits": 1}
+        quant_nodes = {quant_node_type: quant_node_count}
         check_op_type_count(self, model_int4_path, **quant_nodes)
 
         data_reader.rewind()
@@ -146,6 +233,8 @@ class TestOpMatMul4Bits(unittest.TestCase):
             else:
                 raise exception
 
+        return model_int4_path
+
     def quant_test_with_algo(
         self,
         algorithm: str,
@@ -211,6 +300,45 @@ class TestOpMatMul4Bits(unittest.TestCase):
         data_reader = self.input_feeds(1, {"input": [100, 52]})
         self.quant_test(model_fp32_path, data_reader, 32, False)
 
+    @unittest.skipIf(
+        find_spec("onnxruntime.training"), "Skip because training package doesn't has quantize_matmul_4bits"
+    )
+    def test_quantize_gemm_int4(self):
+        for symmetric in (True, False):
+            model_fp32_path = str(Path(self._tmp_model_dir.name).joinpath(f"gemm_fp32_{symmetric}.onnx").absolute())
+            self.construct_model_gemm(model_fp32_path, symmetric=symmetric)
+            data_reader = self.input_feeds(1, {"input": [10, 64]})
+            self.quant_test(model_fp32_path, data_reader, 32, symmetric, ("Gemm",), "MatMulNBits")
+
+    @unittest.skipIf(
+        find_spec("onnxruntime.training"), "Skip because training package doesn't has quantize_matmul_4bits"
+    )
+    def test_quantize_shared_weight_int4(self):
+        # the MatMul uses the weight as is and the Gemm uses its transpose, so each needs its own quantized tensor
+        model_fp32_path = str(Path(self._tmp_model_dir.name).joinpath("shared_weight_fp32.onnx").absolute())
+        self.construct_model_shared_weight(model_fp32_path, symmetric=True)
+        data_reader = self.input_feeds(1, {"input": [10, 32]})
+        model_int4_path = self.quant_test(
+            model_fp32_path, data_reader, 32, True, ("MatMul", "Gemm"), "MatMulNBits", quant_node_count=2
+        )
+
+        model = onnx.load(model_int4_path)
+        initializer_names = [initializer.name for initializer in model.graph.initializer]
+        self.assertEqual(initializer_names.count("shared.weight_Q4"), 1)
+        self.assertEqual(initializer_names.count("shared.weight_T_Q4"), 1)
+        node_weights = {node.name: node.input[1] for node in model.graph.node if node.op_type == "MatMulNBits"}
+        self.assertEqual(node_weights, {"MatMul_0_Q4": "shared.weight_Q4", "Gemm_0_Q4": "shared.weight_T_Q4"})
+
+    @unittest.skipIf(
+        find_spec("onnxruntime.training"), "Skip because training package doesn't has quantize_matmul_4bits"
+    )
+    def test_quantize_conv_int4(self):
+        for symmetric in (True, False):
+            model_fp32_path = str(Path(self._tmp_model_dir.name).joinpath(f"conv_fp32_{symmetric}.onnx").absolute())
+            self.construct_model_conv(model_fp32_path, symmetric=symmetric)
+            data_reader = self.input_feeds(1, {"input": [1, 8, 10, 12]})
+            self.quant_test(model_fp32_path, data_reader, 32, symmetric, ("Conv",), "ConvNBits")
+
     @unittest.skipIf(
         find_spec("onnxruntime.training"), "Skip because training package doesn't has quantize_matmul_4bits"
     )